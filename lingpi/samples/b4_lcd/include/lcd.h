@@ -16,18 +16,38 @@
 #define _LCD_H_
 
 #include <stdint.h>
+#include <stdbool.h>
 
-/* 设置横屏或者竖屏显示 0或1为竖屏 2或3为横屏 */
+/* 上电后的显示方向 0或1为竖屏 2或3为横屏，运行时可以用lcd_set_rotation()修改 */
 #define USE_HORIZONTAL      0
 
-/* 根据LCD是横屏或者竖屏，设置LCD的宽度和高度 */
-#if ((USE_HORIZONTAL==0) || (USE_HORIZONTAL==1))
-#define LCD_W 240
-#define LCD_H 320
-#else
-#define LCD_W 320
-#define LCD_H 240
-#endif
+/* 屏幕控制器的物理分辨率（竖屏） */
+#define LCD_PANEL_W         240
+#define LCD_PANEL_H         320
+/* 各显示方向下宽度和高度的最大值，用于定义行缓冲区 */
+#define LCD_SIZE_MAX        320
+
+/* 当前显示方向下LCD的宽度和高度，随lcd_set_rotation()变化 */
+#define LCD_W               lcd_get_width()
+#define LCD_H               lcd_get_height()
+
+/* 显示方向 */
+typedef enum {
+    LCD_ROTATE_0 = 0,       /* 竖屏，即USE_HORIZONTAL为0 */
+    LCD_ROTATE_90,          /* 横屏，即USE_HORIZONTAL为2 */
+    LCD_ROTATE_180,         /* 竖屏旋转180度，即USE_HORIZONTAL为1 */
+    LCD_ROTATE_270,         /* 横屏旋转180度，即USE_HORIZONTAL为3 */
+} lcd_rotation_t;
+
+/* 总线方式，编译时由src/lcd.c中的LCD_ENABLE_SPI选择 */
+#define LCD_BUS_GPIO        0       /* 通过GPIO接口模拟SPI */
+#define LCD_BUS_SPI         1       /* 硬件SPI */
+#define LCD_BUS_GPIO_REG    2       /* 直接写GPIO寄存器模拟SPI */
+
+/* 镜像显示，可以组合使用 */
+#define LCD_MIRROR_NONE     0x00
+#define LCD_MIRROR_X        0x01    /* 左右镜像 */
+#define LCD_MIRROR_Y        0x02    /* 上下镜像 */
 
 /* 画笔颜色 */
 #define LCD_WHITE           0xFFFF
@@ -58,6 +78,25 @@
 #define LCD_FONT_SIZE24     24
 #define LCD_FONT_SIZE32     32
 
+/* 索引图片没有透明色 */
+#define LCD_INDEX_NO_KEY    0xFFFF
+/* 贴图没有透明色 */
+#define LCD_BLIT_NO_KEY     0xFFFFFFFFU
+
+/* 总线传输统计 */
+typedef struct {
+    uint32_t transactions;  /* 总线传输次数 */
+    uint32_t bytes;         /* 总线传输字节数 */
+    uint32_t commands;      /* 其中的命令字节数 */
+} lcd_bus_stats_t;
+
+/* 总线监听函数，每次总线传输后调用
+ * cmd为true时buf为1个命令字节，否则为命令的参数或像素数据 */
+typedef void (*lcd_bus_hook_t)(bool cmd, const uint8_t *buf, uint32_t len);
+
+/* lcd_flush_async()发送完成的回调函数 */
+typedef void (*lcd_flush_cb_t)(void *arg);
+
 /***************************************************************
  * 函数名称: lcd_init
  * 说    明: Lcd初始化
@@ -76,6 +115,45 @@ unsigned int lcd_init(void);
 unsigned int lcd_deinit(void);
 
 
+/***************************************************************
+ * 函数名称: lcd_set_rotation
+ * 说    明: 设置显示方向和镜像，只写一次屏幕控制器的MADCTL寄存器，
+ *           之后的绘制按新方向的坐标进行，屏幕上已有的内容不变
+ * 参    数:
+ *       @rotation：显示方向，见lcd_rotation_t
+ *       @mirror：镜像，LCD_MIRROR_X、LCD_MIRROR_Y的组合
+ * 返 回 值: 返回0为成功，反之为失败
+ ***************************************************************/
+unsigned int lcd_set_rotation(uint8_t rotation, uint8_t mirror);
+
+
+/***************************************************************
+ * 函数名称: lcd_get_rotation
+ * 说    明: 获取当前的显示方向
+ * 参    数: 无
+ * 返 回 值: 显示方向，见lcd_rotation_t
+ ***************************************************************/
+uint8_t lcd_get_rotation(void);
+
+
+/***************************************************************
+ * 函数名称: lcd_get_width
+ * 说    明: 获取当前显示方向下LCD的宽度
+ * 参    数: 无
+ * 返 回 值: 宽度（像素）
+ ***************************************************************/
+uint16_t lcd_get_width(void);
+
+
+/***************************************************************
+ * 函数名称: lcd_get_height
+ * 说    明: 获取当前显示方向下LCD的高度
+ * 参    数: 无
+ * 返 回 值: 高度（像素）
+ ***************************************************************/
+uint16_t lcd_get_height(void);
+
+
 /***************************************************************
  * 函数名称: lcd_fill
  * 说    明: 指定区域填充颜色
@@ -143,9 +221,67 @@ void lcd_draw_rectangle(uint16_t x1, uint16_t y1, uint16_t x2, uint16_t y2, uint
 void lcd_draw_circle(uint16_t x0, uint16_t y0, uint8_t r, uint16_t color);
 
 
+/***************************************************************
+ * 函数名称: lcd_fill_rectangle
+ * 说    明: 指定位置画实心矩形
+ * 参    数:
+ *       @x1：指定矩形的起始点X坐标
+ *       @y1：指定矩形的起始点Y坐标
+ *       @x2：指定矩形的结束点X坐标
+ *       @y2：指定矩形的结束点Y坐标
+ *       @color：指定矩形的颜色
+ * 返 回 值: 无
+ ***************************************************************/
+void lcd_fill_rectangle(uint16_t x1, uint16_t y1, uint16_t x2, uint16_t y2, uint16_t color);
+
+
+/***************************************************************
+ * 函数名称: lcd_fill_circle
+ * 说    明: 指定位置画实心圆
+ * 参    数:
+ *       @x0：指定圆的中心点X坐标
+ *       @y0：指定圆的中心点Y坐标
+ *       @r：指定圆的半径
+ *       @color：指定圆的颜色
+ * 返 回 值: 无
+ ***************************************************************/
+void lcd_fill_circle(uint16_t x0, uint16_t y0, uint8_t r, uint16_t color);
+
+
+/***************************************************************
+ * 函数名称: lcd_draw_round_rect
+ * 说    明: 指定位置画圆角矩形
+ * 参    数:
+ *       @x1：指定矩形的起始点X坐标
+ *       @y1：指定矩形的起始点Y坐标
+ *       @x2：指定矩形的结束点X坐标
+ *       @y2：指定矩形的结束点Y坐标
+ *       @r：指定圆角的半径
+ *       @color：指定矩形的颜色
+ * 返 回 值: 无
+ ***************************************************************/
+void lcd_draw_round_rect(uint16_t x1, uint16_t y1, uint16_t x2, uint16_t y2, uint8_t r, uint16_t color);
+
+
+/***************************************************************
+ * 函数名称: lcd_fill_round_rect
+ * 说    明: 指定位置画实心圆角矩形
+ * 参    数:
+ *       @x1：指定矩形的起始点X坐标
+ *       @y1：指定矩形的起始点Y坐标
+ *       @x2：指定矩形的结束点X坐标
+ *       @y2：指定矩形的结束点Y坐标
+ *       @r：指定圆角的半径
+ *       @color：指定矩形的颜色
+ * 返 回 值: 无
+ ***************************************************************/
+void lcd_fill_round_rect(uint16_t x1, uint16_t y1, uint16_t x2, uint16_t y2, uint8_t r, uint16_t color);
+
+
 /***************************************************************
  * 函数名称: lcd_show_chinese
- * 说    明: 显示汉字串
+ * 说    明: 显示汉字串，可以混合ASCII字符，ASCII字符占半个字宽。
+ *           边解码UTF-8边显示，字符串长度不受限制
  * 参    数:
  *       @x：指定汉字串的起始位置X坐标
  *       @y：指定汉字串的起始位置X坐标
@@ -159,6 +295,17 @@ void lcd_draw_circle(uint16_t x0, uint16_t y0, uint8_t r, uint16_t color);
 void lcd_show_chinese(uint16_t x, uint16_t y, uint8_t *s, uint16_t fc, uint16_t bc, uint8_t sizey, uint8_t mode);
 
 
+/***************************************************************
+ * 函数名称: lcd_utf8_next
+ * 说    明: 从UTF-8字符串中取出一个字符，并移动到下一个字符，
+ *           无法解码的字节返回替换字符0xFFFD
+ * 参    数:
+ *       @s：字符串指针的地址
+ * 返 回 值: 字符的Unicode码点，字符串结束时返回0
+ ***************************************************************/
+uint32_t lcd_utf8_next(const uint8_t **s);
+
+
 /***************************************************************
  * 函数名称: lcd_show_char
  * 说    明: 显示一个字符
@@ -235,4 +382,272 @@ void lcd_show_float_num1(uint16_t x, uint16_t y, float num, uint8_t len, uint16_
 void lcd_show_picture(uint16_t x, uint16_t y, uint16_t length, uint16_t width, const uint8_t *pic);
 
 
+/***************************************************************
+ * 函数名称: lcd_show_picture_rle
+ * 说    明: 显示行程编码（RLE）压缩的图片，边解码边写入像素流
+ * 参    数:
+ *       @x：指定图片的起始位置X坐标
+ *       @y：指定图片的起始位置Y坐标
+ *       @length：指定图片的长度
+ *       @width：指定图片的宽度
+ *       @data：压缩后的图片数据，由tools/lcd_image_tool.py生成
+ *       @size：压缩后的图片数据字节数
+ * 返 回 值: 无
+ ***************************************************************/
+void lcd_show_picture_rle(uint16_t x, uint16_t y, uint16_t length, uint16_t width, const uint8_t *data, uint32_t size);
+
+
+/***************************************************************
+ * 函数名称: lcd_show_indexed_picture
+ * 说    明: 显示调色板索引图片，像素通过调色板展开为RGB565后写入
+ * 参    数:
+ *       @x：指定图片的起始位置X坐标
+ *       @y：指定图片的起始位置Y坐标
+ *       @length：指定图片的长度
+ *       @width：指定图片的宽度
+ *       @data：图片的索引数据，由tools/lcd_image_tool.py生成
+ *       @bpp：每个像素的位数，可选：1、2、4、8
+ *       @palette：调色板（RGB565），至少有(1 << bpp)项
+ *       @key：透明色索引，LCD_INDEX_NO_KEY表示没有透明色
+ * 返 回 值: 无
+ ***************************************************************/
+void lcd_show_indexed_picture(uint16_t x, uint16_t y, uint16_t length, uint16_t width,
+                              const uint8_t *data, uint8_t bpp, const uint16_t *palette, uint16_t key);
+
+
+/***************************************************************
+ * 函数名称: lcd_blit
+ * 说    明: 把图片中的一个矩形区域显示到屏幕上，超出屏幕的部分被裁剪，
+ *           可以只显示精灵表（sprite sheet）中的一帧
+ * 参    数:
+ *       @x：显示位置X坐标，可以为负数
+ *       @y：显示位置Y坐标，可以为负数
+ *       @pic：图片的内容，RGB565高字节在前
+ *       @length：图片的长度，即每行的像素数
+ *       @sx：源矩形在图片中的X坐标
+ *       @sy：源矩形在图片中的Y坐标
+ *       @w：源矩形的宽度
+ *       @h：源矩形的高度
+ *       @key：透明色（RGB565），与之相同的像素保持屏幕原有内容，
+ *             LCD_BLIT_NO_KEY表示没有透明色
+ * 返 回 值: 无
+ ***************************************************************/
+void lcd_blit(int16_t x, int16_t y, const uint8_t *pic, uint16_t length,
+              uint16_t sx, uint16_t sy, uint16_t w, uint16_t h, uint32_t key);
+
+
+/***************************************************************
+ * 函数名称: lcd_stream_begin
+ * 说    明: 开始像素流写入，设置显示窗口
+ * 参    数:
+ *       @x1：窗口的起始点X坐标
+ *       @y1：窗口的起始点Y坐标
+ *       @x2：窗口的结束点X坐标
+ *       @y2：窗口的结束点Y坐标
+ * 返 回 值: 无
+ ***************************************************************/
+void lcd_stream_begin(uint16_t x1, uint16_t y1, uint16_t x2, uint16_t y2);
+
+
+/***************************************************************
+ * 函数名称: lcd_stream_push
+ * 说    明: 往像素流写入多个像素，像素先缓存，缓冲区满时整块发送
+ * 参    数:
+ *       @pixels：像素数组（RGB565）
+ *       @count：像素数目
+ * 返 回 值: 无
+ ***************************************************************/
+void lcd_stream_push(const uint16_t *pixels, uint32_t count);
+
+
+/***************************************************************
+ * 函数名称: lcd_stream_push_color
+ * 说    明: 往像素流写入多个相同颜色的像素
+ * 参    数:
+ *       @color：像素颜色
+ *       @count：像素数目
+ * 返 回 值: 无
+ ***************************************************************/
+void lcd_stream_push_color(uint16_t color, uint32_t count);
+
+
+/***************************************************************
+ * 函数名称: lcd_stream_push_raw
+ * 说    明: 往像素流写入原始字节数据（RGB565高字节在前）
+ * 参    数:
+ *       @data：原始字节数据
+ *       @len：字节数目
+ * 返 回 值: 无
+ ***************************************************************/
+void lcd_stream_push_raw(const uint8_t *data, uint32_t len);
+
+
+/***************************************************************
+ * 函数名称: lcd_stream_end
+ * 说    明: 结束像素流写入，发送缓冲区中剩余的像素
+ * 参    数: 无
+ * 返 回 值: 无
+ ***************************************************************/
+void lcd_stream_end(void);
+
+
+/***************************************************************
+ * 函数名称: lcd_get_bus_stats
+ * 说    明: 获取总线传输统计，用于评估每帧的总线传输次数和字节数
+ * 参    数:
+ *       @stats：总线传输统计
+ * 返 回 值: 无
+ ***************************************************************/
+void lcd_get_bus_stats(lcd_bus_stats_t *stats);
+
+
+/***************************************************************
+ * 函数名称: lcd_reset_bus_stats
+ * 说    明: 清零总线传输统计
+ * 参    数: 无
+ * 返 回 值: 无
+ ***************************************************************/
+void lcd_reset_bus_stats(void);
+
+
+/***************************************************************
+ * 函数名称: lcd_bus_time_us
+ * 说    明: 按指定的SPI时钟估算总线传输统计对应的传输时间，
+ *           用于比较不同绘制方式的总线开销
+ * 参    数:
+ *       @stats：总线传输统计
+ *       @clock：SPI时钟频率（Hz）
+ *       @overhead_ns：每次总线传输的固定开销（纳秒），如片选和驱动调用
+ * 返 回 值: 估算的传输时间（微秒）
+ ***************************************************************/
+uint32_t lcd_bus_time_us(const lcd_bus_stats_t *stats, uint32_t clock, uint32_t overhead_ns);
+
+
+/***************************************************************
+ * 函数名称: lcd_set_bus_hook
+ * 说    明: 设置总线监听函数，用于捕获发送到屏幕的命令和数据，
+ *           例如在主机上解码命令流、重建屏幕内容做回归比较
+ * 参    数:
+ *       @hook：总线监听函数，NULL表示取消监听
+ * 返 回 值: 无
+ ***************************************************************/
+void lcd_set_bus_hook(lcd_bus_hook_t hook);
+
+
+/***************************************************************
+ * 函数名称: lcd_set_bus
+ * 说    明: 切换总线方式。用模拟SPI方式（LCD_ENABLE_SPI为0或2）编译时
+ *           可以在LCD_BUS_GPIO和LCD_BUS_GPIO_REG之间切换，用于对比
+ *           两种方式的速度；硬件SPI方式编译时只能为LCD_BUS_SPI
+ * 参    数:
+ *       @bus：总线方式，LCD_BUS_GPIO、LCD_BUS_SPI或LCD_BUS_GPIO_REG
+ * 返 回 值: 返回0为成功，反之为当前编译方式不支持
+ ***************************************************************/
+unsigned int lcd_set_bus(uint8_t bus);
+
+
+/***************************************************************
+ * 函数名称: lcd_get_bus
+ * 说    明: 取得当前的总线方式
+ * 参    数: 无
+ * 返 回 值: LCD_BUS_GPIO、LCD_BUS_SPI或LCD_BUS_GPIO_REG
+ ***************************************************************/
+uint8_t lcd_get_bus(void);
+
+
+/***************************************************************
+ * 函数名称: lcd_bus_benchmark
+ * 说    明: 测量当前总线方式的传输速度，以全屏填充的方式发送数据，
+ *           会覆盖屏幕内容
+ * 参    数:
+ *       @frames：全屏填充的次数
+ * 返 回 值: 每秒传输的字节数，测量时间过短时返回0
+ ***************************************************************/
+uint32_t lcd_bus_benchmark(uint16_t frames);
+
+
+/***************************************************************
+ * 函数名称: lcd_framebuffer_enable
+ * 说    明: 启用离屏渲染，之后的绘制操作只写入离屏缓冲区并记录脏矩形，
+ *           调用lcd_flush()时才把有变化的区域发送到屏幕。
+ *           缓冲区可以覆盖整个屏幕，也可以只覆盖一个水平条带，
+ *           超出覆盖范围的绘制被丢弃；与缓冲区原有内容相同的像素不会
+ *           产生脏矩形。每个缓冲区（最多2个）各自记录脏矩形：首次启用
+ *           或覆盖区域改变后的首次刷新发送整个缓冲区，双缓冲交替启用时
+ *           只发送未刷新的区域和与另一个缓冲区刷新内容不同的区域
+ * 参    数:
+ *       @buf：离屏缓冲区，大小至少为width * height个像素
+ *       @x：缓冲区覆盖区域的起始点X坐标
+ *       @y：缓冲区覆盖区域的起始点Y坐标
+ *       @width：缓冲区覆盖区域的宽度
+ *       @height：缓冲区覆盖区域的高度
+ * 返 回 值: 无
+ ***************************************************************/
+void lcd_framebuffer_enable(uint16_t *buf, uint16_t x, uint16_t y, uint16_t width, uint16_t height);
+
+
+/***************************************************************
+ * 函数名称: lcd_framebuffer_disable
+ * 说    明: 关闭离屏渲染，恢复直接写屏，未刷新的区域被丢弃，
+ *           各缓冲区的记录被清除，再次启用时发送整个缓冲区
+ * 参    数: 无
+ * 返 回 值: 无
+ ***************************************************************/
+void lcd_framebuffer_disable(void);
+
+
+/***************************************************************
+ * 函数名称: lcd_flush
+ * 说    明: 把离屏缓冲区中合并后的脏矩形区域发送到屏幕，每个脏矩形
+ *           只设置一次显示窗口
+ * 参    数: 无
+ * 返 回 值: 无
+ ***************************************************************/
+void lcd_flush(void);
+
+
+/***************************************************************
+ * 函数名称: lcd_flush_async
+ * 说    明: 把离屏缓冲区中有变化的区域交给后台刷新任务发送，立即返回。
+ *           发送完成前不能修改该缓冲区，可以调用lcd_framebuffer_enable()
+ *           切换到另一个缓冲区继续渲染。未启用异步刷新或后台刷新任务
+ *           创建失败时同步发送
+ * 参    数:
+ *       @cb：发送完成后的回调函数，在后台刷新任务中调用，可以为NULL
+ *       @arg：回调函数的参数
+ * 返 回 值: 无
+ ***************************************************************/
+void lcd_flush_async(lcd_flush_cb_t cb, void *arg);
+
+
+/***************************************************************
+ * 函数名称: lcd_flush_wait
+ * 说    明: 等待后台刷新任务发送完成
+ * 参    数: 无
+ * 返 回 值: 无
+ ***************************************************************/
+void lcd_flush_wait(void);
+
+
+/***************************************************************
+ * 函数名称: lcd_set_scroll_area
+ * 说    明: 设置垂直滚动区域，顶部和底部的固定区域不滚动，只适用于竖屏显示
+ * 参    数:
+ *       @top：顶部固定区域的行数
+ *       @height：滚动区域的行数
+ * 返 回 值: 无
+ ***************************************************************/
+void lcd_set_scroll_area(uint16_t top, uint16_t height);
+
+
+/***************************************************************
+ * 函数名称: lcd_set_scroll_start
+ * 说    明: 设置垂直滚动起始地址，即显示在滚动区域第一行的显存行
+ * 参    数:
+ *       @line：显存行号，范围为滚动区域内的行
+ * 返 回 值: 无
+ ***************************************************************/
+void lcd_set_scroll_start(uint16_t line);
+
+
 #endif /* _LCD_H_ */
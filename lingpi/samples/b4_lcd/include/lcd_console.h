@@ -0,0 +1,93 @@
+/*
+ * Copyright (c) 2022 FuZhou Lockzhiner Electronic Co., Ltd. All rights reserved.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef _LCD_CONSOLE_H_
+#define _LCD_CONSOLE_H_
+
+#include <stdint.h>
+
+/* 控制台历史记录的行数 */
+#define LCD_CONSOLE_HISTORY     64
+/* 控制台每行最多的字符数 */
+#define LCD_CONSOLE_COLS_MAX    40
+/* lcd_console_printf一次最多输出的字符数 */
+#define LCD_CONSOLE_PRINTF_MAX  128
+
+/***************************************************************
+ * 函数名称: lcd_console_init
+ * 说    明: 初始化滚动控制台，清空控制台区域并设置硬件垂直滚动区域。
+ *           控制台使用期间，控制台区域不能再用其他绘图函数显示，
+ *           只支持竖屏显示（LCD_ROTATE_0）
+ * 参    数:
+ *       @y：控制台区域的起始Y坐标
+ *       @height：控制台区域的高度，按字号取整为整数行
+ *       @fc：字的颜色
+ *       @bc：背景色
+ *       @sizey：字号，可选：12、16、24、32
+ * 返 回 值: 返回0为成功，反之为失败
+ ***************************************************************/
+unsigned int lcd_console_init(uint16_t y, uint16_t height, uint16_t fc, uint16_t bc, uint8_t sizey);
+
+
+/***************************************************************
+ * 函数名称: lcd_console_deinit
+ * 说    明: 关闭滚动控制台，恢复屏幕的滚动设置
+ * 参    数: 无
+ * 返 回 值: 无
+ ***************************************************************/
+void lcd_console_deinit(void);
+
+
+/***************************************************************
+ * 函数名称: lcd_console_write
+ * 说    明: 往控制台写入文本，只写入内存中的历史记录，不操作屏幕，
+ *           遇到'\n'或写满一行时换行，写满一行后紧接着的'\n'不再换行
+ * 参    数:
+ *       @str：文本
+ *       @len：文本的字节数
+ * 返 回 值: 无
+ ***************************************************************/
+void lcd_console_write(const char *str, uint32_t len);
+
+
+/***************************************************************
+ * 函数名称: lcd_console_printf
+ * 说    明: 格式化输出到控制台，只写入内存中的历史记录，不操作屏幕
+ * 参    数:
+ *       @fmt：格式字符串
+ * 返 回 值: 无
+ ***************************************************************/
+void lcd_console_printf(const char *fmt, ...);
+
+
+/***************************************************************
+ * 函数名称: lcd_console_flush
+ * 说    明: 把新增的行显示到屏幕。每行只重画这一行并修改一次滚动
+ *           起始地址；新增行数超过一屏时只显示最后一屏
+ * 参    数: 无
+ * 返 回 值: 本次显示的行数
+ ***************************************************************/
+uint32_t lcd_console_flush(void);
+
+
+/***************************************************************
+ * 函数名称: lcd_console_view
+ * 说    明: 查看历史记录，重画整个控制台区域
+ * 参    数:
+ *       @back：往回翻的行数，0表示回到最新的内容并继续跟随输出
+ * 返 回 值: 无
+ ***************************************************************/
+void lcd_console_view(uint16_t back);
+
+#endif
@@ -15,23 +15,8 @@
 #ifndef _LCD_FONT_H_
 #define _LCD_FONT_H_
 
-/* utf8格式汉字转化为ascii格式 */
-static inline uint32_t chinese_utf8_to_ascii(uint8_t *src, uint32_t src_len, uint8_t *dst, uint32_t *dst_len)
-{
-#define UTF8_TO_ASCII_BYTES         3
-#define UTF8_OFFSET                 2
-    uint32_t i;
-    uint32_t offset = 0;
-    
-    for (i = 0; i < src_len; i += UTF8_TO_ASCII_BYTES) {
-        dst[offset] = src[i];
-        dst[offset + 1] = src[i + 1];
-        offset += UTF8_OFFSET;
-    }
-    
-    *dst_len = offset;
-    return offset;
-}
+/* 汉字编码的字节数：UTF-8编码的汉字占3个字节，加上字符串结束符 */
+#define HZ_INDEX_BYTES              4
 
 /* 12*6的ASCII码显示 */
 const unsigned char ascii_1206[][12] = {
@@ -1480,7 +1465,7 @@ const unsigned char ascii_3216[][64] = {
 
 /* 定义中文字符 12*12 */
 typedef struct {
-    unsigned char Index[2];
+    unsigned char Index[HZ_INDEX_BYTES];
     unsigned char Msk[24];
 } typFNT_GB12;
 
@@ -1498,7 +1483,7 @@ const typFNT_GB12 tfont12[] = {
 
 /* 定义中文字符 16*16  */
 typedef struct {
-    unsigned char Index[2];
+    unsigned char Index[HZ_INDEX_BYTES];
     unsigned char Msk[32];
 } typFNT_GB16;
 
@@ -1517,25 +1502,25 @@ const typFNT_GB16 tfont16[] = {
 
 /* 定义中文字符 24*24 */
 typedef struct {
-    unsigned char Index[2];
+    unsigned char Index[HZ_INDEX_BYTES];
     unsigned char Msk[72];
 } typFNT_GB24;
 
 const typFNT_GB24 tfont24[] = {
 
-    "", 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x18, 0x00, 0x00, 0x10, 0x00, 0x00,
+    "小", 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x18, 0x00, 0x00, 0x10, 0x00, 0x00,
     0x10, 0x00, 0x00, 0x10, 0x00, 0x00, 0x10, 0x00, 0x80, 0x90, 0x00, 0x80, 0x11, 0x01, 0xC0, 0x10,
     0x02, 0x40, 0x10, 0x04, 0x60, 0x10, 0x1C, 0x30, 0x10, 0x18, 0x10, 0x10, 0x30, 0x08, 0x10, 0x30,
     0x04, 0x10, 0x20, 0x00, 0x10, 0x00, 0x00, 0x10, 0x00, 0x00, 0x10, 0x00, 0x00, 0x19, 0x00, 0x00,
     0x1E, 0x00, 0x00, 0x0C, 0x00, 0x00, 0x00, 0x00, /* "小",0 */
     
-    "", 0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x40, 0x00, 0x04, 0x40, 0x00, 0x08, 0xFE, 0x0F, 0x98,
+    "凌", 0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x40, 0x00, 0x04, 0x40, 0x00, 0x08, 0xFE, 0x0F, 0x98,
     0x40, 0x00, 0x50, 0x40, 0x00, 0x40, 0x40, 0x10, 0xC0, 0xFF, 0x3F, 0x20, 0x08, 0x01, 0x20, 0x0C,
     0x0E, 0x20, 0x12, 0x38, 0x10, 0x19, 0x30, 0x90, 0xF8, 0x03, 0x1A, 0x0C, 0x02, 0x1C, 0x16, 0x01,
     0x08, 0x92, 0x01, 0x88, 0xA1, 0x00, 0x48, 0x40, 0x00, 0x0C, 0xB0, 0x00, 0x08, 0x18, 0x07, 0x00,
     0x07, 0x7E, 0xE0, 0x00, 0x10, 0x00, 0x00, 0x00, /* "凌",1 */
     
-    "", 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x08, 0x20, 0x00, 0x1F, 0x60, 0xFC, 0x00, 0x00,
+    "派", 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x08, 0x20, 0x00, 0x1F, 0x60, 0xFC, 0x00, 0x00,
     0x04, 0x00, 0x00, 0x04, 0x18, 0x82, 0x04, 0x0F, 0x84, 0xE4, 0x00, 0x48, 0xA4, 0x00, 0x48, 0x24,
     0x31, 0x40, 0x24, 0x19, 0x20, 0x24, 0x07, 0x20, 0x26, 0x01, 0x20, 0x26, 0x01, 0x10, 0x22, 0x02,
     0x1C, 0x22, 0x02, 0x10, 0x22, 0x04, 0x18, 0x21, 0x0C, 0x18, 0x21, 0x19, 0x98, 0xE0, 0x78, 0x50,
@@ -1545,7 +1530,7 @@ const typFNT_GB24 tfont24[] = {
 
 /* 定义中文字符 32*32 */
 typedef struct {
-    unsigned char Index[2];
+    unsigned char Index[HZ_INDEX_BYTES];
     unsigned char Msk[128];
 } typFNT_GB32;
 
@@ -0,0 +1,54 @@
+/*
+ * Copyright (c) 2022 FuZhou Lockzhiner Electronic Co., Ltd. All rights reserved.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef _LCD_FONT_INDEX_H_
+#define _LCD_FONT_INDEX_H_
+
+/* 由tools/lcd_font_tool.py --hz-index根据lcd_font.h生成，修改汉字表后需要重新生成 */
+
+/* 汉字的Unicode码点和在汉字表中的下标 */
+typedef struct {
+    unsigned short code;
+    unsigned short index;
+} typFNT_GB_INDEX;
+
+/* tfont12按码点升序排列 */
+const typFNT_GB_INDEX tfont12_index[] = {
+    {0x51CC, 1}, /* "凌" */
+    {0x5C0F, 0}, /* "小" */
+    {0x6D3E, 2}, /* "派" */
+};
+
+/* tfont16按码点升序排列 */
+const typFNT_GB_INDEX tfont16_index[] = {
+    {0x51CC, 1}, /* "凌" */
+    {0x5C0F, 0}, /* "小" */
+    {0x6D3E, 2}, /* "派" */
+};
+
+/* tfont24按码点升序排列 */
+const typFNT_GB_INDEX tfont24_index[] = {
+    {0x51CC, 1}, /* "凌" */
+    {0x5C0F, 0}, /* "小" */
+    {0x6D3E, 2}, /* "派" */
+};
+
+/* tfont32按码点升序排列 */
+const typFNT_GB_INDEX tfont32_index[] = {
+    {0x51CC, 1}, /* "凌" */
+    {0x5C0F, 0}, /* "小" */
+    {0x6D3E, 2}, /* "派" */
+};
+
+#endif
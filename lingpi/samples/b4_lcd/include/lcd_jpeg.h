@@ -0,0 +1,88 @@
+/*
+ * Copyright (c) 2022 FuZhou Lockzhiner Electronic Co., Ltd. All rights reserved.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef _LCD_JPEG_H_
+#define _LCD_JPEG_H_
+
+#include <stdint.h>
+
+/* 输入缓冲区大小（字节），流式解码时每次最多读取这么多数据 */
+#define LCD_JPEG_INPUT_SIZE     512
+/* 输出缓冲区大小（字节），一行中相邻的MCU攒满后作为一个显示窗口发送 */
+#define LCD_JPEG_OUTPUT_SIZE    1024
+
+/* 缩小比例 */
+typedef enum {
+    LCD_JPEG_SCALE_1 = 0,       /* 原始大小 */
+    LCD_JPEG_SCALE_1_2,         /* 1/2 */
+    LCD_JPEG_SCALE_1_4,         /* 1/4 */
+    LCD_JPEG_SCALE_1_8,         /* 1/8，只使用直流系数，不做IDCT */
+} lcd_jpeg_scale_t;
+
+/* 读取数据的回调函数，最多读取len字节到buf，返回实际读取的字节数，0表示数据结束 */
+typedef uint32_t (*lcd_jpeg_read_t)(void *arg, uint8_t *buf, uint32_t len);
+
+/***************************************************************
+ * 函数名称: lcd_show_jpeg
+ * 说    明: 解码内存中的JPEG图片并显示。支持基线（baseline）JPEG，
+ *           灰度或YCbCr 4:4:4、4:2:2、4:2:0采样，支持重启间隔。
+ *           按MCU逐行解码，超出屏幕的部分不显示
+ * 参    数:
+ *       @x：图片左上角的X坐标
+ *       @y：图片左上角的Y坐标
+ *       @data：JPEG数据
+ *       @size：JPEG数据的字节数
+ *       @scale：缩小比例，见lcd_jpeg_scale_t
+ * 返 回 值: 返回0为成功，反之为失败
+ ***************************************************************/
+unsigned int lcd_show_jpeg(uint16_t x, uint16_t y, const uint8_t *data, uint32_t size, uint8_t scale);
+
+
+/***************************************************************
+ * 函数名称: lcd_show_jpeg_stream
+ * 说    明: 边读取边解码JPEG图片并显示，图片数据不需要全部保存在内存中，
+ *           可以直接从网络或文件读取
+ * 参    数:
+ *       @x：图片左上角的X坐标
+ *       @y：图片左上角的Y坐标
+ *       @read：读取数据的回调函数
+ *       @arg：传给回调函数的参数
+ *       @scale：缩小比例，见lcd_jpeg_scale_t
+ * 返 回 值: 返回0为成功，反之为失败
+ ***************************************************************/
+unsigned int lcd_show_jpeg_stream(uint16_t x, uint16_t y, lcd_jpeg_read_t read, void *arg, uint8_t scale);
+
+
+/***************************************************************
+ * 函数名称: lcd_jpeg_get_size
+ * 说    明: 读取内存中JPEG图片的宽度和高度，不解码图像数据
+ * 参    数:
+ *       @data：JPEG数据
+ *       @size：JPEG数据的字节数
+ *       @width：返回图片的宽度
+ *       @height：返回图片的高度
+ * 返 回 值: 返回0为成功，反之为失败
+ ***************************************************************/
+unsigned int lcd_jpeg_get_size(const uint8_t *data, uint32_t size, uint16_t *width, uint16_t *height);
+
+
+/***************************************************************
+ * 函数名称: lcd_jpeg_ram_size
+ * 说    明: 获取解码器占用的内存大小，与图片大小无关
+ * 参    数: 无
+ * 返 回 值: 解码器状态和缓冲区的字节数
+ ***************************************************************/
+uint32_t lcd_jpeg_ram_size(void);
+
+#endif
@@ -0,0 +1,102 @@
+/*
+ * Copyright (c) 2022 FuZhou Lockzhiner Electronic Co., Ltd. All rights reserved.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef _LCD_SCENE_H_
+#define _LCD_SCENE_H_
+
+#include <stddef.h>
+#include <stdint.h>
+#include "lcd.h"
+
+/* 每个条带的行数（竖屏），横屏时按宽度比例减少以使用同样的内存 */
+#define LCD_SCENE_BAND_LINES    16
+/* 条带缓冲区数目，2为双缓冲，需要启用异步刷新（LCD_ENABLE_ASYNC）才有效果 */
+#define LCD_SCENE_BAND_BUFS     2
+
+/* 绘制命令的类型 */
+typedef enum {
+    LCD_SCENE_FILL = 0,         /* 填充矩形，(x1, y1)-(x2, y2)，包含结束点 */
+    LCD_SCENE_LINE,             /* 直线，(x1, y1)-(x2, y2) */
+    LCD_SCENE_RECT,             /* 矩形边框，(x1, y1)-(x2, y2) */
+    LCD_SCENE_CIRCLE,           /* 圆，圆心(x1, y1)，半径x2 */
+    LCD_SCENE_FILL_CIRCLE,      /* 实心圆，圆心(x1, y1)，半径x2 */
+    LCD_SCENE_STRING,           /* 字符串，起点(x1, y1)，data为字符串 */
+    LCD_SCENE_CHINESE,          /* 中文字符串，起点(x1, y1)，data为字符串 */
+    LCD_SCENE_PICTURE,          /* 图片，起点(x1, y1)，长x2，宽y2，data为RGB565数据 */
+    LCD_SCENE_PICTURE_RLE,      /* RLE图片，起点(x1, y1)，长x2，宽y2，data/size为压缩数据 */
+    LCD_SCENE_INDEXED,          /* 索引图片，起点(x1, y1)，长x2，宽y2，data为索引数据 */
+} lcd_scene_type_t;
+
+/* 绘制命令，按数组中的顺序绘制，后面的命令覆盖前面的命令 */
+typedef struct {
+    uint8_t type;               /* 命令类型，见lcd_scene_type_t */
+    uint8_t sizey;              /* 字号；索引图片为每个像素的位数 */
+    uint8_t mode;               /* 文字的叠加模式 */
+    uint16_t x1;
+    uint16_t y1;
+    uint16_t x2;
+    uint16_t y2;
+    uint16_t fc;                /* 颜色；文字的颜色；索引图片的透明色索引 */
+    uint16_t bc;                /* 文字的背景色 */
+    const void *data;           /* 字符串、图片数据 */
+    uint32_t size;              /* RLE图片的数据字节数 */
+    const uint16_t *palette;    /* 索引图片的调色板 */
+} lcd_scene_cmd_t;
+
+/* 绘制命令的初始化宏，用于定义常量场景 */
+#define LCD_SCENE_CMD_FILL(x1, y1, x2, y2, color) \
+    { LCD_SCENE_FILL, 0, 0, (x1), (y1), (x2), (y2), (color), 0, NULL, 0, NULL }
+#define LCD_SCENE_CMD_LINE(x1, y1, x2, y2, color) \
+    { LCD_SCENE_LINE, 0, 0, (x1), (y1), (x2), (y2), (color), 0, NULL, 0, NULL }
+#define LCD_SCENE_CMD_RECT(x1, y1, x2, y2, color) \
+    { LCD_SCENE_RECT, 0, 0, (x1), (y1), (x2), (y2), (color), 0, NULL, 0, NULL }
+#define LCD_SCENE_CMD_CIRCLE(x0, y0, r, color) \
+    { LCD_SCENE_CIRCLE, 0, 0, (x0), (y0), (r), 0, (color), 0, NULL, 0, NULL }
+#define LCD_SCENE_CMD_FILL_CIRCLE(x0, y0, r, color) \
+    { LCD_SCENE_FILL_CIRCLE, 0, 0, (x0), (y0), (r), 0, (color), 0, NULL, 0, NULL }
+#define LCD_SCENE_CMD_STRING(x, y, str, fc, bc, sizey, mode) \
+    { LCD_SCENE_STRING, (sizey), (mode), (x), (y), 0, 0, (fc), (bc), (str), 0, NULL }
+#define LCD_SCENE_CMD_CHINESE(x, y, str, fc, bc, sizey, mode) \
+    { LCD_SCENE_CHINESE, (sizey), (mode), (x), (y), 0, 0, (fc), (bc), (str), 0, NULL }
+#define LCD_SCENE_CMD_PICTURE(x, y, length, width, pic) \
+    { LCD_SCENE_PICTURE, 0, 0, (x), (y), (length), (width), 0, 0, (pic), 0, NULL }
+#define LCD_SCENE_CMD_PICTURE_RLE(x, y, length, width, data, size) \
+    { LCD_SCENE_PICTURE_RLE, 0, 0, (x), (y), (length), (width), 0, 0, (data), (size), NULL }
+#define LCD_SCENE_CMD_INDEXED(x, y, length, width, data, bpp, palette, key) \
+    { LCD_SCENE_INDEXED, (bpp), 0, (x), (y), (length), (width), (key), 0, (data), 0, (palette) }
+
+/***************************************************************
+ * 函数名称: lcd_scene_render
+ * 说    明: 按条带渲染整个屏幕。每个条带先填充背景色，再依次执行与该条带
+ *           相交的绘制命令，最后用一个显示窗口发送整个条带，重叠的图形
+ *           按命令顺序正确覆盖，只需要LCD_SCENE_BAND_BUFS个条带的内存。
+ *           渲染期间使用离屏渲染，结束后恢复直接写屏
+ * 参    数:
+ *       @cmds：绘制命令数组
+ *       @num：绘制命令数目
+ *       @bc：背景色
+ * 返 回 值: 无
+ ***************************************************************/
+void lcd_scene_render(const lcd_scene_cmd_t *cmds, uint32_t num, uint16_t bc);
+
+
+/***************************************************************
+ * 函数名称: lcd_scene_ram_size
+ * 说    明: 获取条带缓冲区占用的内存大小
+ * 参    数: 无
+ * 返 回 值: 条带缓冲区的字节数
+ ***************************************************************/
+uint32_t lcd_scene_ram_size(void);
+
+#endif
@@ -0,0 +1,144 @@
+/*
+ * Copyright (c) 2022 FuZhou Lockzhiner Electronic Co., Ltd. All rights reserved.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef _LCD_SPRITE_H_
+#define _LCD_SPRITE_H_
+
+#include <stdint.h>
+#include <stdbool.h>
+
+/* 读取背景的回调函数，把屏幕上(x, y)开始的len个背景像素写入pixels。
+ * 屏幕只能写不能读，精灵下方的背景由该函数提供 */
+typedef void (*lcd_sprite_bg_t)(void *arg, uint16_t x, uint16_t y, uint16_t len, uint16_t *pixels);
+
+/* 图片背景，图片以外的区域为纯色 */
+typedef struct {
+    uint16_t x;                             /* 图片的起始位置X坐标 */
+    uint16_t y;                             /* 图片的起始位置Y坐标 */
+    uint16_t length;                        /* 图片的长度 */
+    uint16_t width;                         /* 图片的宽度 */
+    const uint8_t *pic;                     /* 图片的内容，RGB565高字节在前 */
+    uint16_t bc;                            /* 图片以外区域的颜色 */
+} lcd_sprite_picture_t;
+
+/* 精灵，可以在背景上移动的图片 */
+typedef struct {
+    const uint8_t *pic;                     /* 图片的内容，RGB565高字节在前 */
+    uint16_t length;                        /* 图片的长度，即每行的像素数 */
+    uint16_t sx;                            /* 当前帧在图片中的X坐标 */
+    uint16_t sy;                            /* 当前帧在图片中的Y坐标 */
+    uint16_t width;                         /* 精灵的宽度 */
+    uint16_t height;                        /* 精灵的高度 */
+    uint32_t key;                           /* 透明色，LCD_BLIT_NO_KEY表示没有透明色 */
+    uint16_t *save;                         /* 保存精灵下方背景的缓冲区，可以为NULL */
+    lcd_sprite_bg_t bg;                     /* 读取背景的回调函数 */
+    void *arg;                              /* 传给回调函数的参数 */
+    int16_t x;                              /* 当前位置X坐标 */
+    int16_t y;                              /* 当前位置Y坐标 */
+    bool shown;                             /* 屏幕上是否已有显示内容 */
+} lcd_sprite_t;
+
+/***************************************************************
+ * 函数名称: lcd_sprite_init
+ * 说    明: 初始化精灵，不立即显示。默认背景为黑色
+ * 参    数:
+ *       @sprite：精灵
+ *       @pic：图片的内容，RGB565高字节在前
+ *       @length：图片的长度，图片为精灵表时是整张表的长度
+ *       @width：精灵的宽度
+ *       @height：精灵的高度
+ *       @key：透明色（RGB565），LCD_BLIT_NO_KEY表示没有透明色
+ * 返 回 值: 无
+ ***************************************************************/
+void lcd_sprite_init(lcd_sprite_t *sprite, const uint8_t *pic, uint16_t length, uint16_t width, uint16_t height, uint32_t key);
+
+
+/***************************************************************
+ * 函数名称: lcd_sprite_set_background
+ * 说    明: 设置精灵的背景，应在显示精灵之前设置
+ * 参    数:
+ *       @sprite：精灵
+ *       @save：保存精灵下方背景的缓冲区，width * height个像素；
+ *              为NULL时每次都通过回调函数读取背景
+ *       @bg：读取背景的回调函数，如lcd_sprite_bg_color、lcd_sprite_bg_picture
+ *       @arg：传给回调函数的参数
+ * 返 回 值: 无
+ ***************************************************************/
+void lcd_sprite_set_background(lcd_sprite_t *sprite, uint16_t *save, lcd_sprite_bg_t bg, void *arg);
+
+
+/***************************************************************
+ * 函数名称: lcd_sprite_move
+ * 说    明: 把精灵移动到新的位置，尚未显示时直接显示。新旧位置重叠或相邻时，
+ *           只把两者的并集作为一个窗口发送一次，不重叠时分别发送，
+ *           超出屏幕的部分被裁剪
+ * 参    数:
+ *       @sprite：精灵
+ *       @x：新位置X坐标，可以为负数
+ *       @y：新位置Y坐标，可以为负数
+ * 返 回 值: 无
+ ***************************************************************/
+void lcd_sprite_move(lcd_sprite_t *sprite, int16_t x, int16_t y);
+
+
+/***************************************************************
+ * 函数名称: lcd_sprite_set_frame
+ * 说    明: 切换精灵表中的帧，已显示时在原位置重画
+ * 参    数:
+ *       @sprite：精灵
+ *       @sx：帧在图片中的X坐标
+ *       @sy：帧在图片中的Y坐标
+ * 返 回 值: 无
+ ***************************************************************/
+void lcd_sprite_set_frame(lcd_sprite_t *sprite, uint16_t sx, uint16_t sy);
+
+
+/***************************************************************
+ * 函数名称: lcd_sprite_hide
+ * 说    明: 隐藏精灵，恢复精灵下方的背景
+ * 参    数:
+ *       @sprite：精灵
+ * 返 回 值: 无
+ ***************************************************************/
+void lcd_sprite_hide(lcd_sprite_t *sprite);
+
+
+/***************************************************************
+ * 函数名称: lcd_sprite_bg_color
+ * 说    明: 纯色背景的回调函数
+ * 参    数:
+ *       @arg：背景色，用(void *)(uintptr_t)color传入
+ *       @x：起始位置X坐标
+ *       @y：起始位置Y坐标
+ *       @len：像素数目
+ *       @pixels：背景像素
+ * 返 回 值: 无
+ ***************************************************************/
+void lcd_sprite_bg_color(void *arg, uint16_t x, uint16_t y, uint16_t len, uint16_t *pixels);
+
+
+/***************************************************************
+ * 函数名称: lcd_sprite_bg_picture
+ * 说    明: 图片背景的回调函数
+ * 参    数:
+ *       @arg：图片背景，lcd_sprite_picture_t *
+ *       @x：起始位置X坐标
+ *       @y：起始位置Y坐标
+ *       @len：像素数目
+ *       @pixels：背景像素
+ * 返 回 值: 无
+ ***************************************************************/
+void lcd_sprite_bg_picture(void *arg, uint16_t x, uint16_t y, uint16_t len, uint16_t *pixels);
+
+#endif
@@ -0,0 +1,70 @@
+/*
+ * Copyright (c) 2022 FuZhou Lockzhiner Electronic Co., Ltd. All rights reserved.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef _LCD_TEXT_H_
+#define _LCD_TEXT_H_
+
+#include <stdint.h>
+
+/* 字形描述，字形点阵为字符格中有笔画的最小矩形 */
+typedef struct {
+    uint32_t offset;        /* 点阵在字体位流中的位偏移 */
+    uint16_t code;          /* Unicode码点 */
+    uint8_t width;          /* 点阵的宽度 */
+    uint8_t height;         /* 点阵的高度 */
+    uint8_t x;              /* 点阵在字符格中的X偏移 */
+    uint8_t y;              /* 点阵在字符格中的Y偏移 */
+    uint8_t advance;        /* 字符格的宽度 */
+} lcd_glyph_t;
+
+/* 字体，由tools/lcd_font_tool.py生成 */
+typedef struct {
+    uint8_t height;                 /* 行高，即字符格的高度 */
+    uint8_t ascent;                 /* 基线到字符格顶部的距离 */
+    uint8_t bpp;                    /* 每个像素的位数：1为单色，2、4为抗锯齿灰度 */
+    uint16_t num;                   /* 字形数目 */
+    const lcd_glyph_t *glyphs;      /* 按码点升序排列的字形表 */
+    const uint8_t *bitmap;          /* 点阵位流，高位在前，逐行紧密排列 */
+} lcd_font_t;
+
+/***************************************************************
+ * 函数名称: lcd_show_text
+ * 说    明: 用lcd_font_tool.py生成的字体显示UTF-8字符串，
+ *           字体中没有的字符显示为半个行高宽的空白。
+ *           抗锯齿字体在非叠加模式下按灰度混合字的颜色和背景色，
+ *           叠加模式下只显示灰度达到一半的像素
+ * 参    数:
+ *       @x：起始位置X坐标
+ *       @y：起始位置Y坐标
+ *       @str：UTF-8字符串
+ *       @fc：字的颜色
+ *       @bc：字的背景色
+ *       @font：字体
+ *       @mode：0为非叠加模式；1为叠加模式
+ * 返 回 值: 字符串的显示宽度
+ ***************************************************************/
+uint16_t lcd_show_text(uint16_t x, uint16_t y, const char *str, uint16_t fc, uint16_t bc, const lcd_font_t *font, uint8_t mode);
+
+
+/***************************************************************
+ * 函数名称: lcd_text_width
+ * 说    明: 计算UTF-8字符串用指定字体显示时的宽度
+ * 参    数:
+ *       @str：UTF-8字符串
+ *       @font：字体
+ * 返 回 值: 字符串的显示宽度
+ ***************************************************************/
+uint16_t lcd_text_width(const char *str, const lcd_font_t *font);
+
+#endif
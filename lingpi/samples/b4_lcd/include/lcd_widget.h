@@ -0,0 +1,173 @@
+/*
+ * Copyright (c) 2022 FuZhou Lockzhiner Electronic Co., Ltd. All rights reserved.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef _LCD_WIDGET_H_
+#define _LCD_WIDGET_H_
+
+#include <stdint.h>
+#include <stdbool.h>
+
+/* 标签最多显示的字符数 */
+#define LCD_LABEL_LEN_MAX       40
+/* 数值标签最多的小数位数 */
+#define LCD_NUMBER_DECIMALS_MAX 4
+
+/* 文本标签，记录已显示的内容，更新时只重画有变化的字符 */
+typedef struct {
+    uint16_t x;                             /* 起始位置X坐标 */
+    uint16_t y;                             /* 起始位置Y坐标 */
+    uint16_t fc;                            /* 字的颜色 */
+    uint16_t bc;                            /* 字的背景色 */
+    uint8_t sizey;                          /* 字号 */
+    uint8_t len;                            /* 字符格数目，文本不足时以空格补齐 */
+    bool drawn;                             /* 屏幕上是否已有显示内容 */
+    uint8_t text[LCD_LABEL_LEN_MAX + 1];    /* 已显示的内容 */
+} lcd_label_t;
+
+/* 数值标签，数值右对齐显示 */
+typedef struct {
+    lcd_label_t label;                      /* 显示数值的文本标签 */
+    uint8_t decimals;                       /* 小数位数 */
+} lcd_number_t;
+
+/* 水平进度条 */
+typedef struct {
+    uint16_t x;                             /* 起始位置X坐标 */
+    uint16_t y;                             /* 起始位置Y坐标 */
+    uint16_t width;                         /* 宽度 */
+    uint16_t height;                        /* 高度 */
+    uint16_t fc;                            /* 已完成部分的颜色 */
+    uint16_t bc;                            /* 未完成部分的颜色 */
+    uint32_t max;                           /* 最大值 */
+    uint16_t fill;                          /* 已显示的完成部分宽度 */
+    bool drawn;                             /* 屏幕上是否已有显示内容 */
+} lcd_progress_t;
+
+/***************************************************************
+ * 函数名称: lcd_label_init
+ * 说    明: 初始化文本标签，不立即显示
+ * 参    数:
+ *       @label：文本标签
+ *       @x：起始位置X坐标
+ *       @y：起始位置Y坐标
+ *       @len：字符格数目，最大为LCD_LABEL_LEN_MAX
+ *       @fc：字的颜色
+ *       @bc：字的背景色
+ *       @sizey：字号，可选：12、16、24、32
+ * 返 回 值: 无
+ ***************************************************************/
+void lcd_label_init(lcd_label_t *label, uint16_t x, uint16_t y, uint8_t len, uint16_t fc, uint16_t bc, uint8_t sizey);
+
+
+/***************************************************************
+ * 函数名称: lcd_label_set_text
+ * 说    明: 更新文本标签的内容，只重画与已显示内容不同的字符
+ * 参    数:
+ *       @label：文本标签
+ *       @text：新的内容，超出字符格数目的部分被截断
+ * 返 回 值: 无
+ ***************************************************************/
+void lcd_label_set_text(lcd_label_t *label, const uint8_t *text);
+
+
+/***************************************************************
+ * 函数名称: lcd_label_set_color
+ * 说    明: 修改文本标签的颜色，下次更新时整体重画
+ * 参    数:
+ *       @label：文本标签
+ *       @fc：字的颜色
+ *       @bc：字的背景色
+ * 返 回 值: 无
+ ***************************************************************/
+void lcd_label_set_color(lcd_label_t *label, uint16_t fc, uint16_t bc);
+
+
+/***************************************************************
+ * 函数名称: lcd_label_invalidate
+ * 说    明: 屏幕内容被其他操作覆盖后调用，下次更新时整体重画
+ * 参    数:
+ *       @label：文本标签
+ * 返 回 值: 无
+ ***************************************************************/
+void lcd_label_invalidate(lcd_label_t *label);
+
+
+/***************************************************************
+ * 函数名称: lcd_number_init
+ * 说    明: 初始化数值标签，不立即显示
+ * 参    数:
+ *       @number：数值标签
+ *       @x：起始位置X坐标
+ *       @y：起始位置Y坐标
+ *       @len：字符格数目（包括符号和小数点）
+ *       @decimals：小数位数，最大为LCD_NUMBER_DECIMALS_MAX
+ *       @fc：字的颜色
+ *       @bc：字的背景色
+ *       @sizey：字号，可选：12、16、24、32
+ * 返 回 值: 无
+ ***************************************************************/
+void lcd_number_init(lcd_number_t *number, uint16_t x, uint16_t y, uint8_t len, uint8_t decimals, uint16_t fc, uint16_t bc, uint8_t sizey);
+
+
+/***************************************************************
+ * 函数名称: lcd_number_set
+ * 说    明: 更新数值标签，数值为放大10^decimals倍后的整数，
+ *           例如decimals为2时，2345显示为23.45
+ * 参    数:
+ *       @number：数值标签
+ *       @value：放大后的整数
+ * 返 回 值: 无
+ ***************************************************************/
+void lcd_number_set(lcd_number_t *number, int32_t value);
+
+
+/***************************************************************
+ * 函数名称: lcd_number_set_float
+ * 说    明: 更新数值标签，数值按小数位数四舍五入
+ * 参    数:
+ *       @number：数值标签
+ *       @value：数值
+ * 返 回 值: 无
+ ***************************************************************/
+void lcd_number_set_float(lcd_number_t *number, float value);
+
+
+/***************************************************************
+ * 函数名称: lcd_progress_init
+ * 说    明: 初始化水平进度条，不立即显示
+ * 参    数:
+ *       @bar：进度条
+ *       @x：起始位置X坐标
+ *       @y：起始位置Y坐标
+ *       @width：宽度
+ *       @height：高度
+ *       @max：最大值
+ *       @fc：已完成部分的颜色
+ *       @bc：未完成部分的颜色
+ * 返 回 值: 无
+ ***************************************************************/
+void lcd_progress_init(lcd_progress_t *bar, uint16_t x, uint16_t y, uint16_t width, uint16_t height, uint32_t max, uint16_t fc, uint16_t bc);
+
+
+/***************************************************************
+ * 函数名称: lcd_progress_set
+ * 说    明: 更新进度条，只重画完成部分变化的区域
+ * 参    数:
+ *       @bar：进度条
+ *       @value：当前值，超过最大值时按最大值显示
+ * 返 回 值: 无
+ ***************************************************************/
+void lcd_progress_set(lcd_progress_t *bar, uint32_t value);
+
+#endif
@@ -15,7 +15,11 @@
 #ifndef _PICTURE_H_
 #define _PICTURE_H_
 
-#define IMAGE_MAXSIZE_LINGZHI           26040
-extern const unsigned char gImage_lingzhi[IMAGE_MAXSIZE_LINGZHI];
+/* 图片的长度和宽度 */
+#define IMAGE_LENGTH_LINGZHI            210
+#define IMAGE_WIDTH_LINGZHI             62
+/* RLE压缩后的图片字节数 */
+#define IMAGE_RLE_SIZE_LINGZHI          17924
+extern const unsigned char gImage_lingzhi_rle[IMAGE_RLE_SIZE_LINGZHI];
 
 #endif
\ No newline at end of file
@@ -16,6 +16,7 @@
 #include "ohos_init.h"
 #include "picture.h"
 #include "lcd.h"
+#include "lcd_widget.h"
 
 /* 任务的堆栈大小 */
 #define TASK_STACK_SIZE     20480
@@ -25,8 +26,16 @@
 /* 循环等待时间 */
 #define WAIT_MSEC           1000
 
+/* 是否在启动时测量LCD总线传输速度 */
+#define LCD_BUS_BENCHMARK       0
+/* 测量时全屏填充的次数 */
+#define LCD_BENCHMARK_FRAMES    10
+/* 估算每帧传输时间所用的SPI时钟和每次总线传输的固定开销 */
+#define LCD_BENCHMARK_CLOCK     50000000
+#define LCD_BENCHMARK_OVERHEAD  2000
+
 /* 图片数据 */
-extern const unsigned char gImage_lingzhi[IMAGE_MAXSIZE_LINGZHI];
+extern const unsigned char gImage_lingzhi_rle[IMAGE_RLE_SIZE_LINGZHI];
 
 /* LCD的位置 */
 #define LCD_FILL_X              0
@@ -34,8 +43,8 @@ extern const unsigned char gImage_lingzhi[IMAGE_MAXSIZE_LINGZHI];
 /* 图片的位置，长度和宽度 */
 #define LCD_PICTURE_X           15
 #define LCD_PICTURE_Y           0
-#define LCD_PICTURE_LENGTH      210
-#define LCD_PICTURE_WIDTH       62
+#define LCD_PICTURE_LENGTH      IMAGE_LENGTH_LINGZHI
+#define LCD_PICTURE_WIDTH       IMAGE_WIDTH_LINGZHI
 /* 字符串1的位置，长度和宽度 */
 #define LCD_STRING1_X           0
 #define LCD_STRING1_Y           130
@@ -86,12 +95,41 @@ extern const unsigned char gImage_lingzhi[IMAGE_MAXSIZE_LINGZHI];
 #define LCD_FLOAT1_X            128
 #define LCD_FLOAT1_Y            190
 #define LCD_FLOAT1_SIZE         16
-#define LCD_FLOAT1_NUM          4
+/* 4位数字加小数点，与原来lcd_show_float_num1(len=4)的显示宽度相同；
+ * 整数部分不再补0（" 3.14"），超过99.99时只显示低位
+ */
+#define LCD_FLOAT1_LEN          5
+#define LCD_FLOAT1_DECIMALS     2
 #define LCD_FLOAT1_INCREASE     (0.11)
 /* 中文数字的位置，长度和宽度 */
 #define LCD_CHINESE_X           0
 #define LCD_CHINESE_Y           220
 #define LCD_CHINESE_MODE        0
+
+#if LCD_BUS_BENCHMARK
+/***************************************************************
+* 函数名称: lcd_example_bus_benchmark
+* 说    明: 依次测量当前编译方式支持的各种总线方式的传输速度，
+*           模拟SPI方式编译时GPIO和GPIO_REG两种方式都会测量
+* 参    数: 无
+* 返 回 值: 无
+***************************************************************/
+static void lcd_example_bus_benchmark(void)
+{
+    static const char *names[] = {"gpio", "spi", "gpio_reg"};
+    uint8_t bus = lcd_get_bus();
+    uint8_t i;
+    
+    for (i = LCD_BUS_GPIO; i <= LCD_BUS_GPIO_REG; i++) {
+        if (lcd_set_bus(i) == 0) {
+            printf("lcd bus %s: %u bytes/s\n", names[i], lcd_bus_benchmark(LCD_BENCHMARK_FRAMES));
+        }
+    }
+    lcd_set_bus(bus);
+}
+#endif
+
+
 /***************************************************************
 * 函数名称: lcd_process
 * 说    明: lcd例程
@@ -102,8 +140,12 @@ void lcd_process(void)
 {
     uint32_t ret = 0;
     float t = 0;
+#if LCD_BUS_BENCHMARK
+    lcd_bus_stats_t stats;
+#endif
     uint8_t chinese_string[] = "小凌派";
     uint8_t cur_sizey = SIZEY_12;
+    lcd_number_t float_num;
     
     ret = lcd_init();
     if (ret != 0) {
@@ -111,12 +153,22 @@ void lcd_process(void)
         return;
     }
     
-    lcd_fill(LCD_FILL_X, LCD_FILL_Y, LCD_W, LCD_H, LCD_WHITE);
+#if LCD_BUS_BENCHMARK
+    lcd_example_bus_benchmark();
+#endif
     
+    lcd_fill(LCD_FILL_X, LCD_FILL_Y, LCD_W, LCD_H, LCD_WHITE);
+    /* 数值标签只重画变化的数字 */
+    lcd_number_init(&float_num, LCD_FLOAT1_X, LCD_FLOAT1_Y, LCD_FLOAT1_LEN, LCD_FLOAT1_DECIMALS,
+                    LCD_BLACK, LCD_WHITE, LCD_FLOAT1_SIZE);
+                    
     while (1) {
         printf("************Lcd Example***********\n");
-        lcd_show_picture(LCD_PICTURE_X, LCD_PICTURE_Y, LCD_PICTURE_LENGTH,
-                         LCD_PICTURE_WIDTH, &gImage_lingzhi[0]);
+#if LCD_BUS_BENCHMARK
+        lcd_reset_bus_stats();
+#endif
+        lcd_show_picture_rle(LCD_PICTURE_X, LCD_PICTURE_Y, LCD_PICTURE_LENGTH,
+                             LCD_PICTURE_WIDTH, &gImage_lingzhi_rle[0], IMAGE_RLE_SIZE_LINGZHI);
         lcd_show_string(LCD_STRING1_X, LCD_STRING1_Y, LCD_STRING1_TEXT,
                         LCD_RED, LCD_WHITE, LCD_STRING1_SIZE, LCD_STRING1_MODE);
         lcd_show_string(LCD_STRING2_X, LCD_STRING2_Y, LCD_STRING2_TEXT,
@@ -133,8 +185,7 @@ void lcd_process(void)
                         LCD_BLUE, LCD_WHITE, LCD_STRING5_SIZE, LCD_STRING5_MODE);
         lcd_show_string(LCD_STRING6_X, LCD_STRING6_Y, LCD_STRING6_TEXT,
                         LCD_BLACK, LCD_WHITE, LCD_STRING6_SIZE, LCD_STRING6_MODE);
-        lcd_show_float_num1(LCD_FLOAT1_X, LCD_FLOAT1_Y, t,
-                            LCD_FLOAT1_NUM, LCD_BLACK, LCD_WHITE, LCD_FLOAT1_SIZE);
+        lcd_number_set_float(&float_num, t);
         t += LCD_FLOAT1_INCREASE;
         
         lcd_fill(LCD_CHINESE_X, LCD_CHINESE_Y, LCD_W, LCD_H, LCD_WHITE);
@@ -150,6 +201,13 @@ void lcd_process(void)
             cur_sizey = LCD_FONT_SIZE12;
         }
         
+#if LCD_BUS_BENCHMARK
+        /* 每帧的总线开销 */
+        lcd_get_bus_stats(&stats);
+        printf("lcd frame: %u bytes, %u transactions, %u commands, %u us\n",
+               stats.bytes, stats.transactions, stats.commands,
+               lcd_bus_time_us(&stats, LCD_BENCHMARK_CLOCK, LCD_BENCHMARK_OVERHEAD));
+#endif
         printf("\n");
         LOS_Msleep(WAIT_MSEC);
     }
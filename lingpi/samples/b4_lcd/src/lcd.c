@@ -13,16 +13,31 @@
  * limitations under the License.
  */
 #include "lz_hardware.h"
+#include "los_tick.h"
 #include "lcd_font.h"
+#include "lcd_font_index.h"
 #include "lcd.h"
 
-/* 是否启用SPI通信
+/* 是否启用SPI通信，取值见lcd.h中的LCD_BUS_xxx
  * 0 => 禁用SPI，使用gpio模拟SPI通信
  * 1 => 启用SPI
+ * 2 => 禁用SPI，直接读写GPIO寄存器模拟SPI通信，速度比0快得多
+ * 0和2两种方式都编译进来，运行时可以用lcd_set_bus()切换
+ * 主机模拟器（test目录）编译时通过-D指定
  */
-#define LCD_ENABLE_SPI      0
+#ifndef LCD_ENABLE_SPI
+#define LCD_ENABLE_SPI      LCD_BUS_GPIO
+#endif
 #define LCD_SPI_BUS         0
 
+/* 是否启用异步刷新
+ * 0 => lcd_flush_async()在调用者任务中同步发送
+ * 1 => 由后台刷新任务发送，调用者可以同时渲染另一个离屏缓冲区
+ */
+#ifndef LCD_ENABLE_ASYNC
+#define LCD_ENABLE_ASYNC    0
+#endif
+
 #define LCD_PIN_CS          GPIO0_PC0
 #define LCD_PIN_CLK         GPIO0_PC1
 #define LCD_PIN_MOSI        GPIO0_PC2
@@ -44,7 +59,85 @@
 #define LCD_DC_Clr()        LzGpioSetVal(LCD_PIN_DC, LZGPIO_LEVEL_LOW)
 #define LCD_DC_Set()        LzGpioSetVal(LCD_PIN_DC, LZGPIO_LEVEL_HIGH)
 
-#if LCD_ENABLE_SPI
+#if LCD_ENABLE_ASYNC
+#include "los_task.h"
+#include "los_sem.h"
+
+/* 后台刷新任务的堆栈大小 */
+#define LCD_ASYNC_TASK_STACK    2048
+
+/* 后台刷新任务的优先级，数值越小优先级越高。默认比例程任务（24）低一级：
+ * 调用lcd_flush_async()的任务继续渲染，等待上一帧发送完成或休眠时
+ * 刷新任务才运行。SPI驱动在传输期间挂起任务（如等待DMA完成）时，
+ * 可以设为比调用者高，提交后立即开始发送，传输期间调用者继续渲染；
+ * SPI驱动忙等时应保持比调用者低，否则渲染要等发送完成才能继续
+ */
+#ifndef LCD_ASYNC_TASK_PRIO
+#define LCD_ASYNC_TASK_PRIO     25
+#endif
+
+/* 渲染任务和后台刷新任务都会更新总线统计，读写时禁止任务调度 */
+#define LCD_STATS_LOCK()        LOS_TaskLock()
+#define LCD_STATS_UNLOCK()      LOS_TaskUnlock()
+#else
+#define LCD_STATS_LOCK()
+#define LCD_STATS_UNLOCK()
+#endif
+
+#if (LCD_ENABLE_SPI != LCD_BUS_SPI)
+#include "hal_base.h"
+
+/* GPIO_REG方式下半个时钟周期的最小延时循环次数，0为不延时（全速）。
+ * 连线较长或经过电平转换时时钟过快会出现错位，可以调大
+ */
+#ifndef LCD_REG_DELAY
+#define LCD_REG_DELAY           0
+#endif
+
+/* GPIO0_PC0~GPIO0_PC7对应GPIO0 SWPORT_DR_H寄存器的bit0~bit7，
+ * 寄存器高16位为对应位的写使能，一次写操作只修改写使能的位 */
+#define LCD_REG_PIN(pin)        (1U << ((pin) - GPIO0_PC0))
+#define LCD_REG_CS              LCD_REG_PIN(LCD_PIN_CS)
+#define LCD_REG_CLK             LCD_REG_PIN(LCD_PIN_CLK)
+#define LCD_REG_MOSI            LCD_REG_PIN(LCD_PIN_MOSI)
+#define LCD_REG_DC              LCD_REG_PIN(LCD_PIN_DC)
+#define LCD_REG_WRITE_EN(bits)  ((uint32_t)(bits) << 16)
+/* 主机模拟器把寄存器写操作替换为函数调用 */
+#ifndef LCD_REG_WRITE
+#define LCD_REG_WRITE(val)      (GPIO0->SWPORT_DR_H = (val))
+#endif
+
+/* 预先计算的寄存器值：时钟拉低同时输出数据位；时钟拉高 */
+#define LCD_REG_BIT0            (LCD_REG_WRITE_EN(LCD_REG_CLK | LCD_REG_MOSI))
+#define LCD_REG_BIT1            (LCD_REG_WRITE_EN(LCD_REG_CLK | LCD_REG_MOSI) | LCD_REG_MOSI)
+#define LCD_REG_CLK_HIGH        (LCD_REG_WRITE_EN(LCD_REG_CLK) | LCD_REG_CLK)
+
+#define LCD_REG_CS_Clr()        LCD_REG_WRITE(LCD_REG_WRITE_EN(LCD_REG_CS))
+#define LCD_REG_CS_Set()        LCD_REG_WRITE(LCD_REG_WRITE_EN(LCD_REG_CS) | LCD_REG_CS)
+
+#if LCD_REG_DELAY
+#define LCD_REG_HALF_PERIOD()   lcd_reg_delay(LCD_REG_DELAY)
+#else
+#define LCD_REG_HALF_PERIOD()
+#endif
+
+/* 发送1位数据，数据位为dat的bit位 */
+#define LCD_REG_SEND_BIT(dat, bit) do { \
+    LCD_REG_WRITE(((dat) & (1U << (bit))) ? LCD_REG_BIT1 : LCD_REG_BIT0); \
+    LCD_REG_HALF_PERIOD(); \
+    LCD_REG_WRITE(LCD_REG_CLK_HIGH); \
+    LCD_REG_HALF_PERIOD(); \
+} while (0)
+#endif
+
+#if (LCD_ENABLE_SPI == LCD_BUS_GPIO_REG)
+#undef LCD_DC_Clr
+#undef LCD_DC_Set
+#define LCD_DC_Clr()            LCD_REG_WRITE(LCD_REG_WRITE_EN(LCD_REG_DC))
+#define LCD_DC_Set()            LCD_REG_WRITE(LCD_REG_WRITE_EN(LCD_REG_DC) | LCD_REG_DC)
+#endif
+
+#if (LCD_ENABLE_SPI == LCD_BUS_SPI)
 static SpiBusIo m_spiBus = {
     .cs =   {
         .gpio = GPIO0_PC0,
@@ -96,6 +189,14 @@ static LzSpiConfig m_spiConf = {
 #define REG_ADDRESS_COLUMN      0x2a
 #define REG_ADDRESS_LINE        0x2B
 #define REG_ADDRESS_WRITE       0x2C
+/* 垂直滚动区域定义、垂直滚动起始地址 */
+#define REG_SCROLL_AREA         0x33
+#define REG_SCROLL_START        0x37
+/* 存储器访问控制（MADCTL），决定显存的扫描方向 */
+#define REG_MEMORY_ACCESS       0x36
+/* MADCTL的行地址、列地址顺序位，分别对应逻辑坐标的Y方向和X方向 */
+#define MADCTL_MY               0x80
+#define MADCTL_MX               0x40
 
 /* 寄存器位数 */
 #define REG_BITS_MAXSIZE        8
@@ -113,63 +214,431 @@ static LzSpiConfig m_spiConf = {
 /* 字节转化为bits */
 #define BYTE_TO_BITS            8
 
-/* LCD配置模式 */
-#define LCD_HORIZONTAL_MODE1    1
-#define LCD_HORIZONTAL_MODE2    2
+/* 无法解码的UTF-8字节按替换字符处理 */
+#define UTF8_REPLACEMENT_CHAR   0xFFFD
 
-/* 中文转化为UTF-8的字节数 */
-#define CHINESE_TO_BYTES        2
+/* 像素流缓冲区大小（字节），缓冲区写满后作为一次总线传输发送 */
+#define LCD_STREAM_BUFFER_SIZE  4096
 
-static void lcd_write_bus(uint8_t dat)
+/* 每秒的毫秒数、纳秒数，每微秒的纳秒数 */
+#define MSEC_PER_SEC            1000
+#define NSEC_PER_SEC            1000000000ULL
+#define NSEC_PER_USEC           1000
+
+/* RGB565像素的字节数 */
+#define PIXEL_TO_BYTES          2
+
+/* 地址设置命令的参数字节数 */
+#define ADDRESS_PARAM_BYTES     4
+
+/* RLE图片控制字节：最高位表示重复像素，低7位为像素数目减1 */
+#define RLE_RUN_FLAG            0x80
+#define RLE_COUNT_MASK          0x7F
+
+/* 像素流缓冲区 */
+static uint8_t m_stream_buffer[LCD_STREAM_BUFFER_SIZE];
+static uint32_t m_stream_len = 0;
+
+/* 各显示方向的MADCTL寄存器值，横屏时交换行列地址（MV） */
+static const uint8_t m_rotation_madctl[] = {
+    0x00, 0x70, 0xC0, 0xA0
+};
+/* USE_HORIZONTAL对应的显示方向 */
+static const uint8_t m_horizontal_rotation[] = {
+    LCD_ROTATE_0, LCD_ROTATE_180, LCD_ROTATE_90, LCD_ROTATE_270
+};
+/* 当前的显示方向及该方向下的宽度和高度 */
+static uint8_t m_rotation = LCD_ROTATE_0;
+static uint16_t m_width = LCD_PANEL_W;
+static uint16_t m_height = LCD_PANEL_H;
+
+/* 总线传输统计 */
+static lcd_bus_stats_t m_bus_stats = {0};
+/* 总线监听函数，当前传输的是否为命令字节 */
+static lcd_bus_hook_t m_bus_hook = NULL;
+static bool m_bus_cmd = false;
+
+/* 离屏缓冲区最多记录的脏矩形数目 */
+#define LCD_DIRTY_RECT_MAX      8
+
+/* 矩形区域（包含结束点） */
+typedef struct {
+    uint16_t x1;
+    uint16_t y1;
+    uint16_t x2;
+    uint16_t y2;
+} lcd_rect_t;
+
+/* 离屏缓冲区及其脏矩形 */
+typedef struct {
+    uint16_t *buf;
+    uint16_t x;
+    uint16_t y;
+    uint16_t w;
+    uint16_t h;
+    lcd_rect_t dirty[LCD_DIRTY_RECT_MAX];
+    uint8_t dirty_num;
+} lcd_fb_t;
+
+/* 记录脏矩形的离屏缓冲区数目，双缓冲时两个缓冲区各自记录 */
+#define LCD_FB_SLOT_NUM         2
+
+/* 当前的离屏缓冲区，buf为NULL时直接写屏 */
+static lcd_fb_t m_fb = {0};
+/* 其他用过的离屏缓冲区，脏矩形为与屏幕内容不一致的区域 */
+static lcd_fb_t m_fb_slots[LCD_FB_SLOT_NUM];
+static uint8_t m_fb_slot_next = 0;
+
+#if LCD_ENABLE_ASYNC
+/* 后台刷新任务，job为正在发送的离屏缓冲区 */
+static struct {
+    uint32_t task_id;
+    uint32_t start_sem;
+    uint32_t idle_sem;
+    lcd_fb_t job;
+    lcd_flush_cb_t cb;
+    void *arg;
+    uint8_t buffer[LCD_STREAM_BUFFER_SIZE];
+} m_async;
+
+static unsigned int lcd_async_init(void);
+#endif
+
+/* 当前像素流窗口、写入位置及离屏渲染时窗口内实际变化的区域 */
+static struct {
+    uint16_t x1;
+    uint16_t y1;
+    uint16_t x2;
+    uint16_t y2;
+    uint16_t cx;
+    uint16_t cy;
+    bool changed;
+    lcd_rect_t change;
+} m_win = {0};
+
+#if (LCD_ENABLE_SPI != LCD_BUS_SPI)
+/* 当前的模拟SPI方式，LCD_BUS_GPIO或LCD_BUS_GPIO_REG */
+static uint8_t m_bus = LCD_ENABLE_SPI;
+
+#if LCD_REG_DELAY
+static void lcd_reg_delay(uint32_t n)
 {
-#if LCD_ENABLE_SPI
-    LzSpiWrite(LCD_SPI_BUS, 0, &dat, 1);
-#else
-    uint8_t i;
+    volatile uint32_t i = n;
+    
+    while (i > 0) {
+        i--;
+    }
+}
+#endif
+
+/* 直接写GPIO寄存器模拟SPI，片选在整个传输期间保持有效，每个字节的8位展开发送 */
+static void lcd_write_bus_reg(const uint8_t *buf, uint32_t len)
+{
+    uint8_t dat;
+    uint32_t k;
+    
+    LCD_REG_CS_Clr();
+    for (k = 0; k < len; k++) {
+        dat = buf[k];
+        LCD_REG_SEND_BIT(dat, 7);
+        LCD_REG_SEND_BIT(dat, 6);
+        LCD_REG_SEND_BIT(dat, 5);
+        LCD_REG_SEND_BIT(dat, 4);
+        LCD_REG_SEND_BIT(dat, 3);
+        LCD_REG_SEND_BIT(dat, 2);
+        LCD_REG_SEND_BIT(dat, 1);
+        LCD_REG_SEND_BIT(dat, 0);
+    }
+    LCD_REG_CS_Set();
+}
+
+/* 通过GPIO接口模拟SPI，片选在整个传输期间保持有效 */
+static void lcd_write_bus_gpio(const uint8_t *buf, uint32_t len)
+{
+    uint8_t i, dat;
+    uint32_t k;
     
     LCD_CS_Clr();
-    for (i = 0; i < REG_BITS_MAXSIZE; i++) {
-        LCD_CLK_Clr();
-        if (dat & REG_BITS_HIGH) {
-            LCD_MOSI_Set();
-        } else {
-            LCD_MOSI_Clr();
+    for (k = 0; k < len; k++) {
+        dat = buf[k];
+        for (i = 0; i < REG_BITS_MAXSIZE; i++) {
+            LCD_CLK_Clr();
+            if (dat & REG_BITS_HIGH) {
+                LCD_MOSI_Set();
+            } else {
+                LCD_MOSI_Clr();
+            }
+            LCD_CLK_Set();
+            dat <<= 1;
         }
-        LCD_CLK_Set();
-        dat <<= 1;
     }
     LCD_CS_Set();
+}
 #endif
+
+static void lcd_write_bus_buf(const uint8_t *buf, uint32_t len)
+{
+#if (LCD_ENABLE_SPI == LCD_BUS_SPI)
+    LzSpiWrite(LCD_SPI_BUS, 0, buf, len);
+#else
+    if (m_bus == LCD_BUS_GPIO_REG) {
+        lcd_write_bus_reg(buf, len);
+    } else {
+        lcd_write_bus_gpio(buf, len);
+    }
+#endif
+    LCD_STATS_LOCK();
+    m_bus_stats.transactions++;
+    m_bus_stats.bytes += len;
+    if (m_bus_cmd) {
+        m_bus_stats.commands += len;
+    }
+    LCD_STATS_UNLOCK();
+    if (m_bus_hook != NULL) {
+        m_bus_hook(m_bus_cmd, buf, len);
+    }
 }
 
-static void lcd_wr_data8(uint8_t dat)
+static void lcd_write_bus(uint8_t dat)
 {
-    lcd_write_bus(dat);
+    lcd_write_bus_buf(&dat, 1);
+}
+
+/* 将像素流缓冲区中的数据一次性发送出去 */
+static void lcd_stream_flush(void)
+{
+    if (m_stream_len > 0) {
+        lcd_write_bus_buf(m_stream_buffer, m_stream_len);
+        m_stream_len = 0;
+    }
+}
+
+/* 往像素流缓冲区写入一个像素，缓冲区满时自动发送 */
+static inline void lcd_bus_put(uint16_t color)
+{
+    m_stream_buffer[m_stream_len++] = UINT16_TO_H(color);
+    m_stream_buffer[m_stream_len++] = UINT16_TO_L(color);
+    if (m_stream_len >= LCD_STREAM_BUFFER_SIZE) {
+        lcd_stream_flush();
+    }
+}
+
+/* 记录像素流窗口内实际发生变化的区域 */
+static inline void lcd_win_mark_changed(uint16_t x1, uint16_t x2, uint16_t y)
+{
+    if (!m_win.changed) {
+        m_win.changed = true;
+        m_win.change.x1 = x1;
+        m_win.change.x2 = x2;
+        m_win.change.y1 = y;
+        m_win.change.y2 = y;
+        return;
+    }
+    
+    if (x1 < m_win.change.x1) {
+        m_win.change.x1 = x1;
+    }
+    if (x2 > m_win.change.x2) {
+        m_win.change.x2 = x2;
+    }
+    if (y < m_win.change.y1) {
+        m_win.change.y1 = y;
+    }
+    if (y > m_win.change.y2) {
+        m_win.change.y2 = y;
+    }
+}
+
+/* 往离屏缓冲区的像素流窗口写入一个像素，超出缓冲区覆盖范围的像素被丢弃，
+ * 与缓冲区中原有内容相同的像素不记为脏区域 */
+static inline void lcd_fb_put(uint16_t color)
+{
+    uint32_t fx = (uint32_t)(m_win.cx - m_fb.x);
+    uint32_t fy = (uint32_t)(m_win.cy - m_fb.y);
+    
+    if ((fx < m_fb.w) && (fy < m_fb.h) && (m_fb.buf[fy * m_fb.w + fx] != color)) {
+        m_fb.buf[fy * m_fb.w + fx] = color;
+        lcd_win_mark_changed(m_win.cx, m_win.cx, m_win.cy);
+    }
+    
+    if (++m_win.cx > m_win.x2) {
+        m_win.cx = m_win.x1;
+        if (++m_win.cy > m_win.y2) {
+            m_win.cy = m_win.y1;
+        }
+    }
+}
+
+/* 往像素流写入一个像素，根据当前渲染目标写屏或写入离屏缓冲区 */
+static inline void lcd_stream_put(uint16_t color)
+{
+    if (m_fb.buf != NULL) {
+        lcd_fb_put(color);
+    } else {
+        lcd_bus_put(color);
+    }
+}
+
+/* 往离屏缓冲区的像素流窗口写入多个相同颜色的像素，按行整段填充 */
+static void lcd_fb_push_color(uint16_t color, uint32_t count)
+{
+    uint32_t n, fy;
+    uint16_t x1, x2;
+    uint16_t *line = NULL;
+    
+    while (count > 0) {
+        n = m_win.x2 - m_win.cx + 1;
+        if (n > count) {
+            n = count;
+        }
+        
+        /* 当前行与缓冲区覆盖范围的交集 */
+        fy = (uint32_t)(m_win.cy - m_fb.y);
+        x1 = (m_win.cx > m_fb.x) ? m_win.cx : m_fb.x;
+        x2 = m_win.cx + n - 1;
+        if (x2 > m_fb.x + m_fb.w - 1) {
+            x2 = m_fb.x + m_fb.w - 1;
+        }
+        if ((fy < m_fb.h) && (x1 <= x2)) {
+            line = &m_fb.buf[fy * m_fb.w];
+            for (; x1 <= x2; x1++) {
+                if (line[x1 - m_fb.x] != color) {
+                    line[x1 - m_fb.x] = color;
+                    lcd_win_mark_changed(x1, x1, m_win.cy);
+                }
+            }
+        }
+        
+        count -= n;
+        m_win.cx += n;
+        if (m_win.cx > m_win.x2) {
+            m_win.cx = m_win.x1;
+            if (++m_win.cy > m_win.y2) {
+                m_win.cy = m_win.y1;
+            }
+        }
+    }
+}
+
+/* 计算两个矩形合并后的面积 */
+static uint32_t lcd_rect_union_area(const lcd_rect_t *a, const lcd_rect_t *b)
+{
+    uint32_t w = ((a->x2 > b->x2) ? a->x2 : b->x2) - ((a->x1 < b->x1) ? a->x1 : b->x1) + 1;
+    uint32_t h = ((a->y2 > b->y2) ? a->y2 : b->y2) - ((a->y1 < b->y1) ? a->y1 : b->y1) + 1;
+    
+    return w * h;
+}
+
+/* 把矩形b合并到矩形a */
+static void lcd_rect_union(lcd_rect_t *a, const lcd_rect_t *b)
+{
+    a->x1 = (a->x1 < b->x1) ? a->x1 : b->x1;
+    a->y1 = (a->y1 < b->y1) ? a->y1 : b->y1;
+    a->x2 = (a->x2 > b->x2) ? a->x2 : b->x2;
+    a->y2 = (a->y2 > b->y2) ? a->y2 : b->y2;
+}
+
+/* 判断两个矩形是否重叠或相邻 */
+static bool lcd_rect_touch(const lcd_rect_t *a, const lcd_rect_t *b)
+{
+    return (a->x1 <= b->x2 + 1) && (b->x1 <= a->x2 + 1) &&
+           (a->y1 <= b->y2 + 1) && (b->y1 <= a->y2 + 1);
+}
+
+/* 记录离屏缓冲区的脏矩形，重叠或相邻的矩形合并为一个 */
+static void lcd_fb_add_dirty(lcd_fb_t *fb, uint16_t x1, uint16_t y1, uint16_t x2, uint16_t y2)
+{
+    lcd_rect_t r;
+    uint32_t area, best_area = 0xFFFFFFFF;
+    uint8_t i, best = 0;
+    
+    /* 裁剪到缓冲区覆盖范围 */
+    r.x1 = (x1 > fb->x) ? x1 : fb->x;
+    r.y1 = (y1 > fb->y) ? y1 : fb->y;
+    r.x2 = (x2 < fb->x + fb->w - 1) ? x2 : (fb->x + fb->w - 1);
+    r.y2 = (y2 < fb->y + fb->h - 1) ? y2 : (fb->y + fb->h - 1);
+    if ((r.x1 > r.x2) || (r.y1 > r.y2)) {
+        return;
+    }
+    
+    /* 与已有的矩形合并，合并后可能与其他矩形重叠，需要重新检查 */
+    i = 0;
+    while (i < fb->dirty_num) {
+        if (lcd_rect_touch(&fb->dirty[i], &r)) {
+            lcd_rect_union(&r, &fb->dirty[i]);
+            fb->dirty[i] = fb->dirty[--fb->dirty_num];
+            i = 0;
+        } else {
+            i++;
+        }
+    }
+    
+    if (fb->dirty_num < LCD_DIRTY_RECT_MAX) {
+        fb->dirty[fb->dirty_num++] = r;
+        return;
+    }
+    
+    /* 脏矩形数目已满，合并到合并后面积最小的矩形 */
+    for (i = 0; i < fb->dirty_num; i++) {
+        area = lcd_rect_union_area(&fb->dirty[i], &r);
+        if (area < best_area) {
+            best_area = area;
+            best = i;
+        }
+    }
+    lcd_rect_union(&fb->dirty[best], &r);
+}
+
+/* 把当前像素流窗口内实际变化的区域记为脏矩形 */
+static void lcd_fb_commit_change(void)
+{
+    if (m_win.changed) {
+        m_win.changed = false;
+        lcd_fb_add_dirty(&m_fb, m_win.change.x1, m_win.change.y1, m_win.change.x2, m_win.change.y2);
+    }
 }
 
-static void lcd_wr_data(uint16_t dat)
+static void lcd_wr_data8(uint8_t dat)
 {
-    lcd_write_bus(UINT16_TO_H(dat));
-    lcd_write_bus(UINT16_TO_L(dat));
+    lcd_write_bus(dat);
 }
 
 static void lcd_wr_reg(uint8_t dat)
 {
+#if LCD_ENABLE_ASYNC
+    /* 后台刷新任务正在使用总线时，等待其发送完成 */
+    if (LOS_CurTaskIDGet() != m_async.task_id) {
+        lcd_flush_wait();
+    }
+#endif
+    /* 发送命令前先把未发送的像素数据发送出去 */
+    lcd_stream_flush();
     LCD_DC_Clr();
+    m_bus_cmd = true;
     lcd_write_bus(dat);
+    m_bus_cmd = false;
     LCD_DC_Set();
 }
 
+static void lcd_wr_address(uint16_t start, uint16_t end)
+{
+    uint8_t buf[ADDRESS_PARAM_BYTES];
+    
+    buf[0] = UINT16_TO_H(start);
+    buf[1] = UINT16_TO_L(start);
+    buf[2] = UINT16_TO_H(end);
+    buf[3] = UINT16_TO_L(end);
+    lcd_write_bus_buf(buf, sizeof(buf));
+}
+
 static void lcd_address_set(uint16_t x1, uint16_t y1, uint16_t x2, uint16_t y2)
 {
     /* 列地址设置 */
     lcd_wr_reg(REG_ADDRESS_COLUMN);
-    lcd_wr_data(x1);
-    lcd_wr_data(x2);
+    lcd_wr_address(x1, x2);
     /* 行地址设置 */
     lcd_wr_reg(REG_ADDRESS_LINE);
-    lcd_wr_data(y1);
-    lcd_wr_data(y2);
+    lcd_wr_address(y1, y2);
     /* 储存器写 */
     lcd_wr_reg(REG_ADDRESS_WRITE);
 }
@@ -187,325 +656,530 @@ static uint32_t mypow(uint8_t m, uint8_t n)
 
 
 /***************************************************************
- * 函数名称: lcd_show_chinese_12x12
- * 说    明: 显示单个12x12汉字
+ * 函数名称: lcd_fill_span
+ * 说    明: 填充矩形区域（包含结束点），超出屏幕的部分被裁剪，
+ *           水平线、垂直线都作为一个显示窗口整段填充
  * 参    数:
- *       @x：指定汉字串的起始位置X坐标
- *       @y：指定汉字串的起始位置X坐标
- *       @s：指定汉字串（该汉字串为ascii）
- *       @fc: 字的颜色
- *       @bc: 字的背景色
- *       @sizey: 字号，可选：12
- *       @mode: 0为非叠加模式；1为叠加模式
+ *       @x1：区域的起始点X坐标
+ *       @y1：区域的起始点Y坐标
+ *       @x2：区域的结束点X坐标
+ *       @y2：区域的结束点Y坐标
+ *       @color：填充的颜色
  * 返 回 值: 无
  ***************************************************************/
-static void lcd_show_chinese_12x12(uint16_t x,
-    uint16_t y,
-    uint8_t *s,
-    uint16_t fc,
-    uint16_t bc,
-    uint8_t sizey,
-    uint8_t mode)
+static void lcd_fill_span(int x1, int y1, int x2, int y2, uint16_t color)
 {
-    uint8_t i, j, m = 0;
-    uint16_t k;
-    uint16_t HZnum;         // 汉字数目
-    uint16_t TypefaceNum;   // 一个字符所占字节大小
-    uint16_t x0 = x;
-    
-    TypefaceNum = (sizey / BYTE_TO_BITS + ((sizey % biBYTE_TO_BITSts) ? 1 : 0)) * sizey;
-    
-    /* 统计汉字数目 */
-    HZnum = sizeof(tfont12) / sizeof(typFNT_GB12);
-    
-    for (k = 0; k < HZnum; k++) {
-        if ((tfont12[k].Index[0] == *(s)) && (tfont12[k].Index[1] == *(s + 1))) {
-            lcd_address_set(x, y, x + sizey - 1, y + sizey - 1);
-            for (i = 0; i < TypefaceNum; i++) {
-                for (j = 0; j < BYTE_TO_BITS; j++) {
-                    if (!mode) {
-                        /* 非叠加方式 */
-                        if (tfont12[k].Msk[i] & (0x01 << j)) {
-                            lcd_wr_data(fc);
-                        } else {
-                            lcd_wr_data(bc);
-                        }
-                        
-                        m++;
-                        if ((m % sizey) == 0) {
-                            m = 0;
-                            break;
-                        }
-                    } else {
-                        /* 叠加方式 */
-                        if (tfont12[k].Msk[i] & (0x01 << j)) {
-                            /* 画一个点 */
-                            lcd_draw_point(x, y, fc);
-                        }
-                        
-                        x++;
-                        if ((x - x0) == sizey) {
-                            x = x0;
-                            y++;
-                            break;
-                        }
-                    }
-                }
-            }
-            
-            break; /* 查找到对应点阵字库立即退出，防止多个汉字重复取模带来影响 */
-        }
+    int t;
+    
+    if (x1 > x2) {
+        t = x1;
+        x1 = x2;
+        x2 = t;
     }
+    if (y1 > y2) {
+        t = y1;
+        y1 = y2;
+        y2 = t;
+    }
+    
+    x1 = (x1 < 0) ? 0 : x1;
+    y1 = (y1 < 0) ? 0 : y1;
+    x2 = (x2 > LCD_W - 1) ? (LCD_W - 1) : x2;
+    y2 = (y2 > LCD_H - 1) ? (LCD_H - 1) : y2;
+    if ((x1 > x2) || (y1 > y2)) {
+        return;
+    }
+    
+    lcd_fill(x1, y1, x2 + 1, y2 + 1, color);
 }
 
 /***************************************************************
- * 函数名称: lcd_show_chinese_16x16
- * 说    明: 显示单个16x16汉字
+ * 函数名称: lcd_draw_mono
+ * 说    明: 显示单色点阵，点阵按行存储，每行占用整数个字节，低位在前
  * 参    数:
- *       @x：指定汉字串的起始位置X坐标
- *       @y：指定汉字串的起始位置X坐标
- *       @s：指定汉字串（该汉字串为ascii）
- *       @fc: 字的颜色
- *       @bc: 字的背景色
- *       @sizey: 字号，可选：16
+ *       @x：点阵的起始位置X坐标
+ *       @y：点阵的起始位置Y坐标
+ *       @bitmap：点阵
+ *       @width：点阵的宽度
+ *       @height：点阵的高度
+ *       @fc: 点阵的颜色
+ *       @bc: 点阵的背景色
  *       @mode: 0为非叠加模式；1为叠加模式
  * 返 回 值: 无
  ***************************************************************/
-static void lcd_show_chinese_16x16(uint16_t x,
+static void lcd_draw_mono(uint16_t x,
     uint16_t y,
-    uint8_t *s,
+    const uint8_t *bitmap,
+    uint16_t width,
+    uint16_t height,
     uint16_t fc,
     uint16_t bc,
-    uint8_t sizey,
     uint8_t mode)
 {
-    uint8_t i, j, m = 0;
-    uint16_t k;
-    uint16_t HZnum;         /* 汉字数目 */
-    uint16_t TypefaceNum;   /* 一个字符所占字节大小 */
-    uint16_t x0 = x;
-    
-    TypefaceNum = (sizey / SIZEY_UNIT + ((sizey % SIZEY_UNIT) ? 1 : 0)) * sizey;
-    /* 统计汉字数目 */
-    HZnum = sizeof(tfont16) / sizeof(typFNT_GB16);
-    
-    for (k = 0; k < HZnum; k++) {
-        if ((tfont16[k].Index[0] == *(s)) && (tfont16[k].Index[1] == *(s + 1))) {
-            lcd_address_set(x, y, x + sizey - 1, y + sizey - 1);
-            for (i = 0; i < TypefaceNum; i++) {
-                for (j = 0; j < BYTE_TO_BITS; j++) {
-                    if (!mode) {
-                        /* 非叠加方式 */
-                        if (tfont16[k].Msk[i] & (0x01 << j)) {
-                            lcd_wr_data(fc);
-                        } else {
-                            lcd_wr_data(bc);
-                        }
-                        
-                        m++;
-                        if (m % sizey == 0) {
-                            m = 0;
-                            break;
-                        }
-                    } else {
-                        /* 叠加方式 */
-                        if (tfont16[k].Msk[i] & (0x01 << j)) {
-                            /* 画一个点 */
-                            lcd_draw_point(x, y, fc);
-                        }
-                        
-                        x++;
-                        if ((x - x0) == sizey) {
-                            x = x0;
-                            y++;
-                            break;
-                        }
-                    }
-                }
+    uint16_t row, col, start;
+    uint16_t bytes_per_row = width / BYTE_TO_BITS + ((width % BYTE_TO_BITS) ? 1 : 0);
+    const uint8_t *line = NULL;
+    
+#define MONO_BIT(line, col)     ((line)[(col) / BYTE_TO_BITS] & (0x01 << ((col) % BYTE_TO_BITS)))
+    if (!mode) {
+        /* 非叠加方式 */
+        lcd_stream_begin(x, y, x + width - 1, y + height - 1);
+        for (row = 0; row < height; row++) {
+            line = &bitmap[row * bytes_per_row];
+            for (col = 0; col < width; col++) {
+                lcd_stream_put(MONO_BIT(line, col) ? fc : bc);
+            }
+        }
+        lcd_stream_end();
+        return;
+    }
+    
+    /* 叠加方式：每行连续的点合并为一个水平线段，一次写入 */
+    for (row = 0; row < height; row++) {
+        line = &bitmap[row * bytes_per_row];
+        col = 0;
+        while (col < width) {
+            if (!MONO_BIT(line, col)) {
+                col++;
+                continue;
+            }
+            start = col;
+            while ((col < width) && MONO_BIT(line, col)) {
+                col++;
             }
-            
-            break; /* 查找到对应点阵字库立即退出，防止多个汉字重复取模带来影响 */
+            lcd_fill_span(x + start, y + row, x + col - 1, y + row, fc);
         }
     }
+#undef MONO_BIT
 }
 
+/* 中文字库描述 */
+typedef struct {
+    uint8_t sizey;                  /* 字号 */
+    const uint8_t *base;            /* 字库首地址 */
+    uint16_t stride;                /* 每个汉字结构体所占字节大小 */
+    uint16_t num;                   /* 汉字数目 */
+    const typFNT_GB_INDEX *index;   /* 按码点升序排列的下标表，见lcd_font_index.h */
+} lcd_hz_font_t;
+
+/* 取得汉字结构体中的编码和点阵 */
+#define HZ_ENTRY(font, k)       ((font)->base + (uint32_t)(k) * (font)->stride)
+#define HZ_MSK(p)               ((p) + HZ_INDEX_BYTES)
+
+#define HZ_NUM(tfont)           (sizeof(tfont) / sizeof((tfont)[0]))
+
+/* 下标表与汉字表的数目不一致时编译失败，说明修改汉字表后没有重新生成下标表 */
+#define HZ_INDEX_CHECK(size)    typedef char hz_index_check##size[(HZ_NUM(tfont##size##_index) == \
+                                    HZ_NUM(tfont##size)) ? 1 : -1]
+HZ_INDEX_CHECK(12);
+HZ_INDEX_CHECK(16);
+HZ_INDEX_CHECK(24);
+HZ_INDEX_CHECK(32);
+
+static const lcd_hz_font_t m_hz_fonts[] = {
+    {LCD_FONT_SIZE12, (const uint8_t *)tfont12, sizeof(tfont12[0]), HZ_NUM(tfont12), tfont12_index},
+    {LCD_FONT_SIZE16, (const uint8_t *)tfont16, sizeof(tfont16[0]), HZ_NUM(tfont16), tfont16_index},
+    {LCD_FONT_SIZE24, (const uint8_t *)tfont24, sizeof(tfont24[0]), HZ_NUM(tfont24), tfont24_index},
+    {LCD_FONT_SIZE32, (const uint8_t *)tfont32, sizeof(tfont32[0]), HZ_NUM(tfont32), tfont32_index},
+};
+
+/* 字形缓存的最大条目数目 */
+#define LCD_GLYPH_CACHE_NUM     16
+
+/* 字形缓存的像素池，按当前字号划分为条目：8x16字形16个，16x32字形4个 */
+#define LCD_GLYPH_POOL_SIZE     4096
+
+/* 根据字体大小偏移X轴坐标 */
+#define X_OFFSET(sizey)         ((sizey) / 2)
+
+/* 已展开为RGB565的字形，按(字符, 字色, 背景色)查找，字号由m_glyph_sizey决定 */
+typedef struct {
+    uint8_t ch;
+    uint16_t fc;
+    uint16_t bc;
+    uint32_t stamp;     /* 最近使用时间，0表示空条目 */
+} lcd_glyph_cache_t;
+
+static lcd_glyph_cache_t m_glyph_cache[LCD_GLYPH_CACHE_NUM];
+static uint8_t m_glyph_pool[LCD_GLYPH_POOL_SIZE];
+static uint8_t m_glyph_sizey = 0;
+static uint8_t m_glyph_num = 0;
+static uint32_t m_glyph_clock = 0;
 
 /***************************************************************
- * 函数名称: lcd_show_chinese_24x24
- * 说    明: 显示单个24x24汉字
+ * 函数名称: lcd_utf8_next
+ * 说    明: 从UTF-8字符串中取出一个字符，并移动到下一个字符
  * 参    数:
- *       @x：指定汉字串的起始位置X坐标
- *       @y：指定汉字串的起始位置X坐标
- *       @s：指定汉字串（该汉字串为ascii）
- *       @fc: 字的颜色
- *       @bc: 字的背景色
- *       @sizey: 字号，可选：24
- *       @mode: 0为非叠加模式；1为叠加模式
- * 返 回 值: 无
+ *       @s：字符串指针的地址
+ * 返 回 值: 字符的Unicode码点，字符串结束时返回0
  ***************************************************************/
-static void lcd_show_chinese_24x24(uint16_t x,
-    uint16_t y,
-    uint8_t *s,
-    uint16_t fc,
-    uint16_t bc,
-    uint8_t sizey,
-    uint8_t mode)
+uint32_t lcd_utf8_next(const uint8_t **s)
 {
-    uint8_t i, j, m = 0;
-    uint16_t k;
-    uint16_t HZnum;         /* 汉字数目 */
-    uint16_t TypefaceNum;   /* 一个字符所占字节大小 */
-    uint16_t x0 = x;
-    
-    TypefaceNum = (sizey / BYTE_TO_BITS + ((sizey % BYTE_TO_BITS) ? 1 : 0)) * sizey;
-    /* 统计汉字数目 */
-    HZnum = sizeof(tfont24) / sizeof(typFNT_GB24);
-    
-    for (k = 0; k < HZnum; k++) {
-        if ((tfont24[k].Index[0] == *(s)) && (tfont24[k].Index[1] == *(s + 1))) {
-            lcd_address_set(x, y, x + sizey - 1, y + sizey - 1);
-            for (i = 0; i < TypefaceNum; i++) {
-                for (j = 0; j < BYTE_TO_BITS; j++) {
-                    if (!mode) {
-                        /* 非叠加方式 */
-                        if (tfont24[k].Msk[i] & (0x01 << j)) {
-                            lcd_wr_data(fc);
-                        } else {
-                            lcd_wr_data(bc);
-                        }
-                        
-                        m++;
-                        if (m % sizey == 0) {
-                            m = 0;
-                            break;
-                        }
-                    } else {
-                        /* 叠加方式 */
-                        if (tfont24[k].Msk[i] & (0x01 << j)) {
-                            /* 画一个点 */
-                            lcd_draw_point(x, y, fc);
-                        }
-                        
-                        x++;
-                        if ((x - x0) == sizey) {
-                            x = x0;
-                            y++;
-                            break;
-                        }
-                    }
-                }
-            }
-            
-            break; /* 查找到对应点阵字库立即退出，防止多个汉字重复取模带来影响 */
+    const uint8_t *p = *s;
+    uint32_t code;
+    uint8_t extra, i;
+    
+    if (*p == 0) {
+        return 0;
+    }
+    
+    if (*p < 0x80) {
+        *s = p + 1;
+        return *p;
+    } else if ((*p & 0xE0) == 0xC0) {
+        code = *p & 0x1F;
+        extra = 1;
+    } else if ((*p & 0xF0) == 0xE0) {
+        code = *p & 0x0F;
+        extra = 2;
+    } else if ((*p & 0xF8) == 0xF0) {
+        code = *p & 0x07;
+        extra = 3;
+    } else {
+        *s = p + 1;
+        return UTF8_REPLACEMENT_CHAR;
+    }
+    
+    for (i = 1; i <= extra; i++) {
+        if ((p[i] & 0xC0) != 0x80) {
+            /* 不完整的字符，从出错的字节重新开始 */
+            *s = p + i;
+            return UTF8_REPLACEMENT_CHAR;
         }
+        code = (code << 6) | (p[i] & 0x3F);
     }
+    *s = p + extra + 1;
+    return code;
 }
 
-
 /***************************************************************
- * 函数名称: lcd_show_chinese_32x32
- * 说    明: 显示单个32x32汉字
+ * 函数名称: lcd_hz_font_get
+ * 说    明: 取得指定字号的中文字库
  * 参    数:
- *       @x：指定汉字串的起始位置X坐标
- *       @y：指定汉字串的起始位置X坐标
- *       @s：指定汉字串（该汉字串为ascii）
- *       @fc: 字的颜色
- *       @bc: 字的背景色
- *       @sizey: 字号，可选：32
- *       @mode: 0为非叠加模式；1为叠加模式
- * 返 回 值: 无
+ *       @sizey: 字号，可选：12、16、24、32
+ * 返 回 值: 中文字库，不支持的字号返回NULL
  ***************************************************************/
-static void lcd_show_chinese_32x32(uint16_t x,
-    uint16_t y,
-    uint8_t *s,
-    uint16_t fc,
-    uint16_t bc,
-    uint8_t sizey,
-    uint8_t mode)
+static const lcd_hz_font_t *lcd_hz_font_get(uint8_t sizey)
 {
-    uint8_t i, j, m = 0;
-    uint16_t k;
-    uint16_t HZnum;         /* 汉字数目 */
-    uint16_t TypefaceNum;   /* 一个字符所占字节大小 */
-    uint16_t x0 = x;
-    
-    TypefaceNum = (sizey / SIZEY_UNIT + ((sizey % SIZEY_UNIT) ? 1 : 0)) * sizey;
-    /* 统计汉字数目 */
-    HZnum = sizeof(tfont32) / sizeof(typFNT_GB32);
-    
-    for (k = 0; k < HZnum; k++) {
-        if ((tfont32[k].Index[0] == *(s)) && (tfont32[k].Index[1] == *(s + 1))) {
-            lcd_address_set(x, y, x + sizey - 1, y + sizey - 1);
-            for (i = 0; i < TypefaceNum; i++) {
-                for (j = 0; j < BYTE_TO_BITS; j++) {
-                    if (!mode) {
-                        /* 非叠加方式 */
-                        if (tfont32[k].Msk[i] & (0x01 << j)) {
-                            lcd_wr_data(fc);
-                        } else {
-                            lcd_wr_data(bc);
-                        }
-                        
-                        m++;
-                        if (m % sizey == 0) {
-                            m = 0;
-                            break;
-                        }
-                    } else {
-                        /* 叠加方式 */
-                        if (tfont32[k].Msk[i] & (0x01 << j)) {
-                            lcd_draw_point(x, y, fc); /* 画一个点 */
-                        }
-                        
-                        x++;
-                        if ((x - x0) == sizey) {
-                            x = x0;
-                            y++;
-                            break;
-                        }
-                    }
-                }
-            }
-            
-            break; /* 查找到对应点阵字库立即退出，防止多个汉字重复取模带来影响 */
+    uint8_t f;
+    
+    for (f = 0; f < sizeof(m_hz_fonts) / sizeof(m_hz_fonts[0]); f++) {
+        if (m_hz_fonts[f].sizey == sizey) {
+            return &m_hz_fonts[f];
         }
     }
+    
+    return NULL;
 }
 
 /***************************************************************
- * 函数名称: lcd_init
- * 说    明: Lcd初始化
- * 参    数: 无
- * 返 回 值: 返回0为成功，反之为失败
+ * 函数名称: lcd_hz_find
+ * 说    明: 在下标表中二分查找汉字点阵
+ * 参    数:
+ *       @font：中文字库
+ *       @code：汉字的Unicode码点
+ * 返 回 值: 汉字点阵，找不到返回NULL
  ***************************************************************/
-unsigned int lcd_init(void)
+static const uint8_t *lcd_hz_find(const lcd_hz_font_t *font, uint32_t code)
 {
-    unsigned int delay_msec = 100;
-    unsigned int long_delay_msec = 500;
-#if LCD_ENABLE_SPI
-    LzSpiDeinit(LCD_SPI_BUS);
+    int32_t low, high, mid;
     
-    if (SpiIoInit(m_spiBus) != LZ_HARDWARE_SUCCESS) {
-        printf("%s, %d: SpiIoInit failed!\n", __FILE__, __LINE__);
-        return __LINE__;
-    }
-    if (LzSpiInit(LCD_SPI_BUS, m_spiConf) != LZ_HARDWARE_SUCCESS) {
-        printf("%s, %d: LzSpiInit failed!\n", __FILE__, __LINE__);
-        return __LINE__;
+    low = 0;
+    high = (int32_t)font->num - 1;
+    while (low <= high) {
+        mid = (low + high) / 2;
+        if (font->index[mid].code == code) {
+            return HZ_MSK(HZ_ENTRY(font, font->index[mid].index));
+        } else if (font->index[mid].code < code) {
+            low = mid + 1;
+        } else {
+            high = mid - 1;
+        }
     }
-#else
-    /* 初始化GPIO0_C0 */
-    LzGpioInit(LCD_PIN_CS);
-    LzGpioSetDir(LCD_PIN_CS, LZGPIO_DIR_OUT);
-    LzGpioSetVal(LCD_PIN_CS, LZGPIO_LEVEL_HIGH);
-    /* 初始化GPIO0_C1 */
-    LzGpioInit(LCD_PIN_CLK);
-    LzGpioSetDir(LCD_PIN_CLK, LZGPIO_DIR_OUT);
-    LzGpioSetVal(LCD_PIN_CLK, LZGPIO_LEVEL_LOW);
-    /* 初始化GPIO0_C2 */
+    
+    return NULL;
+}
+
+/***************************************************************
+ * 函数名称: lcd_circle_spans
+ * 说    明: 以水平线段和垂直线段画圆或圆角，左右两半、上下两半可以
+ *           使用不同的圆心，用于画圆角矩形的四个角
+ * 参    数:
+ *       @xl：左半部分圆心的X坐标
+ *       @xr：右半部分圆心的X坐标
+ *       @yt：上半部分圆心的Y坐标
+ *       @yb：下半部分圆心的Y坐标
+ *       @r：半径
+ *       @color：颜色
+ *       @fill：true为实心，false为空心
+ * 返 回 值: 无
+ ***************************************************************/
+static void lcd_circle_spans(int xl, int xr, int yt, int yb, uint8_t r, uint16_t color, bool fill)
+{
+    int a = 0, b = r;
+    int a_start = 0;    /* b不变的一段中a的起始值 */
+    int a_next, b_next;
+    
+    while (a <= b) {
+        a_next = a + 1;
+        b_next = b;
+        /* 判断要画的点是否过远 */
+        if ((a_next * a_next + b * b) > (r * r)) {
+            b_next--;
+        }
+        
+        if (fill) {
+            /* 每个a对应上下两行 */
+            lcd_fill_span(xl - b, yt - a, xr + b, yt - a, color);
+            lcd_fill_span(xl - b, yb + a, xr + b, yb + a, color);
+        }
+        
+        /* b不变的一段点在水平方向和垂直方向上都是连续的 */
+        if ((b_next != b) || (a_next > b_next)) {
+            if (fill) {
+                lcd_fill_span(xl - a, yt - b, xr + a, yt - b, color);
+                lcd_fill_span(xl - a, yb + b, xr + a, yb + b, color);
+            } else {
+                lcd_fill_span(xr + a_start, yt - b, xr + a, yt - b, color);
+                lcd_fill_span(xr + a_start, yb + b, xr + a, yb + b, color);
+                lcd_fill_span(xl - a, yt - b, xl - a_start, yt - b, color);
+                lcd_fill_span(xl - a, yb + b, xl - a_start, yb + b, color);
+                lcd_fill_span(xl - b, yt - a, xl - b, yt - a_start, color);
+                lcd_fill_span(xl - b, yb + a_start, xl - b, yb + a, color);
+                lcd_fill_span(xr + b, yt - a, xr + b, yt - a_start, color);
+                lcd_fill_span(xr + b, yb + a_start, xr + b, yb + a, color);
+            }
+            a_start = a_next;
+        }
+        
+        a = a_next;
+        b = b_next;
+    }
+}
+
+/* 圆角半径不超过矩形宽度和高度的一半 */
+static uint8_t lcd_round_rect_radius(uint16_t x1, uint16_t y1, uint16_t x2, uint16_t y2, uint8_t r)
+{
+    uint16_t w = (x2 > x1) ? (x2 - x1) : (x1 - x2);
+    uint16_t h = (y2 > y1) ? (y2 - y1) : (y1 - y2);
+    
+    if (r > w / 2) {
+        r = w / 2;
+    }
+    if (r > h / 2) {
+        r = h / 2;
+    }
+    
+    return r;
+}
+
+/***************************************************************
+ * 函数名称: lcd_ascii_font
+ * 说    明: 取得ASCII字符的点阵
+ * 参    数:
+ *       @num：ASCII字符
+ *       @sizey: 字号，可选：12、16、24、32
+ * 返 回 值: 字符点阵，不支持的字号或字符返回NULL
+ ***************************************************************/
+static const uint8_t *lcd_ascii_font(uint8_t num, uint8_t sizey)
+{
+    if ((num < ' ') || (num > '~')) {
+        return NULL;
+    }
+    
+    /* 得到偏移后的值 */
+    num = num - ' ';
+    if (sizey == LCD_FONT_SIZE12) {
+        /* 调用6x12字体 */
+        return ascii_1206[num];
+    } else if (sizey == LCD_FONT_SIZE16) {
+        /* 调用8x16字体 */
+        return ascii_1608[num];
+    } else if (sizey == LCD_FONT_SIZE24) {
+        /* 调用12x24字体 */
+        return ascii_2412[num];
+    } else if (sizey == LCD_FONT_SIZE32) {
+        /* 调用16x32字体 */
+        return ascii_3216[num];
+    }
+    
+    return NULL;
+}
+
+/***************************************************************
+ * 函数名称: lcd_glyph_slots
+ * 说    明: 字形缓存按指定字号划分的条目数目，也是非叠加模式下一次
+ *           整行发送的最大字符数
+ * 参    数:
+ *       @sizey: 字号
+ * 返 回 值: 条目数目，至少为1
+ ***************************************************************/
+static uint8_t lcd_glyph_slots(uint8_t sizey)
+{
+    uint32_t bytes = (uint32_t)X_OFFSET(sizey) * sizey * PIXEL_TO_BYTES;
+    
+    if ((bytes == 0) || (bytes > LCD_GLYPH_POOL_SIZE)) {
+        return 1;
+    }
+    if (LCD_GLYPH_POOL_SIZE / bytes > LCD_GLYPH_CACHE_NUM) {
+        return LCD_GLYPH_CACHE_NUM;
+    }
+    return (uint8_t)(LCD_GLYPH_POOL_SIZE / bytes);
+}
+
+/***************************************************************
+ * 函数名称: lcd_glyph_get
+ * 说    明: 从字形缓存取得已展开为RGB565的字形，缓存未命中时展开点阵
+ *           并替换最久未使用的条目。字号改变时清空缓存，按新字号重新
+ *           划分像素池
+ * 参    数:
+ *       @num：ASCII字符
+ *       @fc: 字的颜色
+ *       @bc: 字的背景色
+ *       @sizey: 字号，可选：12、16、24、32
+ * 返 回 值: 字形像素（RGB565高字节在前），不支持的字号或字符返回NULL
+ ***************************************************************/
+static const uint8_t *lcd_glyph_get(uint8_t num, uint16_t fc, uint16_t bc, uint8_t sizey)
+{
+    uint8_t i, victim = 0;
+    uint8_t sizex = X_OFFSET(sizey);
+    uint16_t row, col, bytes_per_row;
+    uint16_t color;
+    uint32_t glyph_bytes = (uint32_t)sizex * sizey * PIXEL_TO_BYTES;
+    uint8_t *dst = NULL;
+    const uint8_t *font = NULL;
+    lcd_glyph_cache_t *g = NULL;
+    
+    font = lcd_ascii_font(num, sizey);
+    if (font == NULL) {
+        return NULL;
+    }
+    
+    if (sizey != m_glyph_sizey) {
+        memset(m_glyph_cache, 0, sizeof(m_glyph_cache));
+        m_glyph_sizey = sizey;
+        m_glyph_num = lcd_glyph_slots(sizey);
+    }
+    
+    m_glyph_clock++;
+    for (i = 0; i < m_glyph_num; i++) {
+        g = &m_glyph_cache[i];
+        if ((g->stamp != 0) && (g->ch == num) && (g->fc == fc) && (g->bc == bc)) {
+            g->stamp = m_glyph_clock;
+            return &m_glyph_pool[i * glyph_bytes];
+        }
+        if (g->stamp < m_glyph_cache[victim].stamp) {
+            victim = i;
+        }
+    }
+    
+    /* 展开点阵，每行占用整数个字节，低位在前 */
+    g = &m_glyph_cache[victim];
+    bytes_per_row = sizex / BYTE_TO_BITS + ((sizex % BYTE_TO_BITS) ? 1 : 0);
+    dst = &m_glyph_pool[victim * glyph_bytes];
+    for (row = 0; row < sizey; row++) {
+        for (col = 0; col < sizex; col++) {
+            color = (font[row * bytes_per_row + col / BYTE_TO_BITS] & (0x01 << (col % BYTE_TO_BITS))) ? fc : bc;
+            *dst++ = UINT16_TO_H(color);
+            *dst++ = UINT16_TO_L(color);
+        }
+    }
+    
+    g->ch = num;
+    g->fc = fc;
+    g->bc = bc;
+    g->stamp = m_glyph_clock;
+    return &m_glyph_pool[victim * glyph_bytes];
+}
+
+/***************************************************************
+ * 函数名称: lcd_show_ascii_run
+ * 说    明: 非叠加模式下把一串ASCII字符作为一个显示窗口逐行发送，
+ *           同一批字符的字形都是最近使用的，不会被互相淘汰。没有字形
+ *           的字符（控制字符、不支持的字号）不显示但仍占半个字宽，
+ *           其两侧的字符分别作为显示窗口发送
+ * 参    数:
+ *       @x：起始位置X坐标
+ *       @y：起始位置Y坐标
+ *       @p：ASCII字符
+ *       @n：字符数目，不超过lcd_glyph_slots(sizey)
+ *       @fc: 字的颜色
+ *       @bc: 字的背景色
+ *       @sizey: 字号，可选：12、16、24、32
+ * 返 回 值: 无
+ ***************************************************************/
+static void lcd_show_ascii_run(uint16_t x, uint16_t y, const uint8_t *p, uint8_t n, uint16_t fc, uint16_t bc, uint8_t sizey)
+{
+    const uint8_t *glyphs[LCD_GLYPH_CACHE_NUM];
+    uint8_t sizex = X_OFFSET(sizey);
+    uint32_t row_bytes = (uint32_t)sizex * PIXEL_TO_BYTES;
+    uint16_t row;
+    uint8_t i, start, end;
+    
+    for (i = 0; i < n; i++) {
+        glyphs[i] = lcd_glyph_get(p[i], fc, bc, sizey);
+    }
+    
+    for (start = 0; start < n; start = end) {
+        if (glyphs[start] == NULL) {
+            end = start + 1;
+            continue;
+        }
+        end = start;
+        while ((end < n) && (glyphs[end] != NULL)) {
+            end++;
+        }
+        
+        lcd_stream_begin(x + start * sizex, y, x + end * sizex - 1, y + sizey - 1);
+        for (row = 0; row < sizey; row++) {
+            for (i = start; i < end; i++) {
+                lcd_stream_push_raw(glyphs[i] + row * row_bytes, row_bytes);
+            }
+        }
+        lcd_stream_end();
+    }
+}
+
+/***************************************************************
+ * 函数名称: lcd_init
+ * 说    明: Lcd初始化
+ * 参    数: 无
+ * 返 回 值: 返回0为成功，反之为失败
+ ***************************************************************/
+unsigned int lcd_init(void)
+{
+    unsigned int delay_msec = 100;
+    unsigned int long_delay_msec = 500;
+#if (LCD_ENABLE_SPI == LCD_BUS_SPI)
+    LzSpiDeinit(LCD_SPI_BUS);
+    
+    if (SpiIoInit(m_spiBus) != LZ_HARDWARE_SUCCESS) {
+        printf("%s, %d: SpiIoInit failed!\n", __FILE__, __LINE__);
+        return __LINE__;
+    }
+    if (LzSpiInit(LCD_SPI_BUS, m_spiConf) != LZ_HARDWARE_SUCCESS) {
+        printf("%s, %d: LzSpiInit failed!\n", __FILE__, __LINE__);
+        return __LINE__;
+    }
+#else
+    /* 初始化GPIO0_C0 */
+    LzGpioInit(LCD_PIN_CS);
+    LzGpioSetDir(LCD_PIN_CS, LZGPIO_DIR_OUT);
+    LzGpioSetVal(LCD_PIN_CS, LZGPIO_LEVEL_HIGH);
+    /* 初始化GPIO0_C1 */
+    LzGpioInit(LCD_PIN_CLK);
+    LzGpioSetDir(LCD_PIN_CLK, LZGPIO_DIR_OUT);
+    LzGpioSetVal(LCD_PIN_CLK, LZGPIO_LEVEL_LOW);
+    /* 初始化GPIO0_C2 */
     LzGpioInit(LCD_PIN_MOSI);
     LzGpioSetDir(LCD_PIN_MOSI, LZGPIO_DIR_OUT);
     LzGpioSetVal(LCD_PIN_MOSI, LZGPIO_LEVEL_LOW);
+#endif
+#if LCD_ENABLE_ASYNC
+    if (lcd_async_init() != 0) {
+        printf("%s, %d: lcd_async_init failed!\n", __FILE__, __LINE__);
+        return __LINE__;
+    }
 #endif
     /* 初始化GPIO0_C3 */
     LzGpioInit(LCD_PIN_RES);
@@ -527,16 +1201,7 @@ unsigned int lcd_init(void)
     /* 等待LCD 100ms */
     LOS_Msleep(delay_msec);
     /* 启动LCD配置，设置显示和颜色配置 */
-    lcd_wr_reg(0X36);
-    if (USE_HORIZONTAL == 0) {
-        lcd_wr_data8(0x00);
-    } else if (USE_HORIZONTAL == LCD_HORIZONTAL_MODE1) {
-        lcd_wr_data8(0xC0);
-    } else if (USE_HORIZONTAL == LCD_HORIZONTAL_MODE2) {
-        lcd_wr_data8(0x70);
-    } else {
-        lcd_wr_data8(0xA0);
-    }
+    lcd_set_rotation(m_horizontal_rotation[USE_HORIZONTAL], LCD_MIRROR_NONE);
     lcd_wr_reg(0X3A);
     lcd_wr_data8(0X05);
     /* ST7789S帧刷屏率设置 */
@@ -615,7 +1280,7 @@ unsigned int lcd_init(void)
  ***************************************************************/
 unsigned int lcd_deinit(void)
 {
-#if LCD_ENABLE_SPI
+#if (LCD_ENABLE_SPI == LCD_BUS_SPI)
     LzSpiDeinit(LCD_SPI_BUS);
 #else
     LzGpioDeinit(LCD_PIN_CS);
@@ -629,6 +1294,85 @@ unsigned int lcd_deinit(void)
 }
 
 
+/***************************************************************
+ * 函数名称: lcd_set_rotation
+ * 说    明: 设置显示方向和镜像。屏幕控制器按MADCTL寄存器的扫描方向把
+ *           窗口内的像素写入显存，改变扫描方向即可旋转和镜像，
+ *           图片等资源不需要重新编码，也不需要软件旋转。
+ *           MX、MY按写入窗口的列地址、行地址方向起作用，
+ *           因此任何方向下左右镜像都是切换MX，上下镜像都是切换MY
+ * 参    数:
+ *       @rotation：显示方向，见lcd_rotation_t
+ *       @mirror：镜像，LCD_MIRROR_X、LCD_MIRROR_Y的组合
+ * 返 回 值: 返回0为成功，反之为失败
+ ***************************************************************/
+unsigned int lcd_set_rotation(uint8_t rotation, uint8_t mirror)
+{
+    uint8_t madctl;
+    
+    if (rotation > LCD_ROTATE_270) {
+        return __LINE__;
+    }
+    
+    madctl = m_rotation_madctl[rotation];
+    if (mirror & LCD_MIRROR_X) {
+        madctl ^= MADCTL_MX;
+    }
+    if (mirror & LCD_MIRROR_Y) {
+        madctl ^= MADCTL_MY;
+    }
+    lcd_wr_reg(REG_MEMORY_ACCESS);
+    lcd_wr_data8(madctl);
+    
+    m_rotation = rotation;
+    if ((rotation == LCD_ROTATE_90) || (rotation == LCD_ROTATE_270)) {
+        m_width = LCD_PANEL_H;
+        m_height = LCD_PANEL_W;
+    } else {
+        m_width = LCD_PANEL_W;
+        m_height = LCD_PANEL_H;
+    }
+    
+    return 0;
+}
+
+
+/***************************************************************
+ * 函数名称: lcd_get_rotation
+ * 说    明: 获取当前的显示方向
+ * 参    数: 无
+ * 返 回 值: 显示方向，见lcd_rotation_t
+ ***************************************************************/
+uint8_t lcd_get_rotation(void)
+{
+    return m_rotation;
+}
+
+
+/***************************************************************
+ * 函数名称: lcd_get_width
+ * 说    明: 获取当前显示方向下LCD的宽度
+ * 参    数: 无
+ * 返 回 值: 宽度（像素）
+ ***************************************************************/
+uint16_t lcd_get_width(void)
+{
+    return m_width;
+}
+
+
+/***************************************************************
+ * 函数名称: lcd_get_height
+ * 说    明: 获取当前显示方向下LCD的高度
+ * 参    数: 无
+ * 返 回 值: 高度（像素）
+ ***************************************************************/
+uint16_t lcd_get_height(void)
+{
+    return m_height;
+}
+
+
 /***************************************************************
  * 函数名称: lcd_fill
  * 说    明: 指定区域填充颜色
@@ -642,16 +1386,11 @@ unsigned int lcd_deinit(void)
  ***************************************************************/
 void lcd_fill(uint16_t xsta, uint16_t ysta, uint16_t xend, uint16_t yend, uint16_t color)
 {
-    uint16_t i, j;
-    
     /* 设置显示范围 */
-    lcd_address_set(xsta, ysta, xend - 1, yend - 1);
+    lcd_stream_begin(xsta, ysta, xend - 1, yend - 1);
     /* 填充颜色 */
-    for (i = ysta; i < yend; i++) {
-        for (j = xsta; j < xend; j++) {
-            lcd_wr_data(color);
-        }
-    }
+    lcd_stream_push_color(color, (uint32_t)(xend - xsta) * (yend - ysta));
+    lcd_stream_end();
 }
 
 
@@ -667,8 +1406,9 @@ void lcd_fill(uint16_t xsta, uint16_t ysta, uint16_t xend, uint16_t yend, uint16
 void lcd_draw_point(uint16_t x, uint16_t y, uint16_t color)
 {
     /* 设置光标位置 */
-    lcd_address_set(x, y, x, y);
-    lcd_wr_data(color);
+    lcd_stream_begin(x, y, x, y);
+    lcd_stream_put(color);
+    lcd_stream_end();
 }
 
 
@@ -688,6 +1428,7 @@ void lcd_draw_line(uint16_t x1, uint16_t y1, uint16_t x2, uint16_t y2, uint16_t
     uint16_t t;
     int xerr = 0, yerr = 0, delta_x, delta_y, distance;
     int incx, incy, uRow, uCol;
+    int sx, sy, ex, ey; /* 当前水平或垂直线段的起点和终点 */
     
     /* 计算坐标增量 */
     delta_x = x2 - x1;
@@ -724,9 +1465,21 @@ void lcd_draw_line(uint16_t x1, uint16_t y1, uint16_t x2, uint16_t y2, uint16_t
         distance = delta_y;
     }
     
+    sx = ex = uRow;
+    sy = ey = uCol;
     for (t = 0; t < distance + 1; t++) {
-        /* 画点 */
-        lcd_draw_point(uRow, uCol, color);
+        /* 连续的点合并为水平或垂直线段，整段填充 */
+        if ((uRow == ex) && (uCol == ey)) {
+            /* 与上一个点重合 */
+        } else if ((uCol == ey) && (sy == ey) && (uRow == ex + incx)) {
+            ex = uRow;
+        } else if ((uRow == ex) && (sx == ex) && (uCol == ey + incy)) {
+            ey = uCol;
+        } else {
+            lcd_fill_span(sx, sy, ex, ey, color);
+            sx = ex = uRow;
+            sy = ey = uCol;
+        }
         xerr += delta_x;
         yerr += delta_y;
         if (xerr > distance) {
@@ -738,6 +1491,7 @@ void lcd_draw_line(uint16_t x1, uint16_t y1, uint16_t x2, uint16_t y2, uint16_t
             uCol += incy;
         }
     }
+    lcd_fill_span(sx, sy, ex, ey, color);
 }
 
 
@@ -754,10 +1508,28 @@ void lcd_draw_line(uint16_t x1, uint16_t y1, uint16_t x2, uint16_t y2, uint16_t
  ***************************************************************/
 void lcd_draw_rectangle(uint16_t x1, uint16_t y1, uint16_t x2, uint16_t y2, uint16_t color)
 {
-    lcd_draw_line(x1, y1, x2, y1, color);
-    lcd_draw_line(x1, y1, x1, y2, color);
-    lcd_draw_line(x1, y2, x2, y2, color);
-    lcd_draw_line(x2, y1, x2, y2, color);
+    /* 四条边各填充一次 */
+    lcd_fill_span(x1, y1, x2, y1, color);
+    lcd_fill_span(x1, y2, x2, y2, color);
+    lcd_fill_span(x1, y1, x1, y2, color);
+    lcd_fill_span(x2, y1, x2, y2, color);
+}
+
+
+/***************************************************************
+ * 函数名称: lcd_fill_rectangle
+ * 说    明: 指定位置画实心矩形
+ * 参    数:
+ *       @x1：指定矩形的起始点X坐标
+ *       @y1：指定矩形的起始点Y坐标
+ *       @x2：指定矩形的结束点X坐标
+ *       @y2：指定矩形的结束点Y坐标
+ *       @color：指定矩形的颜色
+ * 返 回 值: 无
+ ***************************************************************/
+void lcd_fill_rectangle(uint16_t x1, uint16_t y1, uint16_t x2, uint16_t y2, uint16_t color)
+{
+    lcd_fill_span(x1, y1, x2, y2, color);
 }
 
 
@@ -773,26 +1545,69 @@ void lcd_draw_rectangle(uint16_t x1, uint16_t y1, uint16_t x2, uint16_t y2, uint
  ***************************************************************/
 void lcd_draw_circle(uint16_t x0, uint16_t y0, uint8_t r, uint16_t color)
 {
-    int a, b;
+    lcd_circle_spans(x0, x0, y0, y0, r, color, false);
+}
+
+
+/***************************************************************
+ * 函数名称: lcd_fill_circle
+ * 说    明: 指定位置画实心圆
+ * 参    数:
+ *       @x0：指定圆的中心点X坐标
+ *       @y0：指定圆的中心点Y坐标
+ *       @r：指定圆的半径
+ *       @color：指定圆的颜色
+ * 返 回 值: 无
+ ***************************************************************/
+void lcd_fill_circle(uint16_t x0, uint16_t y0, uint8_t r, uint16_t color)
+{
+    lcd_circle_spans(x0, x0, y0, y0, r, color, true);
+}
+
+
+/***************************************************************
+ * 函数名称: lcd_draw_round_rect
+ * 说    明: 指定位置画圆角矩形
+ * 参    数:
+ *       @x1：指定矩形的起始点X坐标
+ *       @y1：指定矩形的起始点Y坐标
+ *       @x2：指定矩形的结束点X坐标
+ *       @y2：指定矩形的结束点Y坐标
+ *       @r：指定圆角的半径
+ *       @color：指定矩形的颜色
+ * 返 回 值: 无
+ ***************************************************************/
+void lcd_draw_round_rect(uint16_t x1, uint16_t y1, uint16_t x2, uint16_t y2, uint8_t r, uint16_t color)
+{
+    r = lcd_round_rect_radius(x1, y1, x2, y2, r);
     
-    a = 0;
-    b = r;
+    lcd_fill_span(x1 + r, y1, x2 - r, y1, color);
+    lcd_fill_span(x1 + r, y2, x2 - r, y2, color);
+    lcd_fill_span(x1, y1 + r, x1, y2 - r, color);
+    lcd_fill_span(x2, y1 + r, x2, y2 - r, color);
+    lcd_circle_spans(x1 + r, x2 - r, y1 + r, y2 - r, r, color, false);
+}
+
+
+/***************************************************************
+ * 函数名称: lcd_fill_round_rect
+ * 说    明: 指定位置画实心圆角矩形
+ * 参    数:
+ *       @x1：指定矩形的起始点X坐标
+ *       @y1：指定矩形的起始点Y坐标
+ *       @x2：指定矩形的结束点X坐标
+ *       @y2：指定矩形的结束点Y坐标
+ *       @r：指定圆角的半径
+ *       @color：指定矩形的颜色
+ * 返 回 值: 无
+ ***************************************************************/
+void lcd_fill_round_rect(uint16_t x1, uint16_t y1, uint16_t x2, uint16_t y2, uint8_t r, uint16_t color)
+{
+    r = lcd_round_rect_radius(x1, y1, x2, y2, r);
     
-    while (a <= b) {
-        lcd_draw_point(x0 - b, y0 - a, color);
-        lcd_draw_point(x0 + b, y0 - a, color);
-        lcd_draw_point(x0 - a, y0 + b, color);
-        lcd_draw_point(x0 - a, y0 - b, color);
-        lcd_draw_point(x0 + b, y0 + a, color);
-        lcd_draw_point(x0 + a, y0 - b, color);
-        lcd_draw_point(x0 + a, y0 + b, color);
-        lcd_draw_point(x0 - b, y0 + a, color);
-        a++;
-        /* 判断要画的点是否过远 */
-        if ((a * a + b * b) > (r * r)) {
-            b--;
-        }
-    }
+    /* 上下两个圆角之间的部分整块填充 */
+    lcd_fill_span(x1, y1 + r, x2, y2 - r, color);
+    lcd_circle_spans(x1 + r, x2 - r, y1 + r, y2 - r, r, color, true);
 }
 
 
@@ -811,26 +1626,43 @@ void lcd_draw_circle(uint16_t x0, uint16_t y0, uint8_t r, uint16_t color)
  ***************************************************************/
 void lcd_show_chinese(uint16_t x, uint16_t y, uint8_t *s, uint16_t fc, uint16_t bc, uint8_t sizey, uint8_t mode)
 {
-    uint8_t buffer[128];
-    uint32_t buffer_len = 0;
-    uint32_t len = strlen(s);
-    
-    memset(buffer, 0, sizeof(buffer));
-    /* utf8格式汉字转化为ascii格式 */
-    chinese_utf8_to_ascii(s, strlen(s), buffer, &buffer_len);
-    
-    for (uint32_t i = 0; i < buffer_len; i += CHINESE_TO_BYTES, x += sizey) {
-        if (sizey == LCD_FONT_SIZE12) {
-            lcd_show_chinese_12x12(x, y, &buffer[i], fc, bc, sizey, mode);
-        } else if (sizey == LCD_FONT_SIZE16) {
-            lcd_show_chinese_16x16(x, y, &buffer[i], fc, bc, sizey, mode);
-        } else if (sizey == LCD_FONT_SIZE24) {
-            lcd_show_chinese_24x24(x, y, &buffer[i], fc, bc, sizey, mode);
-        } else if (sizey == LCD_FONT_SIZE32) {
-            lcd_show_chinese_32x32(x, y, &buffer[i], fc, bc, sizey, mode);
-        } else {
-            return;
+    const uint8_t *p = s;
+    const uint8_t *msk = NULL;
+    const lcd_hz_font_t *font = lcd_hz_font_get(sizey);
+    uint8_t sizex = X_OFFSET(sizey);
+    uint8_t slots = lcd_glyph_slots(sizey);
+    uint8_t n, i;
+    
+    if (font == NULL) {
+        return;
+    }
+    
+    /* 边解码边显示，不复制字符串，长度不受限制 */
+    while (*p != '\0') {
+        if (*p < 0x80) {
+            /* 连续的ASCII字符按半个字宽显示，非叠加模式下合并为一个显示窗口 */
+            n = 0;
+            while ((n < slots) && (p[n] != '\0') && (p[n] < 0x80)) {
+                n++;
+            }
+            if (mode) {
+                for (i = 0; i < n; i++) {
+                    lcd_show_char(x + i * sizex, y, p[i], fc, bc, sizey, mode);
+                }
+            } else {
+                lcd_show_ascii_run(x, y, p, n, fc, bc, sizey);
+            }
+            x += n * sizex;
+            p += n;
+            continue;
+        }
+        
+        /* 字库中没有的汉字不显示，但仍占一个字宽 */
+        msk = lcd_hz_find(font, lcd_utf8_next(&p));
+        if (msk != NULL) {
+            lcd_draw_mono(x, y, msk, sizey, sizey, fc, bc, mode);
         }
+        x += sizey;
     }
 }
 
@@ -850,66 +1682,25 @@ void lcd_show_chinese(uint16_t x, uint16_t y, uint8_t *s, uint16_t fc, uint16_t
  ***************************************************************/
 void lcd_show_char(uint16_t x, uint16_t y, uint8_t num, uint16_t fc, uint16_t bc, uint8_t sizey, uint8_t mode)
 {
-    uint8_t temp, sizex, t, m = 0;
-    uint16_t i;
-    uint16_t TypefaceNum; /* 一个字符所占字节大小 */
-    uint16_t x0 = x;
-    uint16_t size_y2x = 2;
+    uint8_t sizex = X_OFFSET(sizey);
+    const uint8_t *font = NULL;
+    const uint8_t *glyph = NULL;
     
-    sizex = sizey / size_y2x;
-    TypefaceNum = (sizex / BYTE_TO_BITS + ((sizex % BYTE_TO_BITS) ? 1 : 0)) * sizey;
-    
-    /* 得到偏移后的值 */
-    num = num - ' ';
-    /* 设置光标位置 */
-    lcd_address_set(x, y, x + sizex - 1, y + sizey - 1);
-    
-    for (i = 0; i < TypefaceNum; i++) {
-        if (sizey == LCD_FONT_SIZE12) {
-            /* 调用6x12字体 */
-            temp = ascii_1206[num][i];
-        } else if (sizey == LCD_FONT_SIZE16) {
-            /* 调用8x16字体 */
-            temp = ascii_1608[num][i];
-        } else if (sizey == LCD_FONT_SIZE24) {
-            /* 调用12x24字体 */
-            temp = ascii_2412[num][i];
-        } else if (sizey == LCD_FONT_SIZE32) {
-            /* 调用16x32字体 */
-            temp = ascii_3216[num][i];
-        } else {
-            return;
-        }
-        
-        for (t = 0; t < BYTE_TO_BITS; t++) {
-            if (!mode) {
-                /* 非叠加模式 */
-                if (temp & (0x01 << t)) {
-                    lcd_wr_data(fc);
-                } else {
-                    lcd_wr_data(bc);
-                }
-                
-                m++;
-                if (m % sizex == 0) {
-                    m = 0;
-                    break;
-                }
-            } else {
-                /* 叠加模式 */
-                if (temp & (0x01 << t)) {
-                    /* 画一个点 */
-                    lcd_draw_point(x, y, fc);
-                }
-                
-                x++;
-                if ((x - x0) == sizex) {
-                    x = x0;
-                    y++;
-                    break;
-                }
-            }
+    if (!mode) {
+        /* 非叠加模式，直接发送缓存中已展开的字形 */
+        glyph = lcd_glyph_get(num, fc, bc, sizey);
+        if (glyph != NULL) {
+            lcd_stream_begin(x, y, x + sizex - 1, y + sizey - 1);
+            lcd_stream_push_raw(glyph, (uint32_t)sizex * sizey * PIXEL_TO_BYTES);
+            lcd_stream_end();
         }
+        return;
+    }
+    
+    /* 叠加模式 */
+    font = lcd_ascii_font(num, sizey);
+    if (font != NULL) {
+        lcd_draw_mono(x, y, font, sizex, sizey, fc, bc, mode);
     }
 }
 
@@ -929,11 +1720,30 @@ void lcd_show_char(uint16_t x, uint16_t y, uint8_t num, uint16_t fc, uint16_t bc
  ***************************************************************/
 void lcd_show_string(uint16_t x, uint16_t y, const uint8_t *p, uint16_t fc, uint16_t bc, uint8_t sizey, uint8_t mode)
 {
-#define X_OFFSET(sizey)         ((sizey) / 2) /* 根据字体大小偏移X轴坐标 */
+    uint8_t n;
+    uint8_t sizex = X_OFFSET(sizey);
+    uint8_t slots = lcd_glyph_slots(sizey);
+    
+    if (mode) {
+        while (*p != '\0') {
+            lcd_show_char(x, y, *p, fc, bc, sizey, mode);
+            x += sizex;
+            p++;
+        }
+        return;
+    }
+    
+    /* 非叠加模式：每次最多取缓存条目数目个字符，整行作为一个显示窗口发送，
+     * 没有字形的字符与叠加模式一样跳过
+     */
     while (*p != '\0') {
-        lcd_show_char(x, y, *p, fc, bc, sizey, mode);
-        x += X_OFFSET(sizey);
-        p++;
+        n = 0;
+        while ((n < slots) && (p[n] != '\0')) {
+            n++;
+        }
+        lcd_show_ascii_run(x, y, p, n, fc, bc, sizey);
+        x += n * sizex;
+        p += n;
     }
 }
 
@@ -988,7 +1798,6 @@ void lcd_show_int_num(uint16_t x, uint16_t y, uint16_t num, uint8_t len, uint16_
  ***************************************************************/
 void lcd_show_float_num1(uint16_t x, uint16_t y, float num, uint8_t len, uint16_t fc, uint16_t bc, uint8_t sizey)
 {
-#define X_OFFSET(sizey)         ((sizey) / 2)   /* 根据字体大小偏移X坐标移动点数 */
 #define FLOAT_TO_INT(num)       ((num) * 100)   /* 将float数值转化为int数值 */
 #define DECIMAL_TOW             2               /* 保留小数点后2个数值 */
 #define CHAR_0                  ((uint8_t)('0'))
@@ -1021,16 +1830,865 @@ void lcd_show_float_num1(uint16_t x, uint16_t y, float num, uint8_t len, uint16_
  ***************************************************************/
 void lcd_show_picture(uint16_t x, uint16_t y, uint16_t length, uint16_t width, const uint8_t *pic)
 {
-    uint16_t i, j;
-    uint32_t k = 0;
-    uint32_t unit = 2;
-    
-    lcd_address_set(x, y, x + length - 1, y + width - 1);
-    for (i = 0; i < length; i++) {
-        for (j = 0; j < width; j++) {
-            lcd_wr_data8(pic[k * unit]);
-            lcd_wr_data8(pic[k * unit + 1]);
-            k++;
-        }
+    lcd_stream_begin(x, y, x + length - 1, y + width - 1);
+    lcd_stream_push_raw(pic, (uint32_t)length * width * PIXEL_TO_BYTES);
+    lcd_stream_end();
+}
+
+
+/***************************************************************
+ * 函数名称: lcd_show_picture_rle
+ * 说    明: 显示行程编码（RLE）压缩的图片，边解码边写入像素流，
+ *           不需要额外的解压缓冲区。编码格式为若干个数据块：
+ *           控制字节最高位为1时，后跟1个像素，重复(低7位+1)次；
+ *           控制字节最高位为0时，后跟(低7位+1)个像素。
+ *           像素为RGB565，高字节在前。图片数据由
+ *           tools/lcd_image_tool.py生成
+ * 参    数:
+ *       @x：指定图片的起始位置X坐标
+ *       @y：指定图片的起始位置Y坐标
+ *       @length：指定图片的长度
+ *       @width：指定图片的宽度
+ *       @data：压缩后的图片数据
+ *       @size：压缩后的图片数据字节数
+ * 返 回 值: 无
+ ***************************************************************/
+void lcd_show_picture_rle(uint16_t x, uint16_t y, uint16_t length, uint16_t width, const uint8_t *data, uint32_t size)
+{
+    uint32_t pixels = (uint32_t)length * width;
+    uint32_t pos = 0;
+    uint32_t count;
+    uint8_t ctrl;
+    
+    lcd_stream_begin(x, y, x + length - 1, y + width - 1);
+    while (pixels > 0 && pos < size) {
+        ctrl = data[pos++];
+        count = (ctrl & RLE_COUNT_MASK) + 1;
+        if (count > pixels) {
+            count = pixels;
+        }
+        
+        if (ctrl & RLE_RUN_FLAG) {
+            if (pos + PIXEL_TO_BYTES > size) {
+                break;
+            }
+            lcd_stream_push_color((uint16_t)((data[pos] << BYTE_TO_BITS) | data[pos + 1]), count);
+            pos += PIXEL_TO_BYTES;
+        } else {
+            if (pos + count * PIXEL_TO_BYTES > size) {
+                break;
+            }
+            lcd_stream_push_raw(&data[pos], count * PIXEL_TO_BYTES);
+            pos += count * PIXEL_TO_BYTES;
+        }
+        pixels -= count;
+    }
+    lcd_stream_end();
+}
+
+
+/***************************************************************
+ * 函数名称: lcd_show_indexed_picture
+ * 说    明: 显示调色板索引图片。每个像素为bpp位的调色板索引，
+ *           一个字节内靠左的像素在高位，每行占用整数个字节。
+ *           指定透明色索引时，透明像素保持屏幕原有内容
+ * 参    数:
+ *       @x：指定图片的起始位置X坐标
+ *       @y：指定图片的起始位置Y坐标
+ *       @length：指定图片的长度
+ *       @width：指定图片的宽度
+ *       @data：图片的索引数据
+ *       @bpp：每个像素的位数，可选：1、2、4、8
+ *       @palette：调色板（RGB565），至少有(1 << bpp)项
+ *       @key：透明色索引，LCD_INDEX_NO_KEY表示没有透明色
+ * 返 回 值: 无
+ ***************************************************************/
+void lcd_show_indexed_picture(uint16_t x, uint16_t y, uint16_t length, uint16_t width, const uint8_t *data, uint8_t bpp, const uint16_t *palette, uint16_t key)
+{
+    uint32_t bytes_per_row = ((uint32_t)length * bpp + BYTE_TO_BITS - 1) / BYTE_TO_BITS;
+    uint8_t mask = (uint8_t)((1 << bpp) - 1);
+    uint16_t row, col, start;
+    const uint8_t *line = NULL;
+    
+    if ((bpp != 1) && (bpp != 2) && (bpp != 4) && (bpp != BYTE_TO_BITS)) {
+        return;
+    }
+    
+#define INDEX_AT(line, col)     (((line)[((col) * bpp) / BYTE_TO_BITS] >> \
+                                  (BYTE_TO_BITS - bpp - ((col) * bpp) % BYTE_TO_BITS)) & mask)
+    if (key == LCD_INDEX_NO_KEY) {
+        lcd_stream_begin(x, y, x + length - 1, y + width - 1);
+        for (row = 0; row < width; row++) {
+            line = &data[row * bytes_per_row];
+            for (col = 0; col < length; col++) {
+                lcd_stream_put(palette[INDEX_AT(line, col)]);
+            }
+        }
+        lcd_stream_end();
+        return;
+    }
+    
+    /* 有透明色时，每行连续的不透明像素作为一个窗口写入 */
+    for (row = 0; row < width; row++) {
+        line = &data[row * bytes_per_row];
+        col = 0;
+        while (col < length) {
+            if (INDEX_AT(line, col) == key) {
+                col++;
+                continue;
+            }
+            start = col;
+            while ((col < length) && (INDEX_AT(line, col) != key)) {
+                col++;
+            }
+            lcd_stream_begin(x + start, y + row, x + col - 1, y + row);
+            for (; start < col; start++) {
+                lcd_stream_put(palette[INDEX_AT(line, start)]);
+            }
+            lcd_stream_end();
+        }
+    }
+#undef INDEX_AT
+}
+
+
+/***************************************************************
+ * 函数名称: lcd_blit
+ * 说    明: 把图片中的一个矩形区域显示到屏幕上。先把源矩形裁剪到屏幕范围，
+ *           没有透明色时整个区域作为一个窗口逐行写入；有透明色时，
+ *           每行连续的不透明像素作为一个窗口写入
+ * 参    数:
+ *       @x：显示位置X坐标，可以为负数
+ *       @y：显示位置Y坐标，可以为负数
+ *       @pic：图片的内容，RGB565高字节在前
+ *       @length：图片的长度，即每行的像素数
+ *       @sx：源矩形在图片中的X坐标
+ *       @sy：源矩形在图片中的Y坐标
+ *       @w：源矩形的宽度
+ *       @h：源矩形的高度
+ *       @key：透明色（RGB565），LCD_BLIT_NO_KEY表示没有透明色
+ * 返 回 值: 无
+ ***************************************************************/
+void lcd_blit(int16_t x, int16_t y, const uint8_t *pic, uint16_t length, uint16_t sx, uint16_t sy, uint16_t w, uint16_t h, uint32_t key)
+{
+    int32_t cw = w;
+    int32_t ch = h;
+    int32_t row, col, start;
+    const uint8_t *line = NULL;
+    
+    /* 裁剪到屏幕范围 */
+    if (x < 0) {
+        sx -= x;
+        cw += x;
+        x = 0;
+    }
+    if (y < 0) {
+        sy -= y;
+        ch += y;
+        y = 0;
+    }
+    if (x + cw > LCD_W) {
+        cw = LCD_W - x;
+    }
+    if (y + ch > LCD_H) {
+        ch = LCD_H - y;
+    }
+    if ((cw <= 0) || (ch <= 0)) {
+        return;
+    }
+    
+#define PIXEL_AT(line, col)     ((uint16_t)(((line)[(col) * PIXEL_TO_BYTES] << BYTE_TO_BITS) | \
+                                            (line)[(col) * PIXEL_TO_BYTES + 1]))
+    if (key == LCD_BLIT_NO_KEY) {
+        lcd_stream_begin(x, y, x + cw - 1, y + ch - 1);
+        for (row = 0; row < ch; row++) {
+            line = &pic[((uint32_t)(sy + row) * length + sx) * PIXEL_TO_BYTES];
+            lcd_stream_push_raw(line, (uint32_t)cw * PIXEL_TO_BYTES);
+        }
+        lcd_stream_end();
+        return;
+    }
+    
+    for (row = 0; row < ch; row++) {
+        line = &pic[((uint32_t)(sy + row) * length + sx) * PIXEL_TO_BYTES];
+        col = 0;
+        while (col < cw) {
+            if (PIXEL_AT(line, col) == key) {
+                col++;
+                continue;
+            }
+            start = col;
+            while ((col < cw) && (PIXEL_AT(line, col) != key)) {
+                col++;
+            }
+            lcd_stream_begin(x + start, y + row, x + col - 1, y + row);
+            lcd_stream_push_raw(&line[start * PIXEL_TO_BYTES], (uint32_t)(col - start) * PIXEL_TO_BYTES);
+            lcd_stream_end();
+        }
+    }
+#undef PIXEL_AT
+}
+
+
+/***************************************************************
+ * 函数名称: lcd_stream_begin
+ * 说    明: 开始像素流写入，设置显示窗口
+ * 参    数:
+ *       @x1：窗口的起始点X坐标
+ *       @y1：窗口的起始点Y坐标
+ *       @x2：窗口的结束点X坐标
+ *       @y2：窗口的结束点Y坐标
+ * 返 回 值: 无
+ ***************************************************************/
+void lcd_stream_begin(uint16_t x1, uint16_t y1, uint16_t x2, uint16_t y2)
+{
+    if (m_fb.buf != NULL) {
+        lcd_fb_commit_change();
+        m_win.x1 = x1;
+        m_win.y1 = y1;
+        m_win.x2 = x2;
+        m_win.y2 = y2;
+        m_win.cx = x1;
+        m_win.cy = y1;
+    } else {
+        lcd_address_set(x1, y1, x2, y2);
+    }
+}
+
+
+/***************************************************************
+ * 函数名称: lcd_stream_push
+ * 说    明: 往像素流写入多个像素
+ * 参    数:
+ *       @pixels：像素数组（RGB565）
+ *       @count：像素数目
+ * 返 回 值: 无
+ ***************************************************************/
+void lcd_stream_push(const uint16_t *pixels, uint32_t count)
+{
+    uint32_t i;
+    
+    for (i = 0; i < count; i++) {
+        lcd_stream_put(pixels[i]);
+    }
+}
+
+
+/***************************************************************
+ * 函数名称: lcd_stream_push_color
+ * 说    明: 往像素流写入多个相同颜色的像素
+ * 参    数:
+ *       @color：像素颜色
+ *       @count：像素数目
+ * 返 回 值: 无
+ ***************************************************************/
+void lcd_stream_push_color(uint16_t color, uint32_t count)
+{
+    if (m_fb.buf != NULL) {
+        lcd_fb_push_color(color, count);
+        return;
+    }
+    
+    while (count--) {
+        lcd_bus_put(color);
+    }
+}
+
+
+/***************************************************************
+ * 函数名称: lcd_stream_push_raw
+ * 说    明: 往像素流写入原始字节数据（RGB565高字节在前）
+ * 参    数:
+ *       @data：原始字节数据
+ *       @len：字节数目
+ * 返 回 值: 无
+ ***************************************************************/
+void lcd_stream_push_raw(const uint8_t *data, uint32_t len)
+{
+    uint32_t n;
+    
+    if (m_fb.buf != NULL) {
+        for (n = 0; n + 1 < len; n += PIXEL_TO_BYTES) {
+            lcd_fb_put((uint16_t)((data[n] << BYTE_TO_BITS) | data[n + 1]));
+        }
+        return;
+    }
+    
+    while (len > 0) {
+        n = LCD_STREAM_BUFFER_SIZE - m_stream_len;
+        if (n > len) {
+            n = len;
+        }
+        memcpy(&m_stream_buffer[m_stream_len], data, n);
+        m_stream_len += n;
+        data += n;
+        len -= n;
+        if (m_stream_len >= LCD_STREAM_BUFFER_SIZE) {
+            lcd_stream_flush();
+        }
+    }
+}
+
+
+/***************************************************************
+ * 函数名称: lcd_stream_end
+ * 说    明: 结束像素流写入，发送缓冲区中剩余的像素
+ * 参    数: 无
+ * 返 回 值: 无
+ ***************************************************************/
+void lcd_stream_end(void)
+{
+    if (m_fb.buf != NULL) {
+        lcd_fb_commit_change();
+    } else {
+        lcd_stream_flush();
+    }
+}
+
+
+/***************************************************************
+ * 函数名称: lcd_fb_slot_find
+ * 说    明: 查找记录了指定离屏缓冲区的条目
+ * 参    数:
+ *       @fb：离屏缓冲区，比较地址和覆盖区域
+ * 返 回 值: 条目，没有记录时返回NULL
+ ***************************************************************/
+static lcd_fb_t *lcd_fb_slot_find(const lcd_fb_t *fb)
+{
+    uint8_t i;
+    
+    for (i = 0; i < LCD_FB_SLOT_NUM; i++) {
+        if ((m_fb_slots[i].buf == fb->buf) && (m_fb_slots[i].x == fb->x) && (m_fb_slots[i].y == fb->y) &&
+            (m_fb_slots[i].w == fb->w) && (m_fb_slots[i].h == fb->h)) {
+            return &m_fb_slots[i];
+        }
+    }
+    
+    return NULL;
+}
+
+/***************************************************************
+ * 函数名称: lcd_fb_slot_save
+ * 说    明: 保存当前离屏缓冲区的脏矩形，同一缓冲区的旧记录被覆盖，
+ *           条目已满时替换最早保存的条目
+ * 参    数: 无
+ * 返 回 值: 无
+ ***************************************************************/
+static void lcd_fb_slot_save(void)
+{
+    lcd_fb_t *slot = NULL;
+    uint8_t i;
+    
+    if (m_fb.buf == NULL) {
+        return;
+    }
+    
+    for (i = 0; i < LCD_FB_SLOT_NUM; i++) {
+        if (m_fb_slots[i].buf == m_fb.buf) {
+            slot = &m_fb_slots[i];
+        }
+    }
+    for (i = 0; (slot == NULL) && (i < LCD_FB_SLOT_NUM); i++) {
+        if (m_fb_slots[i].buf == NULL) {
+            slot = &m_fb_slots[i];
+        }
+    }
+    if (slot == NULL) {
+        slot = &m_fb_slots[m_fb_slot_next];
+        m_fb_slot_next = (m_fb_slot_next + 1) % LCD_FB_SLOT_NUM;
+    }
+    *slot = m_fb;
+}
+
+/***************************************************************
+ * 函数名称: lcd_fb_diff_dirty
+ * 说    明: 当前离屏缓冲区的矩形r已发送到屏幕，比较另一个缓冲区中
+ *           同一区域的像素，把不一致部分的外接矩形记为其脏矩形
+ * 参    数:
+ *       @slot：另一个离屏缓冲区
+ *       @r：已发送的矩形，在当前缓冲区的覆盖范围内
+ * 返 回 值: 无
+ ***************************************************************/
+static void lcd_fb_diff_dirty(lcd_fb_t *slot, const lcd_rect_t *r)
+{
+    uint16_t x1 = (r->x1 > slot->x) ? r->x1 : slot->x;
+    uint16_t y1 = (r->y1 > slot->y) ? r->y1 : slot->y;
+    uint16_t x2 = (r->x2 < slot->x + slot->w - 1) ? r->x2 : (slot->x + slot->w - 1);
+    uint16_t y2 = (r->y2 < slot->y + slot->h - 1) ? r->y2 : (slot->y + slot->h - 1);
+    lcd_rect_t diff = {0xFFFF, 0xFFFF, 0, 0};
+    const uint16_t *a = NULL;
+    const uint16_t *b = NULL;
+    uint16_t row, first, last, n;
+    
+    if ((x1 > x2) || (y1 > y2)) {
+        return;
+    }
+    
+    /* a、b指向该行第x1列，不构造指向缓冲区之前的指针 */
+    n = x2 - x1;
+    for (row = y1; row <= y2; row++) {
+        a = &m_fb.buf[(row - m_fb.y) * m_fb.w + (x1 - m_fb.x)];
+        b = &slot->buf[(row - slot->y) * slot->w + (x1 - slot->x)];
+        for (first = 0; (first <= n) && (a[first] == b[first]); first++) {
+        }
+        if (first > n) {
+            continue;
+        }
+        for (last = n; a[last] == b[last]; last--) {
+        }
+        diff.x1 = (x1 + first < diff.x1) ? (x1 + first) : diff.x1;
+        diff.x2 = (x1 + last > diff.x2) ? (x1 + last) : diff.x2;
+        diff.y1 = (row < diff.y1) ? row : diff.y1;
+        diff.y2 = row;
+    }
+    
+    if (diff.x1 <= diff.x2) {
+        lcd_fb_add_dirty(slot, diff.x1, diff.y1, diff.x2, diff.y2);
+    }
+}
+
+/***************************************************************
+ * 函数名称: lcd_fb_sent
+ * 说    明: 当前离屏缓冲区的脏矩形已发送，屏幕上这些区域中与其他
+ *           离屏缓冲区内容不同的部分记为其他缓冲区的脏矩形
+ * 参    数: 无
+ * 返 回 值: 无
+ ***************************************************************/
+static void lcd_fb_sent(void)
+{
+    uint8_t i, k;
+    lcd_fb_t *slot = NULL;
+    
+    for (i = 0; i < LCD_FB_SLOT_NUM; i++) {
+        slot = &m_fb_slots[i];
+        if ((slot->buf == NULL) || (slot->buf == m_fb.buf)) {
+            continue;
+        }
+        for (k = 0; k < m_fb.dirty_num; k++) {
+            lcd_fb_diff_dirty(slot, &m_fb.dirty[k]);
+        }
+    }
+    m_fb.dirty_num = 0;
+}
+
+/***************************************************************
+ * 函数名称: lcd_framebuffer_enable
+ * 说    明: 启用离屏渲染，之后的绘制操作只写入离屏缓冲区，
+ *           调用lcd_flush()时才把有变化的区域发送到屏幕。
+ *           每个缓冲区（最多LCD_FB_SLOT_NUM个）各自记录脏矩形：
+ *           缓冲区首次启用或覆盖区域改变后的首次刷新发送整个区域；
+ *           再次启用时只发送该缓冲区未刷新的区域以及期间其他缓冲区
+ *           刷新过的区域，双缓冲交替使用时不必每次发送整个缓冲区
+ * 参    数:
+ *       @buf：离屏缓冲区，大小至少为width * height个像素
+ *       @x：缓冲区覆盖区域的起始点X坐标
+ *       @y：缓冲区覆盖区域的起始点Y坐标
+ *       @width：缓冲区覆盖区域的宽度
+ *       @height：缓冲区覆盖区域的高度
+ * 返 回 值: 无
+ ***************************************************************/
+void lcd_framebuffer_enable(uint16_t *buf, uint16_t x, uint16_t y, uint16_t width, uint16_t height)
+{
+    lcd_fb_t fb = {0};
+    lcd_fb_t *slot = NULL;
+    
+    /* 切换渲染目标前发送未发送的像素，保存当前缓冲区的脏矩形 */
+    lcd_stream_flush();
+    lcd_fb_commit_change();
+    lcd_fb_slot_save();
+    
+    fb.buf = buf;
+    fb.x = x;
+    fb.y = y;
+    fb.w = width;
+    fb.h = height;
+    slot = lcd_fb_slot_find(&fb);
+    if (slot != NULL) {
+        m_fb = *slot;
+    } else {
+        /* 屏幕上的内容与缓冲区不一致，首次刷新发送整个区域 */
+        m_fb = fb;
+        lcd_fb_add_dirty(&m_fb, x, y, x + width - 1, y + height - 1);
+    }
+    m_win.changed = false;
+}
+
+
+/***************************************************************
+ * 函数名称: lcd_framebuffer_disable
+ * 说    明: 关闭离屏渲染，恢复直接写屏，未刷新的区域被丢弃。
+ *           之后直接写屏的内容不会记录到离屏缓冲区中，所以清除
+ *           全部缓冲区的记录，再次启用时发送整个缓冲区
+ * 参    数: 无
+ * 返 回 值: 无
+ ***************************************************************/
+void lcd_framebuffer_disable(void)
+{
+    m_fb.buf = NULL;
+    m_fb.dirty_num = 0;
+    m_win.changed = false;
+    memset(m_fb_slots, 0, sizeof(m_fb_slots));
+}
+
+
+/***************************************************************
+ * 函数名称: lcd_fb_send
+ * 说    明: 把离屏缓冲区中的脏矩形发送到屏幕，每个脏矩形只设置一次显示窗口
+ * 参    数:
+ *       @fb：离屏缓冲区
+ *       @buf：发送用的缓冲区
+ *       @size：发送用的缓冲区大小（字节），必须是偶数
+ * 返 回 值: 无
+ ***************************************************************/
+static void lcd_fb_send(const lcd_fb_t *fb, uint8_t *buf, uint32_t size)
+{
+    uint8_t i;
+    uint16_t row, col;
+    uint32_t len = 0;
+    const uint16_t *line = NULL;
+    const lcd_rect_t *r = NULL;
+    
+    for (i = 0; i < fb->dirty_num; i++) {
+        r = &fb->dirty[i];
+        lcd_address_set(r->x1, r->y1, r->x2, r->y2);
+        for (row = r->y1; row <= r->y2; row++) {
+            line = &fb->buf[(row - fb->y) * fb->w + (r->x1 - fb->x)];
+            for (col = 0; col <= r->x2 - r->x1; col++) {
+                buf[len++] = UINT16_TO_H(line[col]);
+                buf[len++] = UINT16_TO_L(line[col]);
+                if (len >= size) {
+                    lcd_write_bus_buf(buf, len);
+                    len = 0;
+                }
+            }
+        }
+        if (len > 0) {
+            lcd_write_bus_buf(buf, len);
+            len = 0;
+        }
+    }
+}
+
+
+/***************************************************************
+ * 函数名称: lcd_flush
+ * 说    明: 把离屏缓冲区中有变化的区域发送到屏幕
+ * 参    数: 无
+ * 返 回 值: 无
+ ***************************************************************/
+void lcd_flush(void)
+{
+    if (m_fb.buf == NULL) {
+        return;
+    }
+    
+    lcd_fb_commit_change();
+    /* 发送命令时像素流缓冲区已清空，可以用作发送缓冲区 */
+    lcd_fb_send(&m_fb, m_stream_buffer, LCD_STREAM_BUFFER_SIZE);
+    lcd_fb_sent();
+}
+
+
+#if LCD_ENABLE_ASYNC
+/***************************************************************
+ * 函数名称: lcd_async_task
+ * 说    明: 后台刷新任务，发送lcd_flush_async()提交的离屏缓冲区
+ * 参    数: 无
+ * 返 回 值: 无
+ ***************************************************************/
+static void lcd_async_task(void)
+{
+    while (1) {
+        LOS_SemPend(m_async.start_sem, LOS_WAIT_FOREVER);
+        lcd_fb_send(&m_async.job, m_async.buffer, LCD_STREAM_BUFFER_SIZE);
+        if (m_async.cb != NULL) {
+            m_async.cb(m_async.arg);
+        }
+        LOS_SemPost(m_async.idle_sem);
+    }
+}
+
+
+/***************************************************************
+ * 函数名称: lcd_async_init
+ * 说    明: 创建后台刷新任务
+ * 参    数: 无
+ * 返 回 值: 返回0为成功，反之为失败
+ ***************************************************************/
+static unsigned int lcd_async_init(void)
+{
+    TSK_INIT_PARAM_S task = {0};
+    
+    if (m_async.task_id != 0) {
+        return 0;
+    }
+    if (LOS_SemCreate(0, &m_async.start_sem) != LOS_OK) {
+        return __LINE__;
+    }
+    if (LOS_SemCreate(1, &m_async.idle_sem) != LOS_OK) {
+        return __LINE__;
+    }
+    
+    task.pfnTaskEntry = (TSK_ENTRY_FUNC)lcd_async_task;
+    task.uwStackSize = LCD_ASYNC_TASK_STACK;
+    task.pcName = "lcd flush";
+    task.usTaskPrio = LCD_ASYNC_TASK_PRIO;
+    if (LOS_TaskCreate(&m_async.task_id, &task) != LOS_OK) {
+        return __LINE__;
+    }
+    
+    return 0;
+}
+#endif
+
+
+/***************************************************************
+ * 函数名称: lcd_flush_async
+ * 说    明: 把离屏缓冲区中有变化的区域交给后台刷新任务发送，立即返回。
+ *           发送完成前不能修改该缓冲区，可以调用lcd_framebuffer_enable()
+ *           切换到另一个缓冲区继续渲染。上一次的发送未完成时先等待。
+ *           未启用异步刷新（LCD_ENABLE_ASYNC为0）或后台刷新任务创建
+ *           失败时同步发送
+ * 参    数:
+ *       @cb：发送完成后的回调函数，在后台刷新任务中调用，可以为NULL
+ *       @arg：回调函数的参数
+ * 返 回 值: 无
+ ***************************************************************/
+void lcd_flush_async(lcd_flush_cb_t cb, void *arg)
+{
+#if LCD_ENABLE_ASYNC
+    /* 后台刷新任务创建失败时同步发送 */
+    if (m_async.task_id == 0) {
+        lcd_flush();
+        if (cb != NULL) {
+            cb(arg);
+        }
+        return;
+    }
+    if (m_fb.buf == NULL) {
+        return;
+    }
+    
+    lcd_fb_commit_change();
+    LOS_SemPend(m_async.idle_sem, LOS_WAIT_FOREVER);
+    m_async.job = m_fb;
+    m_async.cb = cb;
+    m_async.arg = arg;
+    lcd_fb_sent();
+    LOS_SemPost(m_async.start_sem);
+#else
+    lcd_flush();
+    if (cb != NULL) {
+        cb(arg);
+    }
+#endif
+}
+
+
+/***************************************************************
+ * 函数名称: lcd_flush_wait
+ * 说    明: 等待后台刷新任务发送完成
+ * 参    数: 无
+ * 返 回 值: 无
+ ***************************************************************/
+void lcd_flush_wait(void)
+{
+#if LCD_ENABLE_ASYNC
+    if (m_async.task_id == 0) {
+        return;
+    }
+    LOS_SemPend(m_async.idle_sem, LOS_WAIT_FOREVER);
+    LOS_SemPost(m_async.idle_sem);
+#endif
+}
+
+
+/***************************************************************
+ * 函数名称: lcd_get_bus_stats
+ * 说    明: 获取总线传输统计
+ * 参    数:
+ *       @stats：总线传输统计
+ * 返 回 值: 无
+ ***************************************************************/
+void lcd_get_bus_stats(lcd_bus_stats_t *stats)
+{
+    if (stats != NULL) {
+        LCD_STATS_LOCK();
+        *stats = m_bus_stats;
+        LCD_STATS_UNLOCK();
+    }
+}
+
+
+/***************************************************************
+ * 函数名称: lcd_reset_bus_stats
+ * 说    明: 清零总线传输统计
+ * 参    数: 无
+ * 返 回 值: 无
+ ***************************************************************/
+void lcd_reset_bus_stats(void)
+{
+    LCD_STATS_LOCK();
+    m_bus_stats.transactions = 0;
+    m_bus_stats.bytes = 0;
+    m_bus_stats.commands = 0;
+    LCD_STATS_UNLOCK();
+}
+
+
+/***************************************************************
+ * 函数名称: lcd_bus_time_us
+ * 说    明: 按指定的SPI时钟估算总线传输统计对应的传输时间
+ * 参    数:
+ *       @stats：总线传输统计
+ *       @clock：SPI时钟频率（Hz）
+ *       @overhead_ns：每次总线传输的固定开销（纳秒）
+ * 返 回 值: 估算的传输时间（微秒）
+ ***************************************************************/
+uint32_t lcd_bus_time_us(const lcd_bus_stats_t *stats, uint32_t clock, uint32_t overhead_ns)
+{
+    uint64_t ns;
+    
+    if ((stats == NULL) || (clock == 0)) {
+        return 0;
+    }
+    
+    ns = (uint64_t)stats->bytes * REG_BITS_MAXSIZE * NSEC_PER_SEC / clock;
+    ns += (uint64_t)stats->transactions * overhead_ns;
+    return (uint32_t)(ns / NSEC_PER_USEC);
+}
+
+
+/***************************************************************
+ * 函数名称: lcd_set_bus_hook
+ * 说    明: 设置总线监听函数
+ * 参    数:
+ *       @hook：总线监听函数，NULL表示取消监听
+ * 返 回 值: 无
+ ***************************************************************/
+void lcd_set_bus_hook(lcd_bus_hook_t hook)
+{
+    m_bus_hook = hook;
+}
+
+
+/***************************************************************
+ * 函数名称: lcd_set_scroll_area
+ * 说    明: 设置垂直滚动区域，顶部和底部的固定区域不滚动。
+ *           滚动按屏幕控制器的行进行，只适用于竖屏显示
+ * 参    数:
+ *       @top：顶部固定区域的行数
+ *       @height：滚动区域的行数
+ * 返 回 值: 无
+ ***************************************************************/
+void lcd_set_scroll_area(uint16_t top, uint16_t height)
+{
+    uint16_t bottom;
+    uint8_t buf[6];
+    
+    if ((uint32_t)top + height > LCD_PANEL_H) {
+        return;
+    }
+    bottom = LCD_PANEL_H - top - height;
+    
+    buf[0] = UINT16_TO_H(top);
+    buf[1] = UINT16_TO_L(top);
+    buf[2] = UINT16_TO_H(height);
+    buf[3] = UINT16_TO_L(height);
+    buf[4] = UINT16_TO_H(bottom);
+    buf[5] = UINT16_TO_L(bottom);
+    lcd_wr_reg(REG_SCROLL_AREA);
+    lcd_write_bus_buf(buf, sizeof(buf));
+}
+
+
+/***************************************************************
+ * 函数名称: lcd_set_scroll_start
+ * 说    明: 设置垂直滚动起始地址，即显示在滚动区域第一行的显存行
+ * 参    数:
+ *       @line：显存行号，范围为滚动区域内的行
+ * 返 回 值: 无
+ ***************************************************************/
+void lcd_set_scroll_start(uint16_t line)
+{
+    uint8_t buf[2];
+    
+    buf[0] = UINT16_TO_H(line);
+    buf[1] = UINT16_TO_L(line);
+    lcd_wr_reg(REG_SCROLL_START);
+    lcd_write_bus_buf(buf, sizeof(buf));
+}
+
+
+/***************************************************************
+ * 函数名称: lcd_set_bus
+ * 说    明: 切换总线方式。用模拟SPI方式（LCD_ENABLE_SPI为0或2）编译时
+ *           可以在LCD_BUS_GPIO和LCD_BUS_GPIO_REG之间切换，用于对比
+ *           两种方式的速度；硬件SPI方式编译时只能为LCD_BUS_SPI
+ * 参    数:
+ *       @bus：总线方式，LCD_BUS_GPIO、LCD_BUS_SPI或LCD_BUS_GPIO_REG
+ * 返 回 值: 返回0为成功，反之为当前编译方式不支持
+ ***************************************************************/
+unsigned int lcd_set_bus(uint8_t bus)
+{
+#if (LCD_ENABLE_SPI == LCD_BUS_SPI)
+    return (bus == LCD_BUS_SPI) ? 0 : __LINE__;
+#else
+    if ((bus != LCD_BUS_GPIO) && (bus != LCD_BUS_GPIO_REG)) {
+        return __LINE__;
+    }
+    /* 缓冲区中的像素按原来的方式发送 */
+    lcd_stream_flush();
+    m_bus = bus;
+    return 0;
+#endif
+}
+
+
+/***************************************************************
+ * 函数名称: lcd_get_bus
+ * 说    明: 取得当前的总线方式
+ * 参    数: 无
+ * 返 回 值: LCD_BUS_GPIO、LCD_BUS_SPI或LCD_BUS_GPIO_REG
+ ***************************************************************/
+uint8_t lcd_get_bus(void)
+{
+#if (LCD_ENABLE_SPI == LCD_BUS_SPI)
+    return LCD_BUS_SPI;
+#else
+    return m_bus;
+#endif
+}
+
+
+/***************************************************************
+ * 函数名称: lcd_bus_benchmark
+ * 说    明: 测量当前总线方式（lcd_get_bus()）的传输速度，
+ *           以全屏填充的方式发送数据，会覆盖屏幕内容
+ * 参    数:
+ *       @frames：全屏填充的次数
+ * 返 回 值: 每秒传输的字节数，测量时间过短时返回0
+ ***************************************************************/
+uint32_t lcd_bus_benchmark(uint16_t frames)
+{
+    lcd_bus_stats_t stats;
+    lcd_bus_stats_t end;
+    uint64_t start;
+    uint32_t msec;
+    uint32_t bytes;
+    uint16_t i;
+    
+    lcd_get_bus_stats(&stats);
+    start = LOS_TickCountGet();
+    for (i = 0; i < frames; i++) {
+        lcd_fill(0, 0, LCD_W, LCD_H, (i & 1) ? LCD_BLACK : LCD_WHITE);
+    }
+    msec = LOS_Tick2MS((uint32_t)(LOS_TickCountGet() - start));
+    lcd_get_bus_stats(&end);
+    bytes = end.bytes - stats.bytes;
+    
+    if (msec == 0) {
+        return 0;
     }
+    return (uint32_t)((uint64_t)bytes * MSEC_PER_SEC / msec);
 }
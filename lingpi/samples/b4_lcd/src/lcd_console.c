@@ -0,0 +1,279 @@
+/*
+ * Copyright (c) 2022 FuZhou Lockzhiner Electronic Co., Ltd. All rights reserved.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include <stdio.h>
+#include <stdarg.h>
+#include <stdbool.h>
+#include <string.h>
+#include "lcd.h"
+#include "lcd_console.h"
+
+/*
+ * 控制台使用屏幕控制器的硬件垂直滚动：控制台区域分为rows个槽，每个槽
+ * 显示一行文字。新的一行写入最旧的槽，再把滚动起始地址指向下一个槽，
+ * 屏幕上的内容就整体上移一行，不需要重画其他行。
+ *
+ * 写入（lcd_console_write/lcd_console_printf）只修改内存中的历史记录，
+ * 显示（lcd_console_flush）由显示任务调用，两者可以在不同的任务中运行。
+ * 只支持一个写入任务和一个显示任务。
+ */
+
+/* 可显示的ASCII字符范围 */
+#define CONSOLE_CHAR_MIN        ' '
+#define CONSOLE_CHAR_MAX        '~'
+
+static struct {
+    bool ready;
+    uint16_t y;                 /* 控制台区域的起始Y坐标 */
+    uint16_t rows;              /* 控制台区域的行数 */
+    uint16_t cols;              /* 每行的字符数 */
+    uint16_t fc;
+    uint16_t bc;
+    uint8_t sizey;
+    /* 历史记录，lines[head % LCD_CONSOLE_HISTORY]为正在写入的行 */
+    uint8_t lines[LCD_CONSOLE_HISTORY][LCD_CONSOLE_COLS_MAX];
+    uint8_t lens[LCD_CONSOLE_HISTORY];
+    volatile uint32_t head;     /* 已写完的行数，由写入任务修改 */
+    bool wrapped;               /* 上一行因写满而自动换行，紧接着的'\n'不再换行 */
+    uint32_t shown;             /* 已显示的行数，由显示任务修改 */
+    uint16_t slot;              /* 下一行显示所用的槽，也是屏幕上最旧的槽 */
+    uint16_t back;              /* 查看历史记录时往回翻的行数 */
+} m_console;
+
+/***************************************************************
+ * 函数名称: lcd_console_draw_line
+ * 说    明: 把历史记录中的一行画到指定的槽，不存在的行画为空行
+ * 参    数:
+ *       @slot：槽的序号
+ *       @index：行号
+ *       @valid：行号是否有效
+ * 返 回 值: 无
+ ***************************************************************/
+static void lcd_console_draw_line(uint16_t slot, uint32_t index, bool valid)
+{
+    uint8_t text[LCD_CONSOLE_COLS_MAX + 1];
+    uint8_t len = 0;
+    
+    if (valid) {
+        len = m_console.lens[index % LCD_CONSOLE_HISTORY];
+        memcpy(text, m_console.lines[index % LCD_CONSOLE_HISTORY], len);
+    }
+    memset(&text[len], ' ', m_console.cols - len);
+    text[m_console.cols] = '\0';
+    
+    lcd_show_string(0, m_console.y + slot * m_console.sizey, text,
+                    m_console.fc, m_console.bc, m_console.sizey, 0);
+}
+
+/***************************************************************
+ * 函数名称: lcd_console_init
+ * 说    明: 初始化滚动控制台，清空控制台区域并设置硬件垂直滚动区域
+ * 参    数:
+ *       @y：控制台区域的起始Y坐标
+ *       @height：控制台区域的高度，按字号取整为整数行
+ *       @fc：字的颜色
+ *       @bc：背景色
+ *       @sizey：字号，可选：12、16、24、32
+ * 返 回 值: 返回0为成功，反之为失败
+ ***************************************************************/
+unsigned int lcd_console_init(uint16_t y, uint16_t height, uint16_t fc, uint16_t bc, uint8_t sizey)
+{
+    uint16_t rows = height / sizey;
+    
+    if ((lcd_get_rotation() != LCD_ROTATE_0) || (rows == 0) || ((uint32_t)y + height > LCD_H)) {
+        return 1;
+    }
+    
+    memset(&m_console, 0, sizeof(m_console));
+    m_console.y = y;
+    m_console.rows = (rows >= LCD_CONSOLE_HISTORY) ? (LCD_CONSOLE_HISTORY - 1) : rows;
+    m_console.cols = LCD_W / (sizey / 2);
+    if (m_console.cols > LCD_CONSOLE_COLS_MAX) {
+        m_console.cols = LCD_CONSOLE_COLS_MAX;
+    }
+    m_console.fc = fc;
+    m_console.bc = bc;
+    m_console.sizey = sizey;
+    
+    lcd_fill(0, y, LCD_W, y + m_console.rows * sizey, bc);
+    lcd_set_scroll_area(y, m_console.rows * sizey);
+    lcd_set_scroll_start(y);
+    m_console.ready = true;
+    
+    return 0;
+}
+
+/***************************************************************
+ * 函数名称: lcd_console_deinit
+ * 说    明: 关闭滚动控制台，恢复屏幕的滚动设置
+ * 参    数: 无
+ * 返 回 值: 无
+ ***************************************************************/
+void lcd_console_deinit(void)
+{
+    if (!m_console.ready) {
+        return;
+    }
+    
+    m_console.ready = false;
+    lcd_set_scroll_area(0, LCD_PANEL_H);
+    lcd_set_scroll_start(0);
+}
+
+/***************************************************************
+ * 函数名称: lcd_console_write
+ * 说    明: 往控制台写入文本，只写入内存中的历史记录，不操作屏幕，
+ *           遇到'\n'或写满一行时换行，写满一行后紧接着的'\n'不再换行
+ * 参    数:
+ *       @str：文本
+ *       @len：文本的字节数
+ * 返 回 值: 无
+ ***************************************************************/
+void lcd_console_write(const char *str, uint32_t len)
+{
+    uint32_t head = m_console.head;
+    uint32_t cur = head % LCD_CONSOLE_HISTORY;
+    uint8_t ch;
+    
+    if (!m_console.ready) {
+        return;
+    }
+    
+    while (len--) {
+        ch = (uint8_t)*str++;
+        if (ch == '\r') {
+            continue;
+        }
+        
+        if (ch == '\n') {
+            if (m_console.wrapped) {
+                /* 正好写满一行的文本已经换过行 */
+                m_console.wrapped = false;
+                continue;
+            }
+        } else {
+            if ((ch < CONSOLE_CHAR_MIN) || (ch > CONSOLE_CHAR_MAX)) {
+                ch = ' ';
+            }
+            m_console.lines[cur][m_console.lens[cur]++] = ch;
+            m_console.wrapped = false;
+            if (m_console.lens[cur] < m_console.cols) {
+                continue;
+            }
+            m_console.wrapped = true;
+        }
+        
+        /* 当前行写完，开始新的一行 */
+        head++;
+        m_console.head = head;
+        cur = head % LCD_CONSOLE_HISTORY;
+        m_console.lens[cur] = 0;
+    }
+}
+
+/***************************************************************
+ * 函数名称: lcd_console_printf
+ * 说    明: 格式化输出到控制台，只写入内存中的历史记录，不操作屏幕
+ * 参    数:
+ *       @fmt：格式字符串
+ * 返 回 值: 无
+ ***************************************************************/
+void lcd_console_printf(const char *fmt, ...)
+{
+    char buf[LCD_CONSOLE_PRINTF_MAX];
+    va_list args;
+    int len;
+    
+    va_start(args, fmt);
+    len = vsnprintf(buf, sizeof(buf), fmt, args);
+    va_end(args);
+    
+    if (len < 0) {
+        return;
+    }
+    if (len >= (int)sizeof(buf)) {
+        len = sizeof(buf) - 1;
+    }
+    lcd_console_write(buf, len);
+}
+
+/***************************************************************
+ * 函数名称: lcd_console_flush
+ * 说    明: 把新增的行显示到屏幕。每行只重画这一行，最后修改一次滚动
+ *           起始地址；新增行数超过一屏时只显示最后一屏
+ * 参    数: 无
+ * 返 回 值: 本次显示的行数
+ ***************************************************************/
+uint32_t lcd_console_flush(void)
+{
+    uint32_t head = m_console.head;
+    uint32_t count = 0;
+    
+    if (!m_console.ready || (m_console.back != 0)) {
+        return 0;
+    }
+    
+    if (head - m_console.shown > m_console.rows) {
+        m_console.shown = head - m_console.rows;
+    }
+    while (m_console.shown != head) {
+        lcd_console_draw_line(m_console.slot, m_console.shown, true);
+        m_console.slot = (m_console.slot + 1) % m_console.rows;
+        m_console.shown++;
+        count++;
+    }
+    
+    if (count != 0) {
+        lcd_set_scroll_start(m_console.y + m_console.slot * m_console.sizey);
+    }
+    return count;
+}
+
+/***************************************************************
+ * 函数名称: lcd_console_view
+ * 说    明: 查看历史记录，重画整个控制台区域
+ * 参    数:
+ *       @back：往回翻的行数，0表示回到最新的内容并继续跟随输出
+ * 返 回 值: 无
+ ***************************************************************/
+void lcd_console_view(uint16_t back)
+{
+    uint32_t head = m_console.head;
+    uint32_t oldest = (head >= LCD_CONSOLE_HISTORY - 1) ? (head - (LCD_CONSOLE_HISTORY - 1)) : 0;
+    uint32_t newest;
+    uint32_t index;
+    uint16_t i;
+    
+    if (!m_console.ready) {
+        return;
+    }
+    
+    /* 最多翻到历史记录中最旧的一屏 */
+    if (head - oldest < m_console.rows) {
+        back = 0;
+    } else if (back > head - oldest - m_console.rows) {
+        back = head - oldest - m_console.rows;
+    }
+    m_console.back = back;
+    newest = head - back;
+    
+    for (i = 0; i < m_console.rows; i++) {
+        /* newest + i < rows时该行在第一行之前，index回绕，显示为空行 */
+        index = newest + i - (uint32_t)m_console.rows;
+        lcd_console_draw_line(i, index, (newest + i >= (uint32_t)m_console.rows) && (index >= oldest));
+    }
+    m_console.slot = 0;
+    m_console.shown = head;
+    lcd_set_scroll_start(m_console.y);
+}
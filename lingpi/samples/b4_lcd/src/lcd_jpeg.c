@@ -0,0 +1,1076 @@
+/*
+ * Copyright (c) 2022 FuZhou Lockzhiner Electronic Co., Ltd. All rights reserved.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include <stddef.h>
+#include <string.h>
+#include "lcd.h"
+#include "lcd_jpeg.h"
+
+/*
+ * 基线JPEG解码：按MCU（最小编码单元）顺序做哈夫曼解码、反量化和整数IDCT，
+ * 转换为RGB565后放入输出缓冲区，一行中相邻的若干个MCU攒满后作为一个显示
+ * 窗口发送。解码器只保存码表和一个MCU的数据，占用的内存与图片大小无关。
+ * 超出屏幕右边的MCU只做哈夫曼解码，超出屏幕下边后停止解码。
+ */
+
+/* 块的边长和像素数 */
+#define JPEG_BLOCK_SIZE         8
+#define JPEG_BLOCK_PIXELS       64
+/* 最多的颜色分量数目和采样因子 */
+#define JPEG_COMPONENTS_MAX     3
+#define JPEG_SAMPLING_MAX       2
+/* 量化表、直流和交流哈夫曼表的数目 */
+#define JPEG_QUANT_TABLES       4
+#define JPEG_HUFF_TABLES        2
+/* 哈夫曼码的最大长度，查找表直接解码的码长，每个表的最大符号数 */
+#define JPEG_HUFF_BITS          16
+#define JPEG_HUFF_LOOKUP_BITS   8
+#define JPEG_HUFF_VALUES        162
+/* 系数的最大位数 */
+#define JPEG_COEF_BITS_MAX      15
+/* 8位精度图片反量化后系数的范围，损坏的数据超出范围时限幅，避免IDCT溢出 */
+#define JPEG_COEF_MAX           2047
+#define JPEG_COEF_LIMIT(v)      (((v) > JPEG_COEF_MAX) ? JPEG_COEF_MAX : (((v) < -JPEG_COEF_MAX) ? -JPEG_COEF_MAX : (v)))
+
+/* 标记 */
+#define JPEG_MARKER             0xFF
+#define JPEG_SOF0               0xC0
+#define JPEG_SOF1               0xC1
+#define JPEG_SOF15              0xCF
+#define JPEG_DHT                0xC4
+#define JPEG_JPG                0xC8
+#define JPEG_DAC                0xCC
+#define JPEG_RST0               0xD0
+#define JPEG_RST7               0xD7
+#define JPEG_SOI                0xD8
+#define JPEG_SOS                0xDA
+#define JPEG_DQT                0xDB
+#define JPEG_DRI                0xDD
+
+/* 整数IDCT的定点位数，与libjpeg的jidctint.c相同 */
+#define IDCT_CONST_BITS         13
+#define IDCT_PASS1_BITS         2
+#define IDCT_DESCALE(x, n)      (((x) + (1 << ((n) - 1))) >> (n))
+
+#define FIX_0_298631336         2446
+#define FIX_0_390180644         3196
+#define FIX_0_541196100         4433
+#define FIX_0_765366865         6270
+#define FIX_0_899976223         7373
+#define FIX_1_175875602         9633
+#define FIX_1_501321110         12299
+#define FIX_1_847759065         15137
+#define FIX_1_961570560         16069
+#define FIX_2_053119869         16819
+#define FIX_2_562915447         20995
+#define FIX_3_072711026         25172
+
+/* YCbCr转RGB的定点系数，16位小数 */
+#define YCC_BITS                16
+#define YCC_HALF                (1 << (YCC_BITS - 1))
+#define YCC_FIX(x)              ((int32_t)((x) * (1 << YCC_BITS) + 0.5))
+#define YCC_CENTER              128
+
+/* 哈夫曼表 */
+typedef struct {
+    uint16_t lookup[1 << JPEG_HUFF_LOOKUP_BITS];    /* 前8位查找表，高8位为码长，低8位为符号，0表示码长超过8位 */
+    int32_t maxcode[JPEG_HUFF_BITS + 1];            /* 每种码长的最大码字，-1表示没有该长度的码字 */
+    uint16_t mincode[JPEG_HUFF_BITS + 1];           /* 每种码长的最小码字 */
+    uint8_t valptr[JPEG_HUFF_BITS + 1];             /* 每种码长第一个符号的下标 */
+    uint8_t values[JPEG_HUFF_VALUES];               /* 按码字排列的符号 */
+} jpeg_huff_t;
+
+/* 颜色分量 */
+typedef struct {
+    uint8_t id;
+    uint8_t h;              /* 水平采样因子 */
+    uint8_t v;              /* 垂直采样因子 */
+    uint8_t tq;             /* 量化表 */
+    uint8_t td;             /* 直流哈夫曼表 */
+    uint8_t ta;             /* 交流哈夫曼表 */
+    int16_t dc;             /* 上一个块的直流系数 */
+} jpeg_component_t;
+
+/* 解码器状态 */
+typedef struct {
+    /* 输入数据 */
+    const uint8_t *in;
+    uint32_t in_pos;
+    uint32_t in_len;
+    lcd_jpeg_read_t read;
+    void *arg;
+    bool eof;
+    /* 熵编码数据的位缓冲区 */
+    uint32_t bits;
+    uint8_t bit_cnt;
+    uint8_t marker;         /* 熵编码数据中遇到的标记，0表示没有 */
+    /* 图片参数 */
+    uint16_t width;
+    uint16_t height;
+    uint16_t restart;       /* 重启间隔，单位为MCU，0表示没有 */
+    uint8_t ncomp;
+    uint8_t hmax;
+    uint8_t vmax;
+    uint8_t chroma_scale;   /* 色度分量的缩小比例 */
+    uint8_t hs;             /* 色度分量相对亮度分量的水平、垂直缩小位数 */
+    uint8_t vs;
+    uint8_t huff_defined;   /* 已定义的哈夫曼表，每个表一位 */
+    jpeg_component_t comp[JPEG_COMPONENTS_MAX];
+    uint16_t qt[JPEG_QUANT_TABLES][JPEG_BLOCK_PIXELS];     /* 按Z字形顺序保存 */
+    jpeg_huff_t dc_tab[JPEG_HUFF_TABLES];
+    jpeg_huff_t ac_tab[JPEG_HUFF_TABLES];
+    unsigned int error;     /* 熵解码出错的代码行，0表示没有出错 */
+} jpeg_decoder_t;
+
+/* Z字形顺序到自然顺序的下标 */
+static const uint8_t m_zigzag[JPEG_BLOCK_PIXELS] = {
+    0,  1,  8,  16, 9,  2,  3,  10,
+    17, 24, 32, 25, 18, 11, 4,  5,
+    12, 19, 26, 33, 40, 48, 41, 34,
+    27, 20, 13, 6,  7,  14, 21, 28,
+    35, 42, 49, 56, 57, 50, 43, 36,
+    29, 22, 15, 23, 30, 37, 44, 51,
+    58, 59, 52, 45, 38, 31, 39, 46,
+    53, 60, 61, 54, 47, 55, 62, 63,
+};
+
+static jpeg_decoder_t m_jpeg;
+/* 流式输入缓冲区 */
+static uint8_t m_jpeg_input[LCD_JPEG_INPUT_SIZE];
+/* 输出缓冲区，保存一行中相邻若干个MCU的RGB565像素 */
+static uint16_t m_jpeg_output[LCD_JPEG_OUTPUT_SIZE / sizeof(uint16_t)];
+/* 一个MCU的Y、Cb、Cr分量，已按缩小比例缩小 */
+static uint8_t m_jpeg_y[JPEG_BLOCK_PIXELS * JPEG_SAMPLING_MAX * JPEG_SAMPLING_MAX];
+static uint8_t m_jpeg_cb[JPEG_BLOCK_PIXELS];
+static uint8_t m_jpeg_cr[JPEG_BLOCK_PIXELS];
+/* 一个块的反量化系数，以及缩小前的IDCT结果 */
+static int32_t m_jpeg_coef[JPEG_BLOCK_PIXELS];
+static uint8_t m_jpeg_block[JPEG_BLOCK_PIXELS];
+
+/***************************************************************
+ * 函数名称: jpeg_read_byte
+ * 说    明: 读取一个字节的输入数据，流式输入时缓冲区读完后调用回调函数
+ * 参    数: 无
+ * 返 回 值: 读取的字节，数据结束时返回0
+ ***************************************************************/
+static uint8_t jpeg_read_byte(void)
+{
+    if (m_jpeg.in_pos >= m_jpeg.in_len) {
+        if ((m_jpeg.read == NULL) || m_jpeg.eof) {
+            m_jpeg.eof = true;
+            return 0;
+        }
+        m_jpeg.in_len = m_jpeg.read(m_jpeg.arg, m_jpeg_input, sizeof(m_jpeg_input));
+        m_jpeg.in_pos = 0;
+        if (m_jpeg.in_len > sizeof(m_jpeg_input)) {
+            m_jpeg.in_len = sizeof(m_jpeg_input);
+        }
+        if (m_jpeg.in_len == 0) {
+            m_jpeg.eof = true;
+            return 0;
+        }
+    }
+    
+    return m_jpeg.in[m_jpeg.in_pos++];
+}
+
+/* 读取大端的16位数 */
+static uint16_t jpeg_read_u16(void)
+{
+    uint16_t hi = jpeg_read_byte();
+    
+    return (uint16_t)((hi << 8) | jpeg_read_byte());
+}
+
+/* 跳过输入数据，缓冲区中的数据直接跳过 */
+static void jpeg_skip(uint32_t len)
+{
+    uint32_t step;
+    
+    while ((len > 0) && !m_jpeg.eof) {
+        step = m_jpeg.in_len - m_jpeg.in_pos;
+        if (step == 0) {
+            jpeg_read_byte();
+            len--;
+            continue;
+        }
+        step = (step < len) ? step : len;
+        m_jpeg.in_pos += step;
+        len -= step;
+    }
+}
+
+/***************************************************************
+ * 函数名称: jpeg_huff_build
+ * 说    明: 根据每种码长的码字数目生成范式哈夫曼码表
+ * 参    数:
+ *       @h：哈夫曼表，values已经填好
+ *       @counts：码长为1~16的码字数目，下标0不使用
+ * 返 回 值: 返回0为成功，反之为失败
+ ***************************************************************/
+static unsigned int jpeg_huff_build(jpeg_huff_t *h, const uint8_t *counts)
+{
+    uint32_t code = 0;
+    uint32_t first, fill, n;
+    uint16_t k = 0;
+    uint8_t len, i;
+    
+    memset(h->lookup, 0, sizeof(h->lookup));
+    for (len = 1; len <= JPEG_HUFF_BITS; len++) {
+        h->valptr[len] = (uint8_t)k;
+        h->mincode[len] = (uint16_t)code;
+        for (i = 0; i < counts[len]; i++, k++, code++) {
+            if (code >= (1u << len)) {
+                return __LINE__;
+            }
+            if (len <= JPEG_HUFF_LOOKUP_BITS) {
+                /* 以该码字开头的所有8位前缀都解码为该符号 */
+                fill = 1u << (JPEG_HUFF_LOOKUP_BITS - len);
+                first = code << (JPEG_HUFF_LOOKUP_BITS - len);
+                for (n = 0; n < fill; n++) {
+                    h->lookup[first + n] = (uint16_t)((len << 8) | h->values[k]);
+                }
+            }
+        }
+        h->maxcode[len] = counts[len] ? (int32_t)code - 1 : -1;
+        code <<= 1;
+    }
+    
+    return 0;
+}
+
+/* 读取量化表 */
+static unsigned int jpeg_read_dqt(uint32_t len)
+{
+    uint8_t pq, tq, k;
+    uint32_t need;
+    
+    while (len > 0) {
+        pq = jpeg_read_byte();
+        tq = pq & 0x0F;
+        pq >>= 4;
+        need = 1 + (pq ? 2 : 1) * JPEG_BLOCK_PIXELS;
+        if ((tq >= JPEG_QUANT_TABLES) || (pq > 1) || (len < need)) {
+            return __LINE__;
+        }
+        for (k = 0; k < JPEG_BLOCK_PIXELS; k++) {
+            m_jpeg.qt[tq][k] = pq ? jpeg_read_u16() : jpeg_read_byte();
+        }
+        len -= need;
+    }
+    
+    return 0;
+}
+
+/* 读取哈夫曼表 */
+static unsigned int jpeg_read_dht(uint32_t len)
+{
+    uint8_t counts[JPEG_HUFF_BITS + 1];
+    uint8_t tc, th, i;
+    uint16_t total;
+    jpeg_huff_t *h = NULL;
+    unsigned int ret;
+    
+    while (len > 0) {
+        th = jpeg_read_byte();
+        tc = th >> 4;
+        th &= 0x0F;
+        if ((tc > 1) || (th >= JPEG_HUFF_TABLES) || (len < 1 + JPEG_HUFF_BITS)) {
+            return __LINE__;
+        }
+        total = 0;
+        counts[0] = 0;
+        for (i = 1; i <= JPEG_HUFF_BITS; i++) {
+            counts[i] = jpeg_read_byte();
+            total += counts[i];
+        }
+        len -= 1 + JPEG_HUFF_BITS;
+        if ((total > JPEG_HUFF_VALUES) || (total > len)) {
+            return __LINE__;
+        }
+        
+        h = tc ? &m_jpeg.ac_tab[th] : &m_jpeg.dc_tab[th];
+        for (i = 0; i < total; i++) {
+            h->values[i] = jpeg_read_byte();
+        }
+        len -= total;
+        ret = jpeg_huff_build(h, counts);
+        if (ret != 0) {
+            return ret;
+        }
+        m_jpeg.huff_defined |= 1 << (tc * JPEG_HUFF_TABLES + th);
+    }
+    
+    return 0;
+}
+
+/* 读取帧头，只支持8位精度、1个或3个分量，色度分量不能有更高的采样因子 */
+static unsigned int jpeg_read_sof(uint32_t len)
+{
+    jpeg_component_t *comp = NULL;
+    uint8_t i;
+    
+    if ((jpeg_read_byte() != 8) || (len < 6)) {
+        return __LINE__;
+    }
+    m_jpeg.height = jpeg_read_u16();
+    m_jpeg.width = jpeg_read_u16();
+    m_jpeg.ncomp = jpeg_read_byte();
+    if ((m_jpeg.width == 0) || (m_jpeg.height == 0) ||
+        ((m_jpeg.ncomp != 1) && (m_jpeg.ncomp != JPEG_COMPONENTS_MAX)) ||
+        (len != 6 + 3 * (uint32_t)m_jpeg.ncomp)) {
+        return __LINE__;
+    }
+    
+    for (i = 0; i < m_jpeg.ncomp; i++) {
+        comp = &m_jpeg.comp[i];
+        comp->id = jpeg_read_byte();
+        comp->h = jpeg_read_byte();
+        comp->v = comp->h & 0x0F;
+        comp->h >>= 4;
+        comp->tq = jpeg_read_byte();
+        if ((comp->h == 0) || (comp->h > JPEG_SAMPLING_MAX) ||
+            (comp->v == 0) || (comp->v > JPEG_SAMPLING_MAX) ||
+            (comp->tq >= JPEG_QUANT_TABLES)) {
+            return __LINE__;
+        }
+        if ((i > 0) && ((comp->h != 1) || (comp->v != 1))) {
+            return __LINE__;
+        }
+    }
+    
+    /* 只有一个分量时不交错，每个MCU就是一个块 */
+    if (m_jpeg.ncomp == 1) {
+        m_jpeg.comp[0].h = 1;
+        m_jpeg.comp[0].v = 1;
+    }
+    m_jpeg.hmax = m_jpeg.comp[0].h;
+    m_jpeg.vmax = m_jpeg.comp[0].v;
+    
+    return 0;
+}
+
+/* 读取扫描头，只支持包含全部分量的一次扫描 */
+static unsigned int jpeg_read_sos(void)
+{
+    jpeg_component_t *comp = NULL;
+    uint16_t len = jpeg_read_u16();
+    uint8_t i, t;
+    
+    if ((m_jpeg.ncomp == 0) || (jpeg_read_byte() != m_jpeg.ncomp) ||
+        (len != 6 + 2 * (uint32_t)m_jpeg.ncomp)) {
+        return __LINE__;
+    }
+    
+    for (i = 0; i < m_jpeg.ncomp; i++) {
+        comp = &m_jpeg.comp[i];
+        if (jpeg_read_byte() != comp->id) {
+            return __LINE__;
+        }
+        t = jpeg_read_byte();
+        comp->td = t >> 4;
+        comp->ta = t & 0x0F;
+        if ((comp->td >= JPEG_HUFF_TABLES) || (comp->ta >= JPEG_HUFF_TABLES) ||
+            !(m_jpeg.huff_defined & (1 << comp->td)) ||
+            !(m_jpeg.huff_defined & (1 << (JPEG_HUFF_TABLES + comp->ta)))) {
+            return __LINE__;
+        }
+    }
+    
+    /* 基线JPEG的频谱选择和逐次逼近参数固定，不需要检查 */
+    jpeg_skip(3);
+    return m_jpeg.eof ? __LINE__ : 0;
+}
+
+/***************************************************************
+ * 函数名称: jpeg_read_header
+ * 说    明: 读取SOI到SOS之间的各个段，读取完成后输入位于熵编码数据的开头
+ * 参    数: 无
+ * 返 回 值: 返回0为成功，反之为失败
+ ***************************************************************/
+static unsigned int jpeg_read_header(void)
+{
+    uint8_t marker;
+    uint16_t len;
+    unsigned int ret = 0;
+    
+    if ((jpeg_read_byte() != JPEG_MARKER) || (jpeg_read_byte() != JPEG_SOI)) {
+        return __LINE__;
+    }
+    
+    while (!m_jpeg.eof) {
+        if (jpeg_read_byte() != JPEG_MARKER) {
+            return __LINE__;
+        }
+        do {
+            marker = jpeg_read_byte();
+        } while (marker == JPEG_MARKER);
+        
+        if (marker == JPEG_SOS) {
+            return (m_jpeg.ncomp != 0) ? jpeg_read_sos() : __LINE__;
+        }
+        
+        len = jpeg_read_u16();
+        if (len < 2) {
+            return __LINE__;
+        }
+        len -= 2;
+        if (marker == JPEG_DQT) {
+            ret = jpeg_read_dqt(len);
+        } else if (marker == JPEG_DHT) {
+            ret = jpeg_read_dht(len);
+        } else if ((marker == JPEG_SOF0) || (marker == JPEG_SOF1)) {
+            ret = jpeg_read_sof(len);
+        } else if (marker == JPEG_DRI) {
+            if (len < 2) {
+                return __LINE__;
+            }
+            m_jpeg.restart = jpeg_read_u16();
+            jpeg_skip(len - 2);
+        } else if ((marker > JPEG_SOF1) && (marker <= JPEG_SOF15) &&
+                   (marker != JPEG_DHT) && (marker != JPEG_JPG) && (marker != JPEG_DAC)) {
+            /* 渐进式、无损、算术编码等不支持 */
+            return __LINE__;
+        } else {
+            jpeg_skip(len);
+        }
+        if (ret != 0) {
+            return ret;
+        }
+    }
+    
+    return __LINE__;
+}
+
+/* 向位缓冲区补充数据直到超过24位，去掉填充的0x00，遇到标记后补0 */
+static void jpeg_fill_bits(void)
+{
+    uint8_t c;
+    
+    while (m_jpeg.bit_cnt <= 24) {
+        c = 0;
+        if (m_jpeg.marker == 0) {
+            c = jpeg_read_byte();
+            if (c == JPEG_MARKER) {
+                do {
+                    c = jpeg_read_byte();
+                } while ((c == JPEG_MARKER) && !m_jpeg.eof);
+                if (c == 0) {
+                    c = JPEG_MARKER;
+                } else {
+                    m_jpeg.marker = c;
+                    c = 0;
+                }
+            }
+        }
+        m_jpeg.bits = (m_jpeg.bits << 8) | c;
+        m_jpeg.bit_cnt += 8;
+    }
+}
+
+/* 从位缓冲区取出n位，n不超过16 */
+static inline uint32_t jpeg_get_bits(uint8_t n)
+{
+    if (m_jpeg.bit_cnt < n) {
+        jpeg_fill_bits();
+    }
+    m_jpeg.bit_cnt -= n;
+    return (m_jpeg.bits >> m_jpeg.bit_cnt) & ((1u << n) - 1);
+}
+
+/***************************************************************
+ * 函数名称: jpeg_huff_decode
+ * 说    明: 解码一个哈夫曼符号，码长不超过8位时直接查表
+ * 参    数:
+ *       @h：哈夫曼表
+ * 返 回 值: 符号
+ ***************************************************************/
+static uint8_t jpeg_huff_decode(const jpeg_huff_t *h)
+{
+    uint32_t code;
+    uint16_t entry;
+    uint8_t len;
+    
+    if (m_jpeg.bit_cnt < JPEG_HUFF_BITS) {
+        jpeg_fill_bits();
+    }
+    
+    code = (m_jpeg.bits >> (m_jpeg.bit_cnt - JPEG_HUFF_LOOKUP_BITS)) & ((1u << JPEG_HUFF_LOOKUP_BITS) - 1);
+    entry = h->lookup[code];
+    if (entry != 0) {
+        m_jpeg.bit_cnt -= entry >> 8;
+        return (uint8_t)entry;
+    }
+    
+    for (len = JPEG_HUFF_LOOKUP_BITS + 1; len <= JPEG_HUFF_BITS; len++) {
+        code = (m_jpeg.bits >> (m_jpeg.bit_cnt - len)) & ((1u << len) - 1);
+        if ((int32_t)code <= h->maxcode[len]) {
+            m_jpeg.bit_cnt -= len;
+            return h->values[h->valptr[len] + code - h->mincode[len]];
+        }
+    }
+    
+    m_jpeg.error = __LINE__;
+    return 0;
+}
+
+/* 读取s位的系数并扩展符号 */
+static inline int32_t jpeg_receive(uint8_t s)
+{
+    int32_t v;
+    
+    if (s == 0) {
+        return 0;
+    }
+    if (s > JPEG_COEF_BITS_MAX) {
+        m_jpeg.error = __LINE__;
+        return 0;
+    }
+    v = (int32_t)jpeg_get_bits(s);
+    if (v < (1 << (s - 1))) {
+        v -= (1 << s) - 1;
+    }
+    return v;
+}
+
+/***************************************************************
+ * 函数名称: jpeg_decode_block
+ * 说    明: 解码一个块的系数并反量化，结果按自然顺序保存在m_jpeg_coef
+ * 参    数:
+ *       @comp：颜色分量
+ *       @need_ac：是否需要交流系数，不需要时只读取不保存
+ * 返 回 值: 有非0的交流系数时返回true
+ ***************************************************************/
+static bool jpeg_decode_block(jpeg_component_t *comp, bool need_ac)
+{
+    const uint16_t *q = m_jpeg.qt[comp->tq];
+    const jpeg_huff_t *ac_tab = &m_jpeg.ac_tab[comp->ta];
+    bool ac = false;
+    uint8_t k, rs;
+    int32_t v;
+    
+    comp->dc = (int16_t)(comp->dc + jpeg_receive(jpeg_huff_decode(&m_jpeg.dc_tab[comp->td])));
+    if (need_ac) {
+        memset(m_jpeg_coef, 0, sizeof(m_jpeg_coef));
+    }
+    m_jpeg_coef[0] = JPEG_COEF_LIMIT(comp->dc * q[0]);
+    
+    for (k = 1; k < JPEG_BLOCK_PIXELS; k++) {
+        rs = jpeg_huff_decode(ac_tab);
+        if ((rs & 0x0F) == 0) {
+            /* 0xF0表示16个0，其他表示块结束 */
+            if (rs != 0xF0) {
+                break;
+            }
+            k += 15;
+            continue;
+        }
+        k += rs >> 4;
+        v = jpeg_receive(rs & 0x0F);
+        if (k >= JPEG_BLOCK_PIXELS) {
+            m_jpeg.error = __LINE__;
+            break;
+        }
+        if (need_ac) {
+            m_jpeg_coef[m_zigzag[k]] = JPEG_COEF_LIMIT(v * q[k]);
+            ac = true;
+        }
+    }
+    
+    return ac;
+}
+
+static inline uint8_t jpeg_clamp(int32_t v)
+{
+    return (v < 0) ? 0 : ((v > UINT8_MAX) ? UINT8_MAX : (uint8_t)v);
+}
+
+/***************************************************************
+ * 函数名称: jpeg_idct
+ * 说    明: 8x8整数IDCT，算法与libjpeg的jidctint.c相同，先处理列再处理行，
+ *           全为0的列和行直接填充直流值
+ * 参    数:
+ *       @coef：按自然顺序排列的反量化系数
+ *       @out：输出的8x8像素
+ *       @stride：输出每行的字节数
+ * 返 回 值: 无
+ ***************************************************************/
+static void jpeg_idct(const int32_t *coef, uint8_t *out, uint16_t stride)
+{
+    int32_t ws[JPEG_BLOCK_PIXELS];
+    int32_t tmp0, tmp1, tmp2, tmp3, tmp10, tmp11, tmp12, tmp13;
+    int32_t z1, z2, z3, z4, z5;
+    const int32_t *in = NULL;
+    int32_t *w = NULL;
+    uint8_t i;
+    
+    /* 第一遍：处理列，结果放大2^PASS1_BITS倍 */
+    for (i = 0; i < JPEG_BLOCK_SIZE; i++) {
+        in = coef + i;
+        w = ws + i;
+        if ((in[8] | in[16] | in[24] | in[32] | in[40] | in[48] | in[56]) == 0) {
+            tmp0 = in[0] * (1 << IDCT_PASS1_BITS);
+            w[0] = w[8] = w[16] = w[24] = w[32] = w[40] = w[48] = w[56] = tmp0;
+            continue;
+        }
+        
+        z2 = in[16];
+        z3 = in[48];
+        z1 = (z2 + z3) * FIX_0_541196100;
+        tmp2 = z1 - z3 * FIX_1_847759065;
+        tmp3 = z1 + z2 * FIX_0_765366865;
+        tmp0 = (in[0] + in[32]) * (1 << IDCT_CONST_BITS);
+        tmp1 = (in[0] - in[32]) * (1 << IDCT_CONST_BITS);
+        tmp10 = tmp0 + tmp3;
+        tmp13 = tmp0 - tmp3;
+        tmp11 = tmp1 + tmp2;
+        tmp12 = tmp1 - tmp2;
+        
+        tmp0 = in[56];
+        tmp1 = in[40];
+        tmp2 = in[24];
+        tmp3 = in[8];
+        z1 = tmp0 + tmp3;
+        z2 = tmp1 + tmp2;
+        z3 = tmp0 + tmp2;
+        z4 = tmp1 + tmp3;
+        z5 = (z3 + z4) * FIX_1_175875602;
+        tmp0 *= FIX_0_298631336;
+        tmp1 *= FIX_2_053119869;
+        tmp2 *= FIX_3_072711026;
+        tmp3 *= FIX_1_501321110;
+        z1 *= -FIX_0_899976223;
+        z2 *= -FIX_2_562915447;
+        z3 = z3 * -FIX_1_961570560 + z5;
+        z4 = z4 * -FIX_0_390180644 + z5;
+        tmp0 += z1 + z3;
+        tmp1 += z2 + z4;
+        tmp2 += z2 + z3;
+        tmp3 += z1 + z4;
+        
+        w[0] = IDCT_DESCALE(tmp10 + tmp3, IDCT_CONST_BITS - IDCT_PASS1_BITS);
+        w[56] = IDCT_DESCALE(tmp10 - tmp3, IDCT_CONST_BITS - IDCT_PASS1_BITS);
+        w[8] = IDCT_DESCALE(tmp11 + tmp2, IDCT_CONST_BITS - IDCT_PASS1_BITS);
+        w[48] = IDCT_DESCALE(tmp11 - tmp2, IDCT_CONST_BITS - IDCT_PASS1_BITS);
+        w[16] = IDCT_DESCALE(tmp12 + tmp1, IDCT_CONST_BITS - IDCT_PASS1_BITS);
+        w[40] = IDCT_DESCALE(tmp12 - tmp1, IDCT_CONST_BITS - IDCT_PASS1_BITS);
+        w[24] = IDCT_DESCALE(tmp13 + tmp0, IDCT_CONST_BITS - IDCT_PASS1_BITS);
+        w[32] = IDCT_DESCALE(tmp13 - tmp0, IDCT_CONST_BITS - IDCT_PASS1_BITS);
+    }
+    
+    /* 第二遍：处理行，去掉放大倍数和8倍的缩放，加上128的电平偏移 */
+#define IDCT_OUT(x)             jpeg_clamp(IDCT_DESCALE((x), IDCT_CONST_BITS + IDCT_PASS1_BITS + 3) + YCC_CENTER)
+    for (i = 0; i < JPEG_BLOCK_SIZE; i++, out += stride) {
+        w = ws + i * JPEG_BLOCK_SIZE;
+        if ((w[1] | w[2] | w[3] | w[4] | w[5] | w[6] | w[7]) == 0) {
+            memset(out, jpeg_clamp(IDCT_DESCALE(w[0], IDCT_PASS1_BITS + 3) + YCC_CENTER), JPEG_BLOCK_SIZE);
+            continue;
+        }
+        
+        z2 = w[2];
+        z3 = w[6];
+        z1 = (z2 + z3) * FIX_0_541196100;
+        tmp2 = z1 - z3 * FIX_1_847759065;
+        tmp3 = z1 + z2 * FIX_0_765366865;
+        tmp0 = (w[0] + w[4]) * (1 << IDCT_CONST_BITS);
+        tmp1 = (w[0] - w[4]) * (1 << IDCT_CONST_BITS);
+        tmp10 = tmp0 + tmp3;
+        tmp13 = tmp0 - tmp3;
+        tmp11 = tmp1 + tmp2;
+        tmp12 = tmp1 - tmp2;
+        
+        tmp0 = w[7];
+        tmp1 = w[5];
+        tmp2 = w[3];
+        tmp3 = w[1];
+        z1 = tmp0 + tmp3;
+        z2 = tmp1 + tmp2;
+        z3 = tmp0 + tmp2;
+        z4 = tmp1 + tmp3;
+        z5 = (z3 + z4) * FIX_1_175875602;
+        tmp0 *= FIX_0_298631336;
+        tmp1 *= FIX_2_053119869;
+        tmp2 *= FIX_3_072711026;
+        tmp3 *= FIX_1_501321110;
+        z1 *= -FIX_0_899976223;
+        z2 *= -FIX_2_562915447;
+        z3 = z3 * -FIX_1_961570560 + z5;
+        z4 = z4 * -FIX_0_390180644 + z5;
+        tmp0 += z1 + z3;
+        tmp1 += z2 + z4;
+        tmp2 += z2 + z3;
+        tmp3 += z1 + z4;
+        
+        out[0] = IDCT_OUT(tmp10 + tmp3);
+        out[7] = IDCT_OUT(tmp10 - tmp3);
+        out[1] = IDCT_OUT(tmp11 + tmp2);
+        out[6] = IDCT_OUT(tmp11 - tmp2);
+        out[2] = IDCT_OUT(tmp12 + tmp1);
+        out[5] = IDCT_OUT(tmp12 - tmp1);
+        out[3] = IDCT_OUT(tmp13 + tmp0);
+        out[4] = IDCT_OUT(tmp13 - tmp0);
+    }
+#undef IDCT_OUT
+}
+
+/***************************************************************
+ * 函数名称: jpeg_block_output
+ * 说    明: 把m_jpeg_coef中的一个块变换为像素并按缩小比例缩小。
+ *           没有交流系数或缩小到1/8时只用直流系数，不做IDCT；
+ *           缩小到1/2、1/4时对IDCT结果取平均值
+ * 参    数:
+ *       @ac：是否有交流系数
+ *       @out：输出的像素
+ *       @stride：输出每行的字节数
+ *       @scale：缩小比例
+ * 返 回 值: 无
+ ***************************************************************/
+static void jpeg_block_output(bool ac, uint8_t *out, uint16_t stride, uint8_t scale)
+{
+    uint8_t size = JPEG_BLOCK_SIZE >> scale;
+    uint8_t n = 1 << scale;
+    uint8_t r, c, i, j;
+    uint32_t sum;
+    const uint8_t *p = NULL;
+    
+    if (!ac || (scale == LCD_JPEG_SCALE_1_8)) {
+        /* 直流系数是块平均值的8倍 */
+        c = jpeg_clamp(IDCT_DESCALE(m_jpeg_coef[0], 3) + YCC_CENTER);
+        for (r = 0; r < size; r++, out += stride) {
+            memset(out, c, size);
+        }
+        return;
+    }
+    
+    if (scale == LCD_JPEG_SCALE_1) {
+        jpeg_idct(m_jpeg_coef, out, stride);
+        return;
+    }
+    
+    jpeg_idct(m_jpeg_coef, m_jpeg_block, JPEG_BLOCK_SIZE);
+    for (r = 0; r < size; r++, out += stride) {
+        for (c = 0; c < size; c++) {
+            sum = 0;
+            p = m_jpeg_block + r * n * JPEG_BLOCK_SIZE + c * n;
+            for (i = 0; i < n; i++, p += JPEG_BLOCK_SIZE) {
+                for (j = 0; j < n; j++) {
+                    sum += p[j];
+                }
+            }
+            out[c] = (uint8_t)((sum + n * n / 2) >> (2 * scale));
+        }
+    }
+}
+
+/***************************************************************
+ * 函数名称: jpeg_decode_mcu
+ * 说    明: 解码一个MCU，各分量缩小后保存在m_jpeg_y、m_jpeg_cb、m_jpeg_cr
+ * 参    数:
+ *       @visible：MCU是否在屏幕内，不在屏幕内时只做哈夫曼解码
+ *       @scale：缩小比例
+ * 返 回 值: 无
+ ***************************************************************/
+static void jpeg_decode_mcu(bool visible, uint8_t scale)
+{
+    uint8_t *planes[JPEG_COMPONENTS_MAX] = {m_jpeg_y, m_jpeg_cb, m_jpeg_cr};
+    jpeg_component_t *comp = NULL;
+    uint16_t stride;
+    uint8_t i, bx, by, s, size;
+    bool ac;
+    
+    for (i = 0; i < m_jpeg.ncomp; i++) {
+        comp = &m_jpeg.comp[i];
+        s = (i == 0) ? scale : m_jpeg.chroma_scale;
+        size = JPEG_BLOCK_SIZE >> s;
+        stride = size * comp->h;
+        for (by = 0; by < comp->v; by++) {
+            for (bx = 0; bx < comp->h; bx++) {
+                ac = jpeg_decode_block(comp, visible && (s != LCD_JPEG_SCALE_1_8));
+                if (visible) {
+                    jpeg_block_output(ac, planes[i] + by * size * stride + bx * size, stride, s);
+                }
+            }
+        }
+    }
+}
+
+/* 8位RGB转RGB565 */
+#define JPEG_RGB565(r, g, b)    ((uint16_t)((((r) & 0xF8) << 8) | (((g) & 0xFC) << 3) | ((b) >> 3)))
+
+/***************************************************************
+ * 函数名称: jpeg_mcu_convert
+ * 说    明: 把一个MCU转换为RGB565，每个色度采样的三个色差项只计算一次，
+ *           按采样因子用于对应的多个亮度像素
+ * 参    数:
+ *       @out：输出缓冲区中MCU左上角的位置
+ *       @stride：输出缓冲区每行的像素数
+ *       @mw：缩小后MCU的宽度
+ *       @mh：缩小后MCU的高度
+ * 返 回 值: 无
+ ***************************************************************/
+static void jpeg_mcu_convert(uint16_t *out, uint16_t stride, uint8_t mw, uint8_t mh)
+{
+    uint8_t hn = 1 << m_jpeg.hs;
+    uint8_t cw = mw >> m_jpeg.hs;
+    const uint8_t *py = m_jpeg_y;
+    const uint8_t *pcb = NULL;
+    const uint8_t *pcr = NULL;
+    uint16_t *dst = NULL;
+    int32_t yy, cb, cr, dr, dg, db;
+    uint8_t r, c, j;
+    
+    for (r = 0; r < mh; r++, out += stride) {
+        dst = out;
+        if (m_jpeg.ncomp == 1) {
+            for (c = 0; c < mw; c++) {
+                yy = *py++;
+                *dst++ = JPEG_RGB565(yy, yy, yy);
+            }
+            continue;
+        }
+        
+        pcb = m_jpeg_cb + (r >> m_jpeg.vs) * cw;
+        pcr = m_jpeg_cr + (r >> m_jpeg.vs) * cw;
+        for (c = 0; c < cw; c++) {
+            cb = pcb[c] - YCC_CENTER;
+            cr = pcr[c] - YCC_CENTER;
+            dr = (YCC_FIX(1.402) * cr + YCC_HALF) >> YCC_BITS;
+            dg = (-YCC_FIX(0.344136) * cb - YCC_FIX(0.714136) * cr + YCC_HALF) >> YCC_BITS;
+            db = (YCC_FIX(1.772) * cb + YCC_HALF) >> YCC_BITS;
+            for (j = 0; j < hn; j++) {
+                yy = *py++;
+                *dst++ = JPEG_RGB565(jpeg_clamp(yy + dr), jpeg_clamp(yy + dg), jpeg_clamp(yy + db));
+            }
+        }
+    }
+}
+
+/* 处理重启标记：丢弃剩余的位，找到RSTn标记，直流预测值清0 */
+static void jpeg_restart(void)
+{
+    uint8_t c;
+    uint8_t i;
+    
+    m_jpeg.bits = 0;
+    m_jpeg.bit_cnt = 0;
+    while ((m_jpeg.marker == 0) && !m_jpeg.eof) {
+        if (jpeg_read_byte() != JPEG_MARKER) {
+            continue;
+        }
+        do {
+            c = jpeg_read_byte();
+        } while ((c == JPEG_MARKER) && !m_jpeg.eof);
+        m_jpeg.marker = c;
+    }
+    
+    if ((m_jpeg.marker < JPEG_RST0) || (m_jpeg.marker > JPEG_RST7)) {
+        m_jpeg.error = __LINE__;
+    }
+    m_jpeg.marker = 0;
+    for (i = 0; i < m_jpeg.ncomp; i++) {
+        m_jpeg.comp[i].dc = 0;
+    }
+}
+
+/* 发送输出缓冲区中的一块像素 */
+static void jpeg_flush(uint16_t x, uint16_t y, uint16_t w, uint16_t h, uint16_t stride)
+{
+    const uint16_t *p = m_jpeg_output;
+    uint16_t r;
+    
+    lcd_stream_begin(x, y, x + w - 1, y + h - 1);
+    for (r = 0; r < h; r++, p += stride) {
+        lcd_stream_push(p, w);
+    }
+    lcd_stream_end();
+}
+
+/***************************************************************
+ * 函数名称: jpeg_decode
+ * 说    明: 读取图片头并逐个MCU解码显示
+ * 参    数:
+ *       @x：图片左上角的X坐标
+ *       @y：图片左上角的Y坐标
+ *       @scale：缩小比例
+ * 返 回 值: 返回0为成功，反之为失败
+ ***************************************************************/
+static unsigned int jpeg_decode(uint16_t x, uint16_t y, uint8_t scale)
+{
+    uint16_t mcu_cols, mcu_rows, mx, my;
+    uint16_t vis_w, vis_h, ox, oy, rows, strip_x, stride;
+    uint16_t restart_left;
+    uint8_t mw, mh, strip_mcus, n;
+    unsigned int ret;
+    
+    if (scale > LCD_JPEG_SCALE_1_8) {
+        return __LINE__;
+    }
+    ret = jpeg_read_header();
+    if (ret != 0) {
+        return ret;
+    }
+    
+    /* 缩小后的MCU大小和图片在屏幕内的部分 */
+    mw = (JPEG_BLOCK_SIZE * m_jpeg.hmax) >> scale;
+    mh = (JPEG_BLOCK_SIZE * m_jpeg.vmax) >> scale;
+    mcu_cols = (m_jpeg.width + JPEG_BLOCK_SIZE * m_jpeg.hmax - 1) / (JPEG_BLOCK_SIZE * m_jpeg.hmax);
+    mcu_rows = (m_jpeg.height + JPEG_BLOCK_SIZE * m_jpeg.vmax - 1) / (JPEG_BLOCK_SIZE * m_jpeg.vmax);
+    vis_w = (m_jpeg.width + (1 << scale) - 1) >> scale;
+    vis_h = (m_jpeg.height + (1 << scale) - 1) >> scale;
+    if ((x >= LCD_W) || (y >= LCD_H)) {
+        return 0;
+    }
+    vis_w = (vis_w < LCD_W - x) ? vis_w : (LCD_W - x);
+    vis_h = (vis_h < LCD_H - y) ? vis_h : (LCD_H - y);
+    /* 4:2:0缩小时色度分量少缩小一半，与亮度分量大小相同，不需要上采样 */
+    m_jpeg.chroma_scale = scale;
+    m_jpeg.hs = m_jpeg.hmax - 1;
+    m_jpeg.vs = m_jpeg.vmax - 1;
+    if ((scale != LCD_JPEG_SCALE_1) && (m_jpeg.hmax == JPEG_SAMPLING_MAX) && (m_jpeg.vmax == JPEG_SAMPLING_MAX)) {
+        m_jpeg.chroma_scale = scale - 1;
+        m_jpeg.hs = 0;
+        m_jpeg.vs = 0;
+    }
+    strip_mcus = (uint8_t)(sizeof(m_jpeg_output) / sizeof(m_jpeg_output[0]) / (mw * mh));
+    stride = strip_mcus * mw;
+    
+    restart_left = m_jpeg.restart;
+    for (my = 0; my < mcu_rows; my++) {
+        oy = my * mh;
+        if (oy >= vis_h) {
+            /* 剩余部分都在屏幕下边，不再解码 */
+            break;
+        }
+        rows = (mh < vis_h - oy) ? mh : (vis_h - oy);
+        
+        strip_x = 0;
+        n = 0;
+        for (mx = 0; mx < mcu_cols; mx++) {
+            if (m_jpeg.restart != 0) {
+                if (restart_left == 0) {
+                    jpeg_restart();
+                    restart_left = m_jpeg.restart;
+                }
+                restart_left--;
+            }
+            
+            ox = mx * mw;
+            jpeg_decode_mcu(ox < vis_w, scale);
+            if (m_jpeg.error != 0) {
+                return m_jpeg.error;
+            }
+            if (ox >= vis_w) {
+                continue;
+            }
+            
+            if (n == 0) {
+                strip_x = ox;
+            }
+            jpeg_mcu_convert(m_jpeg_output + n * mw, stride, mw, mh);
+            n++;
+            if ((n == strip_mcus) || (ox + mw >= vis_w)) {
+                jpeg_flush(x + strip_x, y + oy, (n * mw < vis_w - strip_x) ? (n * mw) : (vis_w - strip_x), rows, stride);
+                n = 0;
+            }
+        }
+    }
+    
+    return m_jpeg.eof ? __LINE__ : 0;
+}
+
+/* 初始化解码器状态 */
+static void jpeg_reset(const uint8_t *data, uint32_t size, lcd_jpeg_read_t read, void *arg)
+{
+    memset(&m_jpeg, 0, sizeof(m_jpeg));
+    m_jpeg.in = (data != NULL) ? data : m_jpeg_input;
+    m_jpeg.in_len = size;
+    m_jpeg.read = read;
+    m_jpeg.arg = arg;
+}
+
+/***************************************************************
+ * 函数名称: lcd_show_jpeg
+ * 说    明: 解码内存中的JPEG图片并显示，直接从内存读取，不复制数据
+ * 参    数:
+ *       @x：图片左上角的X坐标
+ *       @y：图片左上角的Y坐标
+ *       @data：JPEG数据
+ *       @size：JPEG数据的字节数
+ *       @scale：缩小比例，见lcd_jpeg_scale_t
+ * 返 回 值: 返回0为成功，反之为失败
+ ***************************************************************/
+unsigned int lcd_show_jpeg(uint16_t x, uint16_t y, const uint8_t *data, uint32_t size, uint8_t scale)
+{
+    jpeg_reset(data, size, NULL, NULL);
+    return jpeg_decode(x, y, scale);
+}
+
+/***************************************************************
+ * 函数名称: lcd_show_jpeg_stream
+ * 说    明: 边读取边解码JPEG图片并显示
+ * 参    数:
+ *       @x：图片左上角的X坐标
+ *       @y：图片左上角的Y坐标
+ *       @read：读取数据的回调函数
+ *       @arg：传给回调函数的参数
+ *       @scale：缩小比例，见lcd_jpeg_scale_t
+ * 返 回 值: 返回0为成功，反之为失败
+ ***************************************************************/
+unsigned int lcd_show_jpeg_stream(uint16_t x, uint16_t y, lcd_jpeg_read_t read, void *arg, uint8_t scale)
+{
+    if (read == NULL) {
+        return __LINE__;
+    }
+    
+    jpeg_reset(NULL, 0, read, arg);
+    return jpeg_decode(x, y, scale);
+}
+
+/***************************************************************
+ * 函数名称: lcd_jpeg_get_size
+ * 说    明: 读取内存中JPEG图片的宽度和高度
+ * 参    数:
+ *       @data：JPEG数据
+ *       @size：JPEG数据的字节数
+ *       @width：返回图片的宽度
+ *       @height：返回图片的高度
+ * 返 回 值: 返回0为成功，反之为失败
+ ***************************************************************/
+unsigned int lcd_jpeg_get_size(const uint8_t *data, uint32_t size, uint16_t *width, uint16_t *height)
+{
+    unsigned int ret;
+    
+    jpeg_reset(data, size, NULL, NULL);
+    ret = jpeg_read_header();
+    if (ret != 0) {
+        return ret;
+    }
+    
+    *width = m_jpeg.width;
+    *height = m_jpeg.height;
+    return 0;
+}
+
+/***************************************************************
+ * 函数名称: lcd_jpeg_ram_size
+ * 说    明: 获取解码器占用的内存大小
+ * 参    数: 无
+ * 返 回 值: 解码器状态和缓冲区的字节数
+ ***************************************************************/
+uint32_t lcd_jpeg_ram_size(void)
+{
+    return sizeof(m_jpeg) + sizeof(m_jpeg_input) + sizeof(m_jpeg_output) +
+           sizeof(m_jpeg_y) + sizeof(m_jpeg_cb) + sizeof(m_jpeg_cr) +
+           sizeof(m_jpeg_coef) + sizeof(m_jpeg_block);
+}
@@ -0,0 +1,187 @@
+/*
+ * Copyright (c) 2022 FuZhou Lockzhiner Electronic Co., Ltd. All rights reserved.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "lcd.h"
+#include "lcd_scene.h"
+
+/*
+ * 条带渲染：整屏RGB565缓冲区需要LCD_W * LCD_H * 2字节，内存放不下，
+ * 因此把屏幕分成若干个LCD_SCENE_BAND_LINES行的水平条带，每次只把一个
+ * 条带作为离屏缓冲区，重放全部绘制命令，超出条带的像素由离屏渲染丢弃。
+ * 一个条带画完后交给lcd_flush_async()发送，同时在另一个缓冲区渲染
+ * 下一个条带。
+ */
+
+/* RGB565每个像素的字节数 */
+#define SCENE_PIXEL_BYTES       2
+/* 每个字节的位数 */
+#define SCENE_BYTE_BITS         8
+
+/* 条带缓冲区，按竖屏的宽度分配，横屏时每个条带的行数相应减少 */
+static uint16_t m_band[LCD_SCENE_BAND_BUFS][LCD_PANEL_W * LCD_SCENE_BAND_LINES];
+
+/***************************************************************
+ * 函数名称: lcd_scene_rows
+ * 说    明: 计算绘制命令覆盖的行范围（包含结束行）
+ * 参    数:
+ *       @cmd：绘制命令
+ *       @top：返回覆盖的第一行
+ *       @bottom：返回覆盖的最后一行
+ * 返 回 值: 无
+ ***************************************************************/
+static void lcd_scene_rows(const lcd_scene_cmd_t *cmd, int *top, int *bottom)
+{
+    switch (cmd->type) {
+        case LCD_SCENE_FILL:
+        case LCD_SCENE_LINE:
+        case LCD_SCENE_RECT:
+            *top = (cmd->y1 < cmd->y2) ? cmd->y1 : cmd->y2;
+            *bottom = (cmd->y1 < cmd->y2) ? cmd->y2 : cmd->y1;
+            break;
+        case LCD_SCENE_CIRCLE:
+        case LCD_SCENE_FILL_CIRCLE:
+            *top = (int)cmd->y1 - cmd->x2;
+            *bottom = (int)cmd->y1 + cmd->x2;
+            break;
+        case LCD_SCENE_STRING:
+        case LCD_SCENE_CHINESE:
+            *top = cmd->y1;
+            *bottom = (int)cmd->y1 + cmd->sizey - 1;
+            break;
+        default:
+            *top = cmd->y1;
+            *bottom = (int)cmd->y1 + cmd->y2 - 1;
+            break;
+    }
+}
+
+/***************************************************************
+ * 函数名称: lcd_scene_draw
+ * 说    明: 在当前条带中执行一条绘制命令。填充和未压缩的图片只绘制
+ *           与条带相交的行，其他命令完整执行，超出条带的像素被丢弃
+ * 参    数:
+ *       @cmd：绘制命令
+ *       @top：条带的第一行
+ *       @bottom：条带的最后一行
+ * 返 回 值: 无
+ ***************************************************************/
+static void lcd_scene_draw(const lcd_scene_cmd_t *cmd, int top, int bottom)
+{
+    int y1, y2;
+    uint32_t stride;
+    
+    switch (cmd->type) {
+        case LCD_SCENE_FILL:
+            y1 = (cmd->y1 < cmd->y2) ? cmd->y1 : cmd->y2;
+            y2 = (cmd->y1 < cmd->y2) ? cmd->y2 : cmd->y1;
+            y1 = (y1 > top) ? y1 : top;
+            y2 = (y2 < bottom) ? y2 : bottom;
+            lcd_fill_rectangle(cmd->x1, y1, cmd->x2, y2, cmd->fc);
+            break;
+        case LCD_SCENE_LINE:
+            lcd_draw_line(cmd->x1, cmd->y1, cmd->x2, cmd->y2, cmd->fc);
+            break;
+        case LCD_SCENE_RECT:
+            lcd_draw_rectangle(cmd->x1, cmd->y1, cmd->x2, cmd->y2, cmd->fc);
+            break;
+        case LCD_SCENE_CIRCLE:
+            lcd_draw_circle(cmd->x1, cmd->y1, (uint8_t)cmd->x2, cmd->fc);
+            break;
+        case LCD_SCENE_FILL_CIRCLE:
+            lcd_fill_circle(cmd->x1, cmd->y1, (uint8_t)cmd->x2, cmd->fc);
+            break;
+        case LCD_SCENE_STRING:
+            lcd_show_string(cmd->x1, cmd->y1, (const uint8_t *)cmd->data, cmd->fc, cmd->bc, cmd->sizey, cmd->mode);
+            break;
+        case LCD_SCENE_CHINESE:
+            lcd_show_chinese(cmd->x1, cmd->y1, (uint8_t *)cmd->data, cmd->fc, cmd->bc, cmd->sizey, cmd->mode);
+            break;
+        case LCD_SCENE_PICTURE:
+            /* 每行数据长度固定，直接定位到与条带相交的第一行 */
+            y1 = (cmd->y1 > top) ? cmd->y1 : top;
+            y2 = ((int)cmd->y1 + cmd->y2 - 1 < bottom) ? ((int)cmd->y1 + cmd->y2 - 1) : bottom;
+            stride = (uint32_t)cmd->x2 * SCENE_PIXEL_BYTES;
+            lcd_show_picture(cmd->x1, y1, cmd->x2, y2 - y1 + 1,
+                             (const uint8_t *)cmd->data + (uint32_t)(y1 - cmd->y1) * stride);
+            break;
+        case LCD_SCENE_PICTURE_RLE:
+            lcd_show_picture_rle(cmd->x1, cmd->y1, cmd->x2, cmd->y2, (const uint8_t *)cmd->data, cmd->size);
+            break;
+        case LCD_SCENE_INDEXED:
+            y1 = (cmd->y1 > top) ? cmd->y1 : top;
+            y2 = ((int)cmd->y1 + cmd->y2 - 1 < bottom) ? ((int)cmd->y1 + cmd->y2 - 1) : bottom;
+            stride = ((uint32_t)cmd->x2 * cmd->sizey + SCENE_BYTE_BITS - 1) / SCENE_BYTE_BITS;
+            lcd_show_indexed_picture(cmd->x1, y1, cmd->x2, y2 - y1 + 1,
+                                     (const uint8_t *)cmd->data + (uint32_t)(y1 - cmd->y1) * stride,
+                                     cmd->sizey, cmd->palette, cmd->fc);
+            break;
+        default:
+            break;
+    }
+}
+
+/***************************************************************
+ * 函数名称: lcd_scene_render
+ * 说    明: 按条带渲染整个屏幕
+ * 参    数:
+ *       @cmds：绘制命令数组
+ *       @num：绘制命令数目
+ *       @bc：背景色
+ * 返 回 值: 无
+ ***************************************************************/
+void lcd_scene_render(const lcd_scene_cmd_t *cmds, uint32_t num, uint16_t bc)
+{
+    uint16_t band_lines = (LCD_PANEL_W * LCD_SCENE_BAND_LINES) / LCD_W;
+    uint32_t band = 0;
+    uint32_t i;
+    int top, bottom, ctop, cbottom;
+    uint16_t lines;
+    
+    for (top = 0; top < LCD_H; top += band_lines) {
+        lines = (top + band_lines > LCD_H) ? (LCD_H - top) : band_lines;
+        bottom = top + lines - 1;
+        
+#if (LCD_SCENE_BAND_BUFS < 2)
+        /* 只有一个条带缓冲区时，等待上一个条带发送完成才能重新使用 */
+        lcd_flush_wait();
+#endif
+        /* 有多个条带缓冲区时，轮流使用，上一个条带发送时渲染下一个条带 */
+        lcd_framebuffer_enable(m_band[band], 0, top, LCD_W, lines);
+        lcd_fill(0, top, LCD_W, bottom + 1, bc);
+        for (i = 0; i < num; i++) {
+            lcd_scene_rows(&cmds[i], &ctop, &cbottom);
+            if ((ctop <= bottom) && (cbottom >= top)) {
+                lcd_scene_draw(&cmds[i], top, bottom);
+            }
+        }
+        
+        /* 启用时整个条带已记为脏区域，合并后只有一个显示窗口 */
+        lcd_flush_async(NULL, NULL);
+        band = (band + 1) % LCD_SCENE_BAND_BUFS;
+    }
+    
+    lcd_flush_wait();
+    lcd_framebuffer_disable();
+}
+
+/***************************************************************
+ * 函数名称: lcd_scene_ram_size
+ * 说    明: 获取条带缓冲区占用的内存大小
+ * 参    数: 无
+ * 返 回 值: 条带缓冲区的字节数
+ ***************************************************************/
+uint32_t lcd_scene_ram_size(void)
+{
+    return sizeof(m_band);
+}
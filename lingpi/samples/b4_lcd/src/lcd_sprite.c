@@ -0,0 +1,382 @@
+/*
+ * Copyright (c) 2022 FuZhou Lockzhiner Electronic Co., Ltd. All rights reserved.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include <stddef.h>
+#include <string.h>
+#include "lcd.h"
+#include "lcd_sprite.h"
+
+/* 每个像素的字节数 */
+#define SPRITE_PIXEL_BYTES      2
+/* 每个字节的位数 */
+#define SPRITE_BYTE_BITS        8
+
+/* 屏幕坐标系中的矩形，包含结束点，x1 > x2表示空矩形 */
+typedef struct {
+    int32_t x1;
+    int32_t y1;
+    int32_t x2;
+    int32_t y2;
+} lcd_sprite_rect_t;
+
+/* 合成一行像素的缓冲区 */
+static uint16_t m_line[LCD_SIZE_MAX];
+
+/* 取得矩形的面积，空矩形为0 */
+static uint32_t lcd_sprite_rect_area(const lcd_sprite_rect_t *r)
+{
+    if ((r->x1 > r->x2) || (r->y1 > r->y2)) {
+        return 0;
+    }
+    return (uint32_t)(r->x2 - r->x1 + 1) * (uint32_t)(r->y2 - r->y1 + 1);
+}
+
+/***************************************************************
+ * 函数名称: lcd_sprite_clip
+ * 说    明: 计算精灵在指定位置时在屏幕上可见的矩形
+ * 参    数:
+ *       @sprite：精灵
+ *       @x：精灵的X坐标
+ *       @y：精灵的Y坐标
+ *       @r：返回可见的矩形，完全在屏幕外时为空矩形
+ * 返 回 值: 无
+ ***************************************************************/
+static void lcd_sprite_clip(const lcd_sprite_t *sprite, int16_t x, int16_t y, lcd_sprite_rect_t *r)
+{
+    r->x1 = (x > 0) ? x : 0;
+    r->y1 = (y > 0) ? y : 0;
+    r->x2 = (int32_t)x + sprite->width - 1;
+    r->y2 = (int32_t)y + sprite->height - 1;
+    if (r->x2 > LCD_W - 1) {
+        r->x2 = LCD_W - 1;
+    }
+    if (r->y2 > LCD_H - 1) {
+        r->y2 = LCD_H - 1;
+    }
+}
+
+/***************************************************************
+ * 函数名称: lcd_sprite_bg_row
+ * 说    明: 读取一行背景，在精灵旧位置范围内的部分取自背景缓冲区，
+ *           其余部分通过回调函数读取
+ * 参    数:
+ *       @sprite：精灵，x、y为旧位置
+ *       @old：旧位置的可见矩形
+ *       @y：行的Y坐标
+ *       @x1：起始X坐标
+ *       @x2：结束X坐标
+ *       @pixels：背景像素
+ * 返 回 值: 无
+ ***************************************************************/
+static void lcd_sprite_bg_row(const lcd_sprite_t *sprite, const lcd_sprite_rect_t *old, int32_t y, int32_t x1, int32_t x2, uint16_t *pixels)
+{
+    int32_t s1 = (old->x1 > x1) ? old->x1 : x1;
+    int32_t s2 = (old->x2 < x2) ? old->x2 : x2;
+    
+    if ((sprite->save == NULL) || (y < old->y1) || (y > old->y2) || (s1 > s2)) {
+        sprite->bg(sprite->arg, (uint16_t)x1, (uint16_t)y, (uint16_t)(x2 - x1 + 1), pixels);
+        return;
+    }
+    
+    if (x1 < s1) {
+        sprite->bg(sprite->arg, (uint16_t)x1, (uint16_t)y, (uint16_t)(s1 - x1), pixels);
+    }
+    memcpy(&pixels[s1 - x1],
+           &sprite->save[(uint32_t)(y - sprite->y) * sprite->width + (uint32_t)(s1 - sprite->x)],
+           (uint32_t)(s2 - s1 + 1) * sizeof(uint16_t));
+    if (s2 < x2) {
+        sprite->bg(sprite->arg, (uint16_t)(s2 + 1), (uint16_t)y, (uint16_t)(x2 - s2), &pixels[s2 + 1 - x1]);
+    }
+}
+
+/***************************************************************
+ * 函数名称: lcd_sprite_compose
+ * 说    明: 合成一个窗口的内容并作为一个像素流发送：先取背景，
+ *           再把精灵新位置上的不透明像素覆盖上去
+ * 参    数:
+ *       @sprite：精灵，x、y为旧位置
+ *       @win：要发送的窗口
+ *       @old：旧位置的可见矩形
+ *       @now：新位置的可见矩形
+ *       @x：新位置X坐标
+ *       @y：新位置Y坐标
+ * 返 回 值: 无
+ ***************************************************************/
+static void lcd_sprite_compose(const lcd_sprite_t *sprite, const lcd_sprite_rect_t *win,
+                               const lcd_sprite_rect_t *old, const lcd_sprite_rect_t *now, int16_t x, int16_t y)
+{
+    int32_t s1 = (now->x1 > win->x1) ? now->x1 : win->x1;
+    int32_t s2 = (now->x2 < win->x2) ? now->x2 : win->x2;
+    int32_t row, col;
+    const uint8_t *line = NULL;
+    uint16_t color;
+    
+    lcd_stream_begin(win->x1, win->y1, win->x2, win->y2);
+    for (row = win->y1; row <= win->y2; row++) {
+        lcd_sprite_bg_row(sprite, old, row, win->x1, win->x2, m_line);
+        if ((row >= now->y1) && (row <= now->y2)) {
+            line = &sprite->pic[((uint32_t)(sprite->sy + row - y) * sprite->length + sprite->sx) * SPRITE_PIXEL_BYTES];
+            for (col = s1; col <= s2; col++) {
+                color = (uint16_t)((line[(col - x) * SPRITE_PIXEL_BYTES] << SPRITE_BYTE_BITS) |
+                                   line[(col - x) * SPRITE_PIXEL_BYTES + 1]);
+                if (color != sprite->key) {
+                    m_line[col - win->x1] = color;
+                }
+            }
+        }
+        lcd_stream_push(m_line, (uint32_t)(win->x2 - win->x1 + 1));
+    }
+    lcd_stream_end();
+}
+
+/***************************************************************
+ * 函数名称: lcd_sprite_save_under
+ * 说    明: 把背景缓冲区更新为新位置下方的背景。与旧位置重叠的部分在缓冲区内
+ *           移动，按移动方向选择行的处理顺序，保证源数据在使用前不被覆盖；
+ *           新露出的部分通过回调函数读取
+ * 参    数:
+ *       @sprite：精灵，x、y为旧位置
+ *       @old：旧位置的可见矩形
+ *       @now：新位置的可见矩形
+ *       @x：新位置X坐标
+ *       @y：新位置Y坐标
+ * 返 回 值: 无
+ ***************************************************************/
+static void lcd_sprite_save_under(const lcd_sprite_t *sprite, const lcd_sprite_rect_t *old,
+                                  const lcd_sprite_rect_t *now, int16_t x, int16_t y)
+{
+    int32_t s1 = (old->x1 > now->x1) ? old->x1 : now->x1;
+    int32_t s2 = (old->x2 < now->x2) ? old->x2 : now->x2;
+    int32_t step = (y > sprite->y) ? 1 : -1;
+    int32_t row = (step > 0) ? now->y1 : now->y2;
+    int32_t end = (step > 0) ? (now->y2 + 1) : (now->y1 - 1);
+    uint16_t *dst = NULL;
+    
+    for (; row != end; row += step) {
+        dst = &sprite->save[(uint32_t)(row - y) * sprite->width + (uint32_t)(now->x1 - x)];
+        if ((row < old->y1) || (row > old->y2) || (s1 > s2)) {
+            sprite->bg(sprite->arg, (uint16_t)now->x1, (uint16_t)row, (uint16_t)(now->x2 - now->x1 + 1), dst);
+            continue;
+        }
+        
+        memmove(&dst[s1 - now->x1],
+                &sprite->save[(uint32_t)(row - sprite->y) * sprite->width + (uint32_t)(s1 - sprite->x)],
+                (uint32_t)(s2 - s1 + 1) * sizeof(uint16_t));
+        if (now->x1 < s1) {
+            sprite->bg(sprite->arg, (uint16_t)now->x1, (uint16_t)row, (uint16_t)(s1 - now->x1), dst);
+        }
+        if (s2 < now->x2) {
+            sprite->bg(sprite->arg, (uint16_t)(s2 + 1), (uint16_t)row, (uint16_t)(now->x2 - s2), &dst[s2 + 1 - now->x1]);
+        }
+    }
+}
+
+/***************************************************************
+ * 函数名称: lcd_sprite_update
+ * 说    明: 把精灵从当前状态更新到新的位置，新旧位置的并集不大于两者面积之和时
+ *           作为一个窗口发送，否则分别发送两个窗口
+ * 参    数:
+ *       @sprite：精灵
+ *       @x：新位置X坐标
+ *       @y：新位置Y坐标
+ *       @visible：更新后是否显示
+ * 返 回 值: 无
+ ***************************************************************/
+static void lcd_sprite_update(lcd_sprite_t *sprite, int16_t x, int16_t y, bool visible)
+{
+    lcd_sprite_rect_t old = {0, 0, -1, -1};
+    lcd_sprite_rect_t now = {0, 0, -1, -1};
+    lcd_sprite_rect_t win;
+    uint32_t old_area, now_area;
+    
+    if (sprite->shown) {
+        lcd_sprite_clip(sprite, sprite->x, sprite->y, &old);
+    }
+    if (visible) {
+        lcd_sprite_clip(sprite, x, y, &now);
+    }
+    old_area = lcd_sprite_rect_area(&old);
+    now_area = lcd_sprite_rect_area(&now);
+    
+    if ((old_area > 0) && (now_area > 0)) {
+        win.x1 = (old.x1 < now.x1) ? old.x1 : now.x1;
+        win.y1 = (old.y1 < now.y1) ? old.y1 : now.y1;
+        win.x2 = (old.x2 > now.x2) ? old.x2 : now.x2;
+        win.y2 = (old.y2 > now.y2) ? old.y2 : now.y2;
+        if (lcd_sprite_rect_area(&win) <= old_area + now_area) {
+            lcd_sprite_compose(sprite, &win, &old, &now, x, y);
+            old_area = 0;
+            now_area = 0;
+        }
+    }
+    if (old_area > 0) {
+        lcd_sprite_compose(sprite, &old, &old, &now, x, y);
+    }
+    if (now_area > 0) {
+        lcd_sprite_compose(sprite, &now, &old, &now, x, y);
+    }
+    
+    /* 完全在屏幕外时没有需要保存的背景 */
+    if ((sprite->save != NULL) && (lcd_sprite_rect_area(&now) > 0) &&
+        ((x != sprite->x) || (y != sprite->y) || !sprite->shown)) {
+        lcd_sprite_save_under(sprite, &old, &now, x, y);
+    }
+    sprite->x = x;
+    sprite->y = y;
+    sprite->shown = visible;
+}
+
+/***************************************************************
+ * 函数名称: lcd_sprite_init
+ * 说    明: 初始化精灵，不立即显示。默认背景为黑色
+ * 参    数:
+ *       @sprite：精灵
+ *       @pic：图片的内容，RGB565高字节在前
+ *       @length：图片的长度，图片为精灵表时是整张表的长度
+ *       @width：精灵的宽度
+ *       @height：精灵的高度
+ *       @key：透明色（RGB565），LCD_BLIT_NO_KEY表示没有透明色
+ * 返 回 值: 无
+ ***************************************************************/
+void lcd_sprite_init(lcd_sprite_t *sprite, const uint8_t *pic, uint16_t length, uint16_t width, uint16_t height, uint32_t key)
+{
+    memset(sprite, 0, sizeof(lcd_sprite_t));
+    sprite->pic = pic;
+    sprite->length = length;
+    sprite->width = width;
+    sprite->height = height;
+    sprite->key = key;
+    sprite->bg = lcd_sprite_bg_color;
+    sprite->arg = (void *)(uintptr_t)LCD_BLACK;
+}
+
+/***************************************************************
+ * 函数名称: lcd_sprite_set_background
+ * 说    明: 设置精灵的背景，应在显示精灵之前设置
+ * 参    数:
+ *       @sprite：精灵
+ *       @save：保存精灵下方背景的缓冲区，width * height个像素，可以为NULL
+ *       @bg：读取背景的回调函数
+ *       @arg：传给回调函数的参数
+ * 返 回 值: 无
+ ***************************************************************/
+void lcd_sprite_set_background(lcd_sprite_t *sprite, uint16_t *save, lcd_sprite_bg_t bg, void *arg)
+{
+    sprite->save = save;
+    sprite->bg = bg;
+    sprite->arg = arg;
+}
+
+/***************************************************************
+ * 函数名称: lcd_sprite_move
+ * 说    明: 把精灵移动到新的位置，尚未显示时直接显示
+ * 参    数:
+ *       @sprite：精灵
+ *       @x：新位置X坐标，可以为负数
+ *       @y：新位置Y坐标，可以为负数
+ * 返 回 值: 无
+ ***************************************************************/
+void lcd_sprite_move(lcd_sprite_t *sprite, int16_t x, int16_t y)
+{
+    lcd_sprite_update(sprite, x, y, true);
+}
+
+/***************************************************************
+ * 函数名称: lcd_sprite_set_frame
+ * 说    明: 切换精灵表中的帧，已显示时在原位置重画
+ * 参    数:
+ *       @sprite：精灵
+ *       @sx：帧在图片中的X坐标
+ *       @sy：帧在图片中的Y坐标
+ * 返 回 值: 无
+ ***************************************************************/
+void lcd_sprite_set_frame(lcd_sprite_t *sprite, uint16_t sx, uint16_t sy)
+{
+    sprite->sx = sx;
+    sprite->sy = sy;
+    if (sprite->shown) {
+        lcd_sprite_update(sprite, sprite->x, sprite->y, true);
+    }
+}
+
+/***************************************************************
+ * 函数名称: lcd_sprite_hide
+ * 说    明: 隐藏精灵，恢复精灵下方的背景
+ * 参    数:
+ *       @sprite：精灵
+ * 返 回 值: 无
+ ***************************************************************/
+void lcd_sprite_hide(lcd_sprite_t *sprite)
+{
+    if (sprite->shown) {
+        lcd_sprite_update(sprite, sprite->x, sprite->y, false);
+    }
+}
+
+/***************************************************************
+ * 函数名称: lcd_sprite_bg_color
+ * 说    明: 纯色背景的回调函数
+ * 参    数:
+ *       @arg：背景色，用(void *)(uintptr_t)color传入
+ *       @x：起始位置X坐标
+ *       @y：起始位置Y坐标
+ *       @len：像素数目
+ *       @pixels：背景像素
+ * 返 回 值: 无
+ ***************************************************************/
+void lcd_sprite_bg_color(void *arg, uint16_t x, uint16_t y, uint16_t len, uint16_t *pixels)
+{
+    uint16_t color = (uint16_t)(uintptr_t)arg;
+    
+    (void)x;
+    (void)y;
+    while (len--) {
+        *pixels++ = color;
+    }
+}
+
+/***************************************************************
+ * 函数名称: lcd_sprite_bg_picture
+ * 说    明: 图片背景的回调函数，图片以外的像素为lcd_sprite_picture_t中的颜色
+ * 参    数:
+ *       @arg：图片背景，lcd_sprite_picture_t *
+ *       @x：起始位置X坐标
+ *       @y：起始位置Y坐标
+ *       @len：像素数目
+ *       @pixels：背景像素
+ * 返 回 值: 无
+ ***************************************************************/
+void lcd_sprite_bg_picture(void *arg, uint16_t x, uint16_t y, uint16_t len, uint16_t *pixels)
+{
+    const lcd_sprite_picture_t *bg = (const lcd_sprite_picture_t *)arg;
+    const uint8_t *line = NULL;
+    uint16_t i;
+    uint16_t px;
+    
+    if ((y < bg->y) || (y >= bg->y + bg->width)) {
+        lcd_sprite_bg_color((void *)(uintptr_t)bg->bc, x, y, len, pixels);
+        return;
+    }
+    
+    line = &bg->pic[(uint32_t)(y - bg->y) * bg->length * SPRITE_PIXEL_BYTES];
+    for (i = 0; i < len; i++) {
+        px = x + i;
+        if ((px < bg->x) || (px >= bg->x + bg->length)) {
+            pixels[i] = bg->bc;
+        } else {
+            pixels[i] = (uint16_t)((line[(px - bg->x) * SPRITE_PIXEL_BYTES] << SPRITE_BYTE_BITS) |
+                                   line[(px - bg->x) * SPRITE_PIXEL_BYTES + 1]);
+        }
+    }
+}
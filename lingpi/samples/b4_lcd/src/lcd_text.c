@@ -0,0 +1,254 @@
+/*
+ * Copyright (c) 2022 FuZhou Lockzhiner Electronic Co., Ltd. All rights reserved.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include <stddef.h>
+#include "lcd.h"
+#include "lcd_text.h"
+
+/* 每个字节的位数 */
+#define TEXT_BYTE_BITS          8
+/* 字符格的最大宽度 */
+#define TEXT_ADVANCE_MAX        255
+/* 字体每个像素的最大位数及对应的灰度等级数 */
+#define TEXT_BPP_MAX            4
+#define TEXT_LEVELS_MAX         (1 << TEXT_BPP_MAX)
+/* 缓存的混合色表数目 */
+#define TEXT_RAMP_NUM           4
+
+/* RGB565各分量的位置和掩码 */
+#define RGB565_R(c)             (((c) >> 11) & 0x1F)
+#define RGB565_G(c)             (((c) >> 5) & 0x3F)
+#define RGB565_B(c)             ((c) & 0x1F)
+#define RGB565(r, g, b)         ((uint16_t)(((r) << 11) | ((g) << 5) | (b)))
+
+/* 字的颜色与背景色之间的混合色表，color[0]为背景色，color[最大灰度]为字的颜色 */
+typedef struct {
+    bool valid;
+    uint8_t bpp;
+    uint16_t fc;
+    uint16_t bc;
+    uint16_t color[TEXT_LEVELS_MAX];
+} lcd_text_ramp_t;
+
+static lcd_text_ramp_t m_ramps[TEXT_RAMP_NUM];
+static uint8_t m_ramp_next = 0;
+
+/***************************************************************
+ * 函数名称: lcd_font_find
+ * 说    明: 在字形表中二分查找字符
+ * 参    数:
+ *       @font：字体
+ *       @code：字符的Unicode码点
+ * 返 回 值: 字形描述，字体中没有该字符时返回NULL
+ ***************************************************************/
+static const lcd_glyph_t *lcd_font_find(const lcd_font_t *font, uint32_t code)
+{
+    uint16_t low = 0;
+    uint16_t high = font->num;
+    uint16_t mid;
+    
+    while (low < high) {
+        mid = low + (high - low) / 2;
+        if (font->glyphs[mid].code == code) {
+            return &font->glyphs[mid];
+        }
+        if (font->glyphs[mid].code < code) {
+            low = mid + 1;
+        } else {
+            high = mid;
+        }
+    }
+    return NULL;
+}
+
+/* 从位流中取出bpp位，高位在前 */
+static inline uint8_t lcd_font_bits(const uint8_t *bitmap, uint32_t pos, uint8_t bpp)
+{
+    uint8_t shift = TEXT_BYTE_BITS - bpp - (pos % TEXT_BYTE_BITS);
+    
+    return (bitmap[pos / TEXT_BYTE_BITS] >> shift) & ((1 << bpp) - 1);
+}
+
+/***************************************************************
+ * 函数名称: lcd_text_ramp
+ * 说    明: 取得字的颜色与背景色之间的混合色表，每种颜色组合只计算一次，
+ *           最近使用的TEXT_RAMP_NUM种组合保存在缓存中
+ * 参    数:
+ *       @fc：字的颜色
+ *       @bc：字的背景色
+ *       @bpp：字体每个像素的位数
+ * 返 回 值: 混合色表，下标为灰度等级
+ ***************************************************************/
+static const uint16_t *lcd_text_ramp(uint16_t fc, uint16_t bc, uint8_t bpp)
+{
+    lcd_text_ramp_t *ramp = NULL;
+    uint8_t top = (1 << bpp) - 1;
+    uint8_t i;
+    
+    for (i = 0; i < TEXT_RAMP_NUM; i++) {
+        ramp = &m_ramps[i];
+        if (ramp->valid && (ramp->fc == fc) && (ramp->bc == bc) && (ramp->bpp == bpp)) {
+            return ramp->color;
+        }
+    }
+    
+    ramp = &m_ramps[m_ramp_next];
+    m_ramp_next = (m_ramp_next + 1) % TEXT_RAMP_NUM;
+    ramp->valid = true;
+    ramp->fc = fc;
+    ramp->bc = bc;
+    ramp->bpp = bpp;
+    /* 各分量按灰度等级线性插值，四舍五入 */
+#define RAMP_MIX(f, b)          (((f) * i + (b) * (top - i) + top / 2) / top)
+    for (i = 0; i <= top; i++) {
+        ramp->color[i] = RGB565(RAMP_MIX(RGB565_R(fc), RGB565_R(bc)),
+                                RAMP_MIX(RGB565_G(fc), RGB565_G(bc)),
+                                RAMP_MIX(RGB565_B(fc), RGB565_B(bc)));
+    }
+#undef RAMP_MIX
+    
+    return ramp->color;
+}
+
+/***************************************************************
+ * 函数名称: lcd_draw_glyph
+ * 说    明: 显示一个字形。非叠加模式下整个字符格作为一个窗口逐行写入，
+ *           灰度经混合色表换算为字的颜色与背景色之间的颜色；
+ *           叠加模式下每行连续的笔画作为一个水平线段写入
+ * 参    数:
+ *       @x：字符格的起始位置X坐标
+ *       @y：字符格的起始位置Y坐标
+ *       @font：字体
+ *       @glyph：字形描述
+ *       @fc：字的颜色
+ *       @bc：字的背景色
+ *       @mode：0为非叠加模式；1为叠加模式
+ * 返 回 值: 无
+ ***************************************************************/
+static void lcd_draw_glyph(uint16_t x, uint16_t y, const lcd_font_t *font, const lcd_glyph_t *glyph, uint16_t fc, uint16_t bc, uint8_t mode)
+{
+    uint16_t line[TEXT_ADVANCE_MAX];
+    const uint16_t *ramp = NULL;
+    uint32_t pos = glyph->offset;
+    uint8_t half = 1 << (font->bpp - 1);
+    uint8_t row, col, start;
+    bool inside;
+    
+    if (!mode) {
+        ramp = lcd_text_ramp(fc, bc, font->bpp);
+        lcd_stream_begin(x, y, x + glyph->advance - 1, y + font->height - 1);
+        for (row = 0; row < font->height; row++) {
+            inside = (row >= glyph->y) && (row < glyph->y + glyph->height);
+            for (col = 0; col < glyph->advance; col++) {
+                line[col] = bc;
+                if (inside && (col >= glyph->x) && (col < glyph->x + glyph->width)) {
+                    line[col] = ramp[lcd_font_bits(font->bitmap, pos, font->bpp)];
+                    pos += font->bpp;
+                }
+            }
+            lcd_stream_push(line, glyph->advance);
+        }
+        lcd_stream_end();
+        return;
+    }
+    
+    /* 叠加模式不知道屏幕上原有的颜色，灰度达到一半的像素显示为字的颜色 */
+    for (row = 0; row < glyph->height; row++) {
+        col = 0;
+        while (col < glyph->width) {
+            if (lcd_font_bits(font->bitmap, pos, font->bpp) < half) {
+                col++;
+                pos += font->bpp;
+                continue;
+            }
+            start = col;
+            while ((col < glyph->width) && (lcd_font_bits(font->bitmap, pos, font->bpp) >= half)) {
+                col++;
+                pos += font->bpp;
+            }
+            lcd_fill_rectangle(x + glyph->x + start, y + glyph->y + row,
+                               x + glyph->x + col - 1, y + glyph->y + row, fc);
+        }
+    }
+}
+
+/***************************************************************
+ * 函数名称: lcd_show_text
+ * 说    明: 用lcd_font_tool.py生成的字体显示UTF-8字符串，
+ *           超出屏幕右边界的字符不显示
+ * 参    数:
+ *       @x：起始位置X坐标
+ *       @y：起始位置Y坐标
+ *       @str：UTF-8字符串
+ *       @fc：字的颜色
+ *       @bc：字的背景色
+ *       @font：字体
+ *       @mode：0为非叠加模式；1为叠加模式
+ * 返 回 值: 字符串的显示宽度
+ ***************************************************************/
+uint16_t lcd_show_text(uint16_t x, uint16_t y, const char *str, uint16_t fc, uint16_t bc, const lcd_font_t *font, uint8_t mode)
+{
+    const uint8_t *p = (const uint8_t *)str;
+    const lcd_glyph_t *glyph = NULL;
+    uint16_t start = x;
+    uint16_t advance;
+    uint32_t code;
+    
+    if ((font->bpp == 0) || (font->bpp > TEXT_BPP_MAX)) {
+        return 0;
+    }
+    
+    while ((code = lcd_utf8_next(&p)) != 0) {
+        glyph = lcd_font_find(font, code);
+        advance = (glyph != NULL) ? glyph->advance : (font->height / 2);
+        if (advance == 0) {
+            continue;
+        }
+        if (x + advance > LCD_W) {
+            break;
+        }
+        
+        if (glyph != NULL) {
+            lcd_draw_glyph(x, y, font, glyph, fc, bc, mode);
+        } else if (!mode) {
+            lcd_fill(x, y, x + advance, y + font->height, bc);
+        }
+        x += advance;
+    }
+    
+    return x - start;
+}
+
+/***************************************************************
+ * 函数名称: lcd_text_width
+ * 说    明: 计算UTF-8字符串用指定字体显示时的宽度
+ * 参    数:
+ *       @str：UTF-8字符串
+ *       @font：字体
+ * 返 回 值: 字符串的显示宽度
+ ***************************************************************/
+uint16_t lcd_text_width(const char *str, const lcd_font_t *font)
+{
+    const uint8_t *p = (const uint8_t *)str;
+    const lcd_glyph_t *glyph = NULL;
+    uint32_t width = 0;
+    uint32_t code;
+    
+    while ((code = lcd_utf8_next(&p)) != 0) {
+        glyph = lcd_font_find(font, code);
+        width += (glyph != NULL) ? glyph->advance : (font->height / 2);
+    }
+    
+    return (width > UINT16_MAX) ? UINT16_MAX : (uint16_t)width;
+}
@@ -0,0 +1,287 @@
+/*
+ * Copyright (c) 2022 FuZhou Lockzhiner Electronic Co., Ltd. All rights reserved.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include <string.h>
+#include "lcd.h"
+#include "lcd_widget.h"
+
+/* 十进制的基数 */
+#define DECIMAL_BASE            10
+
+/* int32_t能表示的范围为[-2^31, 2^31) */
+#define INT32_FLOAT_LIMIT       2147483648.0f
+
+/* 小数位数对应的放大倍数 */
+static const uint32_t m_decimal_scale[LCD_NUMBER_DECIMALS_MAX + 1] = {
+    1, 10, 100, 1000, 10000
+};
+
+/***************************************************************
+ * 函数名称: lcd_label_update
+ * 说    明: 比较新旧内容，连续变化的字符作为一个字符串重画
+ * 参    数:
+ *       @label：文本标签
+ *       @cells：新的内容，长度为label->len
+ * 返 回 值: 无
+ ***************************************************************/
+static void lcd_label_update(lcd_label_t *label, const uint8_t *cells)
+{
+    uint8_t sizex = label->sizey / 2;
+    uint8_t run[LCD_LABEL_LEN_MAX + 1];
+    uint8_t i = 0;
+    uint8_t start;
+    
+    while (i < label->len) {
+        if (label->drawn && (cells[i] == label->text[i])) {
+            i++;
+            continue;
+        }
+        start = i;
+        while ((i < label->len) && (!label->drawn || (cells[i] != label->text[i]))) {
+            i++;
+        }
+        
+        memcpy(run, &cells[start], i - start);
+        run[i - start] = '\0';
+        lcd_show_string(label->x + start * sizex, label->y, run, label->fc, label->bc, label->sizey, 0);
+    }
+    
+    memcpy(label->text, cells, label->len);
+    label->drawn = true;
+}
+
+/***************************************************************
+ * 函数名称: lcd_label_init
+ * 说    明: 初始化文本标签，不立即显示
+ * 参    数:
+ *       @label：文本标签
+ *       @x：起始位置X坐标
+ *       @y：起始位置Y坐标
+ *       @len：字符格数目，最大为LCD_LABEL_LEN_MAX
+ *       @fc：字的颜色
+ *       @bc：字的背景色
+ *       @sizey：字号，可选：12、16、24、32
+ * 返 回 值: 无
+ ***************************************************************/
+void lcd_label_init(lcd_label_t *label, uint16_t x, uint16_t y, uint8_t len, uint16_t fc, uint16_t bc, uint8_t sizey)
+{
+    memset(label, 0, sizeof(lcd_label_t));
+    label->x = x;
+    label->y = y;
+    label->len = (len > LCD_LABEL_LEN_MAX) ? LCD_LABEL_LEN_MAX : len;
+    label->fc = fc;
+    label->bc = bc;
+    label->sizey = sizey;
+    label->drawn = false;
+}
+
+/***************************************************************
+ * 函数名称: lcd_label_set_text
+ * 说    明: 更新文本标签的内容，只重画与已显示内容不同的字符
+ * 参    数:
+ *       @label：文本标签
+ *       @text：新的内容，超出字符格数目的部分被截断
+ * 返 回 值: 无
+ ***************************************************************/
+void lcd_label_set_text(lcd_label_t *label, const uint8_t *text)
+{
+    uint8_t cells[LCD_LABEL_LEN_MAX];
+    uint8_t i;
+    
+    for (i = 0; i < label->len; i++) {
+        if (*text != '\0') {
+            cells[i] = *text++;
+        } else {
+            cells[i] = ' ';
+        }
+    }
+    lcd_label_update(label, cells);
+}
+
+/***************************************************************
+ * 函数名称: lcd_label_set_color
+ * 说    明: 修改文本标签的颜色，下次更新时整体重画
+ * 参    数:
+ *       @label：文本标签
+ *       @fc：字的颜色
+ *       @bc：字的背景色
+ * 返 回 值: 无
+ ***************************************************************/
+void lcd_label_set_color(lcd_label_t *label, uint16_t fc, uint16_t bc)
+{
+    if ((label->fc != fc) || (label->bc != bc)) {
+        label->fc = fc;
+        label->bc = bc;
+        label->drawn = false;
+    }
+}
+
+/***************************************************************
+ * 函数名称: lcd_label_invalidate
+ * 说    明: 屏幕内容被其他操作覆盖后调用，下次更新时整体重画
+ * 参    数:
+ *       @label：文本标签
+ * 返 回 值: 无
+ ***************************************************************/
+void lcd_label_invalidate(lcd_label_t *label)
+{
+    label->drawn = false;
+}
+
+/***************************************************************
+ * 函数名称: lcd_number_init
+ * 说    明: 初始化数值标签，不立即显示
+ * 参    数:
+ *       @number：数值标签
+ *       @x：起始位置X坐标
+ *       @y：起始位置Y坐标
+ *       @len：字符格数目（包括符号和小数点）
+ *       @decimals：小数位数，最大为LCD_NUMBER_DECIMALS_MAX
+ *       @fc：字的颜色
+ *       @bc：字的背景色
+ *       @sizey：字号，可选：12、16、24、32
+ * 返 回 值: 无
+ ***************************************************************/
+void lcd_number_init(lcd_number_t *number, uint16_t x, uint16_t y, uint8_t len, uint8_t decimals, uint16_t fc, uint16_t bc, uint8_t sizey)
+{
+    lcd_label_init(&number->label, x, y, len, fc, bc, sizey);
+    number->decimals = (decimals > LCD_NUMBER_DECIMALS_MAX) ? LCD_NUMBER_DECIMALS_MAX : decimals;
+}
+
+/***************************************************************
+ * 函数名称: lcd_number_set
+ * 说    明: 更新数值标签，数值为放大10^decimals倍后的整数，
+ *           例如decimals为2时，2345显示为23.45。
+ *           数值从低位开始逐位取出，位数超过字符格时只显示低位
+ * 参    数:
+ *       @number：数值标签
+ *       @value：放大后的整数
+ * 返 回 值: 无
+ ***************************************************************/
+void lcd_number_set(lcd_number_t *number, int32_t value)
+{
+    uint8_t cells[LCD_LABEL_LEN_MAX];
+    uint32_t v = (value < 0) ? (uint32_t)(-(int64_t)value) : (uint32_t)value;
+    uint8_t digits = 0;
+    int i = number->label.len - 1;
+    
+    /* 至少显示1位整数 */
+    while ((i >= 0) && ((v != 0) || (digits <= number->decimals))) {
+        if ((number->decimals != 0) && (digits == number->decimals)) {
+            cells[i--] = '.';
+            if (i < 0) {
+                break;
+            }
+        }
+        cells[i--] = '0' + (v % DECIMAL_BASE);
+        v /= DECIMAL_BASE;
+        digits++;
+    }
+    if ((value < 0) && (i >= 0)) {
+        cells[i--] = '-';
+    }
+    while (i >= 0) {
+        cells[i--] = ' ';
+    }
+    
+    lcd_label_update(&number->label, cells);
+}
+
+/***************************************************************
+ * 函数名称: lcd_number_set_float
+ * 说    明: 更新数值标签，数值按小数位数四舍五入，放大后超出
+ *           int32_t范围时按最大或最小值显示
+ * 参    数:
+ *       @number：数值标签
+ *       @value：数值
+ * 返 回 值: 无
+ ***************************************************************/
+void lcd_number_set_float(lcd_number_t *number, float value)
+{
+    float scaled = value * m_decimal_scale[number->decimals];
+    float rounded = (scaled < 0) ? (scaled - 0.5f) : (scaled + 0.5f);
+    int32_t v;
+    
+    /* 超出int32_t范围的浮点数转换为整数是未定义行为，先限幅，NaN显示为0 */
+    if (rounded != rounded) {
+        v = 0;
+    } else if (rounded >= INT32_FLOAT_LIMIT) {
+        v = INT32_MAX;
+    } else if (rounded <= -INT32_FLOAT_LIMIT) {
+        v = INT32_MIN;
+    } else {
+        v = (int32_t)rounded;
+    }
+    lcd_number_set(number, v);
+}
+
+/***************************************************************
+ * 函数名称: lcd_progress_init
+ * 说    明: 初始化水平进度条，不立即显示
+ * 参    数:
+ *       @bar：进度条
+ *       @x：起始位置X坐标
+ *       @y：起始位置Y坐标
+ *       @width：宽度
+ *       @height：高度
+ *       @max：最大值
+ *       @fc：已完成部分的颜色
+ *       @bc：未完成部分的颜色
+ * 返 回 值: 无
+ ***************************************************************/
+void lcd_progress_init(lcd_progress_t *bar, uint16_t x, uint16_t y, uint16_t width, uint16_t height, uint32_t max, uint16_t fc, uint16_t bc)
+{
+    bar->x = x;
+    bar->y = y;
+    bar->width = width;
+    bar->height = height;
+    bar->max = (max == 0) ? 1 : max;
+    bar->fc = fc;
+    bar->bc = bc;
+    bar->fill = 0;
+    bar->drawn = false;
+}
+
+/***************************************************************
+ * 函数名称: lcd_progress_set
+ * 说    明: 更新进度条，只重画完成部分变化的区域
+ * 参    数:
+ *       @bar：进度条
+ *       @value：当前值，超过最大值时按最大值显示
+ * 返 回 值: 无
+ ***************************************************************/
+void lcd_progress_set(lcd_progress_t *bar, uint32_t value)
+{
+    uint16_t fill;
+    
+    if (value > bar->max) {
+        value = bar->max;
+    }
+    fill = (uint16_t)((uint64_t)value * bar->width / bar->max);
+    
+    if (!bar->drawn) {
+        if (fill > 0) {
+            lcd_fill(bar->x, bar->y, bar->x + fill, bar->y + bar->height, bar->fc);
+        }
+        if (fill < bar->width) {
+            lcd_fill(bar->x + fill, bar->y, bar->x + bar->width, bar->y + bar->height, bar->bc);
+        }
+        bar->drawn = true;
+    } else if (fill > bar->fill) {
+        lcd_fill(bar->x + bar->fill, bar->y, bar->x + fill, bar->y + bar->height, bar->fc);
+    } else if (fill < bar->fill) {
+        lcd_fill(bar->x + fill, bar->y, bar->x + bar->fill, bar->y + bar->height, bar->bc);
+    }
+    bar->fill = fill;
+}
@@ -0,0 +1,308 @@
+/*
+ * Copyright (c) 2022 FuZhou Lockzhiner Electronic Co., Ltd. All rights reserved.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+/* 主机基准使用的JPEG图片（160x120，基线，YCbCr 4:2:0，质量80），
+ * 由渐变背景、圆、矩形和斜线组成，用Pillow生成，数据为原始JPEG文件
+ */
+#ifndef _GRADIENT_JPG_H_
+#define _GRADIENT_JPG_H_
+
+#define GRADIENT_JPG_W                  160
+#define GRADIENT_JPG_H                  120
+#define GRADIENT_JPG_SIZE               4478
+
+static const unsigned char m_gradient_jpg[GRADIENT_JPG_SIZE] = {
+    0XFF, 0XD8, 0XFF, 0XE0, 0X00, 0X10, 0X4A, 0X46, 0X49, 0X46, 0X00, 0X01, 0X01, 0X00, 0X00, 0X01,
+    0X00, 0X01, 0X00, 0X00, 0XFF, 0XDB, 0X00, 0X43, 0X00, 0X06, 0X04, 0X05, 0X06, 0X05, 0X04, 0X06,
+    0X06, 0X05, 0X06, 0X07, 0X07, 0X06, 0X08, 0X0A, 0X10, 0X0A, 0X0A, 0X09, 0X09, 0X0A, 0X14, 0X0E,
+    0X0F, 0X0C, 0X10, 0X17, 0X14, 0X18, 0X18, 0X17, 0X14, 0X16, 0X16, 0X1A, 0X1D, 0X25, 0X1F, 0X1A,
+    0X1B, 0X23, 0X1C, 0X16, 0X16, 0X20, 0X2C, 0X20, 0X23, 0X26, 0X27, 0X29, 0X2A, 0X29, 0X19, 0X1F,
+    0X2D, 0X30, 0X2D, 0X28, 0X30, 0X25, 0X28, 0X29, 0X28, 0XFF, 0XDB, 0X00, 0X43, 0X01, 0X07, 0X07,
+    0X07, 0X0A, 0X08, 0X0A, 0X13, 0X0A, 0X0A, 0X13, 0X28, 0X1A, 0X16, 0X1A, 0X28, 0X28, 0X28, 0X28,
+    0X28, 0X28, 0X28, 0X28, 0X28, 0X28, 0X28, 0X28, 0X28, 0X28, 0X28, 0X28, 0X28, 0X28, 0X28, 0X28,
+    0X28, 0X28, 0X28, 0X28, 0X28, 0X28, 0X28, 0X28, 0X28, 0X28, 0X28, 0X28, 0X28, 0X28, 0X28, 0X28,
+    0X28, 0X28, 0X28, 0X28, 0X28, 0X28, 0X28, 0X28, 0X28, 0X28, 0X28, 0X28, 0X28, 0X28, 0XFF, 0XC0,
+    0X00, 0X11, 0X08, 0X00, 0X78, 0X00, 0XA0, 0X03, 0X01, 0X22, 0X00, 0X02, 0X11, 0X01, 0X03, 0X11,
+    0X01, 0XFF, 0XC4, 0X00, 0X1F, 0X00, 0X00, 0X01, 0X05, 0X01, 0X01, 0X01, 0X01, 0X01, 0X01, 0X00,
+    0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X01, 0X02, 0X03, 0X04, 0X05, 0X06, 0X07, 0X08, 0X09,
+    0X0A, 0X0B, 0XFF, 0XC4, 0X00, 0XB5, 0X10, 0X00, 0X02, 0X01, 0X03, 0X03, 0X02, 0X04, 0X03, 0X05,
+    0X05, 0X04, 0X04, 0X00, 0X00, 0X01, 0X7D, 0X01, 0X02, 0X03, 0X00, 0X04, 0X11, 0X05, 0X12, 0X21,
+    0X31, 0X41, 0X06, 0X13, 0X51, 0X61, 0X07, 0X22, 0X71, 0X14, 0X32, 0X81, 0X91, 0XA1, 0X08, 0X23,
+    0X42, 0XB1, 0XC1, 0X15, 0X52, 0XD1, 0XF0, 0X24, 0X33, 0X62, 0X72, 0X82, 0X09, 0X0A, 0X16, 0X17,
+    0X18, 0X19, 0X1A, 0X25, 0X26, 0X27, 0X28, 0X29, 0X2A, 0X34, 0X35, 0X36, 0X37, 0X38, 0X39, 0X3A,
+    0X43, 0X44, 0X45, 0X46, 0X47, 0X48, 0X49, 0X4A, 0X53, 0X54, 0X55, 0X56, 0X57, 0X58, 0X59, 0X5A,
+    0X63, 0X64, 0X65, 0X66, 0X67, 0X68, 0X69, 0X6A, 0X73, 0X74, 0X75, 0X76, 0X77, 0X78, 0X79, 0X7A,
+    0X83, 0X84, 0X85, 0X86, 0X87, 0X88, 0X89, 0X8A, 0X92, 0X93, 0X94, 0X95, 0X96, 0X97, 0X98, 0X99,
+    0X9A, 0XA2, 0XA3, 0XA4, 0XA5, 0XA6, 0XA7, 0XA8, 0XA9, 0XAA, 0XB2, 0XB3, 0XB4, 0XB5, 0XB6, 0XB7,
+    0XB8, 0XB9, 0XBA, 0XC2, 0XC3, 0XC4, 0XC5, 0XC6, 0XC7, 0XC8, 0XC9, 0XCA, 0XD2, 0XD3, 0XD4, 0XD5,
+    0XD6, 0XD7, 0XD8, 0XD9, 0XDA, 0XE1, 0XE2, 0XE3, 0XE4, 0XE5, 0XE6, 0XE7, 0XE8, 0XE9, 0XEA, 0XF1,
+    0XF2, 0XF3, 0XF4, 0XF5, 0XF6, 0XF7, 0XF8, 0XF9, 0XFA, 0XFF, 0XC4, 0X00, 0X1F, 0X01, 0X00, 0X03,
+    0X01, 0X01, 0X01, 0X01, 0X01, 0X01, 0X01, 0X01, 0X01, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X01,
+    0X02, 0X03, 0X04, 0X05, 0X06, 0X07, 0X08, 0X09, 0X0A, 0X0B, 0XFF, 0XC4, 0X00, 0XB5, 0X11, 0X00,
+    0X02, 0X01, 0X02, 0X04, 0X04, 0X03, 0X04, 0X07, 0X05, 0X04, 0X04, 0X00, 0X01, 0X02, 0X77, 0X00,
+    0X01, 0X02, 0X03, 0X11, 0X04, 0X05, 0X21, 0X31, 0X06, 0X12, 0X41, 0X51, 0X07, 0X61, 0X71, 0X13,
+    0X22, 0X32, 0X81, 0X08, 0X14, 0X42, 0X91, 0XA1, 0XB1, 0XC1, 0X09, 0X23, 0X33, 0X52, 0XF0, 0X15,
+    0X62, 0X72, 0XD1, 0X0A, 0X16, 0X24, 0X34, 0XE1, 0X25, 0XF1, 0X17, 0X18, 0X19, 0X1A, 0X26, 0X27,
+    0X28, 0X29, 0X2A, 0X35, 0X36, 0X37, 0X38, 0X39, 0X3A, 0X43, 0X44, 0X45, 0X46, 0X47, 0X48, 0X49,
+    0X4A, 0X53, 0X54, 0X55, 0X56, 0X57, 0X58, 0X59, 0X5A, 0X63, 0X64, 0X65, 0X66, 0X67, 0X68, 0X69,
+    0X6A, 0X73, 0X74, 0X75, 0X76, 0X77, 0X78, 0X79, 0X7A, 0X82, 0X83, 0X84, 0X85, 0X86, 0X87, 0X88,
+    0X89, 0X8A, 0X92, 0X93, 0X94, 0X95, 0X96, 0X97, 0X98, 0X99, 0X9A, 0XA2, 0XA3, 0XA4, 0XA5, 0XA6,
+    0XA7, 0XA8, 0XA9, 0XAA, 0XB2, 0XB3, 0XB4, 0XB5, 0XB6, 0XB7, 0XB8, 0XB9, 0XBA, 0XC2, 0XC3, 0XC4,
+    0XC5, 0XC6, 0XC7, 0XC8, 0XC9, 0XCA, 0XD2, 0XD3, 0XD4, 0XD5, 0XD6, 0XD7, 0XD8, 0XD9, 0XDA, 0XE2,
+    0XE3, 0XE4, 0XE5, 0XE6, 0XE7, 0XE8, 0XE9, 0XEA, 0XF2, 0XF3, 0XF4, 0XF5, 0XF6, 0XF7, 0XF8, 0XF9,
+    0XFA, 0XFF, 0XDA, 0X00, 0X0C, 0X03, 0X01, 0X00, 0X02, 0X11, 0X03, 0X11, 0X00, 0X3F, 0X00, 0XF9,
+    0XEA, 0X0B, 0X7F, 0X6A, 0XB9, 0X1C, 0X38, 0XED, 0X56, 0X23, 0X87, 0X1D, 0XAA, 0X5D, 0X98, 0XAF,
+    0XDF, 0X28, 0XD3, 0X86, 0X1E, 0X07, 0X93, 0X0A, 0XD7, 0X2B, 0X84, 0XC5, 0X35, 0X85, 0X58, 0X61,
+    0X50, 0X3D, 0X78, 0X19, 0XB6, 0X71, 0X1A, 0X49, 0XA4, 0XCF, 0X4F, 0X0E, 0XEE, 0X57, 0X7A, 0X85,
+    0X86, 0X6A, 0XC3, 0X2E, 0X68, 0X11, 0X92, 0X6B, 0XF2, 0XDC, 0XCF, 0X35, 0X95, 0X69, 0X34, 0X99,
+    0XED, 0XD0, 0X95, 0X8A, 0XEB, 0X1E, 0X6A, 0X78, 0XA0, 0XCF, 0X6A, 0XB1, 0X14, 0X19, 0XED, 0X57,
+    0XE0, 0XB6, 0XE9, 0XC5, 0X70, 0X61, 0X30, 0XD2, 0XAF, 0X2B, 0XB3, 0XD0, 0X8D, 0X74, 0X8A, 0XF0,
+    0X5B, 0XFB, 0X56, 0X8C, 0X16, 0XDE, 0XD5, 0X62, 0X0B, 0X6F, 0X6A, 0XBF, 0X14, 0X18, 0XED, 0X5F,
+    0XA1, 0XE5, 0X39, 0X5A, 0X8A, 0X4D, 0XA2, 0XFE, 0XB0, 0X57, 0X8A, 0X0C, 0X76, 0XAB, 0X0B, 0X1E,
+    0X2A, 0XC2, 0XC7, 0X81, 0X4A, 0X57, 0X15, 0XF4, 0XF3, 0XAB, 0X0C, 0X3C, 0X0D, 0XE9, 0X54, 0XBB,
+    0X2B, 0X95, 0XC5, 0X42, 0XF5, 0X61, 0XEA, 0X06, 0X15, 0XF0, 0XF9, 0XD6, 0X79, 0X64, 0XD2, 0X67,
+    0XAF, 0X87, 0X65, 0X77, 0X14, 0XCD, 0X99, 0X35, 0X63, 0X61, 0X35, 0X24, 0X70, 0XE7, 0XB5, 0X7E,
+    0X6D, 0X8B, 0XC6, 0XCF, 0X11, 0X33, 0XDA, 0XA3, 0X3B, 0X15, 0XE3, 0X87, 0X3D, 0XAA, 0XE4, 0X36,
+    0XF9, 0XED, 0X56, 0X21, 0XB7, 0XCF, 0X6A, 0XA9, 0XAA, 0X6A, 0XA2, 0XD2, 0X46, 0XB2, 0XD3, 0XA1,
+    0X6B, 0XDD, 0X58, 0X81, 0XB6, 0XDD, 0X14, 0X90, 0X99, 0XE0, 0X33, 0X9E, 0X80, 0X0C, 0X8E, 0XE3,
+    0XA8, 0XE8, 0X0E, 0X6B, 0XB3, 0X2F, 0XC1, 0X73, 0X3E, 0X69, 0X1B, 0XD5, 0XC7, 0X42, 0X84, 0X39,
+    0XE6, 0XF4, 0XFE, 0XB4, 0X5D, 0XDF, 0X91, 0X3D, 0XFD, 0XD5, 0XB6, 0X93, 0X62, 0XF7, 0X77, 0XAF,
+    0XB2, 0X35, 0XE0, 0X01, 0XD5, 0X8F, 0X65, 0X03, 0XB9, 0XFF, 0X00, 0X3D, 0X2A, 0XB5, 0XAE, 0X99,
+    0XA8, 0XEB, 0XB7, 0X06, 0X6D, 0X48, 0XCF, 0X61, 0XA6, 0XAB, 0XA3, 0XC1, 0X6A, 0X8C, 0X16, 0X59,
+    0X08, 0X3B, 0X83, 0X48, 0XC3, 0X95, 0XFF, 0X00, 0X74, 0X10, 0X41, 0XF4, 0X23, 0X27, 0X47, 0X46,
+    0XF0, 0XC6, 0XDB, 0XE7, 0XD4, 0XB5, 0X97, 0X8E, 0XF7, 0X51, 0X7D, 0XBB, 0X7E, 0X4F, 0XDD, 0XDB,
+    0X81, 0XC8, 0X58, 0XC1, 0XF4, 0X3F, 0XC5, 0XD7, 0XE8, 0X49, 0XCF, 0X52, 0X91, 0X63, 0XB5, 0X7E,
+    0X85, 0X97, 0X65, 0X9A, 0X27, 0X55, 0X59, 0X76, 0XEF, 0XEB, 0XFE, 0X5F, 0X79, 0XCA, 0X9D, 0X4C,
+    0X63, 0XBD, 0X7F, 0X76, 0X1F, 0XCB, 0X7D, 0XFF, 0X00, 0XC4, 0XD7, 0XFE, 0X92, 0XB4, 0XEF, 0X73,
+    0XCA, 0XF6, 0X62, 0X98, 0XC3, 0X15, 0X61, 0X86, 0X2A, 0X17, 0XAF, 0XA2, 0XCD, 0XB3, 0X98, 0XD3,
+    0X4D, 0X26, 0X7F, 0X3E, 0XE1, 0XDD, 0XCA, 0XCF, 0X50, 0XB2, 0XE6, 0XAC, 0XB2, 0XE6, 0X92, 0XD6,
+    0XD2, 0XF7, 0X52, 0XD5, 0X6D, 0X34, 0X9D, 0X16, 0XD2, 0X4B, 0XED, 0X5E, 0XF5, 0XF6, 0X5B, 0XDB,
+    0X47, 0XD5, 0X8F, 0X72, 0X4F, 0X40, 0XA0, 0X02, 0X49, 0X24, 0X00, 0X01, 0X24, 0X80, 0X09, 0X1F,
+    0X97, 0XE6, 0X39, 0X9C, 0XF1, 0X13, 0XE5, 0X89, 0XED, 0XD0, 0X76, 0X29, 0X4D, 0X24, 0X50, 0X2E,
+    0XE9, 0XE4, 0X44, 0X1C, 0X91, 0XB8, 0XF5, 0XC7, 0XA7, 0XAD, 0X1A, 0X4B, 0X5E, 0XEB, 0X57, 0X4F,
+    0X6B, 0XE1, 0XED, 0X1F, 0X51, 0XD5, 0XAE, 0X91, 0X4C, 0X8D, 0X15, 0XA4, 0X0D, 0X23, 0X04, 0X04,
+    0X02, 0XF8, 0X50, 0X4E, 0X32, 0X54, 0X64, 0X8E, 0XE2, 0XBE, 0X9B, 0XF8, 0X4D, 0XFB, 0X3A, 0X69,
+    0X96, 0X36, 0X96, 0X9A, 0XBF, 0XC4, 0X34, 0X6D, 0X53, 0X5C, 0X6F, 0XDE, 0X1B, 0X06, 0X93, 0X36,
+    0XD6, 0XDF, 0X32, 0XB2, 0XAB, 0X01, 0XFE, 0XB1, 0X86, 0X08, 0X23, 0X26, 0X33, 0XB8, 0X8D, 0XAC,
+    0X00, 0X63, 0XF4, 0X0D, 0XA5, 0XB4, 0X16, 0X76, 0XB0, 0XDA, 0XD9, 0XC3, 0X14, 0X16, 0XD0, 0X22,
+    0XC7, 0X14, 0X51, 0X20, 0X54, 0X8D, 0X14, 0X60, 0X2A, 0X81, 0XC0, 0X00, 0X00, 0X00, 0X15, 0XC3,
+    0X0C, 0X3A, 0X5A, 0XC9, 0XDD, 0X9D, 0XBE, 0XDA, 0X4B, 0X63, 0XF3, 0XFE, 0X3F, 0X0F, 0X78, 0XD9,
+    0X3F, 0XE6, 0X40, 0XF1, 0X21, 0XFF, 0X00, 0XB7, 0X09, 0XFF, 0X00, 0XF8, 0XDD, 0X53, 0XD2, 0XFC,
+    0X41, 0XA6, 0X5C, 0XCB, 0XE5, 0XB4, 0X8D, 0X6E, 0XDD, 0X8C, 0XE0, 0X28, 0X3F, 0X8E, 0X48, 0X1D,
+    0X3B, 0XE2, 0XBF, 0X44, 0X6B, 0X9F, 0XF1, 0X8F, 0X83, 0X7C, 0X3B, 0XE3, 0X3B, 0X05, 0XB3, 0XF1,
+    0X3E, 0X93, 0X6D, 0XA8, 0X44, 0X99, 0XF2, 0XDA, 0X40, 0X56, 0X48, 0XB2, 0X54, 0X9D, 0X92, 0X29,
+    0X0C, 0X99, 0XDA, 0XB9, 0XDA, 0X46, 0X40, 0XC1, 0XC8, 0XAF, 0X53, 0X0B, 0X8C, 0X96, 0X1A, 0X49,
+    0XC5, 0X26, 0X86, 0XB1, 0X13, 0X5D, 0X4F, 0X8E, 0X2D, 0XA3, 0X47, 0X8D, 0X5E, 0X32, 0XAC, 0X8C,
+    0X01, 0X56, 0X53, 0X90, 0X47, 0XA8, 0XAB, 0X4B, 0X1E, 0X2B, 0X77, 0XE2, 0X27, 0XC2, 0X3D, 0X73,
+    0XE1, 0X9D, 0XC4, 0X9A, 0XA7, 0X86, 0XBE, 0XD9, 0XAE, 0X78, 0X36, 0X38, 0X7C, 0XCB, 0X98, 0XE4,
+    0X75, 0X6B, 0X8B, 0X20, 0X08, 0XDC, 0XDB, 0X46, 0X37, 0X0E, 0X4B, 0X65, 0X46, 0X00, 0XDD, 0XB8,
+    0X0D, 0XA1, 0XCE, 0X25, 0XA5, 0XC4, 0X17, 0X96, 0XB1, 0XDC, 0X5A, 0XC8, 0XB2, 0XC3, 0X20, 0XCA,
+    0XB2, 0XF7, 0XFF, 0X00, 0X3E, 0X95, 0XF7, 0XF9, 0X76, 0X75, 0X43, 0X11, 0X46, 0XF1, 0XD2, 0X4B,
+    0X75, 0XFE, 0X5E, 0X47, 0X55, 0X1A, 0XDC, 0XE3, 0X4A, 0XE2, 0XA2, 0X7A, 0XB0, 0XF5, 0X5D, 0XC8,
+    0XC9, 0X04, 0XF3, 0X5F, 0X37, 0X9C, 0XE7, 0X96, 0XBA, 0X4C, 0XF7, 0X30, 0X91, 0X94, 0XDD, 0XA2,
+    0XAE, 0X40, 0XE2, 0X99, 0XB3, 0X35, 0X37, 0XCB, 0XEB, 0X4F, 0X5D, 0X9D, 0XCF, 0XE9, 0X5F, 0X9C,
+    0X63, 0X31, 0X75, 0X6B, 0XCB, 0XA9, 0XED, 0XD2, 0X85, 0X48, 0XFD, 0X97, 0XF7, 0X11, 0X24, 0X39,
+    0XED, 0X56, 0X56, 0X24, 0X8E, 0X36, 0X92, 0X56, 0X54, 0X8D, 0X01, 0X66, 0X66, 0X38, 0X00, 0X0E,
+    0XA4, 0X9A, 0X82, 0XFF, 0X00, 0X52, 0XB1, 0XD2, 0XEC, 0XDE, 0XE6, 0XEE, 0X5D, 0XA8, 0XBD, 0X00,
+    0X1C, 0XB1, 0XEC, 0X07, 0XBD, 0X66, 0X47, 0X04, 0XBE, 0X22, 0X96, 0X53, 0XAD, 0X49, 0X2D, 0X8E,
+    0X90, 0X19, 0X4C, 0X56, 0X4B, 0XC3, 0XCB, 0X8E, 0X77, 0X48, 0X40, 0X24, 0X03, 0XFD, 0XD0, 0X7F,
+    0X22, 0X32, 0X77, 0XC0, 0XE1, 0XA2, 0XDA, 0X94, 0XDA, 0X5E, 0XAC, 0XBA, 0X98, 0XA9, 0XC1, 0XFB,
+    0X3A, 0X71, 0X6E, 0X5D, 0XBF, 0X57, 0XD9, 0X7F, 0X48, 0X91, 0XAE, 0XEF, 0X35, 0XF9, 0X2E, 0X6C,
+    0X7C, 0X3A, 0X56, 0X2B, 0X68, 0XC8, 0X8E, 0X6D, 0X49, 0X89, 0XC0, 0XFE, 0XF2, 0XC6, 0X07, 0X56,
+    0XC7, 0X7C, 0XFE, 0X59, 0X53, 0X5D, 0X5E, 0X85, 0XA0, 0XDA, 0X69, 0X31, 0XC8, 0XB6, 0XA8, 0XDE,
+    0X64, 0XA4, 0X34, 0XB2, 0XC8, 0XC5, 0X9E, 0X56, 0XF5, 0X62, 0X7F, 0X13, 0XE9, 0X92, 0X78, 0XE6,
+    0XA6, 0XB5, 0XBC, 0XD3, 0XA0, 0X89, 0X23, 0X8E, 0X45, 0X48, 0XD0, 0X05, 0X55, 0X58, 0XC8, 0X0A,
+    0X07, 0X40, 0X06, 0X2A, 0XDA, 0X6A, 0XBA, 0X70, 0XFF, 0X00, 0X97, 0X8F, 0XFC, 0X71, 0XBF, 0XC2,
+    0XBE, 0XFB, 0X2D, 0XFA, 0X8D, 0X1B, 0X4A, 0X75, 0X63, 0X7F, 0XF1, 0X2F, 0XF3, 0X1D, 0X2A, 0X53,
+    0X53, 0XF6, 0X95, 0X2E, 0XE5, 0XE9, 0XB7, 0XA2, 0XE9, 0XF9, 0XBE, 0XA5, 0X94, 0X87, 0X02, 0XA4,
+    0XD9, 0X8A, 0X82, 0X2D, 0X56, 0XC2, 0X49, 0X12, 0X38, 0XE7, 0XCB, 0XB1, 0X0A, 0X06, 0XC6, 0XE4,
+    0X9F, 0XC2, 0XAE, 0X38, 0XAF, 0X5A, 0XBE, 0X6B, 0X41, 0X41, 0XBA, 0X53, 0X4E, 0XDD, 0X9A, 0X67,
+    0XA5, 0X4A, 0X4E, 0XFA, 0X9E, 0X42, 0XF5, 0X0B, 0X2E, 0X6A, 0XC3, 0X0A, 0X04, 0X79, 0XAF, 0X80,
+    0XCC, 0XF3, 0X59, 0X56, 0X93, 0X49, 0X9F, 0XCF, 0X74, 0X25, 0X62, 0X8D, 0XDB, 0XAD, 0XB5, 0XAC,
+    0XB3, 0XBE, 0X31, 0X1A, 0X96, 0XC1, 0X38, 0XC9, 0XEC, 0X3F, 0X1E, 0X95, 0XF4, 0X67, 0XEC, 0XA5,
+    0XF0, 0XE2, 0X0B, 0X2D, 0X0D, 0X3C, 0X71, 0XAE, 0X5A, 0X6E, 0XD7, 0X35, 0X22, 0XED, 0X64, 0X65,
+    0X0D, 0XFE, 0X8D, 0X6C, 0X7E, 0X50, 0XCA, 0XAC, 0X06, 0XD6, 0X7F, 0X9B, 0XE6, 0XC9, 0XCC, 0X65,
+    0X70, 0X40, 0X66, 0X07, 0XE7, 0X3D, 0X53, 0X4E, 0X9F, 0X58, 0XD4, 0X34, 0X5D, 0X06, 0XCD, 0XD6,
+    0X3B, 0XBD, 0X56, 0XF6, 0X3B, 0X68, 0X9A, 0X42, 0X44, 0X60, 0XB3, 0X05, 0X1B, 0X88, 0XC9, 0XC6,
+    0XE7, 0X53, 0XC0, 0X3D, 0X2B, 0XF4, 0X32, 0XD2, 0XDA, 0X0B, 0X3B, 0X58, 0X6D, 0X6C, 0XE1, 0X8A,
+    0X0B, 0X68, 0X11, 0X63, 0X8A, 0X28, 0X90, 0X2A, 0X46, 0X8A, 0X30, 0X15, 0X40, 0XE0, 0X00, 0X00,
+    0X00, 0X0A, 0XE7, 0XC1, 0X43, 0XDD, 0XE7, 0X7B, 0XB3, 0XDD, 0XC2, 0XEB, 0X0E, 0X62, 0X5A, 0X28,
+    0XA2, 0XBB, 0X4E, 0X90, 0XA2, 0X8A, 0X28, 0X02, 0X2B, 0XBB, 0X68, 0X2F, 0X2D, 0X66, 0XB5, 0XBC,
+    0X86, 0X29, 0XED, 0XA7, 0X46, 0X8E, 0X58, 0XA5, 0X40, 0XC9, 0X22, 0X30, 0XC1, 0X56, 0X07, 0X82,
+    0X08, 0X24, 0X10, 0X6B, 0XE2, 0XEF, 0X88, 0X3E, 0X13, 0XFF, 0X00, 0X85, 0X61, 0XF1, 0X45, 0XF4,
+    0X8B, 0X18, 0X9D, 0X3C, 0X33, 0XAC, 0XAF, 0XDA, 0X2C, 0X1A, 0X59, 0X19, 0X84, 0X4C, 0X01, 0X0D,
+    0X18, 0X66, 0X00, 0X16, 0X0D, 0XC6, 0X32, 0X5B, 0X6B, 0X45, 0X92, 0X49, 0XE7, 0XED, 0X6A, 0XF0,
+    0XCF, 0XDB, 0X07, 0X44, 0X7B, 0XFF, 0X00, 0X85, 0XB1, 0X6A, 0XF6, 0XC2, 0X04, 0XB9, 0XD1, 0XAF,
+    0XA2, 0XB8, 0X33, 0XB0, 0XC4, 0XAB, 0X1B, 0X9F, 0X2C, 0XAC, 0X6C, 0X06, 0X46, 0X5D, 0XE2, 0X62,
+    0X32, 0X07, 0XC9, 0X9E, 0XA0, 0X0A, 0XA8, 0X4E, 0X50, 0X7C, 0XD1, 0X7A, 0X95, 0X09, 0X72, 0XC9,
+    0X34, 0X78, 0XCB, 0X8A, 0XA7, 0X30, 0XC4, 0X86, 0XAD, 0XD9, 0X4A, 0X97, 0X96, 0X70, 0X5C, 0XC4,
+    0X18, 0X47, 0X34, 0X6B, 0X22, 0X86, 0XEA, 0X01, 0X19, 0X19, 0XFC, 0XEA, 0XAD, 0XF3, 0X2C, 0X52,
+    0X48, 0XD2, 0X30, 0X54, 0X51, 0X96, 0X66, 0X38, 0X00, 0X63, 0XA9, 0XAF, 0X9A, 0X9E, 0X2E, 0X58,
+    0X8A, 0XCD, 0X33, 0XED, 0XF2, 0X39, 0X2F, 0X6A, 0XFD, 0X3F, 0X54, 0X47, 0X59, 0X3A, 0XAE, 0XAE,
+    0X2D, 0XDD, 0XAD, 0X2C, 0X63, 0X37, 0X5A, 0X89, 0X03, 0X6C, 0X2A, 0X09, 0X09, 0X9F, 0XE2, 0X73,
+    0XD0, 0X0E, 0X9D, 0XFB, 0X8E, 0X80, 0XE6, 0XAA, 0XCF, 0X7F, 0X75, 0XAC, 0X3C, 0XF6, 0X9A, 0X29,
+    0X11, 0XC0, 0X84, 0X24, 0X97, 0XC4, 0XF1, 0XEE, 0X10, 0X77, 0X38, 0XEF, 0X9F, 0XCB, 0X20, 0XD6,
+    0XAE, 0X9B, 0XA7, 0X5B, 0XE9, 0XE8, 0XE2, 0XDD, 0X4E, 0XF9, 0X0E, 0XE9, 0X24, 0X76, 0X2C, 0XF2,
+    0X37, 0XA9, 0X27, 0XF1, 0XF6, 0XE4, 0XD6, 0XFC, 0XAA, 0X1A, 0XCF, 0X7E, 0XDF, 0XE6, 0X7B, 0X2E,
+    0XB4, 0XF1, 0X3E, 0XEE, 0X1D, 0XDA, 0X3D, 0X65, 0XF7, 0XFC, 0X3D, 0XFD, 0X76, 0XF5, 0X29, 0XD8,
+    0X68, 0XF8, 0XBB, 0X7B, 0XED, 0X4D, 0XD2, 0XEA, 0XF5, 0XB1, 0XB7, 0XE5, 0XF9, 0X21, 0X03, 0X9C,
+    0X20, 0X3E, 0X87, 0XBF, 0X5F, 0XD7, 0X3A, 0XF4, 0X51, 0X51, 0X29, 0X39, 0X3B, 0XB3, 0XAA, 0X8D,
+    0X08, 0X51, 0X5C, 0XB0, 0X5F, 0XE6, 0XFD, 0X5F, 0X50, 0XA2, 0X8A, 0X2A, 0X4D, 0X4B, 0X3A, 0X6F,
+    0XFC, 0X84, 0X6D, 0X7F, 0XEB, 0XAA, 0X7F, 0X31, 0X5D, 0XCB, 0X8A, 0XE1, 0XB4, 0XCF, 0XF9, 0X08,
+    0XDA, 0XFF, 0X00, 0XD7, 0X54, 0XFE, 0X62, 0XBB, 0XC2, 0XB9, 0XA8, 0XAD, 0X8F, 0X78, 0X6A, 0X4E,
+    0X09, 0XEE, 0X2B, 0XFB, 0XC7, 0X93, 0X88, 0XF3, 0X56, 0X22, 0X83, 0X3D, 0XAA, 0XC4, 0X50, 0X64,
+    0XF4, 0XAB, 0XF0, 0X5B, 0XF4, 0XE2, 0XBA, 0X30, 0X98, 0X69, 0XD7, 0X95, 0XD9, 0XFC, 0XD5, 0X1A,
+    0XF6, 0X31, 0XF4, 0XE8, 0XFC, 0XBF, 0X8A, 0X5F, 0X0E, 0XFD, 0XF5, 0XAB, 0X7F, 0XFD, 0X1F, 0X15,
+    0X7D, 0XE9, 0X5F, 0X06, 0XF8, 0XFF, 0X00, 0X48, 0X96, 0XF7, 0XC3, 0X12, 0XB4, 0X3F, 0X7A, 0XD5,
+    0X85, 0XC1, 0X5E, 0X3E, 0X65, 0X50, 0X43, 0X77, 0XE3, 0X00, 0X93, 0XF8, 0X63, 0XBD, 0X7D, 0XA5,
+    0XE0, 0X0F, 0X13, 0XDA, 0XF8, 0XCF, 0XC1, 0XBA, 0X4F, 0X88, 0X6C, 0X57, 0X64, 0X57, 0XD0, 0X87,
+    0X68, 0XF2, 0X4F, 0X95, 0X20, 0X25, 0X64, 0X4C, 0X90, 0X33, 0XB5, 0XC3, 0X2E, 0X70, 0X01, 0XC6,
+    0X47, 0X06, 0XBE, 0X86, 0XAE, 0X19, 0XE1, 0XED, 0X17, 0XD8, 0XFA, 0X5C, 0XB2, 0XB2, 0XAB, 0X41,
+    0X5B, 0XA1, 0XD0, 0X51, 0X45, 0X15, 0X91, 0XE8, 0X05, 0X14, 0X51, 0X40, 0X05, 0X79, 0X57, 0XED,
+    0X47, 0XFF, 0X00, 0X24, 0X27, 0XC4, 0XDF, 0XF6, 0XEB, 0XFF, 0X00, 0XA5, 0X51, 0X57, 0XAA, 0XD7,
+    0XCC, 0XBF, 0XB6, 0X07, 0X88, 0X60, 0XD6, 0X53, 0X45, 0XF0, 0X26, 0X8F, 0XE5, 0XDE, 0X6B, 0X3F,
+    0X6A, 0XFB, 0X7D, 0XC2, 0X24, 0XA0, 0X1B, 0X70, 0XB1, 0X30, 0X45, 0X6C, 0X8C, 0X65, 0X96, 0X46,
+    0X6C, 0X6E, 0X04, 0X05, 0X1C, 0X61, 0XC1, 0XA4, 0XDA, 0X4A, 0XEC, 0X0F, 0X33, 0XB1, 0XD4, 0X2D,
+    0X74, 0X8F, 0X07, 0X69, 0XD7, 0X97, 0XCF, 0XB2, 0X25, 0XB5, 0X88, 0X00, 0X39, 0X67, 0X6D, 0X83,
+    0X0A, 0XA3, 0XB9, 0X3F, 0XFD, 0X7E, 0X82, 0XB1, 0X2F, 0XAD, 0X2F, 0X75, 0XDB, 0XD9, 0X9F, 0X54,
+    0X49, 0XAC, 0XB4, 0XE2, 0X50, 0XC7, 0X67, 0X90, 0X1D, 0XC0, 0X00, 0X83, 0X21, 0X1C, 0X8C, 0XFF,
+    0X00, 0X77, 0XB1, 0XF7, 0X19, 0X3D, 0X6E, 0X89, 0XE1, 0X5C, 0X6A, 0X0F, 0XAA, 0X6B, 0X92, 0X47,
+    0X7F, 0XA9, 0XBE, 0XDD, 0X87, 0X67, 0XEE, 0XED, 0XC0, 0XE4, 0X2C, 0X60, 0XFA, 0X1F, 0XE2, 0XEB,
+    0XF4, 0X24, 0XE6, 0X3D, 0X79, 0X76, 0X6A, 0XD3, 0XAF, 0XA6, 0XDF, 0XFD, 0X04, 0X57, 0XCF, 0X51,
+    0XA6, 0XA9, 0X5E, 0XA4, 0X77, 0X7D, 0X7F, 0X1D, 0X3F, 0XCC, 0XFA, 0X7C, 0X8A, 0X11, 0XC4, 0XD7,
+    0X70, 0X9E, 0XCA, 0X3B, 0X77, 0XD5, 0X6F, 0XE5, 0XE4, 0X67, 0X46, 0X8B, 0X1A, 0X2A, 0X46, 0XA1,
+    0X51, 0X40, 0X0A, 0XAA, 0X30, 0X00, 0XF4, 0X14, 0XB4, 0X51, 0X4C, 0XFB, 0XA4, 0XAC, 0X14, 0X51,
+    0X45, 0X00, 0X14, 0X51, 0X45, 0X00, 0X5A, 0XD2, 0XFF, 0X00, 0XE4, 0X27, 0X69, 0XFF, 0X00, 0X5D,
+    0X93, 0XFF, 0X00, 0X42, 0X15, 0XE8, 0X8B, 0X1E, 0X6B, 0XCF, 0X34, 0X81, 0X9D, 0X5A, 0XC8, 0X7A,
+    0XCE, 0X9F, 0XFA, 0X10, 0XAF, 0X55, 0X86, 0X0C, 0XF6, 0XAF, 0X0F, 0X35, 0X8C, 0XA5, 0X52, 0X31,
+    0X5D, 0X8C, 0X2A, 0XCF, 0X95, 0XA3, 0XCC, 0XE0, 0XB6, 0XF6, 0XAD, 0X18, 0X2D, 0XBA, 0X71, 0X56,
+    0X60, 0XB6, 0XF6, 0XAB, 0XF1, 0X41, 0X8C, 0X71, 0X5F, 0XAE, 0X65, 0X39, 0X5A, 0X8A, 0X4D, 0XA3,
+    0XF9, 0X53, 0XEB, 0X25, 0X4F, 0XB2, 0X24, 0XB1, 0X3C, 0X72, 0XA2, 0XBC, 0X6E, 0X0A, 0XB2, 0X30,
+    0XC8, 0X60, 0X7A, 0X82, 0X3D, 0X29, 0XDF, 0X07, 0X3C, 0X55, 0X71, 0XF0, 0XA7, 0XC5, 0XE7, 0X41,
+    0XD5, 0XDE, 0XDA, 0X3F, 0X04, 0X6B, 0X57, 0X2D, 0X24, 0X57, 0X72, 0X65, 0X45, 0X8C, 0XE5, 0X70,
+    0XA1, 0X9B, 0X9E, 0X08, 0X55, 0X43, 0XB8, 0XE3, 0X00, 0X3E, 0X57, 0X0E, 0X0E, 0X8A, 0XC7, 0X81,
+    0X55, 0XF5, 0X2B, 0X0B, 0X6D, 0X42, 0XCA, 0X6B, 0X4B, 0XD8, 0X56, 0X6B, 0X69, 0X57, 0X6B, 0XA3,
+    0X74, 0X23, 0XFA, 0X1E, 0XE0, 0XF5, 0X07, 0X9A, 0XF5, 0XF3, 0X3C, 0X25, 0X1A, 0XB4, 0X79, 0X5E,
+    0X8D, 0X6C, 0XCF, 0X57, 0X2D, 0XCC, 0X65, 0X86, 0XA9, 0X7D, 0XE2, 0XF7, 0X47, 0XD4, 0XD6, 0X97,
+    0X30, 0X5E, 0X5A, 0XC3, 0X75, 0X67, 0X34, 0X53, 0XDB, 0X4E, 0X8B, 0X24, 0X52, 0XC4, 0XE1, 0X92,
+    0X44, 0X61, 0X90, 0XCA, 0X47, 0X04, 0X10, 0X41, 0X04, 0X54, 0XB5, 0XF1, 0XCF, 0X84, 0XFC, 0X43,
+    0XE3, 0XBF, 0X85, 0X66, 0X3B, 0X4F, 0X0F, 0X3A, 0XF8, 0X87, 0XC2, 0XCA, 0XCF, 0X2B, 0X69, 0XD7,
+    0X20, 0X07, 0X84, 0X17, 0X0C, 0XC2, 0X36, 0X07, 0X70, 0X62, 0X01, 0XC6, 0XDC, 0XAE, 0XE6, 0X63,
+    0XE5, 0XE4, 0XF3, 0XEA, 0X9E, 0X1F, 0XFD, 0XA6, 0X7C, 0X13, 0X7B, 0X28, 0XB7, 0XD7, 0X61, 0XD5,
+    0X34, 0X1B, 0XA4, 0X8B, 0X33, 0X7D, 0XA6, 0XDC, 0XCB, 0X1A, 0XCA, 0X30, 0X1A, 0X35, 0X31, 0XEE,
+    0X72, 0X41, 0X27, 0X04, 0XA2, 0XF0, 0XA7, 0X38, 0X38, 0X15, 0XF1, 0X2F, 0X47, 0XCA, 0X7D, 0XB5,
+    0X1A, 0XF4, 0XEB, 0XC7, 0X9A, 0X9B, 0XB9, 0XEE, 0X55, 0X15, 0XDD, 0XCC, 0X16, 0X76, 0XB3, 0X5D,
+    0X5E, 0X4D, 0X14, 0X16, 0XD0, 0X23, 0X49, 0X2C, 0XB2, 0XB8, 0X54, 0X8D, 0X14, 0X64, 0XB3, 0X13,
+    0XC0, 0X00, 0X02, 0X49, 0X35, 0XE5, 0X57, 0X7F, 0XB4, 0X47, 0XC3, 0X38, 0X2D, 0X66, 0X96, 0X2D,
+    0X7E, 0X5B, 0X99, 0X23, 0X46, 0X75, 0X86, 0X2B, 0X1B, 0X80, 0XF2, 0X10, 0X32, 0X15, 0X4B, 0X20,
+    0X5C, 0X9E, 0X83, 0X24, 0X0F, 0X52, 0X2B, 0XE7, 0X5F, 0X16, 0X7C, 0X57, 0XF1, 0X1F, 0XC5, 0X3D,
+    0X76, 0X48, 0XA3, 0XD0, 0XA5, 0X9B, 0X43, 0X8E, 0X10, 0X91, 0XE8, 0XAB, 0X79, 0X22, 0XDA, 0XB4,
+    0X84, 0X86, 0XDF, 0X74, 0XE8, 0X63, 0X32, 0X7D, 0XC6, 0X2A, 0X37, 0X20, 0X04, 0X26, 0X33, 0X86,
+    0X0F, 0X32, 0X92, 0X8A, 0XE6, 0X93, 0XB2, 0X35, 0X6D, 0X2D, 0X59, 0XEA, 0XBF, 0X14, 0XBE, 0X32,
+    0XDD, 0XEA, 0XBA, 0X36, 0XA2, 0X3C, 0X1D, 0X7F, 0X16, 0X8B, 0XE1, 0XC3, 0XA7, 0XCA, 0XE9, 0XAF,
+    0X5E, 0X45, 0X24, 0X53, 0XEA, 0X13, 0X70, 0XA2, 0X1B, 0X08, 0XCE, 0XD6, 0X62, 0X1B, 0XE4, 0X79,
+    0X30, 0X7C, 0XBD, 0XC5, 0XBE, 0X4D, 0XAA, 0X5F, 0XC9, 0X3E, 0X15, 0XF8, 0X2E, 0X5D, 0X32, 0X23,
+    0XAA, 0X6A, 0XB0, 0X2A, 0XDE, 0XCA, 0XA3, 0XC9, 0X8D, 0X87, 0XCF, 0X02, 0XF3, 0X92, 0X7D, 0X18,
+    0XE7, 0XA7, 0X50, 0X38, 0XEE, 0X40, 0XDB, 0XD0, 0XBC, 0X2F, 0XA8, 0XEA, 0X3A, 0XAD, 0XA6, 0XBB,
+    0XE3, 0X2B, 0XB5, 0XBD, 0XD4, 0XE1, 0XB7, 0X8E, 0X0B, 0X6B, 0X64, 0X89, 0X23, 0X86, 0XC9, 0X10,
+    0X61, 0X11, 0X11, 0X00, 0X40, 0X14, 0X63, 0X01, 0X40, 0X50, 0X4B, 0X1E, 0X49, 0XDD, 0X5D, 0XED,
+    0XBD, 0XB7, 0X4E, 0X2B, 0X8A, 0X55, 0X1E, 0X2E, 0X5E, 0XCA, 0X97, 0XC3, 0XD5, 0X9C, 0XF3, 0XC4,
+    0XC5, 0X3B, 0X44, 0XAF, 0X6F, 0X6D, 0XED, 0X5C, 0X3F, 0X8A, 0XD7, 0X66, 0XBF, 0X74, 0XBE, 0X9B,
+    0X3F, 0XF4, 0X01, 0X5E, 0XA3, 0X0D, 0XBE, 0X31, 0XC5, 0X79, 0XA7, 0X8D, 0X57, 0X6F, 0X89, 0XAF,
+    0X07, 0XA6, 0XCF, 0XFD, 0X01, 0X6B, 0XB7, 0X30, 0XC1, 0XAC, 0X3E, 0X0E, 0X2F, 0XCD, 0X7E, 0X4C,
+    0XFA, 0X6E, 0X11, 0XAB, 0XCF, 0X8C, 0X92, 0XFE, 0XEB, 0XFC, 0XE2, 0X61, 0XD1, 0X45, 0X15, 0XE0,
+    0X1F, 0XA2, 0X05, 0X14, 0X51, 0X40, 0X05, 0X14, 0X51, 0X40, 0X17, 0XB4, 0X21, 0X9D, 0X6F, 0X4F,
+    0X1E, 0XB7, 0X11, 0XFF, 0X00, 0XE8, 0X42, 0XBD, 0XA6, 0X0B, 0X6F, 0X6A, 0XF1, 0X9F, 0X0E, 0X0D,
+    0XDE, 0X21, 0XD2, 0XC7, 0XAD, 0XD4, 0X43, 0XFF, 0X00, 0X1F, 0X15, 0XEF, 0XF0, 0X5B, 0X74, 0XE2,
+    0X9D, 0X2C, 0X1F, 0XD6, 0X2A, 0XA7, 0XD8, 0XF2, 0X33, 0X2A, 0XBC, 0X92, 0X8A, 0X3C, 0XD2, 0X28,
+    0X31, 0XDA, 0XAC, 0X2C, 0X58, 0XAB, 0X0B, 0X1E, 0X29, 0X4A, 0XE2, 0XBF, 0X5E, 0X9D, 0X58, 0X61,
+    0XE0, 0X7F, 0X26, 0X53, 0XA9, 0X72, 0XB9, 0X5C, 0X54, 0X2E, 0X2A, 0XC3, 0X8A, 0XAD, 0X71, 0X24,
+    0X70, 0XC4, 0XF2, 0XCC, 0XEB, 0X1C, 0X48, 0XA5, 0X9D, 0XDC, 0XE0, 0X28, 0X1C, 0X92, 0X4F, 0X61,
+    0X5F, 0X0F, 0X9C, 0XE7, 0X76, 0XBC, 0X53, 0X3D, 0X7C, 0X36, 0XA4, 0X2E, 0X2B, 0X91, 0XF1, 0X5E,
+    0XA9, 0X6D, 0X2D, 0XC1, 0XD1, 0X6D, 0X34, 0XC8, 0XF5, 0X9D, 0X5B, 0X61, 0X99, 0X2D, 0X9D, 0X15,
+    0XA2, 0X84, 0XE3, 0X86, 0X90, 0XB1, 0XC2, 0XF0, 0X78, 0XEE, 0X72, 0X07, 0X1B, 0X81, 0XA6, 0XCB,
+    0XAA, 0X6A, 0X5E, 0X2C, 0X99, 0XED, 0X7C, 0X32, 0XCD, 0X67, 0XA4, 0XB4, 0X47, 0XCC, 0XD5, 0XA4,
+    0X85, 0X81, 0X62, 0X78, 0XDB, 0X08, 0X38, 0XC9, 0X18, 0X20, 0X9E, 0XDC, 0XF4, 0X20, 0X6E, 0XE9,
+    0XBC, 0X3B, 0XE1, 0XDD, 0X3F, 0X42, 0XB2, 0X5B, 0X6D, 0X3A, 0XDD, 0X63, 0X1B, 0X40, 0X79, 0X08,
+    0X1E, 0X64, 0XA4, 0X67, 0X97, 0X6E, 0XE7, 0X93, 0XEC, 0X33, 0XC6, 0X05, 0X7C, 0X1E, 0X2B, 0X14,
+    0XE3, 0X3E, 0X6A, 0XBA, 0XCB, 0XF9, 0X7B, 0X7F, 0X8B, 0XB7, 0XA6, 0XFD, 0XEC, 0X7D, 0X1D, 0X14,
+    0XB0, 0XFA, 0XD4, 0XF8, 0XBB, 0X7F, 0X9F, 0XF9, 0X6F, 0XE8, 0X73, 0X7E, 0X1B, 0XF0, 0X0D, 0X85,
+    0X9E, 0X6E, 0X75, 0X68, 0X6D, 0XAF, 0XAF, 0XE5, 0X40, 0X24, 0X06, 0X04, 0X10, 0X21, 0XFF, 0X00,
+    0X62, 0X30, 0XA0, 0X0E, 0XDC, 0XE3, 0X27, 0X19, 0XE3, 0X24, 0X57, 0X77, 0X0D, 0XBE, 0X71, 0XC5,
+    0X58, 0X86, 0XDF, 0XDA, 0XB4, 0X6D, 0XED, 0XBA, 0X71, 0X5B, 0XE0, 0XF0, 0XD5, 0X71, 0X93, 0XE7,
+    0XAA, 0XEF, 0XFD, 0X74, 0X35, 0X96, 0X2D, 0XC9, 0XDE, 0X4C, 0XAF, 0X6F, 0X6D, 0XED, 0X5A, 0X10,
+    0XDB, 0XE2, 0XAC, 0XC3, 0X6F, 0X8E, 0XD5, 0X6D, 0X21, 0XC5, 0X7E, 0X87, 0X96, 0XE0, 0X23, 0X4A,
+    0X29, 0XB1, 0X2C, 0X45, 0XCA, 0XE9, 0X0E, 0X05, 0X79, 0X27, 0X8F, 0X46, 0X3C, 0X59, 0X7C, 0X3F,
+    0XEB, 0X9F, 0XFE, 0X8B, 0X5A, 0XF6, 0X7D, 0X98, 0XAF, 0X1A, 0XF8, 0X81, 0XFF, 0X00, 0X23, 0X75,
+    0XFF, 0X00, 0XFD, 0XB3, 0XFF, 0X00, 0XD1, 0X6B, 0X58, 0X71, 0X05, 0X58, 0XBA, 0X11, 0XA6, 0XBB,
+    0XFE, 0X8C, 0XFB, 0XAE, 0X07, 0X97, 0X36, 0X3A, 0X7F, 0XE0, 0X7F, 0X9C, 0X4E, 0X76, 0X8A, 0X28,
+    0XAF, 0X91, 0X3F, 0X52, 0X0A, 0X28, 0XA2, 0X80, 0X0A, 0X28, 0XA2, 0X80, 0X35, 0X3C, 0X2C, 0X33,
+    0XE2, 0X7D, 0X20, 0X7A, 0XDE, 0X42, 0X3F, 0XF1, 0XF1, 0X5F, 0X49, 0XC5, 0X06, 0X2B, 0XE6, 0XFF,
+    0X00, 0X08, 0X0C, 0XF8, 0XB3, 0X45, 0X1F, 0XF4, 0XFB, 0X07, 0XFE, 0X8C, 0X5A, 0XFA, 0X7C, 0X47,
+    0X8A, 0XF7, 0X72, 0X85, 0X15, 0X19, 0X49, 0X9F, 0X33, 0X9E, 0XCF, 0X96, 0XAC, 0X17, 0X91, 0XE4,
+    0XE5, 0X71, 0X51, 0X3D, 0X58, 0X7A, 0XE4, 0X3C, 0X4B, 0XE2, 0X93, 0X69, 0X7E, 0XFA, 0X36, 0X87,
+    0X68, 0XFA, 0X9E, 0XBE, 0XD0, 0X99, 0X16, 0X04, 0X20, 0X47, 0X08, 0XE3, 0X0D, 0X2B, 0X12, 0X36,
+    0X8E, 0X72, 0X07, 0X53, 0XC0, 0XE3, 0X70, 0X35, 0XAE, 0X6B, 0X9C, 0X4A, 0X6D, 0XC2, 0X0C, 0XFE,
+    0X58, 0XC0, 0XD1, 0X9D, 0X79, 0X72, 0XC1, 0X7F, 0X92, 0X5D, 0XDB, 0XE8, 0XBC, 0XCB, 0X7E, 0X24,
+    0XD7, 0XB4, 0XEF, 0X0F, 0XD8, 0XB5, 0XCE, 0XA7, 0X70, 0X91, 0X8D, 0XA4, 0XA4, 0X40, 0X8F, 0X32,
+    0X52, 0X31, 0XC2, 0X2F, 0X73, 0XC8, 0XF6, 0X19, 0XE7, 0X03, 0X9A, 0XE6, 0XA0, 0XD1, 0X75, 0X3F,
+    0X16, 0XCC, 0X97, 0X7E, 0X27, 0X47, 0XB2, 0XD2, 0X1A, 0X21, 0XE5, 0XE9, 0X11, 0XCC, 0XC1, 0X98,
+    0X9E, 0X77, 0X4E, 0X46, 0XDC, 0X91, 0X80, 0X42, 0XF6, 0XE3, 0X38, 0X21, 0XB7, 0X6C, 0X78, 0X73,
+    0XC2, 0X8D, 0X6B, 0X7C, 0XBA, 0XC6, 0XB9, 0X76, 0XFA, 0X96, 0XBC, 0XD1, 0X08, 0XDA, 0X76, 0X00,
+    0X47, 0X08, 0XE7, 0X2B, 0X12, 0X80, 0X36, 0X8E, 0X70, 0X4F, 0X53, 0XC9, 0XE3, 0X71, 0X15, 0XD5,
+    0XC7, 0X0E, 0X7B, 0X57, 0XE7, 0XD8, 0XBC, 0XCB, 0XDE, 0XB5, 0X17, 0X79, 0X7F, 0X37, 0XFF, 0X00,
+    0X23, 0XFE, 0X7B, 0XF6, 0XB1, 0XF4, 0X54, 0XEB, 0XD3, 0XC3, 0X2E, 0X5A, 0X2E, 0XF2, 0XFE, 0X6F,
+    0XFE, 0X47, 0XFC, 0XDE, 0XBD, 0XAC, 0X54, 0XB6, 0XB5, 0X8E, 0X18, 0XA3, 0X8A, 0X18, 0XD6, 0X38,
+    0X91, 0X42, 0XA2, 0X20, 0XC0, 0X50, 0X38, 0X00, 0X0E, 0XC2, 0XAF, 0XC1, 0X6F, 0XED, 0X56, 0X21,
+    0XB7, 0XF6, 0XAD, 0X1B, 0X7B, 0X6F, 0X6A, 0XD3, 0X2D, 0XC0, 0X4A, 0XB4, 0XAE, 0XC4, 0XB1, 0X05,
+    0X6B, 0X7B, 0X6E, 0X9C, 0X56, 0X8C, 0X36, 0XFE, 0XD5, 0X62, 0X1B, 0X7C, 0X76, 0XAB, 0X89, 0X16,
+    0X3B, 0X57, 0XE8, 0XF9, 0X6E, 0X02, 0X34, 0XA2, 0X9B, 0X43, 0X58, 0X8B, 0X95, 0X92, 0X1C, 0X0E,
+    0X95, 0X26, 0XCC, 0X55, 0X8D, 0X98, 0XA6, 0X38, 0XAE, 0XDC, 0X66, 0X3A, 0X18, 0X78, 0X1D, 0X94,
+    0X67, 0X72, 0XBB, 0X8A, 0XF3, 0XAF, 0X15, 0X78, 0X37, 0X50, 0XD5, 0X75, 0XDB, 0XAB, 0XDB, 0X79,
+    0XAD, 0X16, 0X29, 0X76, 0XE0, 0X3B, 0X30, 0X6E, 0X14, 0X0E, 0X70, 0XA7, 0XD2, 0XBD, 0X19, 0XEA,
+    0X22, 0XB9, 0XAF, 0XCD, 0XB3, 0X7C, 0XF5, 0XF3, 0X68, 0XCF, 0XA9, 0XC9, 0XF3, 0X2A, 0XD9, 0X75,
+    0X47, 0X56, 0X83, 0XD5, 0XAB, 0X6B, 0XAE, 0X9A, 0X3F, 0XD0, 0XF2, 0X8F, 0XF8, 0X57, 0XDA, 0XAF,
+    0XFC, 0XFC, 0X58, 0XFF, 0X00, 0XDF, 0X6F, 0XFF, 0X00, 0XC4, 0XD2, 0X8F, 0X87, 0XBA, 0XB1, 0XE9,
+    0X3D, 0X8F, 0XFD, 0XF6, 0XFF, 0X00, 0XFC, 0X4D, 0X7A, 0XB2, 0XC7, 0X9A, 0XB3, 0X14, 0X19, 0XED,
+    0X5F, 0X37, 0X1C, 0XF3, 0X17, 0X52, 0X56, 0X8D, 0XBE, 0XE3, 0XEA, 0X63, 0XC5, 0X78, 0XE7, 0XBB,
+    0X5F, 0X71, 0XE4, 0X8B, 0XF0, 0XDF, 0X58, 0X6E, 0X97, 0X16, 0X1F, 0XF7, 0XDB, 0XFF, 0X00, 0XF1,
+    0X35, 0X32, 0X7C, 0X2E, 0XD6, 0XDF, 0XA5, 0XCE, 0X9F, 0XFF, 0X00, 0X7F, 0X1F, 0XFF, 0X00, 0X88,
+    0XAF, 0X64, 0X82, 0XDB, 0XDA, 0XB4, 0XA0, 0XB7, 0XF6, 0XAF, 0XA6, 0XCB, 0XBE, 0XB3, 0X88, 0XB7,
+    0X3F, 0XE4, 0X5F, 0XFA, 0XD7, 0X8C, 0XEE, 0XBE, 0XE3, 0XC4, 0X17, 0XE1, 0X36, 0XBC, 0XDD, 0X2E,
+    0XB4, 0XDF, 0XFB, 0XF9, 0X27, 0XFF, 0X00, 0X11, 0X52, 0X0F, 0X84, 0X1A, 0XF9, 0XFF, 0X00, 0X97,
+    0XBD, 0X2F, 0XFE, 0XFE, 0XC9, 0XFF, 0X00, 0XC4, 0X57, 0XBC, 0XC5, 0X0E, 0X3B, 0X54, 0XE2, 0X3C,
+    0X57, 0XD5, 0X53, 0XCB, 0XE9, 0X28, 0XDE, 0XA1, 0X71, 0XE2, 0X8C, 0X6B, 0XEA, 0XBE, 0XE3, 0XC4,
+    0X34, 0X0F, 0X85, 0X3A, 0XE6, 0X9F, 0XAE, 0XE9, 0XB7, 0XB3, 0XDD, 0X69, 0XAD, 0X15, 0XB5, 0XCC,
+    0X73, 0X38, 0X49, 0X1C, 0XB1, 0X55, 0X60, 0X4E, 0X3E, 0X4E, 0XBC, 0X57, 0XB3, 0X30, 0XC5, 0X58,
+    0X61, 0X8A, 0X85, 0XEB, 0XCD, 0XC6, 0X63, 0X69, 0X60, 0XA0, 0XE3, 0X4C, 0X2A, 0XE6, 0X15, 0X71,
+    0XB2, 0X52, 0XAB, 0XD0, 0XF9, 0X92, 0XE3, 0X5A, 0XD5, 0X7C, 0X65, 0X3C, 0X96, 0X7E, 0X13, 0X77,
+    0XB1, 0XD1, 0X5A, 0X13, 0XE6, 0X6B, 0X52, 0XC0, 0XE1, 0X9D, 0X89, 0XC6, 0XD8, 0X14, 0XED, 0XC9,
+    0X18, 0X20, 0XB7, 0X6E, 0X71, 0X82, 0X17, 0X77, 0X49, 0XE1, 0XBF, 0X0D, 0XE9, 0XBE, 0X1D, 0XB0,
+    0X4B, 0X5D, 0X2E, 0XD9, 0X23, 0X01, 0X40, 0X79, 0X48, 0X1E, 0X64, 0XA4, 0X67, 0X97, 0X6E, 0XE7,
+    0X93, 0XEC, 0X33, 0X81, 0X81, 0XC5, 0X14, 0X57, 0XCA, 0X67, 0X78, 0X9A, 0X91, 0XAB, 0X2A, 0X09,
+    0XFB, 0XAB, 0XF1, 0XF5, 0XFE, 0XBD, 0X0F, 0XC2, 0X73, 0X06, 0XF0, 0XB5, 0XA7, 0X82, 0XA5, 0XA4,
+    0X22, 0XFE, 0X6F, 0XCE, 0X4F, 0XAB, 0XFC, 0X17, 0X44, 0X8D, 0XA8, 0XE1, 0XCF, 0X6A, 0XB9, 0X0D,
+    0XBE, 0X7B, 0X51, 0X45, 0X71, 0X65, 0XF4, 0XE3, 0X39, 0X2B, 0X9C, 0XAA, 0X6D, 0X1A, 0X30, 0X5B,
+    0X74, 0XE2, 0XB4, 0X61, 0XB7, 0XC7, 0X6A, 0X28, 0XAF, 0XD2, 0XF2, 0X9C, 0X3C, 0X12, 0X56, 0X43,
+    0XE7, 0X65, 0XB4, 0X8B, 0X1D, 0XAA, 0X4D, 0X98, 0XA2, 0X8A, 0XF7, 0X71, 0X13, 0X70, 0X87, 0XBA,
+    0X75, 0X52, 0X93, 0X6C, 0X8D, 0X85, 0X40, 0XF4, 0X51, 0X5F, 0X9D, 0X67, 0X78, 0XCA, 0XBA, 0XEA,
+    0X7B, 0X38, 0X62, 0X22, 0XB9, 0XA5, 0X58, 0XF3, 0XDA, 0X8A, 0X2B, 0XF3, 0XAA, 0XF5, 0X65, 0X39,
+    0XFB, 0XCC, 0XF6, 0X69, 0X36, 0X8B, 0X31, 0X41, 0X9C, 0X71, 0X57, 0XE0, 0XB6, 0XE9, 0XC5, 0X14,
+    0X57, 0XBB, 0X94, 0XD0, 0X84, 0X9A, 0XB9, 0XD2, 0XA6, 0XCD, 0X18, 0X2D, 0XFD, 0XAA, 0XF4, 0X50,
+    0XE3, 0XB5, 0X14, 0X57, 0XE9, 0X79, 0X7D, 0X18, 0X46, 0X2A, 0XC8, 0XA8, 0XCD, 0X93, 0X88, 0XF1,
+    0X43, 0X0C, 0X51, 0X45, 0X2C, 0XC6, 0XBC, 0XE1, 0X0F, 0X74, 0XED, 0XA0, 0XC8, 0X5E, 0XA0, 0X61,
+    0X45, 0X15, 0XF9, 0X5E, 0X73, 0X8B, 0XAA, 0XDB, 0XD4, 0XF7, 0X30, 0XE7, 0XFF, 0XD9
+};
+
+#endif
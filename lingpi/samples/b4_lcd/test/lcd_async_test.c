@@ -0,0 +1,173 @@
+/*
+ * Copyright (c) 2022 FuZhou Lockzhiner Electronic Co., Ltd. All rights reserved.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+/* 异步刷新测试：用LCD_ENABLE_ASYNC=1编译，模拟慢速总线，两个全屏离屏
+ * 缓冲区交替渲染和发送。检查lcd_flush_async()立即返回、每帧的屏幕
+ * 内容正确、每个缓冲区各自记录脏矩形、发送期间调用者可以继续渲染，
+ * 以及后台任务创建失败时同步发送
+ */
+#include <stdio.h>
+#include <time.h>
+#include "lcd.h"
+#include "picture.h"
+#include "lcd_sim.h"
+#include "los_task.h"
+#include "lcd_test.h"
+
+#define FRAME_NUM               6
+#define FRAME_PIXELS            (LCD_PANEL_W * LCD_PANEL_H)
+#define FRAME_BYTES             (FRAME_PIXELS * 2)
+/* 慢速总线每个字节50ns，即160Mbit/s以下的SPI，整帧约7.7ms */
+#define SLOW_BYTE_NS            50
+/* 检查渲染与发送重叠时每个字节200ns，整帧约31ms */
+#define OVERLAP_BYTE_NS         200
+#define OVERLAP_FRAMES_MAX      1000
+#define NSEC_PER_SEC            1000000000ULL
+
+static uint16_t m_buf[2][FRAME_PIXELS];
+static uint32_t m_ref[FRAME_NUM];
+static volatile uint32_t m_done = 0;
+
+static uint64_t now_ns(void)
+{
+    struct timespec ts;
+    
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint64_t)ts.tv_sec * NSEC_PER_SEC + (uint64_t)ts.tv_nsec;
+}
+
+
+/* 在白色背景上重画每帧的全部内容，只有数值不同 */
+static void draw_frame(uint32_t i)
+{
+    lcd_show_picture_rle(15, 0, IMAGE_LENGTH_LINGZHI, IMAGE_WIDTH_LINGZHI,
+                         gImage_lingzhi_rle, IMAGE_RLE_SIZE_LINGZHI);
+    lcd_show_string(0, 130, (const uint8_t *)"Welcome to XiaoLingPai!", LCD_RED, LCD_WHITE, LCD_FONT_SIZE16, 0);
+    lcd_show_int_num(128, 190, (uint16_t)(i * 111), 4, LCD_BLACK, LCD_WHITE, LCD_FONT_SIZE16);
+    lcd_draw_circle(120, 240, 40, LCD_RED);
+}
+
+
+static void on_flushed(void *arg)
+{
+    (void)arg;
+    m_done++;
+}
+
+
+int main(void)
+{
+    lcd_sim_stats_t stats;
+    lcd_bus_stats_t bus;
+    uint64_t start, submit_ns, total_ns;
+    uint32_t i, bytes, overlap = 0;
+    
+    /* 后台刷新任务创建失败：lcd_init()报错，lcd_flush_async()同步发送并调用回调 */
+    printf("simulating a failed flush task:\n");
+    lcd_sim_reset();
+    los_stub_set_task_fail(1);
+    LCD_TEST_CHECK(lcd_init() != 0, "lcd_init succeeded without the flush task");
+    los_stub_set_task_fail(0);
+    lcd_fill(0, 0, LCD_W, LCD_H, LCD_WHITE);
+    draw_frame(0);
+    m_ref[0] = lcd_sim_hash();
+    lcd_fill(0, 0, LCD_W, LCD_H, LCD_GRAY);
+    lcd_framebuffer_enable(m_buf[0], 0, 0, LCD_PANEL_W, LCD_PANEL_H);
+    lcd_fill(0, 0, LCD_W, LCD_H, LCD_WHITE);
+    draw_frame(0);
+    lcd_flush_async(on_flushed, NULL);
+    LCD_TEST_CHECK(m_done == 1, "fallback flush did not call back before returning");
+    LCD_TEST_CHECK(lcd_sim_hash() == m_ref[0], "fallback flush frame differs");
+    lcd_framebuffer_disable();
+    
+    lcd_sim_reset();
+    LCD_TEST_CHECK(lcd_init() == 0, "lcd_init failed");
+    lcd_fill(0, 0, LCD_W, LCD_H, LCD_WHITE);
+    for (i = 0; i < FRAME_NUM; i++) {
+        draw_frame(i);
+        m_ref[i] = lcd_sim_hash();
+    }
+    
+    /* 逐帧等待发送完成，检查内容和每帧发送的字节数 */
+    lcd_fill(0, 0, LCD_W, LCD_H, LCD_GRAY);
+    lcd_sim_set_byte_ns(SLOW_BYTE_NS);
+    m_done = 0;
+    for (i = 0; i < FRAME_NUM; i++) {
+        lcd_framebuffer_enable(m_buf[i & 1], 0, 0, LCD_PANEL_W, LCD_PANEL_H);
+        if (i < 2) {
+            lcd_fill(0, 0, LCD_W, LCD_H, LCD_WHITE);
+        }
+        draw_frame(i);
+        lcd_sim_reset_stats();
+        start = now_ns();
+        lcd_flush_async(on_flushed, NULL);
+        submit_ns = now_ns() - start;
+        lcd_flush_wait();
+        lcd_sim_get_stats(&stats);
+        printf("frame %u: %7u bytes, submit %6llu ns\n", i, stats.bytes, (unsigned long long)submit_ns);
+        LCD_TEST_CHECK(lcd_sim_hash() == m_ref[i], "frame %u differs", i);
+        /* 整帧发送时，提交时间应远小于总线传输时间 */
+        if (i < 2) {
+            LCD_TEST_CHECK(submit_ns < (uint64_t)stats.bytes * SLOW_BYTE_NS / 2,
+                           "frame %u: lcd_flush_async took %llu ns", i, (unsigned long long)submit_ns);
+        }
+        /* 每个缓冲区第一次发送整帧，之后只发送数值变化的区域 */
+        if (i >= 2) {
+            LCD_TEST_CHECK(stats.bytes < FRAME_BYTES / 100, "frame %u sent %u bytes", i, stats.bytes);
+        }
+    }
+    LCD_TEST_CHECK(m_done == FRAME_NUM, "%u callbacks for %u frames", m_done, FRAME_NUM);
+    
+    /* 渲染下一帧的同时发送上一帧 */
+    m_done = 0;
+    start = now_ns();
+    for (i = 0; i < FRAME_NUM; i++) {
+        lcd_framebuffer_enable(m_buf[i & 1], 0, 0, LCD_PANEL_W, LCD_PANEL_H);
+        draw_frame(FRAME_NUM - 1 - i);
+        lcd_flush_async(on_flushed, NULL);
+    }
+    lcd_flush_wait();
+    total_ns = now_ns() - start;
+    lcd_framebuffer_disable();
+    printf("pipelined %u frames: %llu us\n", FRAME_NUM, (unsigned long long)(total_ns / 1000));
+    LCD_TEST_CHECK(lcd_sim_hash() == m_ref[0], "pipelined last frame differs");
+    LCD_TEST_CHECK(m_done == FRAME_NUM, "%u callbacks for %u frames", m_done, FRAME_NUM);
+    
+    /* 发送整帧期间在另一个缓冲区中继续渲染，并读取总线统计 */
+    lcd_sim_set_byte_ns(OVERLAP_BYTE_NS);
+    lcd_framebuffer_enable(m_buf[0], 0, 0, LCD_PANEL_W, LCD_PANEL_H);
+    lcd_fill(0, 0, LCD_W, LCD_H, LCD_BLUE);
+    m_done = 0;
+    lcd_get_bus_stats(&bus);
+    bytes = bus.bytes;
+    lcd_flush_async(on_flushed, NULL);
+    lcd_framebuffer_enable(m_buf[1], 0, 0, LCD_PANEL_W, LCD_PANEL_H);
+    for (i = 0; (i < OVERLAP_FRAMES_MAX) && (m_done == 0); i++) {
+        draw_frame(i);
+        lcd_get_bus_stats(&bus);
+        LCD_TEST_CHECK(bus.bytes >= bytes, "bus bytes went back from %u to %u", bytes, bus.bytes);
+        bytes = bus.bytes;
+        if (m_done == 0) {
+            overlap++;
+        }
+    }
+    lcd_flush_wait();
+    lcd_framebuffer_disable();
+    printf("rendered %u frames during one slow flush\n", overlap);
+    LCD_TEST_CHECK(overlap > 0, "no frame was rendered while the flush task was sending");
+    LCD_TEST_CHECK(m_done == 1, "%u callbacks for 1 frame", m_done);
+    
+    lcd_sim_set_byte_ns(0);
+    return LCD_TEST_RESULT();
+}
@@ -0,0 +1,125 @@
+/*
+ * Copyright (c) 2022 FuZhou Lockzhiner Electronic Co., Ltd. All rights reserved.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+/* 总线开销基准：逐个运行测试用例，报告总线传输次数、字节数和按指定
+ * SPI时钟计算的传输时间。传输统计从模拟面板解码的总线数据得到，
+ * 并与驱动自己的lcd_get_bus_stats()核对
+ *
+ * 用法: lcd_bench [-c 时钟Hz] [-t 每次传输的开销ns] [-o 目录] [用例名...]
+ */
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <unistd.h>
+#include "lcd.h"
+#include "lcd_sim.h"
+#include "lcd_cases.h"
+
+/* 默认的SPI时钟，与lcd.c中LzSpiConfig的speed一致 */
+#define BENCH_CLOCK_DEFAULT     50000000
+#define PATH_MAX_LEN            256
+#define NSEC_PER_USEC           1000
+#define USEC_PER_SEC            1000000
+
+static bool bench_selected(const char *name, int argc, char **argv)
+{
+    int i;
+    
+    if (optind >= argc) {
+        return true;
+    }
+    for (i = optind; i < argc; i++) {
+        if (strcmp(argv[i], name) == 0) {
+            return true;
+        }
+    }
+    return false;
+}
+
+
+int main(int argc, char **argv)
+{
+    uint32_t clock_hz = BENCH_CLOCK_DEFAULT;
+    uint32_t overhead_ns = 0;
+    const char *dir = NULL;
+    char path[PATH_MAX_LEN];
+    lcd_sim_stats_t sim, total = {0};
+    lcd_bus_stats_t drv;
+    clock_t start;
+    uint32_t i, cpu_us, failed = 0;
+    int opt;
+    
+    while ((opt = getopt(argc, argv, "c:t:o:")) != -1) {
+        if (opt == 'c') {
+            clock_hz = (uint32_t)strtoul(optarg, NULL, 0);
+        } else if (opt == 't') {
+            overhead_ns = (uint32_t)strtoul(optarg, NULL, 0);
+        } else if (opt == 'o') {
+            dir = optarg;
+        } else {
+            fprintf(stderr, "usage: %s [-c clock_hz] [-t overhead_ns] [-o dir] [case...]\n", argv[0]);
+            return 1;
+        }
+    }
+    
+    lcd_sim_reset();
+    if (lcd_init() != 0) {
+        printf("lcd_init failed\n");
+        return 1;
+    }
+    
+    printf("SPI clock %u Hz, %u ns per transaction\n", clock_hz, overhead_ns);
+    printf("%-16s %8s %10s %8s %10s %10s %10s\n",
+           "case", "trans", "bytes", "cmds", "pixels", "bus_us", "cpu_us");
+    for (i = 0; i < g_lcd_case_num; i++) {
+        if (!bench_selected(g_lcd_cases[i].name, argc, argv)) {
+            continue;
+        }
+        lcd_case_prepare();
+        lcd_sim_reset_stats();
+        lcd_reset_bus_stats();
+        
+        start = clock();
+        g_lcd_cases[i].run();
+        cpu_us = (uint32_t)((uint64_t)(clock() - start) * USEC_PER_SEC / CLOCKS_PER_SEC);
+        
+        lcd_sim_get_stats(&sim);
+        lcd_get_bus_stats(&drv);
+        printf("%-16s %8u %10u %8u %10u %10llu %10u\n", g_lcd_cases[i].name,
+               sim.transactions, sim.bytes, sim.commands, sim.pixels,
+               (unsigned long long)(lcd_sim_time_ns(&sim, clock_hz, overhead_ns) / NSEC_PER_USEC), cpu_us);
+        /* 驱动的统计应与总线上实际传输的一致 */
+        if ((drv.transactions != sim.transactions) || (drv.bytes != sim.bytes) ||
+            (drv.commands != sim.commands)) {
+            printf("  driver stats differ: trans %u bytes %u cmds %u\n",
+                   drv.transactions, drv.bytes, drv.commands);
+            failed++;
+        }
+        
+        total.transactions += sim.transactions;
+        total.bytes += sim.bytes;
+        total.commands += sim.commands;
+        total.pixels += sim.pixels;
+        if (dir != NULL) {
+            snprintf(path, sizeof(path), "%s/%s.ppm", dir, g_lcd_cases[i].name);
+            lcd_sim_dump_ppm(path);
+        }
+    }
+    printf("%-16s %8u %10u %8u %10u %10llu\n", "total",
+           total.transactions, total.bytes, total.commands, total.pixels,
+           (unsigned long long)(lcd_sim_time_ns(&total, clock_hz, overhead_ns) / NSEC_PER_USEC));
+    
+    return (failed == 0) ? 0 : 1;
+}
@@ -0,0 +1,66 @@
+/*
+ * Copyright (c) 2022 FuZhou Lockzhiner Electronic Co., Ltd. All rights reserved.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+/* 总线切换测试：模拟SPI方式编译时，GPIO和GPIO_REG两种写入方式运行
+ * 同样的用例，屏幕内容和总线传输应当相同；并在模拟器上并排运行
+ * lcd_bus_benchmark()（模拟器的速度只反映解码开销，不代表开发板）
+ */
+#include <stdio.h>
+#include "lcd.h"
+#include "lcd_sim.h"
+#include "lcd_cases.h"
+#include "lcd_test.h"
+
+#define BENCH_FRAMES            2
+
+/* 用指定的写入方式运行用例，返回屏幕哈希 */
+static uint32_t run_case(const lcd_case_t *c, uint8_t bus, lcd_sim_stats_t *stats)
+{
+    lcd_set_bus(bus);
+    lcd_case_prepare();
+    lcd_sim_reset_stats();
+    c->run();
+    lcd_sim_get_stats(stats);
+    return lcd_sim_hash();
+}
+
+
+int main(void)
+{
+    lcd_sim_stats_t gpio, reg;
+    uint32_t i, hash;
+    
+    lcd_sim_reset();
+    lcd_init();
+    LCD_TEST_CHECK(lcd_get_bus() == LCD_BUS_GPIO, "default bus %u", lcd_get_bus());
+    LCD_TEST_CHECK(lcd_set_bus(LCD_BUS_SPI) != 0, "switched to hardware SPI");
+    LCD_TEST_CHECK(lcd_get_bus() == LCD_BUS_GPIO, "bus changed by a failed switch");
+    
+    for (i = 0; i < g_lcd_case_num; i++) {
+        hash = run_case(&g_lcd_cases[i], LCD_BUS_GPIO, &gpio);
+        LCD_TEST_CHECK(run_case(&g_lcd_cases[i], LCD_BUS_GPIO_REG, &reg) == hash,
+                       "%s: frames differ", g_lcd_cases[i].name);
+        LCD_TEST_CHECK((gpio.bytes == reg.bytes) && (gpio.transactions == reg.transactions),
+                       "%s: gpio %u bytes/%u trans, gpio_reg %u bytes/%u trans", g_lcd_cases[i].name,
+                       gpio.bytes, gpio.transactions, reg.bytes, reg.transactions);
+    }
+    
+    lcd_set_bus(LCD_BUS_GPIO);
+    printf("simulated gpio:     %u bytes/s\n", lcd_bus_benchmark(BENCH_FRAMES));
+    lcd_set_bus(LCD_BUS_GPIO_REG);
+    printf("simulated gpio_reg: %u bytes/s\n", lcd_bus_benchmark(BENCH_FRAMES));
+    LCD_TEST_CHECK(lcd_get_bus() == LCD_BUS_GPIO_REG, "bus %u", lcd_get_bus());
+    
+    return LCD_TEST_RESULT();
+}
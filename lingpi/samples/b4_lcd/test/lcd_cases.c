@@ -0,0 +1,473 @@
+/*
+ * Copyright (c) 2022 FuZhou Lockzhiner Electronic Co., Ltd. All rights reserved.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+/* 覆盖lcd.h及各扩展模块公开接口的测试用例，由lcd_golden和lcd_bench共用 */
+#include <stddef.h>
+#include "lcd.h"
+#include "lcd_console.h"
+#include "lcd_scene.h"
+#include "lcd_sprite.h"
+#include "lcd_text.h"
+#include "lcd_widget.h"
+#include "picture.h"
+#include "lcd_cases.h"
+
+/* 用例使用的RGB565测试图片，左上到右下渐变，中间有透明色方块 */
+#define PATTERN_W               64
+#define PATTERN_H               48
+#define PATTERN_KEY             LCD_MAGENTA
+
+static uint8_t m_pattern[PATTERN_W * PATTERN_H * 2];
+static uint16_t m_framebuffer[LCD_PANEL_W * LCD_PANEL_H];
+
+/* 4bpp索引图片和调色板 */
+#define INDEXED_W               32
+#define INDEXED_H               24
+static uint8_t m_indexed[INDEXED_W * INDEXED_H / 2];
+static const uint16_t m_palette[16] = {
+    LCD_BLACK, LCD_WHITE, LCD_RED, LCD_GREEN, LCD_BLUE, LCD_YELLOW, LCD_CYAN, LCD_MAGENTA,
+    LCD_GRAY, LCD_BROWN, LCD_BRRED, LCD_DARKBLUE, LCD_LIGHTBLUE, LCD_GRAYBLUE, LCD_LIGHTGREEN, LCD_LGRAY
+};
+
+/* 只有"A"、"B"两个字形的8x8单色字体 */
+static const uint8_t m_font_bitmap[] = {
+    0x18, 0x24, 0x42, 0x42, 0x7E, 0x42, 0x42, 0x00,
+    0x7C, 0x42, 0x42, 0x7C, 0x42, 0x42, 0x7C, 0x00,
+};
+static const lcd_glyph_t m_font_glyphs[] = {
+    {0, 'A', 8, 8, 0, 1, 9},
+    {64, 'B', 8, 8, 0, 1, 9},
+};
+static const lcd_font_t m_font = {10, 8, 1, 2, m_font_glyphs, m_font_bitmap};
+
+/* 抗锯齿字体：4x4的"A"为从0到最大值的灰度渐变，5x4的"B"为最大灰度的
+ * 边框和中间的几级灰度，每行位数不是8的整数倍
+ */
+static const uint8_t m_font4_bitmap[] = {
+    0x01, 0x23, 0x45, 0x67, 0x89, 0xAB, 0xCD, 0xEF,
+    0xFF, 0xFF, 0xFF, 0x04, 0x0F, 0xF8, 0x78, 0xFF, 0xFF, 0xFF,
+};
+static const lcd_glyph_t m_font4_glyphs[] = {
+    {0, 'A', 4, 4, 1, 1, 6},
+    {64, 'B', 5, 4, 1, 1, 7},
+};
+static const lcd_font_t m_font4 = {6, 5, 4, 2, m_font4_glyphs, m_font4_bitmap};
+
+static const uint8_t m_font2_bitmap[] = {
+    0x1B, 0x1B, 0x1B, 0x1B,
+    0xFF, 0xF1, 0x3E, 0x6F, 0xFF,
+};
+static const lcd_glyph_t m_font2_glyphs[] = {
+    {0, 'A', 4, 4, 1, 1, 6},
+    {32, 'B', 5, 4, 1, 1, 7},
+};
+static const lcd_font_t m_font2 = {6, 5, 2, 2, m_font2_glyphs, m_font2_bitmap};
+
+static void case_make_pattern(void)
+{
+    uint16_t x, y, color;
+    uint32_t k = 0;
+    
+    for (y = 0; y < PATTERN_H; y++) {
+        for (x = 0; x < PATTERN_W; x++) {
+            color = (uint16_t)(((x >> 1) << 11) | (y << 5) | ((x + y) >> 2));
+            if ((x >= 24) && (x < 40) && (y >= 16) && (y < 32)) {
+                color = PATTERN_KEY;
+            }
+            m_pattern[k++] = (uint8_t)(color >> 8);
+            m_pattern[k++] = (uint8_t)color;
+        }
+    }
+    for (k = 0; k < sizeof(m_indexed); k++) {
+        m_indexed[k] = (uint8_t)(((k % 16) << 4) | ((k / 16) % 16));
+    }
+}
+
+
+void lcd_case_prepare(void)
+{
+    static bool made = false;
+    
+    if (!made) {
+        case_make_pattern();
+        made = true;
+    }
+    lcd_framebuffer_disable();
+    lcd_set_rotation(LCD_ROTATE_0, LCD_MIRROR_NONE);
+    lcd_set_scroll_area(0, LCD_PANEL_H);
+    lcd_set_scroll_start(0);
+    lcd_fill(0, 0, LCD_W, LCD_H, LCD_WHITE);
+}
+
+
+static void case_fill(void)
+{
+    lcd_fill(0, 0, LCD_W, LCD_H, LCD_BLUE);
+    lcd_fill(10, 10, 50, 40, LCD_RED);
+}
+
+
+static void case_draw_point(void)
+{
+    uint16_t i;
+    
+    for (i = 0; i < 32; i++) {
+        lcd_draw_point(3 + i * 7, 3 + i * 9, LCD_RED);
+    }
+}
+
+
+static void case_draw_line(void)
+{
+    lcd_draw_line(10, 10, 200, 150, LCD_GREEN);
+    lcd_draw_line(200, 10, 190, 300, LCD_GREEN);
+    lcd_draw_line(100, 10, 10, 30, LCD_RED);
+    lcd_draw_line(5, 300, 230, 300, LCD_BLUE);
+    lcd_draw_line(50, 250, 50, 50, LCD_BLUE);
+    lcd_draw_line(60, 60, 60, 60, LCD_BLACK);
+}
+
+
+static void case_draw_rectangle(void)
+{
+    lcd_draw_rectangle(20, 20, 100, 90, LCD_BLUE);
+    lcd_draw_rectangle(120, 200, 121, 300, LCD_RED);
+}
+
+
+static void case_fill_rectangle(void)
+{
+    lcd_fill_rectangle(20, 20, 200, 120, LCD_RED);
+    lcd_fill_rectangle(30, 200, 30, 250, LCD_BLUE);
+}
+
+
+static void case_draw_circle(void)
+{
+    lcd_draw_circle(120, 160, 50, LCD_RED);
+    lcd_draw_circle(120, 160, 5, LCD_RED);
+    lcd_draw_circle(10, 10, 30, LCD_BLUE);
+}
+
+
+static void case_fill_circle(void)
+{
+    lcd_fill_circle(120, 160, 50, LCD_RED);
+    lcd_fill_circle(230, 310, 20, LCD_GREEN);
+}
+
+
+static void case_round_rect(void)
+{
+    lcd_draw_round_rect(20, 20, 200, 120, 15, LCD_RED);
+    lcd_fill_round_rect(20, 150, 200, 250, 15, LCD_BLUE);
+    lcd_fill_round_rect(20, 270, 40, 280, 30, LCD_GREEN);
+}
+
+
+static void case_show_char(void)
+{
+    lcd_show_char(10, 10, 'A', LCD_RED, LCD_WHITE, LCD_FONT_SIZE12, 0);
+    lcd_show_char(30, 10, 'g', LCD_RED, LCD_WHITE, LCD_FONT_SIZE16, 0);
+    lcd_show_char(50, 10, '@', LCD_BLUE, LCD_WHITE, LCD_FONT_SIZE24, 0);
+    lcd_show_char(80, 10, '8', LCD_BLUE, LCD_WHITE, LCD_FONT_SIZE32, 1);
+}
+
+
+static void case_show_string(void)
+{
+    lcd_show_string(0, 130, (const uint8_t *)"Welcome to XiaoLingPai!", LCD_RED, LCD_WHITE, LCD_FONT_SIZE16, 0);
+    lcd_show_string(0, 100, (const uint8_t *)"Hello 123", LCD_RED, LCD_WHITE, LCD_FONT_SIZE12, 0);
+    lcd_show_string(0, 70, (const uint8_t *)"AbC", LCD_BLUE, LCD_WHITE, LCD_FONT_SIZE24, 0);
+    lcd_show_string(100, 70, (const uint8_t *)"Xy", LCD_BLUE, LCD_WHITE, LCD_FONT_SIZE32, 1);
+}
+
+
+static void case_show_number(void)
+{
+    lcd_show_int_num(128, 160, 240, 3, LCD_BLUE, LCD_WHITE, LCD_FONT_SIZE16);
+    lcd_show_int_num(128, 180, 7, 4, LCD_BLUE, LCD_WHITE, LCD_FONT_SIZE16);
+    lcd_show_float_num1(128, 200, 3.14f, 4, LCD_BLACK, LCD_WHITE, LCD_FONT_SIZE16);
+}
+
+
+static void case_show_chinese(void)
+{
+    lcd_show_chinese(0, 10, (uint8_t *)"小凌派", LCD_RED, LCD_WHITE, LCD_FONT_SIZE12, 0);
+    lcd_show_chinese(0, 30, (uint8_t *)"小凌派", LCD_RED, LCD_WHITE, LCD_FONT_SIZE16, 0);
+    lcd_show_chinese(0, 60, (uint8_t *)"小凌派", LCD_RED, LCD_WHITE, LCD_FONT_SIZE24, 0);
+    lcd_show_chinese(0, 100, (uint8_t *)"小凌派", LCD_RED, LCD_WHITE, LCD_FONT_SIZE32, 0);
+    lcd_show_chinese(100, 100, (uint8_t *)"小凌派", LCD_BLUE, LCD_WHITE, LCD_FONT_SIZE16, 1);
+    lcd_show_chinese(0, 150, (uint8_t *)"Hi小凌派V2", LCD_BLACK, LCD_YELLOW, LCD_FONT_SIZE16, 0);
+}
+
+
+static void case_show_picture(void)
+{
+    lcd_show_picture_rle(15, 0, IMAGE_LENGTH_LINGZHI, IMAGE_WIDTH_LINGZHI,
+                         gImage_lingzhi_rle, IMAGE_RLE_SIZE_LINGZHI);
+    lcd_show_picture(20, 100, PATTERN_W, PATTERN_H, m_pattern);
+    lcd_show_indexed_picture(120, 100, INDEXED_W, INDEXED_H, m_indexed, 4, m_palette, LCD_INDEX_NO_KEY);
+    lcd_show_indexed_picture(120, 150, INDEXED_W, INDEXED_H, m_indexed, 4, m_palette, 0);
+}
+
+
+static void case_blit(void)
+{
+    lcd_fill(0, 0, LCD_W, 100, LCD_GRAY);
+    lcd_blit(-20, -10, m_pattern, PATTERN_W, 0, 0, PATTERN_W, PATTERN_H, LCD_BLIT_NO_KEY);
+    lcd_blit(100, 20, m_pattern, PATTERN_W, 16, 8, 40, 30, PATTERN_KEY);
+    lcd_blit(210, 300, m_pattern, PATTERN_W, 0, 0, PATTERN_W, PATTERN_H, PATTERN_KEY);
+}
+
+
+static void case_stream(void)
+{
+    static const uint16_t pixels[] = {LCD_RED, LCD_GREEN, LCD_BLUE, LCD_BLACK};
+    static const uint8_t raw[] = {0x07, 0xE0, 0xF8, 0x00};
+    uint16_t i;
+    
+    lcd_stream_begin(10, 10, 109, 59);
+    for (i = 0; i < 1000; i++) {
+        lcd_stream_push(pixels, 4);
+    }
+    lcd_stream_push_color(LCD_YELLOW, 800);
+    for (i = 0; i < 600; i++) {
+        lcd_stream_push_raw(raw, sizeof(raw));
+    }
+    lcd_stream_end();
+}
+
+
+static void case_framebuffer(void)
+{
+    lcd_framebuffer_enable(m_framebuffer, 0, 0, LCD_PANEL_W, LCD_PANEL_H);
+    lcd_fill(0, 0, LCD_W, LCD_H, LCD_WHITE);
+    lcd_flush();
+    lcd_show_string(10, 10, (const uint8_t *)"Frame 1", LCD_BLACK, LCD_WHITE, LCD_FONT_SIZE16, 0);
+    lcd_draw_circle(120, 160, 40, LCD_RED);
+    lcd_flush();
+    lcd_show_string(10, 10, (const uint8_t *)"Frame 2", LCD_BLACK, LCD_WHITE, LCD_FONT_SIZE16, 0);
+    lcd_flush_async(NULL, NULL);
+    lcd_flush_wait();
+    lcd_framebuffer_disable();
+}
+
+
+static void case_band(void)
+{
+    uint16_t y;
+    
+    for (y = 0; y < LCD_PANEL_H; y += 40) {
+        lcd_framebuffer_enable(m_framebuffer, 0, y, LCD_PANEL_W, 40);
+        lcd_fill(0, 0, LCD_W, LCD_H, LCD_LGRAY);
+        lcd_fill_circle(120, 160, 100, LCD_BLUE);
+        lcd_show_string(20, 150, (const uint8_t *)"band", LCD_WHITE, LCD_BLUE, LCD_FONT_SIZE32, 1);
+        lcd_flush();
+    }
+    lcd_framebuffer_disable();
+}
+
+
+static void case_rotation(void)
+{
+    uint8_t rotation;
+    
+    for (rotation = LCD_ROTATE_0; rotation <= LCD_ROTATE_270; rotation++) {
+        lcd_set_rotation(rotation, (rotation == LCD_ROTATE_180) ? LCD_MIRROR_X : LCD_MIRROR_NONE);
+        lcd_show_string(4, 4 + rotation * 20, (const uint8_t *)"Rotate", LCD_RED, LCD_WHITE, LCD_FONT_SIZE16, 0);
+        lcd_fill(LCD_W - 20, LCD_H - 20, LCD_W, LCD_H, LCD_BLUE);
+    }
+}
+
+
+static void case_console(void)
+{
+    uint16_t i;
+    
+    lcd_console_init(40, 240, LCD_GREEN, LCD_BLACK, LCD_FONT_SIZE16);
+    for (i = 0; i < 30; i++) {
+        lcd_console_printf("line %u: %s\n", i, (i & 1) ? "odd" : "even");
+        if (i % 7 == 0) {
+            lcd_console_flush();
+        }
+    }
+    lcd_console_flush();
+    lcd_console_view(3);
+    lcd_console_view(0);
+    lcd_console_deinit();
+}
+
+
+/* 16号字每行30个字符：正好一行宽的文本后面的'\n'不产生空行，更长的文本折行 */
+static void case_console_wrap(void)
+{
+    lcd_console_init(40, 160, LCD_YELLOW, LCD_BLUE, LCD_FONT_SIZE16);
+    lcd_console_printf("%s\n", "012345678901234567890123456789");
+    lcd_console_printf("next\n");
+    lcd_console_printf("%s\n", "abcdefghijklmnopqrstuvwxyzABCDEFGHIJKLMNOPQRS");
+    lcd_console_printf("%s\r\n\n", "ABCDEFGHIJKLMNOPQRSTUVWXYZabcd");
+    lcd_console_printf("end\n");
+    lcd_console_flush();
+    lcd_console_deinit();
+}
+
+
+static void case_widget(void)
+{
+    lcd_label_t label;
+    lcd_number_t number;
+    lcd_progress_t bar;
+    
+    lcd_label_init(&label, 10, 40, 12, LCD_RED, LCD_WHITE, LCD_FONT_SIZE16);
+    lcd_label_set_text(&label, (const uint8_t *)"Hello world!");
+    lcd_label_set_text(&label, (const uint8_t *)"Help");
+    lcd_number_init(&number, 10, 10, 7, 2, LCD_BLACK, LCD_WHITE, LCD_FONT_SIZE16);
+    lcd_number_set(&number, 2345);
+    lcd_number_set(&number, -2346);
+    lcd_number_set_float(&number, 3.14159f);
+    lcd_progress_init(&bar, 10, 80, 200, 10, 100, LCD_BLUE, LCD_GRAY);
+    lcd_progress_set(&bar, 30);
+    lcd_progress_set(&bar, 70);
+    lcd_progress_set(&bar, 45);
+}
+
+
+static void case_scene(void)
+{
+    static const lcd_scene_cmd_t cmds[] = {
+        LCD_SCENE_CMD_FILL(0, 0, 239, 40, LCD_DARKBLUE),
+        LCD_SCENE_CMD_STRING(8, 12, "Dashboard", LCD_WHITE, LCD_DARKBLUE, LCD_FONT_SIZE16, 1),
+        LCD_SCENE_CMD_PICTURE_RLE(15, 60, IMAGE_LENGTH_LINGZHI, IMAGE_WIDTH_LINGZHI,
+                                  gImage_lingzhi_rle, IMAGE_RLE_SIZE_LINGZHI),
+        LCD_SCENE_CMD_FILL_CIRCLE(120, 200, 60, LCD_LIGHTBLUE),
+        LCD_SCENE_CMD_CIRCLE(120, 200, 60, LCD_BLACK),
+        LCD_SCENE_CMD_LINE(0, 319, 239, 100, LCD_RED),
+        LCD_SCENE_CMD_RECT(10, 150, 230, 300, LCD_GREEN),
+        LCD_SCENE_CMD_CHINESE(72, 190, "小凌派", LCD_BLACK, LCD_WHITE, LCD_FONT_SIZE32, 1),
+        LCD_SCENE_CMD_INDEXED(180, 280, INDEXED_W, INDEXED_H, m_indexed, 4, m_palette, 0),
+    };
+    
+    lcd_scene_render(cmds, sizeof(cmds) / sizeof(cmds[0]), LCD_WHITE);
+}
+
+
+static void case_sprite(void)
+{
+    lcd_sprite_t sprite;
+    lcd_sprite_picture_t bg = {15, 0, PATTERN_W, PATTERN_H, m_pattern, LCD_WHITE};
+    static uint16_t save[16 * 16];
+    int16_t i;
+    
+    lcd_show_picture(bg.x, bg.y, bg.length, bg.width, m_pattern);
+    lcd_sprite_init(&sprite, m_pattern, PATTERN_W, 16, 16, PATTERN_KEY);
+    lcd_sprite_set_background(&sprite, save, lcd_sprite_bg_picture, &bg);
+    for (i = 0; i < 10; i++) {
+        lcd_sprite_move(&sprite, (int16_t)(i * 9 - 8), (int16_t)(i * 5));
+    }
+    lcd_sprite_set_frame(&sprite, 24, 16);
+    lcd_sprite_hide(&sprite);
+    
+    lcd_sprite_init(&sprite, m_pattern, PATTERN_W, 16, 16, LCD_BLIT_NO_KEY);
+    lcd_sprite_set_background(&sprite, NULL, lcd_sprite_bg_color, (void *)(uintptr_t)LCD_WHITE);
+    lcd_sprite_move(&sprite, 200, 200);
+    lcd_sprite_move(&sprite, 230, 310);
+}
+
+
+static void case_show_text(void)
+{
+    uint16_t width;
+    
+    width = lcd_show_text(10, 10, "ABBA", LCD_BLACK, LCD_WHITE, &m_font, 0);
+    lcd_show_text(10 + width, 10, "BA?", LCD_RED, LCD_WHITE, &m_font, 1);
+    lcd_fill(10, 30, 10 + lcd_text_width("AB", &m_font), 32, LCD_GREEN);
+}
+
+
+/* 抗锯齿字体：两组颜色交替显示，超过混合色表缓存数目后再用回第一组；
+ * 叠加模式显示在彩色条纹上，只有灰度达到一半的像素改为字的颜色
+ */
+static void case_show_text_gray(const lcd_font_t *font)
+{
+    uint16_t y;
+    
+    for (y = 0; y < 3; y++) {
+        lcd_show_text(10, 10 + y * 8, "ABBA", LCD_BLACK, LCD_WHITE, font, 0);
+        lcd_show_text(40, 10 + y * 8, "BAAB", LCD_YELLOW, LCD_DARKBLUE, font, 0);
+    }
+    lcd_show_text(10, 40, "AB", LCD_RED, LCD_GREEN, font, 0);
+    lcd_show_text(30, 40, "AB", LCD_CYAN, LCD_BROWN, font, 0);
+    lcd_show_text(50, 40, "AB", LCD_MAGENTA, LCD_GRAY, font, 0);
+    lcd_show_text(70, 40, "BA", LCD_BLACK, LCD_WHITE, font, 0);
+    
+    lcd_fill(10, 60, 100, 63, LCD_BLUE);
+    lcd_fill(10, 63, 100, 66, LCD_LGRAY);
+    lcd_show_text(10, 60, "ABBA", LCD_RED, LCD_WHITE, font, 1);
+    lcd_show_text(40, 60, "BAAB", LCD_BLACK, LCD_WHITE, font, 1);
+}
+
+
+static void case_show_text_gray4(void)
+{
+    case_show_text_gray(&m_font4);
+}
+
+
+static void case_show_text_gray2(void)
+{
+    case_show_text_gray(&m_font2);
+}
+
+
+static void case_scroll(void)
+{
+    lcd_show_string(0, 0, (const uint8_t *)"fixed top", LCD_BLACK, LCD_WHITE, LCD_FONT_SIZE16, 0);
+    lcd_show_string(0, 16, (const uint8_t *)"scroll row", LCD_RED, LCD_WHITE, LCD_FONT_SIZE16, 0);
+    lcd_set_scroll_area(16, 288);
+    lcd_set_scroll_start(100);
+}
+
+
+const lcd_case_t g_lcd_cases[] = {
+    {"fill", case_fill},
+    {"draw_point", case_draw_point},
+    {"draw_line", case_draw_line},
+    {"draw_rectangle", case_draw_rectangle},
+    {"fill_rectangle", case_fill_rectangle},
+    {"draw_circle", case_draw_circle},
+    {"fill_circle", case_fill_circle},
+    {"round_rect", case_round_rect},
+    {"show_char", case_show_char},
+    {"show_string", case_show_string},
+    {"show_number", case_show_number},
+    {"show_chinese", case_show_chinese},
+    {"show_picture", case_show_picture},
+    {"blit", case_blit},
+    {"stream", case_stream},
+    {"framebuffer", case_framebuffer},
+    {"band", case_band},
+    {"rotation", case_rotation},
+    {"console", case_console},
+    {"console_wrap", case_console_wrap},
+    {"widget", case_widget},
+    {"scene", case_scene},
+    {"sprite", case_sprite},
+    {"show_text", case_show_text},
+    {"show_text_gray4", case_show_text_gray4},
+    {"show_text_gray2", case_show_text_gray2},
+    {"scroll", case_scroll},
+};
+
+const uint32_t g_lcd_case_num = sizeof(g_lcd_cases) / sizeof(g_lcd_cases[0]);
@@ -0,0 +1,38 @@
+/*
+ * Copyright (c) 2022 FuZhou Lockzhiner Electronic Co., Ltd. All rights reserved.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef _LCD_CASES_H_
+#define _LCD_CASES_H_
+
+#include <stdint.h>
+
+/* 测试用例，每个用例调用一组lcd_*接口 */
+typedef struct {
+    const char *name;                       /* 用例名称 */
+    void (*run)(void);                      /* 绘制函数 */
+} lcd_case_t;
+
+extern const lcd_case_t g_lcd_cases[];
+extern const uint32_t g_lcd_case_num;
+
+/***************************************************************
+ * 函数名称: lcd_case_prepare
+ * 说    明: 恢复默认的显示方向和滚动设置，白色清屏，
+ *           每个用例运行前调用，使用例之间互不影响
+ * 参    数: 无
+ * 返 回 值: 无
+ ***************************************************************/
+void lcd_case_prepare(void);
+
+#endif
@@ -0,0 +1,141 @@
+/*
+ * Copyright (c) 2022 FuZhou Lockzhiner Electronic Co., Ltd. All rights reserved.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+/* 离屏渲染测试：同样的绘制内容分别直接写屏和经离屏缓冲区刷新，
+ * 比较屏幕内容和总线上传输的字节数
+ */
+#include <stdio.h>
+#include "lcd.h"
+#include "picture.h"
+#include "lcd_sim.h"
+#include "lcd_test.h"
+
+#define BAND_LINES              16
+#define PART_X                  30
+#define PART_Y                  100
+#define PART_W                  100
+#define PART_H                  50
+
+static uint16_t m_frame[LCD_PANEL_W * LCD_PANEL_H];
+
+/* 仪表盘的内容，value为每秒变化的数值 */
+static void draw_content(float value)
+{
+    lcd_show_picture_rle(15, 0, IMAGE_LENGTH_LINGZHI, IMAGE_WIDTH_LINGZHI,
+                         gImage_lingzhi_rle, IMAGE_RLE_SIZE_LINGZHI);
+    lcd_show_string(0, 130, (const uint8_t *)"Welcome to XiaoLingPai!", LCD_RED, LCD_WHITE, LCD_FONT_SIZE16, 0);
+    lcd_show_string(100, 70, (const uint8_t *)"Xy", LCD_BLUE, LCD_WHITE, LCD_FONT_SIZE32, 1);
+    lcd_show_float_num1(128, 190, value, 4, LCD_BLACK, LCD_WHITE, LCD_FONT_SIZE16);
+    lcd_show_chinese(0, 220, (uint8_t *)"小凌派", LCD_RED, LCD_WHITE, LCD_FONT_SIZE32, 0);
+    lcd_draw_line(10, 10, 200, 150, LCD_GREEN);
+    lcd_draw_rectangle(20, 20, 100, 90, LCD_BLUE);
+    lcd_draw_circle(120, 160, 50, LCD_RED);
+}
+
+
+/* 清屏后绘制整个仪表盘 */
+static void draw_dashboard(float value)
+{
+    lcd_fill(0, 0, LCD_W, LCD_H, LCD_WHITE);
+    draw_content(value);
+}
+
+
+/* 运行一次绘制，返回总线上传输的字节数 */
+static uint32_t measure(void (*draw)(float), float value, bool flush)
+{
+    lcd_sim_stats_t stats;
+    
+    lcd_sim_reset_stats();
+    draw(value);
+    if (flush) {
+        lcd_flush();
+    }
+    lcd_sim_get_stats(&stats);
+    return stats.bytes;
+}
+
+
+static void show_value(float value)
+{
+    lcd_show_float_num1(128, 190, value, 4, LCD_BLACK, LCD_WHITE, LCD_FONT_SIZE16);
+}
+
+
+int main(void)
+{
+    lcd_sim_stats_t stats;
+    uint32_t direct_hash, hash, direct_bytes, full_bytes, bytes;
+    uint16_t y;
+    
+    lcd_sim_reset();
+    lcd_init();
+    
+    /* 直接写屏 */
+    direct_bytes = measure(draw_dashboard, 3.14f, false);
+    direct_hash = lcd_sim_hash();
+    printf("%-28s %8u bytes\n", "direct, full frame", direct_bytes);
+    
+    /* 全屏离屏缓冲区，首次刷新发送整个屏幕 */
+    lcd_fill(0, 0, LCD_W, LCD_H, LCD_GRAY);
+    lcd_framebuffer_enable(m_frame, 0, 0, LCD_PANEL_W, LCD_PANEL_H);
+    bytes = measure(draw_dashboard, 3.14f, true);
+    hash = lcd_sim_hash();
+    printf("%-28s %8u bytes\n", "framebuffer, full frame", bytes);
+    LCD_TEST_CHECK(hash == direct_hash, "framebuffer frame differs: 0x%08x != 0x%08x", hash, direct_hash);
+    
+    /* 没有绘制时刷新不发送数据 */
+    lcd_sim_reset_stats();
+    lcd_flush();
+    lcd_sim_get_stats(&stats);
+    LCD_TEST_CHECK(stats.bytes == 0, "empty flush sent %u bytes", stats.bytes);
+    
+    /* 重画相同的内容，只发送重叠图形互相覆盖的区域 */
+    full_bytes = bytes;
+    bytes = measure(draw_content, 3.14f, true);
+    printf("%-28s %8u bytes\n", "framebuffer, same content", bytes);
+    LCD_TEST_CHECK(bytes < full_bytes, "redraw sent %u bytes, full frame %u", bytes, full_bytes);
+    
+    /* 只改变一个数值：离屏渲染只发送变化的数字 */
+    bytes = measure(show_value, 3.15f, true);
+    hash = lcd_sim_hash();
+    lcd_framebuffer_disable();
+    printf("%-28s %8u bytes\n", "framebuffer, one number", bytes);
+    direct_bytes = measure(show_value, 3.15f, false);
+    printf("%-28s %8u bytes\n", "direct, one number", direct_bytes);
+    LCD_TEST_CHECK(hash == lcd_sim_hash(), "incremental frame differs");
+    LCD_TEST_CHECK(bytes < direct_bytes, "framebuffer sent %u bytes, direct %u", bytes, direct_bytes);
+    
+    /* 条带：每次渲染BAND_LINES行 */
+    lcd_fill(0, 0, LCD_W, LCD_H, LCD_GRAY);
+    lcd_sim_reset_stats();
+    for (y = 0; y < LCD_PANEL_H; y += BAND_LINES) {
+        lcd_framebuffer_enable(m_frame, 0, y, LCD_PANEL_W, BAND_LINES);
+        draw_dashboard(3.14f);
+        lcd_flush();
+    }
+    lcd_framebuffer_disable();
+    LCD_TEST_CHECK(lcd_sim_hash() == direct_hash, "banded frame differs");
+    
+    /* 只覆盖部分屏幕的缓冲区，缓冲区以外的绘制被丢弃 */
+    draw_dashboard(3.14f);
+    lcd_framebuffer_enable(m_frame, PART_X, PART_Y, PART_W, PART_H);
+    lcd_fill(0, 0, LCD_W, LCD_H, LCD_GRAY);
+    draw_dashboard(3.14f);
+    lcd_flush();
+    lcd_framebuffer_disable();
+    LCD_TEST_CHECK(lcd_sim_hash() == direct_hash, "partial framebuffer differs");
+    
+    return LCD_TEST_RESULT();
+}
@@ -0,0 +1,134 @@
+/*
+ * Copyright (c) 2022 FuZhou Lockzhiner Electronic Co., Ltd. All rights reserved.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+/* 标准图像测试：逐个运行测试用例，把模拟面板上的显示内容与记录的
+ * 标准图像哈希比较。修改渲染代码后显示内容应当不变，有意改变显示
+ * 效果时用-u重新生成下面的表格
+ *
+ * 用法: lcd_golden [-u] [-o 目录]
+ *       -u：打印当前的哈希表格，不做比较
+ *       -o：把每个用例的显示内容保存为PPM图片
+ */
+#include <stdio.h>
+#include <string.h>
+#include <unistd.h>
+#include "lcd.h"
+#include "lcd_sim.h"
+#include "lcd_cases.h"
+
+#define PATH_MAX_LEN            256
+
+typedef struct {
+    const char *name;
+    uint32_t hash;
+} golden_t;
+
+/* 标准图像的哈希 */
+static const golden_t m_golden[] = {
+    {"fill", 0x44246705},
+    {"draw_point", 0x0915a005},
+    {"draw_line", 0x99a848b8},
+    {"draw_rectangle", 0xeb0e8fa9},
+    {"fill_rectangle", 0x583fe620},
+    {"draw_circle", 0xc1d0831a},
+    {"fill_circle", 0x6a889f33},
+    {"round_rect", 0xecd2ff9f},
+    {"show_char", 0x4cced34b},
+    {"show_string", 0x45e87b29},
+    {"show_number", 0x8dfa0723},
+    {"show_chinese", 0x77416ea7},
+    {"show_picture", 0xe9d46dad},
+    {"blit", 0xeb7c371c},
+    {"stream", 0x21d59b59},
+    {"framebuffer", 0xb649822f},
+    {"band", 0x2c84cfd9},
+    {"rotation", 0x6a9f69fd},
+    {"console", 0x01be37f2},
+    {"console_wrap", 0x459387d7},
+    {"widget", 0x11b8ce8f},
+    {"scene", 0xe5853cbc},
+    {"sprite", 0x5dc531ed},
+    {"show_text", 0x3c08b0b3},
+    {"show_text_gray4", 0x460d5ef6},
+    {"show_text_gray2", 0x4f387241},
+    {"scroll", 0x1162146b},
+};
+
+
+static const golden_t *golden_find(const char *name)
+{
+    uint32_t i;
+    
+    for (i = 0; i < sizeof(m_golden) / sizeof(m_golden[0]); i++) {
+        if (strcmp(m_golden[i].name, name) == 0) {
+            return &m_golden[i];
+        }
+    }
+    return NULL;
+}
+
+
+int main(int argc, char **argv)
+{
+    const char *dir = NULL;
+    const golden_t *golden = NULL;
+    char path[PATH_MAX_LEN];
+    bool update = false;
+    uint32_t i, hash, failed = 0;
+    int opt;
+    
+    while ((opt = getopt(argc, argv, "uo:")) != -1) {
+        if (opt == 'u') {
+            update = true;
+        } else if (opt == 'o') {
+            dir = optarg;
+        } else {
+            fprintf(stderr, "usage: %s [-u] [-o dir]\n", argv[0]);
+            return 1;
+        }
+    }
+    
+    lcd_sim_reset();
+    if (lcd_init() != 0) {
+        printf("lcd_init failed\n");
+        return 1;
+    }
+    
+    for (i = 0; i < g_lcd_case_num; i++) {
+        lcd_case_prepare();
+        g_lcd_cases[i].run();
+        hash = lcd_sim_hash();
+        
+        golden = golden_find(g_lcd_cases[i].name);
+        if (update) {
+            printf("    {\"%s\", 0x%08x},\n", g_lcd_cases[i].name, hash);
+        } else if ((golden == NULL) || (golden->hash != hash)) {
+            printf("FAIL %-16s 0x%08x, expected 0x%08x\n", g_lcd_cases[i].name, hash,
+                   (golden != NULL) ? golden->hash : 0);
+            failed++;
+        } else {
+            printf("ok   %-16s 0x%08x\n", g_lcd_cases[i].name, hash);
+        }
+        
+        if (dir != NULL) {
+            snprintf(path, sizeof(path), "%s/%s.ppm", dir, g_lcd_cases[i].name);
+            lcd_sim_dump_ppm(path);
+        }
+    }
+    
+    if (!update) {
+        printf("%u/%u cases passed\n", g_lcd_case_num - failed, g_lcd_case_num);
+    }
+    return (failed == 0) ? 0 : 1;
+}
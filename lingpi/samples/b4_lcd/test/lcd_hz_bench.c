@@ -0,0 +1,239 @@
+/*
+ * Copyright (c) 2022 FuZhou Lockzhiner Electronic Co., Ltd. All rights reserved.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+/* 汉字查找基准：在GB2312一级字库规模的合成字库中查找200个汉字的字符串，
+ * 比较原来逐个比较编码的线性查找和按码点排序的下标表二分查找的速度，
+ * 并测量lcd_show_chinese用实际字库显示200个汉字，以及显示汉字和ASCII
+ * 字符交替出现的长字符串的速度
+ *
+ * 用法: lcd_hz_bench [-n 重复次数]
+ */
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <unistd.h>
+#include "lcd.h"
+#include "lcd_sim.h"
+
+/* GB2312一级汉字的数目 */
+#define HZ_BENCH_NUM            3755
+#define HZ_BENCH_STR_LEN        200
+#define HZ_BENCH_REPEAT         2000
+#define HZ_CODE_BASE            0x4E00
+/* 汉字和ASCII字符混合的长字符串重复的次数，远超原来128字节的长度限制 */
+#define HZ_BENCH_MIX_REPEAT     100
+#define NSEC_PER_SEC            1000000000ULL
+
+/* 与lcd_font.h中typFNT_GB16相同的布局 */
+typedef struct {
+    unsigned char Index[4];
+    unsigned char Msk[32];
+} hz_entry_t;
+
+/* 与lcd_font_index.h中typFNT_GB_INDEX相同的布局 */
+typedef struct {
+    unsigned short code;
+    unsigned short index;
+} hz_index_t;
+
+static hz_entry_t m_font[HZ_BENCH_NUM];
+static hz_index_t m_index[HZ_BENCH_NUM];
+static unsigned char m_str[HZ_BENCH_STR_LEN * 3 + 1];
+
+/* 混合字符串的一段：3个汉字和10个ASCII字符 */
+static const char m_mix_part[] = "小凌派LCD 12.5V ";
+#define HZ_MIX_PART_CHARS       13
+static uint8_t m_mix[sizeof(m_mix_part) * HZ_BENCH_MIX_REPEAT];
+
+static uint64_t now_ns(void)
+{
+    struct timespec ts;
+    
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint64_t)ts.tv_sec * NSEC_PER_SEC + (uint64_t)ts.tv_nsec;
+}
+
+
+static void utf8_put(unsigned char *p, uint16_t code)
+{
+    p[0] = (unsigned char)(0xE0 | (code >> 12));
+    p[1] = (unsigned char)(0x80 | ((code >> 6) & 0x3F));
+    p[2] = (unsigned char)(0x80 | (code & 0x3F));
+}
+
+
+static int index_cmp(const void *a, const void *b)
+{
+    return (int)((const hz_index_t *)a)->code - (int)((const hz_index_t *)b)->code;
+}
+
+
+/* 字库中的汉字按取模工具的输入顺序排列，与码点顺序无关 */
+static void font_build(void)
+{
+    uint32_t i, k;
+    uint16_t code;
+    
+    for (i = 0; i < HZ_BENCH_NUM; i++) {
+        /* 乘以与HZ_BENCH_NUM互质的数打乱顺序 */
+        k = (i * 1543) % HZ_BENCH_NUM;
+        code = (uint16_t)(HZ_CODE_BASE + k * 5);
+        utf8_put(m_font[i].Index, code);
+        memset(m_font[i].Msk, (int)(i & 0xFF), sizeof(m_font[i].Msk));
+        m_index[i].code = code;
+        m_index[i].index = (unsigned short)i;
+    }
+    qsort(m_index, HZ_BENCH_NUM, sizeof(m_index[0]), index_cmp);
+    
+    srand(1);
+    for (i = 0; i < HZ_BENCH_STR_LEN; i++) {
+        memcpy(&m_str[i * 3], m_font[rand() % HZ_BENCH_NUM].Index, 3);
+    }
+    m_str[HZ_BENCH_STR_LEN * 3] = '\0';
+}
+
+
+/* 原来的查找方式：逐个比较UTF-8编码 */
+static const unsigned char *find_linear(const unsigned char *s)
+{
+    uint32_t k;
+    
+    for (k = 0; k < HZ_BENCH_NUM; k++) {
+        if ((m_font[k].Index[0] == s[0]) && (m_font[k].Index[1] == s[1]) && (m_font[k].Index[2] == s[2])) {
+            return m_font[k].Msk;
+        }
+    }
+    return NULL;
+}
+
+
+/* lcd_hz_find的查找方式：在下标表中二分查找码点 */
+static const unsigned char *find_index(const unsigned char *s)
+{
+    uint16_t code = (uint16_t)(((s[0] & 0x0F) << 12) | ((s[1] & 0x3F) << 6) | (s[2] & 0x3F));
+    int32_t lo = 0, hi = HZ_BENCH_NUM - 1, mid;
+    
+    while (lo <= hi) {
+        mid = (lo + hi) / 2;
+        if (m_index[mid].code == code) {
+            return m_font[m_index[mid].index].Msk;
+        } else if (m_index[mid].code < code) {
+            lo = mid + 1;
+        } else {
+            hi = mid - 1;
+        }
+    }
+    return NULL;
+}
+
+
+/* 查找repeat遍字符串，返回每秒查找的汉字数 */
+static double lookups_per_sec(const unsigned char *(*find)(const unsigned char *), uint32_t repeat,
+                              uint32_t *checksum)
+{
+    const unsigned char *msk = NULL;
+    uint64_t start, ns;
+    uint32_t r, i, sum = 0;
+    
+    start = now_ns();
+    for (r = 0; r < repeat; r++) {
+        for (i = 0; i < HZ_BENCH_STR_LEN; i++) {
+            msk = find(&m_str[i * 3]);
+            sum += (msk != NULL) ? msk[0] : 0xFFFF;
+        }
+    }
+    ns = now_ns() - start;
+    *checksum = sum;
+    return (double)repeat * HZ_BENCH_STR_LEN * NSEC_PER_SEC / (double)((ns == 0) ? 1 : ns);
+}
+
+
+int main(int argc, char **argv)
+{
+    static const char *hz = "小凌派";
+    uint8_t text[HZ_BENCH_STR_LEN * 3 + 1];
+    uint32_t repeat = HZ_BENCH_REPEAT;
+    uint32_t sum_linear, sum_index, i, r;
+    double linear, index;
+    uint64_t start, ns;
+    lcd_sim_stats_t stats;
+    uint8_t mode;
+    int opt;
+    
+    while ((opt = getopt(argc, argv, "n:")) != -1) {
+        if (opt == 'n') {
+            repeat = (uint32_t)strtoul(optarg, NULL, 0);
+        } else {
+            fprintf(stderr, "usage: %s [-n repeat]\n", argv[0]);
+            return 1;
+        }
+    }
+    if (repeat == 0) {
+        repeat = 1;
+    }
+    
+    font_build();
+    linear = lookups_per_sec(find_linear, repeat / 10 + 1, &sum_linear);
+    index = lookups_per_sec(find_index, repeat / 10 + 1, &sum_index);
+    if (sum_linear != sum_index) {
+        printf("lookup results differ\n");
+        return 1;
+    }
+    index = lookups_per_sec(find_index, repeat, &sum_index);
+    printf("%u hanzi, %u-char string\n", HZ_BENCH_NUM, HZ_BENCH_STR_LEN);
+    printf("%-24s %14.0f lookups/s\n", "linear scan", linear);
+    printf("%-24s %14.0f lookups/s (%.0fx)\n", "sorted index", index, index / linear);
+    
+    /* 用实际字库显示200个汉字，包括查找和绘制 */
+    for (i = 0; i < HZ_BENCH_STR_LEN; i++) {
+        memcpy(&text[i * 3], &hz[(i % 3) * 3], 3);
+    }
+    text[HZ_BENCH_STR_LEN * 3] = '\0';
+    lcd_sim_reset();
+    if (lcd_init() != 0) {
+        printf("lcd_init failed\n");
+        return 1;
+    }
+    start = now_ns();
+    for (r = 0; r < repeat / 100 + 1; r++) {
+        lcd_show_chinese(0, 0, text, LCD_RED, LCD_WHITE, LCD_FONT_SIZE16, 0);
+    }
+    ns = now_ns() - start;
+    printf("%-24s %14.0f chars/s\n", "lcd_show_chinese 16",
+           (double)(repeat / 100 + 1) * HZ_BENCH_STR_LEN * NSEC_PER_SEC / (double)((ns == 0) ? 1 : ns));
+           
+    /* 汉字和ASCII字符混合的长字符串，非叠加和叠加模式 */
+    for (i = 0; i < HZ_BENCH_MIX_REPEAT; i++) {
+        memcpy(&m_mix[i * (sizeof(m_mix_part) - 1)], m_mix_part, sizeof(m_mix_part) - 1);
+    }
+    m_mix[HZ_BENCH_MIX_REPEAT * (sizeof(m_mix_part) - 1)] = '\0';
+    printf("mixed string: %u bytes, %u chars\n", (uint32_t)strlen((const char *)m_mix),
+           HZ_BENCH_MIX_REPEAT * HZ_MIX_PART_CHARS);
+    for (mode = 0; mode < 2; mode++) {
+        lcd_sim_reset_stats();
+        start = now_ns();
+        for (r = 0; r < repeat / 100 + 1; r++) {
+            lcd_show_chinese(0, 0, m_mix, LCD_RED, LCD_WHITE, LCD_FONT_SIZE16, mode);
+        }
+        ns = now_ns() - start;
+        lcd_sim_get_stats(&stats);
+        printf("%-24s %14.0f chars/s, %u transactions per string\n",
+               (mode == 0) ? "mixed, mode 0" : "mixed, mode 1",
+               (double)(repeat / 100 + 1) * HZ_BENCH_MIX_REPEAT * HZ_MIX_PART_CHARS * NSEC_PER_SEC /
+               (double)((ns == 0) ? 1 : ns), stats.transactions / (repeat / 100 + 1));
+    }
+    
+    return 0;
+}
@@ -0,0 +1,209 @@
+/*
+ * Copyright (c) 2022 FuZhou Lockzhiner Electronic Co., Ltd. All rights reserved.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+/* JPEG解码基准：按四种缩小比例解码内置的测试图片（gradient_jpg.h）和
+ * 命令行指定的JPEG文件，报告每张图片的解码时间、每秒显示的像素数
+ * （超出屏幕的部分不计入）和总线字节数。内置图片还检查流式解码与
+ * 内存解码的结果相同，以及几处纯色区域解码后的颜色
+ *
+ * 用法: lcd_jpeg_bench [-n 重复次数] [JPEG文件...]
+ */
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <unistd.h>
+#include "lcd.h"
+#include "lcd_jpeg.h"
+#include "lcd_sim.h"
+#include "lcd_test.h"
+#include "gradient_jpg.h"
+
+#define JPEG_BENCH_REPEAT       200
+#define JPEG_SCALE_NUM          4
+#define NSEC_PER_SEC            1000000000ULL
+#define NSEC_PER_USEC           1000
+#define PIXELS_PER_MPIXEL       1000000.0
+/* RGB565每个分量允许的误差，量化和色度下采样都会改变颜色 */
+#define COLOR_TOLERANCE         3
+
+typedef struct {
+    const uint8_t *data;
+    uint32_t size;
+    uint32_t pos;
+} jpeg_src_t;
+
+/* 内置图片中的纯色区域：白色的圆心和红色矩形的中心 */
+typedef struct {
+    uint16_t x;
+    uint16_t y;
+    uint8_t r;
+    uint8_t g;
+    uint8_t b;
+} color_probe_t;
+
+static const color_probe_t m_probes[] = {
+    {50, 50, 255, 255, 255},
+    {120, 65, 200, 30, 30},
+};
+
+static uint64_t now_ns(void)
+{
+    struct timespec ts;
+    
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint64_t)ts.tv_sec * NSEC_PER_SEC + (uint64_t)ts.tv_nsec;
+}
+
+
+static uint32_t jpeg_read(void *arg, uint8_t *buf, uint32_t len)
+{
+    jpeg_src_t *src = (jpeg_src_t *)arg;
+    uint32_t n = src->size - src->pos;
+    
+    n = (n < len) ? n : len;
+    memcpy(buf, src->data + src->pos, n);
+    src->pos += n;
+    return n;
+}
+
+
+static int color_diff(uint8_t a, uint8_t b)
+{
+    return (a > b) ? (a - b) : (b - a);
+}
+
+
+/* 按RGB565比较一个像素，每个分量允许COLOR_TOLERANCE的误差 */
+static bool color_near(uint16_t pixel, const color_probe_t *probe)
+{
+    return (color_diff((uint8_t)(pixel >> 11), probe->r >> 3) <= COLOR_TOLERANCE) &&
+           (color_diff((uint8_t)((pixel >> 5) & 0x3F), probe->g >> 2) <= COLOR_TOLERANCE * 2) &&
+           (color_diff((uint8_t)(pixel & 0x1F), probe->b >> 3) <= COLOR_TOLERANCE);
+}
+
+
+/* 按四种缩小比例解码repeat遍，打印一行结果 */
+static void jpeg_bench(const char *name, const uint8_t *data, uint32_t size, uint32_t repeat)
+{
+    lcd_sim_stats_t stats;
+    uint16_t width = 0, height = 0;
+    uint32_t r;
+    uint64_t start, ns;
+    uint8_t scale;
+    unsigned int ret = 0;
+    
+    LCD_TEST_CHECK(lcd_jpeg_get_size(data, size, &width, &height) == 0, "%s: bad header", name);
+    for (scale = LCD_JPEG_SCALE_1; scale < JPEG_SCALE_NUM; scale++) {
+        lcd_sim_reset_stats();
+        start = now_ns();
+        for (r = 0; r < repeat; r++) {
+            ret |= lcd_show_jpeg(0, 0, data, size, scale);
+        }
+        ns = (now_ns() - start) / repeat;
+        lcd_sim_get_stats(&stats);
+        LCD_TEST_CHECK(ret == 0, "%s: decode failed at 1/%u", name, 1u << scale);
+        
+        printf("%-24s %5ux%-5u 1/%u %10llu %10.2f %10u\n", name, width, height, 1u << scale,
+               (unsigned long long)(ns / NSEC_PER_USEC),
+               (double)(stats.pixels / repeat) * NSEC_PER_SEC / PIXELS_PER_MPIXEL / (double)((ns == 0) ? 1 : ns),
+               stats.bytes / repeat);
+    }
+}
+
+
+/* 读取整个文件，返回的内存由调用者释放 */
+static uint8_t *file_load(const char *path, uint32_t *size)
+{
+    FILE *fp = fopen(path, "rb");
+    uint8_t *data = NULL;
+    long len;
+    
+    if (fp == NULL) {
+        return NULL;
+    }
+    fseek(fp, 0, SEEK_END);
+    len = ftell(fp);
+    fseek(fp, 0, SEEK_SET);
+    if (len > 0) {
+        data = (uint8_t *)malloc((size_t)len);
+    }
+    if ((data != NULL) && (fread(data, 1, (size_t)len, fp) != (size_t)len)) {
+        free(data);
+        data = NULL;
+    }
+    fclose(fp);
+    *size = (uint32_t)len;
+    return data;
+}
+
+
+int main(int argc, char **argv)
+{
+    uint32_t repeat = JPEG_BENCH_REPEAT;
+    jpeg_src_t src = {m_gradient_jpg, GRADIENT_JPG_SIZE, 0};
+    lcd_sim_stats_t stats;
+    uint32_t hash, size, i;
+    uint8_t *data = NULL;
+    int opt;
+    
+    while ((opt = getopt(argc, argv, "n:")) != -1) {
+        if (opt == 'n') {
+            repeat = (uint32_t)strtoul(optarg, NULL, 0);
+        } else {
+            fprintf(stderr, "usage: %s [-n repeat] [file.jpg...]\n", argv[0]);
+            return 1;
+        }
+    }
+    if (repeat == 0) {
+        repeat = 1;
+    }
+    
+    lcd_sim_reset();
+    if (lcd_init() != 0) {
+        printf("lcd_init failed\n");
+        return 1;
+    }
+    
+    /* 内置图片：检查写入的像素数、几处纯色区域的颜色和流式解码的结果 */
+    lcd_fill(0, 0, LCD_W, LCD_H, LCD_GRAY);
+    lcd_sim_reset_stats();
+    LCD_TEST_CHECK(lcd_show_jpeg(0, 0, m_gradient_jpg, GRADIENT_JPG_SIZE, LCD_JPEG_SCALE_1) == 0, "decode failed");
+    lcd_sim_get_stats(&stats);
+    LCD_TEST_CHECK(stats.pixels == GRADIENT_JPG_W * GRADIENT_JPG_H, "wrote %u pixels", stats.pixels);
+    for (i = 0; i < sizeof(m_probes) / sizeof(m_probes[0]); i++) {
+        LCD_TEST_CHECK(color_near(lcd_sim_get_pixel(m_probes[i].x, m_probes[i].y), &m_probes[i]),
+                       "pixel (%u, %u) is 0x%04x", m_probes[i].x, m_probes[i].y,
+                       lcd_sim_get_pixel(m_probes[i].x, m_probes[i].y));
+    }
+    hash = lcd_sim_hash();
+    lcd_fill(0, 0, LCD_W, LCD_H, LCD_GRAY);
+    LCD_TEST_CHECK(lcd_show_jpeg_stream(0, 0, jpeg_read, &src, LCD_JPEG_SCALE_1) == 0, "stream decode failed");
+    LCD_TEST_CHECK(lcd_sim_hash() == hash, "stream decode differs");
+    
+    printf("decoder RAM %u bytes\n", lcd_jpeg_ram_size());
+    printf("%-24s %11s %3s %10s %10s %10s\n", "image", "size", "", "us/image", "Mpixel/s", "bytes");
+    jpeg_bench("gradient_jpg.h", m_gradient_jpg, GRADIENT_JPG_SIZE, repeat);
+    for (i = (uint32_t)optind; i < (uint32_t)argc; i++) {
+        data = file_load(argv[i], &size);
+        if (data == NULL) {
+            printf("%s: cannot read\n", argv[i]);
+            return 1;
+        }
+        jpeg_bench(argv[i], data, size, repeat / 10 + 1);
+        free(data);
+    }
+    
+    return LCD_TEST_RESULT();
+}
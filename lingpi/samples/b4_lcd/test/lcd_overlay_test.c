@@ -0,0 +1,202 @@
+/*
+ * Copyright (c) 2022 FuZhou Lockzhiner Electronic Co., Ltd. All rights reserved.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+/* 叠加显示测试：lcd_show_char和lcd_show_chinese的叠加模式按行合并为
+ * 水平线段发送，结果应与原来逐点调用lcd_draw_point的方式完全相同。
+ * 参考实现按原来的取模方式（每行从低位开始，按字节对齐）逐点画字，
+ * 在条纹背景上比较12、16、24、32四种字号的全部ASCII字符和汉字
+ */
+#include <stdio.h>
+#include <string.h>
+#include "lcd.h"
+#include "lcd_sim.h"
+#include "lcd_test.h"
+
+#define ASCII_FIRST             ' '
+#define ASCII_LAST              '~'
+#define STRIPE_H                7
+#define HZ_X                    3
+#define HZ_Y                    5
+#define BITS_PER_BYTE           8
+
+/* 与lcd_font.h中typFNT_GB12~typFNT_GB32相同的布局 */
+typedef struct {
+    unsigned char Index[4];
+    unsigned char Msk[24];
+} hz12_t;
+
+typedef struct {
+    unsigned char Index[4];
+    unsigned char Msk[32];
+} hz16_t;
+
+typedef struct {
+    unsigned char Index[4];
+    unsigned char Msk[72];
+} hz24_t;
+
+typedef struct {
+    unsigned char Index[4];
+    unsigned char Msk[128];
+} hz32_t;
+
+extern const unsigned char ascii_1206[][12];
+extern const unsigned char ascii_1608[][16];
+extern const unsigned char ascii_2412[][48];
+extern const unsigned char ascii_3216[][64];
+extern const hz12_t tfont12[];
+extern const hz16_t tfont16[];
+extern const hz24_t tfont24[];
+extern const hz32_t tfont32[];
+
+typedef struct {
+    uint8_t sizey;
+    const uint8_t *ascii;                   /* 第一个字符' '的点阵 */
+    uint32_t ascii_bytes;                   /* 每个ASCII字符的字节数 */
+    const uint8_t *hz;                      /* 第一个汉字的编码 */
+    uint32_t hz_bytes;                      /* 每个汉字条目的字节数 */
+} font_t;
+
+static const font_t m_fonts[] = {
+    {LCD_FONT_SIZE12, ascii_1206[0], sizeof(ascii_1206[0]), tfont12[0].Index, sizeof(tfont12[0])},
+    {LCD_FONT_SIZE16, ascii_1608[0], sizeof(ascii_1608[0]), tfont16[0].Index, sizeof(tfont16[0])},
+    {LCD_FONT_SIZE24, ascii_2412[0], sizeof(ascii_2412[0]), tfont24[0].Index, sizeof(tfont24[0])},
+    {LCD_FONT_SIZE32, ascii_3216[0], sizeof(ascii_3216[0]), tfont32[0].Index, sizeof(tfont32[0])},
+};
+
+/* 汉字串，各字号的字库都按这个顺序存放，前后加ASCII字符检查混合显示 */
+static const char m_hz_str[] = "小凌派";
+#define HZ_NUM                  3
+#define HZ_UTF8_BYTES           3
+static const char m_mix_str[] = "Lz小凌派!";
+#define MIX_HEAD                2
+
+/* 画条纹背景，叠加模式不应改写字形以外的像素 */
+static void fill_background(void)
+{
+    uint16_t y;
+    
+    for (y = 0; y < LCD_H; y += STRIPE_H) {
+        lcd_fill(0, y, LCD_W, (y + STRIPE_H < LCD_H) ? (y + STRIPE_H) : LCD_H,
+                 ((y / STRIPE_H) % 2) ? LCD_GRAY : LCD_BLUE);
+    }
+}
+
+
+/* 参考实现：按原来的方式逐点画出一个w x h的字形 */
+static void ref_draw(uint16_t x, uint16_t y, const uint8_t *msk, uint8_t w, uint8_t h, uint16_t fc)
+{
+    uint8_t stride = (uint8_t)((w + BITS_PER_BYTE - 1) / BITS_PER_BYTE);
+    uint8_t row, col;
+    
+    for (row = 0; row < h; row++) {
+        for (col = 0; col < w; col++) {
+            if (msk[row * stride + col / BITS_PER_BYTE] & (0x01 << (col % BITS_PER_BYTE))) {
+                lcd_draw_point(x + col, y + row, fc);
+            }
+        }
+    }
+}
+
+
+static void ref_char(uint16_t x, uint16_t y, uint8_t c, const font_t *font)
+{
+    ref_draw(x, y, font->ascii + (c - ASCII_FIRST) * font->ascii_bytes, font->sizey / 2, font->sizey, LCD_RED);
+}
+
+
+static void ref_hz(uint16_t x, uint16_t y, uint8_t k, const font_t *font)
+{
+    ref_draw(x, y, font->hz + k * font->hz_bytes + 4, font->sizey, font->sizey, LCD_RED);
+}
+
+
+/* 全部ASCII字符按网格排列，逐点画出和用lcd_show_char画出的结果相同 */
+static void check_ascii(const font_t *font, uint32_t blank)
+{
+    uint16_t sizex = font->sizey / 2;
+    uint16_t cols = LCD_W / sizex;
+    uint32_t hash;
+    uint8_t c;
+    
+    fill_background();
+    for (c = ASCII_FIRST; c <= ASCII_LAST; c++) {
+        ref_char((c - ASCII_FIRST) % cols * sizex, (c - ASCII_FIRST) / cols * font->sizey, c, font);
+    }
+    hash = lcd_sim_hash();
+    LCD_TEST_CHECK(hash != blank, "size %u: reference drew nothing", font->sizey);
+    
+    fill_background();
+    for (c = ASCII_FIRST; c <= ASCII_LAST; c++) {
+        lcd_show_char((c - ASCII_FIRST) % cols * sizex, (c - ASCII_FIRST) / cols * font->sizey, c,
+                      LCD_RED, LCD_WHITE, font->sizey, 1);
+    }
+    LCD_TEST_CHECK(lcd_sim_hash() == hash, "size %u: ascii overlay differs from per-point", font->sizey);
+}
+
+
+/* 汉字串和汉字、ASCII混合的字符串 */
+static void check_chinese(const font_t *font)
+{
+    uint16_t sizex = font->sizey / 2;
+    uint16_t y2 = HZ_Y + font->sizey + 1;
+    uint32_t hash;
+    uint8_t k;
+    
+    for (k = 0; k < HZ_NUM; k++) {
+        LCD_TEST_CHECK(memcmp(font->hz + k * font->hz_bytes, &m_hz_str[k * HZ_UTF8_BYTES], HZ_UTF8_BYTES) == 0,
+                       "size %u: unexpected glyph %u in font", font->sizey, k);
+    }
+    
+    fill_background();
+    for (k = 0; k < HZ_NUM; k++) {
+        ref_hz(HZ_X + k * font->sizey, HZ_Y, k, font);
+    }
+    for (k = 0; k < MIX_HEAD; k++) {
+        ref_char(HZ_X + k * sizex, y2, (uint8_t)m_mix_str[k], font);
+    }
+    for (k = 0; k < HZ_NUM; k++) {
+        ref_hz(HZ_X + MIX_HEAD * sizex + k * font->sizey, y2, k, font);
+    }
+    ref_char(HZ_X + MIX_HEAD * sizex + HZ_NUM * font->sizey, y2,
+             (uint8_t)m_mix_str[MIX_HEAD + HZ_NUM * HZ_UTF8_BYTES], font);
+    hash = lcd_sim_hash();
+    
+    fill_background();
+    lcd_show_chinese(HZ_X, HZ_Y, (uint8_t *)m_hz_str, LCD_RED, LCD_WHITE, font->sizey, 1);
+    lcd_show_chinese(HZ_X, y2, (uint8_t *)m_mix_str, LCD_RED, LCD_WHITE, font->sizey, 1);
+    LCD_TEST_CHECK(lcd_sim_hash() == hash, "size %u: chinese overlay differs from per-point", font->sizey);
+}
+
+
+int main(void)
+{
+    uint32_t blank;
+    uint8_t f;
+    
+    lcd_sim_reset();
+    if (lcd_init() != 0) {
+        printf("lcd_init failed\n");
+        return 1;
+    }
+    fill_background();
+    blank = lcd_sim_hash();
+    
+    for (f = 0; f < sizeof(m_fonts) / sizeof(m_fonts[0]); f++) {
+        check_ascii(&m_fonts[f], blank);
+        check_chinese(&m_fonts[f]);
+    }
+    
+    return LCD_TEST_RESULT();
+}
@@ -0,0 +1,154 @@
+/*
+ * Copyright (c) 2022 FuZhou Lockzhiner Electronic Co., Ltd. All rights reserved.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+/* 图形基准：报告每个图形在总线上传输的字节数。"before"按原来的方式
+ * 用lcd_draw_point()逐点画出同样的像素（每个点设置一次1x1窗口），
+ * "after"为当前按水平、竖直线段填充窗口的实现，两者的屏幕内容应当相同
+ */
+#include <stdio.h>
+#include "lcd.h"
+#include "lcd_sim.h"
+
+#define PRIM_BG                 LCD_WHITE
+#define PRIM_FG                 LCD_RED
+
+typedef struct {
+    const char *name;
+    void (*draw)(void);
+} prim_t;
+
+static void prim_hline(void)
+{
+    lcd_draw_line(10, 100, 229, 100, PRIM_FG);
+}
+
+
+static void prim_vline(void)
+{
+    lcd_draw_line(120, 10, 120, 309, PRIM_FG);
+}
+
+
+static void prim_line(void)
+{
+    lcd_draw_line(10, 10, 200, 150, PRIM_FG);
+}
+
+
+static void prim_rectangle(void)
+{
+    lcd_draw_rectangle(20, 20, 219, 299, PRIM_FG);
+}
+
+
+static void prim_circle(void)
+{
+    lcd_draw_circle(120, 160, 100, PRIM_FG);
+}
+
+
+static void prim_fill_rectangle(void)
+{
+    lcd_fill_rectangle(20, 40, 219, 139, PRIM_FG);
+}
+
+
+static void prim_fill_circle(void)
+{
+    lcd_fill_circle(120, 160, 60, PRIM_FG);
+}
+
+
+static void prim_round_rect(void)
+{
+    lcd_draw_round_rect(20, 20, 219, 139, 16, PRIM_FG);
+}
+
+
+static void prim_fill_round_rect(void)
+{
+    lcd_fill_round_rect(20, 160, 219, 299, 16, PRIM_FG);
+}
+
+
+static const prim_t m_prims[] = {
+    {"hline", prim_hline},
+    {"vline", prim_vline},
+    {"line", prim_line},
+    {"rectangle", prim_rectangle},
+    {"circle", prim_circle},
+    {"fill_rectangle", prim_fill_rectangle},
+    {"fill_circle", prim_fill_circle},
+    {"round_rect", prim_round_rect},
+    {"fill_round_rect", prim_fill_round_rect},
+};
+
+static uint8_t m_mask[LCD_SIM_W * LCD_SIM_H];
+
+int main(void)
+{
+    lcd_sim_stats_t stats;
+    uint32_t i, after, before, pixels, hash;
+    uint32_t total_before = 0, total_after = 0, failed = 0;
+    uint16_t x, y;
+    
+    lcd_sim_reset();
+    if (lcd_init() != 0) {
+        printf("lcd_init failed\n");
+        return 1;
+    }
+    
+    printf("%-16s %8s %10s %10s %8s\n", "primitive", "pixels", "before", "after", "ratio");
+    for (i = 0; i < sizeof(m_prims) / sizeof(m_prims[0]); i++) {
+        lcd_fill(0, 0, LCD_W, LCD_H, PRIM_BG);
+        lcd_sim_reset_stats();
+        m_prims[i].draw();
+        lcd_sim_get_stats(&stats);
+        after = stats.bytes;
+        hash = lcd_sim_hash();
+        
+        /* 记录图形覆盖的像素，再逐点重画 */
+        pixels = 0;
+        for (y = 0; y < LCD_SIM_H; y++) {
+            for (x = 0; x < LCD_SIM_W; x++) {
+                m_mask[y * LCD_SIM_W + x] = (lcd_sim_get_pixel(x, y) != PRIM_BG);
+                pixels += m_mask[y * LCD_SIM_W + x];
+            }
+        }
+        lcd_fill(0, 0, LCD_W, LCD_H, PRIM_BG);
+        lcd_sim_reset_stats();
+        for (y = 0; y < LCD_SIM_H; y++) {
+            for (x = 0; x < LCD_SIM_W; x++) {
+                if (m_mask[y * LCD_SIM_W + x]) {
+                    lcd_draw_point(x, y, PRIM_FG);
+                }
+            }
+        }
+        lcd_sim_get_stats(&stats);
+        before = stats.bytes;
+        if (lcd_sim_hash() != hash) {
+            printf("%s: per-point frame differs\n", m_prims[i].name);
+            failed++;
+        }
+        
+        printf("%-16s %8u %10u %10u %7.1fx\n", m_prims[i].name, pixels, before, after,
+               (double)before / (double)((after == 0) ? 1 : after));
+        total_before += before;
+        total_after += after;
+    }
+    printf("%-16s %8s %10u %10u %7.1fx\n", "total", "", total_before, total_after,
+           (double)total_before / (double)((total_after == 0) ? 1 : total_after));
+    
+    return (failed == 0) ? 0 : 1;
+}
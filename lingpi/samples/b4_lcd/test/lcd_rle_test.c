@@ -0,0 +1,72 @@
+/*
+ * Copyright (c) 2022 FuZhou Lockzhiner Electronic Co., Ltd. All rights reserved.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+/* RLE图片测试：用lcd_show_picture_rle()解码例程图片，逐像素与压缩前的
+ * 原始数据比较，并检查图片以外的像素没有被改写
+ */
+#include <stdio.h>
+#include "lcd.h"
+#include "picture.h"
+#include "lcd_sim.h"
+#include "lcd_test.h"
+#include "lingzhi_raw.h"
+
+#define PIC_X                   15
+#define PIC_Y                   40
+
+int main(void)
+{
+    lcd_sim_stats_t stats;
+    uint32_t diff = 0, outside = 0, i;
+    uint16_t x, y, expect;
+    bool inside;
+    
+    lcd_sim_reset();
+    lcd_init();
+    LCD_TEST_CHECK(IMAGE_LENGTH_LINGZHI * IMAGE_WIDTH_LINGZHI * 2 == LINGZHI_RAW_SIZE, "image size mismatch");
+    
+    lcd_fill(0, 0, LCD_W, LCD_H, LCD_GRAY);
+    lcd_sim_reset_stats();
+    lcd_show_picture_rle(PIC_X, PIC_Y, IMAGE_LENGTH_LINGZHI, IMAGE_WIDTH_LINGZHI,
+                         gImage_lingzhi_rle, IMAGE_RLE_SIZE_LINGZHI);
+    lcd_sim_get_stats(&stats);
+    LCD_TEST_CHECK(stats.pixels == IMAGE_LENGTH_LINGZHI * IMAGE_WIDTH_LINGZHI,
+                   "wrote %u pixels", stats.pixels);
+    
+    for (y = 0; y < LCD_SIM_H; y++) {
+        for (x = 0; x < LCD_SIM_W; x++) {
+            inside = (x >= PIC_X) && (x < PIC_X + IMAGE_LENGTH_LINGZHI) &&
+                     (y >= PIC_Y) && (y < PIC_Y + IMAGE_WIDTH_LINGZHI);
+            if (!inside) {
+                outside += (lcd_sim_get_pixel(x, y) != LCD_GRAY);
+                continue;
+            }
+            i = ((uint32_t)(y - PIC_Y) * IMAGE_LENGTH_LINGZHI + (x - PIC_X)) * 2;
+            expect = (uint16_t)((m_lingzhi_raw[i] << 8) | m_lingzhi_raw[i + 1]);
+            if (lcd_sim_get_pixel(x, y) != expect) {
+                if (diff == 0) {
+                    printf("first difference at (%u, %u): 0x%04x != 0x%04x\n",
+                           x, y, lcd_sim_get_pixel(x, y), expect);
+                }
+                diff++;
+            }
+        }
+    }
+    LCD_TEST_CHECK(diff == 0, "%u pixels differ from the original image", diff);
+    LCD_TEST_CHECK(outside == 0, "%u pixels outside the image changed", outside);
+    
+    printf("%u raw bytes, %u RLE bytes, ratio %.2f\n", LINGZHI_RAW_SIZE, IMAGE_RLE_SIZE_LINGZHI,
+           (double)LINGZHI_RAW_SIZE / IMAGE_RLE_SIZE_LINGZHI);
+    return LCD_TEST_RESULT();
+}
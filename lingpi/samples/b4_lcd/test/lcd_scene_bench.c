@@ -0,0 +1,205 @@
+/*
+ * Copyright (c) 2022 FuZhou Lockzhiner Electronic Co., Ltd. All rights reserved.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+/* 条带渲染基准：同一个有重叠图形的场景分别直接写屏、经整屏离屏缓冲区
+ * 刷新和用lcd_scene_render()条带渲染，报告每帧的总线传输次数、字节数、
+ * 按50MHz SPI时钟计算的传输时间，以及绘制缓冲区和栈的峰值内存。
+ * 栈用量在预先填充固定字节的线程栈上运行一帧后统计，三种方式的
+ * 屏幕内容应当相同
+ */
+#include <stdio.h>
+#include <string.h>
+#include <pthread.h>
+#include "lcd.h"
+#include "lcd_scene.h"
+#include "picture.h"
+#include "lcd_sim.h"
+#include "lcd_test.h"
+
+#define SCENE_BG                LCD_WHITE
+#define SCENE_CLOCK             50000000
+#define NSEC_PER_USEC           1000
+#define STACK_SIZE              (256 * 1024)
+#define STACK_ALIGN             4096
+#define STACK_FILL              0xa5
+
+typedef struct {
+    const char *name;
+    void (*render)(void);
+    uint32_t ram;                           /* 绘制缓冲区的字节数 */
+} scene_mode_t;
+
+static const lcd_scene_cmd_t m_scene[] = {
+    LCD_SCENE_CMD_FILL(0, 0, 239, 40, LCD_DARKBLUE),
+    LCD_SCENE_CMD_STRING(8, 12, "Dashboard", LCD_WHITE, LCD_DARKBLUE, LCD_FONT_SIZE16, 1),
+    LCD_SCENE_CMD_PICTURE_RLE(15, 60, IMAGE_LENGTH_LINGZHI, IMAGE_WIDTH_LINGZHI,
+                              gImage_lingzhi_rle, IMAGE_RLE_SIZE_LINGZHI),
+    LCD_SCENE_CMD_FILL_CIRCLE(120, 200, 60, LCD_LIGHTBLUE),
+    LCD_SCENE_CMD_CIRCLE(120, 200, 60, LCD_BLACK),
+    LCD_SCENE_CMD_LINE(0, 319, 239, 100, LCD_RED),
+    LCD_SCENE_CMD_RECT(10, 150, 230, 300, LCD_GREEN),
+    LCD_SCENE_CMD_CHINESE(72, 190, "小凌派", LCD_BLACK, LCD_WHITE, LCD_FONT_SIZE32, 1),
+};
+
+#define SCENE_NUM               (sizeof(m_scene) / sizeof(m_scene[0]))
+
+static uint16_t m_frame[LCD_PANEL_W * LCD_PANEL_H];
+static uint8_t m_stack[STACK_SIZE] __attribute__((aligned(STACK_ALIGN)));
+
+/* 按顺序直接执行场景中的绘制命令，后面的图形覆盖前面的图形 */
+static void scene_replay(void)
+{
+    const lcd_scene_cmd_t *cmd;
+    uint32_t i;
+    
+    lcd_fill(0, 0, LCD_W, LCD_H, SCENE_BG);
+    for (i = 0; i < SCENE_NUM; i++) {
+        cmd = &m_scene[i];
+        switch (cmd->type) {
+            case LCD_SCENE_FILL:
+                lcd_fill_rectangle(cmd->x1, cmd->y1, cmd->x2, cmd->y2, cmd->fc);
+                break;
+            case LCD_SCENE_LINE:
+                lcd_draw_line(cmd->x1, cmd->y1, cmd->x2, cmd->y2, cmd->fc);
+                break;
+            case LCD_SCENE_RECT:
+                lcd_draw_rectangle(cmd->x1, cmd->y1, cmd->x2, cmd->y2, cmd->fc);
+                break;
+            case LCD_SCENE_CIRCLE:
+                lcd_draw_circle(cmd->x1, cmd->y1, (uint8_t)cmd->x2, cmd->fc);
+                break;
+            case LCD_SCENE_FILL_CIRCLE:
+                lcd_fill_circle(cmd->x1, cmd->y1, (uint8_t)cmd->x2, cmd->fc);
+                break;
+            case LCD_SCENE_STRING:
+                lcd_show_string(cmd->x1, cmd->y1, (const uint8_t *)cmd->data, cmd->fc, cmd->bc, cmd->sizey, cmd->mode);
+                break;
+            case LCD_SCENE_CHINESE:
+                lcd_show_chinese(cmd->x1, cmd->y1, (uint8_t *)cmd->data, cmd->fc, cmd->bc, cmd->sizey, cmd->mode);
+                break;
+            case LCD_SCENE_PICTURE_RLE:
+                lcd_show_picture_rle(cmd->x1, cmd->y1, cmd->x2, cmd->y2, (const uint8_t *)cmd->data, cmd->size);
+                break;
+            default:
+                break;
+        }
+    }
+}
+
+
+static void render_direct(void)
+{
+    scene_replay();
+}
+
+
+static void render_framebuffer(void)
+{
+    lcd_framebuffer_enable(m_frame, 0, 0, LCD_PANEL_W, LCD_PANEL_H);
+    scene_replay();
+    lcd_flush();
+    lcd_framebuffer_disable();
+}
+
+
+static void render_scene(void)
+{
+    lcd_scene_render(m_scene, SCENE_NUM, SCENE_BG);
+}
+
+
+static void *stack_thread(void *arg)
+{
+    ((void (*)(void))arg)();
+    return NULL;
+}
+
+
+/* 在填充过的线程栈上运行一帧，返回栈被改写部分的字节数 */
+static uint32_t stack_peak(void (*render)(void))
+{
+    pthread_attr_t attr;
+    pthread_t thread;
+    uint32_t i;
+    
+    memset(m_stack, STACK_FILL, sizeof(m_stack));
+    pthread_attr_init(&attr);
+    pthread_attr_setstack(&attr, m_stack, sizeof(m_stack));
+    if (pthread_create(&thread, &attr, stack_thread, (void *)render) != 0) {
+        pthread_attr_destroy(&attr);
+        return 0;
+    }
+    pthread_join(thread, NULL);
+    pthread_attr_destroy(&attr);
+    
+    /* 栈向低地址增长，第一个被改写的字节以上都算作用量 */
+    for (i = 0; i < sizeof(m_stack); i++) {
+        if (m_stack[i] != STACK_FILL) {
+            break;
+        }
+    }
+    return sizeof(m_stack) - i;
+}
+
+
+static void render_none(void)
+{
+}
+
+
+int main(void)
+{
+    const scene_mode_t modes[] = {
+        {"direct", render_direct, 0},
+        {"framebuffer", render_framebuffer, sizeof(m_frame)},
+        {"scene", render_scene, lcd_scene_ram_size()},
+    };
+    lcd_sim_stats_t stats;
+    uint32_t i, hash = 0, base, stack;
+    
+    lcd_sim_reset();
+    if (lcd_init() != 0) {
+        printf("lcd_init failed\n");
+        return 1;
+    }
+    
+    /* 空线程的栈用量为线程本身的开销，从各方式的用量中扣除 */
+    base = stack_peak(render_none);
+    printf("%-12s %6s %8s %10s %8s %10s %8s\n",
+           "mode", "trans", "bytes", "time_us", "pixels", "buf_ram", "stack");
+    for (i = 0; i < sizeof(modes) / sizeof(modes[0]); i++) {
+        lcd_fill(0, 0, LCD_W, LCD_H, LCD_GRAY);
+        lcd_sim_reset_stats();
+        stack = stack_peak(modes[i].render);
+        lcd_sim_get_stats(&stats);
+        stack = (stack > base) ? (stack - base) : 0;
+        
+        printf("%-12s %6u %8u %10llu %8u %10u %8u\n", modes[i].name, stats.transactions, stats.bytes,
+               (unsigned long long)(lcd_sim_time_ns(&stats, SCENE_CLOCK, 0) / NSEC_PER_USEC),
+               stats.pixels, modes[i].ram, stack);
+        if (i == 0) {
+            hash = lcd_sim_hash();
+        }
+        LCD_TEST_CHECK(lcd_sim_hash() == hash, "%s frame differs from direct", modes[i].name);
+        LCD_TEST_CHECK(stack != 0, "%s stack not measured", modes[i].name);
+    }
+    
+    /* 条带渲染每个像素只发送一次 */
+    lcd_sim_reset_stats();
+    render_scene();
+    lcd_sim_get_stats(&stats);
+    LCD_TEST_CHECK(stats.pixels == (uint32_t)LCD_W * LCD_H, "scene sent %u pixels", stats.pixels);
+    
+    return LCD_TEST_RESULT();
+}
@@ -0,0 +1,407 @@
+/*
+ * Copyright (c) 2022 FuZhou Lockzhiner Electronic Co., Ltd. All rights reserved.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+/* ST7789V面板模拟器：实现LzGpioSetVal()/LzSpiWrite()，把总线上的
+ * 字节流按命令解码到内存中的显存
+ */
+#include <stdio.h>
+#include <string.h>
+#include <time.h>
+#include "lz_hardware.h"
+#include "hal_base.h"
+#include "lcd_sim.h"
+
+/* LCD驱动使用的引脚 */
+#define SIM_PIN_CS              GPIO0_PC0
+#define SIM_PIN_CLK             GPIO0_PC1
+#define SIM_PIN_MOSI            GPIO0_PC2
+#define SIM_PIN_DC              GPIO0_PC6
+
+/* 解码的命令 */
+#define CMD_COLUMN              0x2A
+#define CMD_ROW                 0x2B
+#define CMD_WRITE               0x2C
+#define CMD_SCROLL_AREA         0x33
+#define CMD_MADCTL              0x36
+#define CMD_SCROLL_START        0x37
+
+/* MADCTL：行地址镜像、列地址镜像、行列交换 */
+#define MADCTL_MY               0x80
+#define MADCTL_MX               0x40
+#define MADCTL_MV               0x20
+
+/* 命令参数的最大字节数 */
+#define PARAM_MAX               8
+
+/* FNV-1a哈希 */
+#define FNV_OFFSET              2166136261U
+#define FNV_PRIME               16777619U
+
+#define NSEC_PER_SEC            1000000000ULL
+#define BYTE_TO_BITS            8
+
+struct GPIO_REG g_lcd_sim_gpio0;
+
+/* 引脚电平 */
+static uint8_t m_pin[GPIO_PIN_NUM];
+
+/* 显存，按面板的行列存放 */
+static uint16_t m_gram[LCD_SIM_H][LCD_SIM_W];
+
+/* 命令解码状态 */
+static struct {
+    uint8_t cmd;                            /* 当前命令 */
+    uint8_t param[PARAM_MAX];               /* 已收到的参数 */
+    uint8_t param_num;                      /* 已收到的参数字节数 */
+    uint16_t xs, xe, ys, ye;                /* 列地址和行地址窗口 */
+    uint16_t cx, cy;                        /* 写入位置 */
+    uint8_t hi;                             /* 像素的高字节 */
+    bool have_hi;                           /* 是否已收到高字节 */
+    uint8_t madctl;                         /* MADCTL寄存器 */
+    uint16_t tfa, vsa, vsp;                 /* 顶部固定区域、滚动区域、滚动起始地址 */
+    uint8_t bits;                           /* GPIO模拟时已收到的位数 */
+    uint8_t shift;                          /* GPIO模拟时正在接收的字节 */
+} m_dec;
+
+static lcd_sim_stats_t m_stats;
+
+/* 模拟慢速总线：LzSpiWrite()每个字节的传输时间（纳秒） */
+static uint32_t m_byte_ns = 0;
+
+
+/* 把逻辑地址(cx, cy)按MADCTL换算为显存位置并写入像素 */
+static void sim_put_pixel(uint16_t color)
+{
+    bool mv = (m_dec.madctl & MADCTL_MV) != 0;
+    int lx = m_dec.cx;
+    int ly = m_dec.cy;
+    int px, py;
+    
+    if (m_dec.madctl & MADCTL_MX) {
+        lx = (mv ? LCD_SIM_H : LCD_SIM_W) - 1 - lx;
+    }
+    if (m_dec.madctl & MADCTL_MY) {
+        ly = (mv ? LCD_SIM_W : LCD_SIM_H) - 1 - ly;
+    }
+    px = mv ? ly : lx;
+    py = mv ? lx : ly;
+    if ((px >= 0) && (px < LCD_SIM_W) && (py >= 0) && (py < LCD_SIM_H)) {
+        m_gram[py][px] = color;
+    }
+    m_stats.pixels++;
+    
+    /* 写满一行后换行，写满窗口后回到窗口起点 */
+    if (++m_dec.cx > m_dec.xe) {
+        m_dec.cx = m_dec.xs;
+        if (++m_dec.cy > m_dec.ye) {
+            m_dec.cy = m_dec.ys;
+        }
+    }
+}
+
+
+/* 处理命令参数，参数收齐后更新面板状态 */
+static void sim_on_param(uint8_t dat)
+{
+    uint16_t start, end;
+    
+    if (m_dec.cmd == CMD_WRITE) {
+        if (!m_dec.have_hi) {
+            m_dec.hi = dat;
+            m_dec.have_hi = true;
+            return;
+        }
+        m_dec.have_hi = false;
+        sim_put_pixel((uint16_t)((m_dec.hi << BYTE_TO_BITS) | dat));
+        return;
+    }
+    
+    if (m_dec.param_num >= PARAM_MAX) {
+        return;
+    }
+    m_dec.param[m_dec.param_num++] = dat;
+    
+    switch (m_dec.cmd) {
+        case CMD_COLUMN:
+        case CMD_ROW:
+            if (m_dec.param_num == 4) {
+                start = (uint16_t)((m_dec.param[0] << BYTE_TO_BITS) | m_dec.param[1]);
+                end = (uint16_t)((m_dec.param[2] << BYTE_TO_BITS) | m_dec.param[3]);
+                if (m_dec.cmd == CMD_COLUMN) {
+                    m_dec.xs = start;
+                    m_dec.xe = end;
+                } else {
+                    m_dec.ys = start;
+                    m_dec.ye = end;
+                }
+            }
+            break;
+        case CMD_MADCTL:
+            m_dec.madctl = dat;
+            break;
+        case CMD_SCROLL_AREA:
+            if (m_dec.param_num == 6) {
+                m_dec.tfa = (uint16_t)((m_dec.param[0] << BYTE_TO_BITS) | m_dec.param[1]);
+                m_dec.vsa = (uint16_t)((m_dec.param[2] << BYTE_TO_BITS) | m_dec.param[3]);
+            }
+            break;
+        case CMD_SCROLL_START:
+            if (m_dec.param_num == 2) {
+                m_dec.vsp = (uint16_t)((m_dec.param[0] << BYTE_TO_BITS) | m_dec.param[1]);
+            }
+            break;
+        default:
+            break;
+    }
+}
+
+
+/* 处理总线上的一个字节，dc为0时是命令 */
+static void sim_on_byte(uint8_t dat, bool dc)
+{
+    m_stats.bytes++;
+    if (dc) {
+        sim_on_param(dat);
+        return;
+    }
+    
+    m_stats.commands++;
+    m_dec.cmd = dat;
+    m_dec.param_num = 0;
+    if (dat == CMD_WRITE) {
+        m_dec.cx = m_dec.xs;
+        m_dec.cy = m_dec.ys;
+        m_dec.have_hi = false;
+    }
+}
+
+
+/* 引脚电平变化：片选下降沿开始一次传输，时钟上升沿采样数据 */
+static void sim_set_pin(uint32_t id, uint8_t val)
+{
+    uint8_t old;
+    
+    if (id >= GPIO_PIN_NUM) {
+        return;
+    }
+    old = m_pin[id];
+    m_pin[id] = val;
+    
+    if (id == SIM_PIN_CS) {
+        if (old && !val) {
+            m_stats.transactions++;
+            m_dec.bits = 0;
+        }
+    } else if ((id == SIM_PIN_CLK) && !old && val && !m_pin[SIM_PIN_CS]) {
+        m_dec.shift = (uint8_t)((m_dec.shift << 1) | m_pin[SIM_PIN_MOSI]);
+        if (++m_dec.bits == BYTE_TO_BITS) {
+            m_dec.bits = 0;
+            sim_on_byte(m_dec.shift, m_pin[SIM_PIN_DC] != 0);
+        }
+    }
+}
+
+
+unsigned int LzGpioInit(uint32_t id)
+{
+    (void)id;
+    return LZ_HARDWARE_SUCCESS;
+}
+
+
+unsigned int LzGpioDeinit(uint32_t id)
+{
+    (void)id;
+    return LZ_HARDWARE_SUCCESS;
+}
+
+
+unsigned int LzGpioSetDir(uint32_t id, LzGpioDir dir)
+{
+    (void)id;
+    (void)dir;
+    return LZ_HARDWARE_SUCCESS;
+}
+
+
+unsigned int LzGpioSetVal(uint32_t id, LzGpioValue val)
+{
+    sim_set_pin(id, (val == LZGPIO_LEVEL_HIGH) ? 1 : 0);
+    return LZ_HARDWARE_SUCCESS;
+}
+
+
+unsigned int LzGpioGetVal(uint32_t id, LzGpioValue *val)
+{
+    *val = (id < GPIO_PIN_NUM && m_pin[id]) ? LZGPIO_LEVEL_HIGH : LZGPIO_LEVEL_LOW;
+    return LZ_HARDWARE_SUCCESS;
+}
+
+
+unsigned int SpiIoInit(SpiBusIo bus)
+{
+    (void)bus;
+    return LZ_HARDWARE_SUCCESS;
+}
+
+
+unsigned int LzSpiInit(unsigned int id, LzSpiConfig conf)
+{
+    (void)id;
+    (void)conf;
+    return LZ_HARDWARE_SUCCESS;
+}
+
+
+unsigned int LzSpiDeinit(unsigned int id)
+{
+    (void)id;
+    return LZ_HARDWARE_SUCCESS;
+}
+
+
+/* 像SPI传输一样阻塞调用者指定的时间 */
+static void sim_sleep_ns(uint64_t ns)
+{
+    struct timespec ts;
+    
+    ts.tv_sec = (time_t)(ns / NSEC_PER_SEC);
+    ts.tv_nsec = (long)(ns % NSEC_PER_SEC);
+    while (nanosleep(&ts, &ts) != 0) {
+    }
+}
+
+
+unsigned int LzSpiWrite(unsigned int id, unsigned int cs, const void *buf, unsigned int len)
+{
+    const uint8_t *p = buf;
+    unsigned int i;
+    
+    (void)id;
+    (void)cs;
+    m_stats.transactions++;
+    for (i = 0; i < len; i++) {
+        sim_on_byte(p[i], m_pin[SIM_PIN_DC] != 0);
+    }
+    if (m_byte_ns != 0) {
+        sim_sleep_ns((uint64_t)len * m_byte_ns);
+    }
+    return LZ_HARDWARE_SUCCESS;
+}
+
+
+void lcd_sim_reg_write(uint32_t val)
+{
+    uint32_t bit;
+    
+    g_lcd_sim_gpio0.SWPORT_DR_H = val;
+    for (bit = 0; bit < BYTE_TO_BITS; bit++) {
+        if (val & (1U << (bit + 16))) {
+            sim_set_pin(GPIO0_PC0 + bit, (uint8_t)((val >> bit) & 1));
+        }
+    }
+}
+
+
+void lcd_sim_reset(void)
+{
+    memset(m_gram, 0, sizeof(m_gram));
+    memset(&m_dec, 0, sizeof(m_dec));
+    m_dec.xe = LCD_SIM_W - 1;
+    m_dec.ye = LCD_SIM_H - 1;
+    m_dec.vsa = LCD_SIM_H;
+    lcd_sim_reset_stats();
+}
+
+
+void lcd_sim_set_byte_ns(uint32_t ns)
+{
+    m_byte_ns = ns;
+}
+
+
+void lcd_sim_get_stats(lcd_sim_stats_t *stats)
+{
+    *stats = m_stats;
+}
+
+
+void lcd_sim_reset_stats(void)
+{
+    memset(&m_stats, 0, sizeof(m_stats));
+}
+
+
+uint64_t lcd_sim_time_ns(const lcd_sim_stats_t *stats, uint32_t clock, uint32_t overhead_ns)
+{
+    if (clock == 0) {
+        return 0;
+    }
+    return (uint64_t)stats->bytes * BYTE_TO_BITS * NSEC_PER_SEC / clock +
+           (uint64_t)stats->transactions * overhead_ns;
+}
+
+
+uint16_t lcd_sim_get_pixel(uint16_t x, uint16_t y)
+{
+    uint32_t row = y;
+    
+    if ((x >= LCD_SIM_W) || (y >= LCD_SIM_H)) {
+        return 0;
+    }
+    /* 滚动区域内的第n行显示从滚动起始地址开始的第n行显存 */
+    if ((m_dec.vsa > 0) && (y >= m_dec.tfa) && (y < m_dec.tfa + m_dec.vsa)) {
+        row = m_dec.tfa + (m_dec.vsp + m_dec.vsa - m_dec.tfa + (y - m_dec.tfa)) % m_dec.vsa;
+    }
+    return m_gram[row][x];
+}
+
+
+uint32_t lcd_sim_hash(void)
+{
+    uint32_t hash = FNV_OFFSET;
+    uint16_t x, y, color;
+    
+    for (y = 0; y < LCD_SIM_H; y++) {
+        for (x = 0; x < LCD_SIM_W; x++) {
+            color = lcd_sim_get_pixel(x, y);
+            hash = (hash ^ (color >> BYTE_TO_BITS)) * FNV_PRIME;
+            hash = (hash ^ (color & 0xFF)) * FNV_PRIME;
+        }
+    }
+    return hash;
+}
+
+
+unsigned int lcd_sim_dump_ppm(const char *path)
+{
+    FILE *fp = fopen(path, "wb");
+    uint16_t x, y, color;
+    
+    if (fp == NULL) {
+        return __LINE__;
+    }
+    fprintf(fp, "P6\n%d %d\n255\n", LCD_SIM_W, LCD_SIM_H);
+    for (y = 0; y < LCD_SIM_H; y++) {
+        for (x = 0; x < LCD_SIM_W; x++) {
+            color = lcd_sim_get_pixel(x, y);
+            /* RGB565展开为RGB888 */
+            fputc(((color >> 11) & 0x1F) << 3, fp);
+            fputc(((color >> 5) & 0x3F) << 2, fp);
+            fputc((color & 0x1F) << 3, fp);
+        }
+    }
+    fclose(fp);
+    return 0;
+}
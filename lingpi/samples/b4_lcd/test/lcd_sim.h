@@ -0,0 +1,124 @@
+/*
+ * Copyright (c) 2022 FuZhou Lockzhiner Electronic Co., Ltd. All rights reserved.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef _LCD_SIM_H_
+#define _LCD_SIM_H_
+
+#include <stdint.h>
+
+/* 模拟的面板尺寸，与ST7789V的显存一致（竖屏） */
+#define LCD_SIM_W               240
+#define LCD_SIM_H               320
+
+/* 从总线上解码得到的传输统计 */
+typedef struct {
+    uint32_t transactions;                  /* 传输次数：片选有效的次数或LzSpiWrite()的调用次数 */
+    uint32_t bytes;                         /* 总字节数 */
+    uint32_t commands;                      /* 命令字节数 */
+    uint32_t pixels;                        /* 写入显存的像素数 */
+} lcd_sim_stats_t;
+
+/***************************************************************
+ * 函数名称: lcd_sim_reset
+ * 说    明: 复位模拟的面板：显存清零，MADCTL、滚动区域恢复默认值，
+ *           传输统计清零
+ * 参    数: 无
+ * 返 回 值: 无
+ ***************************************************************/
+void lcd_sim_reset(void);
+
+
+/***************************************************************
+ * 函数名称: lcd_sim_set_byte_ns
+ * 说    明: 模拟慢速总线，LzSpiWrite()按字节数阻塞调用者，
+ *           用于测试后台刷新任务与渲染并行。lcd_sim_reset()不改变该设置
+ * 参    数:
+ *       @ns：每个字节的传输时间（纳秒），0为不阻塞
+ * 返 回 值: 无
+ ***************************************************************/
+void lcd_sim_set_byte_ns(uint32_t ns);
+
+
+/***************************************************************
+ * 函数名称: lcd_sim_get_stats
+ * 说    明: 获取从总线上解码得到的传输统计
+ * 参    数:
+ *       @stats：传输统计
+ * 返 回 值: 无
+ ***************************************************************/
+void lcd_sim_get_stats(lcd_sim_stats_t *stats);
+
+
+/***************************************************************
+ * 函数名称: lcd_sim_reset_stats
+ * 说    明: 清零传输统计
+ * 参    数: 无
+ * 返 回 值: 无
+ ***************************************************************/
+void lcd_sim_reset_stats(void);
+
+
+/***************************************************************
+ * 函数名称: lcd_sim_time_ns
+ * 说    明: 按指定的SPI时钟计算传输统计对应的传输时间
+ * 参    数:
+ *       @stats：传输统计
+ *       @clock：SPI时钟频率（Hz）
+ *       @overhead_ns：每次传输的固定开销（纳秒）
+ * 返 回 值: 传输时间（纳秒）
+ ***************************************************************/
+uint64_t lcd_sim_time_ns(const lcd_sim_stats_t *stats, uint32_t clock, uint32_t overhead_ns);
+
+
+/***************************************************************
+ * 函数名称: lcd_sim_get_pixel
+ * 说    明: 获取屏幕上显示的像素，已按垂直滚动换算显存行
+ * 参    数:
+ *       @x：面板的X坐标
+ *       @y：面板的Y坐标
+ * 返 回 值: 像素颜色（RGB565）
+ ***************************************************************/
+uint16_t lcd_sim_get_pixel(uint16_t x, uint16_t y);
+
+
+/***************************************************************
+ * 函数名称: lcd_sim_hash
+ * 说    明: 计算屏幕上显示内容的FNV-1a哈希，用于和标准图像比较
+ * 参    数: 无
+ * 返 回 值: 哈希值
+ ***************************************************************/
+uint32_t lcd_sim_hash(void);
+
+
+/***************************************************************
+ * 函数名称: lcd_sim_dump_ppm
+ * 说    明: 把屏幕上显示的内容保存为PPM图片
+ * 参    数:
+ *       @path：文件路径
+ * 返 回 值: 返回0为成功，反之为失败
+ ***************************************************************/
+unsigned int lcd_sim_dump_ppm(const char *path);
+
+
+/***************************************************************
+ * 函数名称: lcd_sim_reg_write
+ * 说    明: 模拟写GPIO0 SWPORT_DR_H寄存器，LCD_BUS_GPIO_REG方式
+ *           编译时LCD_REG_WRITE被替换为该函数
+ * 参    数:
+ *       @val：寄存器值，高16位为写使能
+ * 返 回 值: 无
+ ***************************************************************/
+void lcd_sim_reg_write(uint32_t val);
+
+#endif
@@ -0,0 +1,93 @@
+/*
+ * Copyright (c) 2022 FuZhou Lockzhiner Electronic Co., Ltd. All rights reserved.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+/* 字符串测试：含有控制字符的字符串在非叠加和叠加模式下都跳过该字符，
+ * 之后的字符照常显示，与分段显示的结果相同
+ */
+#include <stdio.h>
+#include <string.h>
+#include "lcd.h"
+#include "lcd_sim.h"
+#include "lcd_test.h"
+
+#define TEXT_X                  4
+#define TEXT_Y                  40
+
+/* 在灰色背景上显示一次，返回屏幕哈希 */
+static uint32_t show_string(const char *s, uint8_t sizey, uint8_t mode)
+{
+    lcd_fill(0, 0, LCD_W, LCD_H, LCD_GRAY);
+    lcd_show_string(TEXT_X, TEXT_Y, (const uint8_t *)s, LCD_RED, LCD_WHITE, sizey, mode);
+    return lcd_sim_hash();
+}
+
+
+/* 跳过的字符处留空，前后两段分别显示 */
+static uint32_t show_parts(const char *a, const char *b, uint8_t skip, uint8_t sizey, uint8_t mode)
+{
+    uint16_t x = TEXT_X + (uint16_t)(strlen(a) + skip) * (sizey / 2);
+    
+    lcd_fill(0, 0, LCD_W, LCD_H, LCD_GRAY);
+    lcd_show_string(TEXT_X, TEXT_Y, (const uint8_t *)a, LCD_RED, LCD_WHITE, sizey, mode);
+    lcd_show_string(x, TEXT_Y, (const uint8_t *)b, LCD_RED, LCD_WHITE, sizey, mode);
+    return lcd_sim_hash();
+}
+
+
+static uint32_t show_chinese(const char *s, uint8_t mode)
+{
+    lcd_fill(0, 0, LCD_W, LCD_H, LCD_GRAY);
+    lcd_show_chinese(TEXT_X, TEXT_Y, (uint8_t *)s, LCD_RED, LCD_WHITE, LCD_FONT_SIZE16, mode);
+    return lcd_sim_hash();
+}
+
+
+int main(void)
+{
+    static const uint8_t sizes[] = {LCD_FONT_SIZE12, LCD_FONT_SIZE16, LCD_FONT_SIZE24, LCD_FONT_SIZE32};
+    uint32_t blank, hash;
+    uint8_t mode, i;
+    
+    lcd_sim_reset();
+    lcd_init();
+    lcd_fill(0, 0, LCD_W, LCD_H, LCD_GRAY);
+    blank = lcd_sim_hash();
+    
+    for (mode = 0; mode <= 1; mode++) {
+        for (i = 0; i < sizeof(sizes); i++) {
+            hash = show_string("Hi\nthere", sizes[i], mode);
+            LCD_TEST_CHECK(hash == show_parts("Hi", "there", 1, sizes[i], mode),
+                           "newline, size %u mode %u", sizes[i], mode);
+            hash = show_string("\t\x01tab", sizes[i], mode);
+            LCD_TEST_CHECK(hash == show_parts("", "tab", 2, sizes[i], mode),
+                           "leading control chars, size %u mode %u", sizes[i], mode);
+        }
+        /* 超过一次整行发送的字符数，跳过的字符在第二批中 */
+        hash = show_string("0123456789abcdefghij\rklmnop", LCD_FONT_SIZE12, mode);
+        LCD_TEST_CHECK(hash == show_parts("0123456789abcdefghij", "klmnop", 1, LCD_FONT_SIZE12, mode),
+                       "control char in a later run, mode %u", mode);
+        
+        /* 不支持的字号不显示，也不影响之后的显示 */
+        LCD_TEST_CHECK(show_string("abc", 20, mode) == blank, "size 20 drew pixels, mode %u", mode);
+        
+        /* 汉字串中的ASCII部分同样处理 */
+        hash = show_chinese("AB\n小凌派", mode);
+        lcd_fill(0, 0, LCD_W, LCD_H, LCD_GRAY);
+        lcd_show_chinese(TEXT_X, TEXT_Y, (uint8_t *)"AB", LCD_RED, LCD_WHITE, LCD_FONT_SIZE16, mode);
+        lcd_show_chinese(TEXT_X + 3 * 8, TEXT_Y, (uint8_t *)"小凌派", LCD_RED, LCD_WHITE, LCD_FONT_SIZE16, mode);
+        LCD_TEST_CHECK(hash == lcd_sim_hash(), "newline in hanzi string, mode %u", mode);
+    }
+    
+    return LCD_TEST_RESULT();
+}
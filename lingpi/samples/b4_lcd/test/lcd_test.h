@@ -0,0 +1,36 @@
+/*
+ * Copyright (c) 2022 FuZhou Lockzhiner Electronic Co., Ltd. All rights reserved.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef _LCD_TEST_H_
+#define _LCD_TEST_H_
+
+#include <stdio.h>
+#include <stdint.h>
+
+/* 主机测试程序共用的检查宏，每个测试程序只有一个源文件 */
+static uint32_t m_test_failed = 0;
+
+#define LCD_TEST_CHECK(cond, ...) do { \
+    if (!(cond)) { \
+        printf("FAIL %s:%d: ", __FILE__, __LINE__); \
+        printf(__VA_ARGS__); \
+        printf("\n"); \
+        m_test_failed++; \
+    } \
+} while (0)
+
+/* 测试结果，作为main()的返回值 */
+#define LCD_TEST_RESULT()       ((m_test_failed == 0) ? (printf("PASS\n"), 0) : 1)
+
+#endif
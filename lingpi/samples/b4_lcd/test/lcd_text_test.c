@@ -0,0 +1,151 @@
+/*
+ * Copyright (c) 2022 FuZhou Lockzhiner Electronic Co., Ltd. All rights reserved.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+/* 抗锯齿字体测试：用2、4位灰度的手工字体检查非叠加模式下灰度0和最大
+ * 灰度的像素分别正好是背景色和字的颜色，中间灰度的各分量介于两者之间，
+ * 颜色组合超过混合色表缓存数目时结果不变；叠加模式下只有灰度达到一半
+ * 的像素改为字的颜色，其余像素保持屏幕原有的颜色
+ */
+#include <stdio.h>
+#include "lcd.h"
+#include "lcd_text.h"
+#include "lcd_sim.h"
+#include "lcd_test.h"
+
+#define TEXT_X                  20
+#define TEXT_Y                  30
+#define GLYPH_W                 4
+#define GLYPH_H                 4
+#define GLYPH_X                 1
+#define GLYPH_Y                 1
+#define BITS_PER_BYTE           8
+#define REPEAT                  2
+
+#define RGB565_R(c)             (((c) >> 11) & 0x1F)
+#define RGB565_G(c)             (((c) >> 5) & 0x3F)
+#define RGB565_B(c)             ((c) & 0x1F)
+
+/* 4x4的"A"，灰度按行从0递增到最大值，字符格6x6 */
+static const uint8_t m_font4_bitmap[] = {0x01, 0x23, 0x45, 0x67, 0x89, 0xAB, 0xCD, 0xEF};
+static const uint8_t m_font2_bitmap[] = {0x1B, 0x1B, 0x1B, 0x1B};
+static const lcd_glyph_t m_glyphs[] = {
+    {0, 'A', GLYPH_W, GLYPH_H, GLYPH_X, GLYPH_Y, 6},
+};
+static const lcd_font_t m_font4 = {6, 5, 4, 1, m_glyphs, m_font4_bitmap};
+static const lcd_font_t m_font2 = {6, 5, 2, 1, m_glyphs, m_font2_bitmap};
+
+/* 字的颜色和背景色，数目超过lcd_text.c中混合色表的缓存数目 */
+static const uint16_t m_pairs[][2] = {
+    {0xFFFF, 0x0000},
+    {0x0000, 0xFFFF},
+    {0x1234, 0xFEDC},
+    {LCD_RED, LCD_BLUE},
+    {0x07E0, 0xF81F},
+    {0x8410, 0x8430},
+};
+
+#define PAIR_NUM                (sizeof(m_pairs) / sizeof(m_pairs[0]))
+
+static uint8_t glyph_level(const lcd_font_t *font, uint8_t col, uint8_t row)
+{
+    uint32_t pos = ((uint32_t)row * GLYPH_W + col) * font->bpp;
+    uint8_t shift = BITS_PER_BYTE - font->bpp - (pos % BITS_PER_BYTE);
+    
+    return (font->bitmap[pos / BITS_PER_BYTE] >> shift) & ((1 << font->bpp) - 1);
+}
+
+
+static int between(uint8_t v, uint8_t a, uint8_t b)
+{
+    return (a < b) ? ((v >= a) && (v <= b)) : ((v >= b) && (v <= a));
+}
+
+
+/* 非叠加模式：字符格中字形以外的像素和灰度0为背景色，最大灰度为字的颜色 */
+static void check_opaque(const lcd_font_t *font, uint16_t fc, uint16_t bc)
+{
+    uint8_t top = (1 << font->bpp) - 1;
+    uint8_t col, row, level;
+    uint16_t pixel;
+    
+    lcd_show_text(TEXT_X, TEXT_Y, "A", fc, bc, font, 0);
+    LCD_TEST_CHECK(lcd_sim_get_pixel(TEXT_X, TEXT_Y) == bc, "%u bpp 0x%04x/0x%04x: cell corner 0x%04x",
+                   font->bpp, fc, bc, lcd_sim_get_pixel(TEXT_X, TEXT_Y));
+    for (row = 0; row < GLYPH_H; row++) {
+        for (col = 0; col < GLYPH_W; col++) {
+            level = glyph_level(font, col, row);
+            pixel = lcd_sim_get_pixel(TEXT_X + GLYPH_X + col, TEXT_Y + GLYPH_Y + row);
+            if (level == 0) {
+                LCD_TEST_CHECK(pixel == bc, "%u bpp 0x%04x/0x%04x: level 0 is 0x%04x",
+                               font->bpp, fc, bc, pixel);
+            } else if (level == top) {
+                LCD_TEST_CHECK(pixel == fc, "%u bpp 0x%04x/0x%04x: level %u is 0x%04x",
+                               font->bpp, fc, bc, level, pixel);
+            } else {
+                LCD_TEST_CHECK(between(RGB565_R(pixel), RGB565_R(fc), RGB565_R(bc)) &&
+                               between(RGB565_G(pixel), RGB565_G(fc), RGB565_G(bc)) &&
+                               between(RGB565_B(pixel), RGB565_B(fc), RGB565_B(bc)),
+                               "%u bpp 0x%04x/0x%04x: level %u is 0x%04x", font->bpp, fc, bc, level, pixel);
+            }
+        }
+    }
+}
+
+
+/* 叠加模式：在两种颜色的背景上显示，灰度达到一半的像素为字的颜色 */
+static void check_overlay(const lcd_font_t *font, uint16_t fc)
+{
+    uint8_t half = 1 << (font->bpp - 1);
+    uint8_t col, row;
+    uint16_t pixel, bg;
+    
+    lcd_fill(TEXT_X, TEXT_Y, TEXT_X + 6, TEXT_Y + 3, LCD_GRAY);
+    lcd_fill(TEXT_X, TEXT_Y + 3, TEXT_X + 6, TEXT_Y + 6, LCD_GREEN);
+    lcd_show_text(TEXT_X, TEXT_Y, "A", fc, LCD_WHITE, font, 1);
+    for (row = 0; row < GLYPH_H; row++) {
+        for (col = 0; col < GLYPH_W; col++) {
+            pixel = lcd_sim_get_pixel(TEXT_X + GLYPH_X + col, TEXT_Y + GLYPH_Y + row);
+            bg = (GLYPH_Y + row < 3) ? LCD_GRAY : LCD_GREEN;
+            LCD_TEST_CHECK(pixel == ((glyph_level(font, col, row) >= half) ? fc : bg),
+                           "%u bpp overlay: pixel (%u, %u) level %u is 0x%04x",
+                           font->bpp, col, row, glyph_level(font, col, row), pixel);
+        }
+    }
+}
+
+
+int main(void)
+{
+    const lcd_font_t *fonts[] = {&m_font4, &m_font2};
+    uint32_t f, r, i;
+    
+    lcd_sim_reset();
+    if (lcd_init() != 0) {
+        printf("lcd_init failed\n");
+        return 1;
+    }
+    
+    for (r = 0; r < REPEAT; r++) {
+        for (i = 0; i < PAIR_NUM; i++) {
+            for (f = 0; f < sizeof(fonts) / sizeof(fonts[0]); f++) {
+                check_opaque(fonts[f], m_pairs[i][0], m_pairs[i][1]);
+            }
+        }
+    }
+    for (f = 0; f < sizeof(fonts) / sizeof(fonts[0]); f++) {
+        check_overlay(fonts[f], LCD_RED);
+    }
+    
+    return LCD_TEST_RESULT();
+}
@@ -0,0 +1,1654 @@
+/*
+ * Copyright (c) 2022 FuZhou Lockzhiner Electronic Co., Ltd. All rights reserved.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+/* 例程图片gImage_lingzhi压缩前的RGB565原始数据（210x62，高字节在前），
+ * 取自改为RLE格式之前的src/picture.c，用于检查RLE解码的结果
+ */
+#ifndef _LINGZHI_RAW_H_
+#define _LINGZHI_RAW_H_
+
+#define LINGZHI_RAW_SIZE                26040
+
+static const unsigned char m_lingzhi_raw[LINGZHI_RAW_SIZE] = {
+    0XFF, 0XBF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFD, 0XFF, 0XFC, 0XFF, 0XFC, 0XFF, 0XFD, 0XFF, 0XFD,
+    0XFF, 0XFF, 0XFF, 0XFE, 0XFF, 0XFE, 0XFF, 0XFE, 0XFF, 0XFE, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
+    0XFF, 0XFF, 0XFF, 0XFD, 0XFF, 0XFD, 0XFF, 0XFD, 0XFF, 0XFD, 0XFF, 0XFD, 0XFF, 0XFE, 0XFF, 0XFF,
+    0XFF, 0XFF, 0XFF, 0XDF, 0XFF, 0XDF, 0XFF, 0XDF, 0XFF, 0XDF, 0XFF, 0XDF, 0XFF, 0XDF, 0XFF, 0XFF,
+    0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XF7, 0XFF, 0XF7, 0XFF, 0XF7, 0XFF, 0XF7, 0XFF, 0XF7, 0XFF,
+    0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFE, 0XFF, 0XDD, 0XFF, 0XDD, 0XFF, 0XDD,
+    0XFF, 0XDD, 0XFF, 0XDF, 0XFF, 0XBF, 0XFF, 0XBF, 0XFF, 0XDF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
+    0XFF, 0XFF, 0XFF, 0XFD, 0XFF, 0XFB, 0XFF, 0XFC, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XDF, 0XFF, 0XFF,
+    0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
+    0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
+    0XF7, 0X9E, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
+    0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XDF,
+    0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
+    0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
+    0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XDF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
+    0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
+    0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
+    0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
+    0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XDF, 0XF7, 0XBE, 0XFF, 0XDF, 0XFF, 0XFF,
+    0XFF, 0XDF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XDF, 0XF7, 0XBE, 0XFF, 0XDF, 0XFF, 0XFF, 0XFF, 0XFF,
+    0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
+    0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
+    0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
+    0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
+    0XFF, 0XDF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XDF, 0XFF, 0XFF, 0XFF, 0XFF,
+    0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
+    0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XBF, 0XFF, 0XFF, 0XFF, 0XFD, 0XFF, 0XFA, 0XF7, 0XF9, 0XFF, 0XF9,
+    0XFF, 0XFA, 0XFF, 0XFB, 0XFF, 0XFB, 0XFF, 0XFB, 0XFF, 0XFA, 0XFF, 0XFA, 0XFF, 0XFA, 0XFF, 0XFB,
+    0XFF, 0XFD, 0XFF, 0XFD, 0XFF, 0XFC, 0XFF, 0XFB, 0XFF, 0XFB, 0XFF, 0XFB, 0XFF, 0XFA, 0XFF, 0XFA,
+    0XFF, 0XFB, 0XFF, 0XFB, 0XFF, 0XFC, 0XFF, 0XFC, 0XFF, 0XFD, 0XFF, 0XFD, 0XFF, 0XFC, 0XFF, 0XFC,
+    0XFF, 0XFC, 0XFF, 0XFC, 0XFF, 0XFC, 0XFF, 0XFC, 0XFF, 0XFC, 0XFF, 0XFC, 0XFF, 0XFC, 0XFF, 0XFC,
+    0XFF, 0XFC, 0XFF, 0XFC, 0XFF, 0XFC, 0XFF, 0XFC, 0XFF, 0XFC, 0XFF, 0XFB, 0XFF, 0XFB, 0XFF, 0XFA,
+    0XFF, 0XFA, 0XFF, 0XFA, 0XFF, 0XFA, 0XFF, 0XFB, 0XFF, 0XFD, 0XFF, 0XFD, 0XFF, 0XFC, 0XFF, 0XFC,
+    0XFF, 0XFD, 0XFF, 0XFC, 0XFF, 0XFC, 0XFF, 0XFB, 0XFF, 0XF9, 0XFF, 0XFA, 0XFF, 0XFE, 0XFF, 0XFF,
+    0XFF, 0XBF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
+    0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
+    0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XBF, 0XFF, 0XDF, 0XFF, 0XFF, 0XFF, 0XFF,
+    0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XBF, 0XFF, 0XDF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
+    0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
+    0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
+    0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
+    0XFF, 0XDF, 0XFF, 0XDF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
+    0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
+    0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
+    0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XDF, 0XFF, 0XDF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
+    0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
+    0XFF, 0XDF, 0XF7, 0X9E, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
+    0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
+    0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
+    0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
+    0XFF, 0XFF, 0XFF, 0XDF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
+    0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
+    0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFD, 0XFF, 0XFC, 0XF7, 0XF8, 0XDF, 0X73,
+    0XD7, 0X30, 0XD7, 0X4F, 0XDF, 0X70, 0XDF, 0X50, 0XDF, 0X50, 0XDF, 0X50, 0XDF, 0X6F, 0XDF, 0X6F,
+    0XDF, 0X6F, 0XDF, 0X50, 0XDF, 0X51, 0XDF, 0X51, 0XDF, 0X32, 0XDF, 0X31, 0XDF, 0X51, 0XDF, 0X50,
+    0XDF, 0X50, 0XDF, 0X4F, 0XDF, 0X4F, 0XDF, 0X4F, 0XDF, 0X4F, 0XDF, 0X4F, 0XDF, 0X4F, 0XDF, 0X4F,
+    0XDF, 0X6F, 0XDF, 0X6E, 0XDF, 0X6E, 0XDF, 0X6E, 0XDF, 0X4F, 0XDF, 0X4F, 0XDF, 0X4F, 0XDF, 0X50,
+    0XDF, 0X50, 0XDF, 0X50, 0XDF, 0X50, 0XDF, 0X50, 0XDF, 0X50, 0XDF, 0X50, 0XDF, 0X50, 0XDF, 0X50,
+    0XDF, 0X4F, 0XE7, 0X2F, 0XE7, 0X2F, 0XDF, 0X4F, 0XDF, 0X6E, 0XDF, 0X6F, 0XDF, 0X51, 0XD7, 0X51,
+    0XD7, 0X50, 0XD7, 0X70, 0XD7, 0X51, 0XD7, 0X52, 0XD7, 0X52, 0XD7, 0X51, 0XD7, 0X31, 0XE7, 0X74,
+    0XFF, 0XFB, 0XFF, 0XFE, 0XFF, 0XDE, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
+    0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
+    0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XBF, 0XFF, 0XDF, 0XFF, 0XFF,
+    0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XBE, 0XFF, 0XFF, 0XFF, 0XDF, 0XFF, 0XFF, 0XFF, 0XFF,
+    0XFF, 0XFF, 0XFF, 0XDF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
+    0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
+    0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XDF, 0XF7, 0XBE, 0XFF, 0XDF,
+    0XFF, 0XFF, 0XFF, 0XDF, 0XFF, 0XDF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
+    0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
+    0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
+    0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XDF, 0XFF, 0XFF,
+    0XFF, 0XFF, 0XFF, 0XDF, 0XF7, 0XBE, 0XF7, 0XBE, 0XFF, 0XFF, 0XF7, 0XBE, 0XF7, 0XBE, 0XFF, 0XDF,
+    0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
+    0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
+    0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
+    0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
+    0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XDF, 0XFF, 0XFF, 0XFF, 0XDF, 0XF7, 0XBE, 0XFF, 0XDF,
+    0XFF, 0XDF, 0XFF, 0XDF, 0XFF, 0XDF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
+    0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFC, 0XFF, 0XFA,
+    0XE7, 0XB4, 0XC6, 0XCD, 0XAE, 0X28, 0XAE, 0X26, 0XAE, 0X26, 0XAE, 0X06, 0XAE, 0X26, 0XAE, 0X26,
+    0XAE, 0X45, 0XAE, 0X44, 0XAE, 0X44, 0XAE, 0X45, 0XAE, 0X26, 0XAE, 0X27, 0XAE, 0X27, 0XAE, 0X27,
+    0XAE, 0X27, 0XAE, 0X26, 0XAE, 0X26, 0XAE, 0X25, 0XAE, 0X45, 0XAE, 0X44, 0XAE, 0X44, 0XAE, 0X44,
+    0XAE, 0X44, 0XAE, 0X44, 0XAE, 0X43, 0XAE, 0X43, 0XAE, 0X43, 0XAE, 0X43, 0XB6, 0X24, 0XB6, 0X25,
+    0XB6, 0X25, 0XB6, 0X25, 0XB6, 0X25, 0XB6, 0X25, 0XB6, 0X25, 0XB6, 0X25, 0XB6, 0X25, 0XB6, 0X25,
+    0XB6, 0X26, 0XB6, 0X26, 0XB6, 0X26, 0XB6, 0X26, 0XB6, 0X26, 0XAE, 0X25, 0XAE, 0X44, 0XA6, 0X64,
+    0XA6, 0X46, 0XA6, 0X46, 0XAE, 0X45, 0XAE, 0X45, 0XAE, 0X46, 0XAE, 0X27, 0XAE, 0X28, 0XAE, 0X28,
+    0XAE, 0X09, 0XC6, 0XAF, 0XEF, 0XB9, 0XFF, 0XFE, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
+    0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
+    0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XDF, 0XFF, 0XBF,
+    0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XDF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
+    0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XDF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
+    0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
+    0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
+    0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XDF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
+    0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
+    0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
+    0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
+    0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
+    0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XDF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
+    0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
+    0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
+    0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
+    0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XDF,
+    0XFF, 0XDF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XDF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
+    0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
+    0XFF, 0XFD, 0XFF, 0XFB, 0XE7, 0XB4, 0XC6, 0XAC, 0XAE, 0X06, 0XAE, 0X24, 0XAE, 0X43, 0XAE, 0X23,
+    0XAE, 0X23, 0XAE, 0X22, 0XAE, 0X41, 0XAE, 0X40, 0XAE, 0X40, 0XAE, 0X41, 0XAE, 0X22, 0XAE, 0X23,
+    0XAE, 0X23, 0XAE, 0X23, 0XAE, 0X22, 0XAE, 0X22, 0XAE, 0X21, 0XAE, 0X41, 0XAE, 0X41, 0XAE, 0X41,
+    0XAE, 0X40, 0XAE, 0X40, 0XAE, 0X41, 0XAE, 0X41, 0XAE, 0X41, 0XAE, 0X41, 0XAE, 0X41, 0XAE, 0X21,
+    0XAE, 0X21, 0XAE, 0X21, 0XAE, 0X21, 0XAE, 0X21, 0XAE, 0X21, 0XAE, 0X21, 0XAE, 0X21, 0XAE, 0X22,
+    0XAE, 0X22, 0XAE, 0X22, 0XAE, 0X22, 0XAE, 0X22, 0XAE, 0X23, 0XA6, 0X23, 0XA6, 0X23, 0XA6, 0X42,
+    0XA6, 0X60, 0X9E, 0X60, 0X9E, 0X62, 0XA6, 0X42, 0XA6, 0X60, 0XA6, 0X60, 0XA6, 0X41, 0XA6, 0X42,
+    0XAE, 0X43, 0XA6, 0X04, 0XA6, 0X06, 0XC6, 0XAD, 0XEF, 0XB8, 0XFF, 0XFE, 0XFF, 0XFF, 0XFF, 0XFF,
+    0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
+    0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
+    0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XDF, 0XF7, 0XBE, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XBF,
+    0XF7, 0X9E, 0XFF, 0XFF, 0XFF, 0XDF, 0XFF, 0XDF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XDF, 0XFF, 0XFF,
+    0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
+    0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
+    0XF7, 0X9E, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XDF,
+    0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
+    0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
+    0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
+    0XF7, 0XBE, 0XFF, 0XDF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
+    0XFF, 0XDF, 0XFF, 0XDF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
+    0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
+    0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
+    0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
+    0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XDF, 0XFF, 0XDF, 0XFF, 0XDF, 0XFF, 0XFF,
+    0XFF, 0XDF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XDF, 0XFF, 0XDF, 0XFF, 0XFF,
+    0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
+    0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFE, 0XFF, 0XFC, 0XEF, 0XB5, 0XC6, 0XAC, 0XAE, 0X05, 0XAE, 0X43,
+    0XB6, 0X83, 0XAE, 0X62, 0XAE, 0X61, 0XAE, 0X61, 0XAE, 0X60, 0XAE, 0X80, 0XAE, 0X80, 0XAE, 0X60,
+    0XAE, 0X61, 0XAE, 0X61, 0XAE, 0X61, 0XAE, 0X61, 0XAE, 0X61, 0XAE, 0X61, 0XAE, 0X60, 0XAE, 0X60,
+    0XAE, 0X60, 0XAE, 0X60, 0XAE, 0X60, 0XAE, 0X60, 0XAE, 0X60, 0XAE, 0X61, 0XAE, 0X61, 0XAE, 0X61,
+    0XAE, 0X61, 0XAE, 0X61, 0XAE, 0X61, 0XAE, 0X60, 0XAE, 0X60, 0XAE, 0X60, 0XAE, 0X60, 0XAE, 0X60,
+    0XAE, 0X60, 0XAE, 0X60, 0XAE, 0X60, 0XAE, 0X61, 0XAE, 0X61, 0XAE, 0X61, 0XA6, 0X62, 0XA6, 0X62,
+    0XA6, 0X62, 0XA6, 0X81, 0XA6, 0X80, 0XA6, 0XA0, 0XA6, 0X81, 0XA6, 0X80, 0XA6, 0X80, 0XAE, 0X80,
+    0XAE, 0X80, 0XAE, 0X60, 0XB6, 0X61, 0XAE, 0X42, 0XAE, 0X24, 0XC6, 0XCC, 0XEF, 0XD7, 0XFF, 0XFD,
+    0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
+    0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
+    0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XF7, 0XBE, 0XFF, 0XFF, 0XF7, 0XBE,
+    0XAD, 0X75, 0X8C, 0X51, 0XE6, 0XFB, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XDF, 0XFF, 0XFF, 0XFF, 0XFF,
+    0XFF, 0XDF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
+    0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
+    0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XF7, 0XBE, 0XFF, 0XFF,
+    0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
+    0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
+    0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
+    0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XDF, 0XFF, 0XDF, 0XFF, 0XFF,
+    0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XF7, 0XBE, 0XF7, 0XBE, 0XFF, 0XFF, 0XFF, 0XFF,
+    0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
+    0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
+    0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
+    0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XDF, 0XFF, 0XDF,
+    0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XDF, 0XF7, 0X9E, 0XF7, 0XBE, 0XFF, 0XFF,
+    0XFF, 0XFF, 0XF7, 0XBE, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
+    0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFE, 0XEF, 0XB7, 0XBE, 0X8D,
+    0XA5, 0XE5, 0XA6, 0X23, 0XAE, 0X42, 0XA6, 0X21, 0XAE, 0X41, 0XAE, 0X40, 0XAE, 0X60, 0XAE, 0X60,
+    0XAE, 0X60, 0XAE, 0X40, 0XAE, 0X41, 0XAE, 0X41, 0XAE, 0X41, 0XAE, 0X40, 0XAE, 0X41, 0XAE, 0X41,
+    0XAE, 0X41, 0XAE, 0X41, 0XAE, 0X40, 0XAE, 0X40, 0XAE, 0X40, 0XAE, 0X41, 0XAE, 0X41, 0XAE, 0X42,
+    0XAE, 0X22, 0XAE, 0X23, 0XAE, 0X23, 0XA6, 0X43, 0XA6, 0X61, 0X9E, 0X80, 0XA6, 0X80, 0XA6, 0X80,
+    0XA6, 0X60, 0XA6, 0X60, 0XA6, 0X60, 0XA6, 0X60, 0XA6, 0X60, 0XA6, 0X60, 0XA6, 0X60, 0XA6, 0X60,
+    0XA6, 0X60, 0XA6, 0X61, 0X9E, 0X61, 0XA6, 0X61, 0XA6, 0X60, 0XA6, 0X60, 0XA6, 0X41, 0XAE, 0X40,
+    0XAE, 0X60, 0XAE, 0X60, 0XAE, 0X60, 0XAE, 0X40, 0XAE, 0X60, 0XAE, 0X21, 0XAE, 0X23, 0XC6, 0XCA,
+    0XEF, 0XD7, 0XFF, 0XFD, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
+    0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
+    0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XBF, 0XFF, 0XFF, 0XFF, 0XDF,
+    0XFF, 0XFF, 0XD6, 0X79, 0X4A, 0X49, 0X21, 0X24, 0X94, 0XB2, 0XE7, 0X1C, 0XFF, 0XFF, 0XFF, 0XFF,
+    0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XDF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
+    0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
+    0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XDF, 0XFF, 0XDF, 0XEF, 0X7D, 0XD6, 0X9A, 0XEF, 0X5D, 0XFF, 0XFF,
+    0XFF, 0XFF, 0XFF, 0XBF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
+    0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
+    0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
+    0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
+    0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XF7, 0X9E, 0XF7, 0XBE, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
+    0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
+    0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
+    0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
+    0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XDF, 0XFF, 0XFF,
+    0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XDF, 0XFF, 0XBE, 0XFF, 0XBE, 0XD6, 0X9A, 0XA5, 0X14, 0X94, 0X92,
+    0XBD, 0XD7, 0XF7, 0XBE, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
+    0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XDF, 0XFF, 0XFE,
+    0XEF, 0XD7, 0XC6, 0XAD, 0XAE, 0X05, 0XAE, 0X42, 0XAE, 0X62, 0XAE, 0X41, 0XAE, 0X61, 0XAE, 0X60,
+    0XAE, 0X60, 0XAE, 0X80, 0XAE, 0X60, 0XAE, 0X60, 0XAE, 0X61, 0XAE, 0X61, 0XAE, 0X61, 0XAE, 0X61,
+    0XAE, 0X61, 0XAE, 0X61, 0XAE, 0X61, 0XAE, 0X61, 0XAE, 0X61, 0XAE, 0X61, 0XAE, 0X61, 0XAE, 0X61,
+    0XAE, 0X61, 0XAE, 0X61, 0XAE, 0X42, 0XAE, 0X43, 0XAE, 0X43, 0XAE, 0X43, 0XA6, 0X81, 0XA6, 0XA0,
+    0XA6, 0XA0, 0XA6, 0X80, 0XA6, 0X80, 0XA6, 0X80, 0XA6, 0X80, 0XAE, 0X80, 0XAE, 0X80, 0XAE, 0X80,
+    0XAE, 0X80, 0XA6, 0X80, 0XA6, 0X80, 0XA6, 0X81, 0XA6, 0X81, 0XA6, 0X81, 0XAE, 0X61, 0XAE, 0X42,
+    0XAE, 0X43, 0XB6, 0X42, 0XB6, 0X60, 0XB6, 0X60, 0XB6, 0X60, 0XB6, 0X60, 0XB6, 0X60, 0XAE, 0X41,
+    0XAE, 0X23, 0XC6, 0XCB, 0XEF, 0XD6, 0XFF, 0XFD, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
+    0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
+    0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
+    0XFF, 0XFF, 0XFF, 0XDF, 0XFF, 0XFF, 0XB5, 0XB6, 0X29, 0X45, 0X18, 0XE3, 0X31, 0XA6, 0XAD, 0X55,
+    0XF7, 0XBE, 0XFF, 0XDF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XDF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
+    0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
+    0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XDF, 0XF7, 0XBE, 0X42, 0X28, 0X39, 0XC7,
+    0X94, 0X92, 0XFF, 0XDF, 0XFF, 0XFF, 0XFF, 0XDF, 0XFF, 0XFF, 0XFF, 0XDF, 0XFF, 0XFF, 0XFF, 0XFF,
+    0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
+    0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
+    0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
+    0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XE7, 0X1C, 0XB5, 0X75, 0X84, 0X10, 0X7B, 0XEF, 0XBD, 0XF7,
+    0XF7, 0XBE, 0XFF, 0XFF, 0XFF, 0XDF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
+    0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
+    0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
+    0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XDE, 0XF7, 0X9D,
+    0XF7, 0X7D, 0XF7, 0X9E, 0XFF, 0XFF, 0XFF, 0XFF, 0XF7, 0X7D, 0XE7, 0X1C, 0XA4, 0XF3, 0X63, 0X0C,
+    0X10, 0X82, 0X00, 0X00, 0X52, 0X8A, 0XC6, 0X38, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
+    0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
+    0XFF, 0XFF, 0XFF, 0XFD, 0XEF, 0XD5, 0XC6, 0XAB, 0XAE, 0X23, 0XAE, 0X41, 0XAE, 0X80, 0XAE, 0X60,
+    0XAE, 0X60, 0XAE, 0X60, 0XAE, 0X60, 0XAE, 0X60, 0XAE, 0X60, 0XAE, 0X60, 0XAE, 0X60, 0XAE, 0X61,
+    0XAE, 0X61, 0XAE, 0X61, 0XAE, 0X61, 0XAE, 0X42, 0XAE, 0X42, 0XAE, 0X42, 0XAE, 0X41, 0XA6, 0X20,
+    0XAE, 0X60, 0XAE, 0X60, 0XAE, 0X60, 0XAE, 0X80, 0XAE, 0X60, 0XAE, 0X60, 0XAE, 0X61, 0XAE, 0X61,
+    0X9E, 0X20, 0XA6, 0XA1, 0XAE, 0XA1, 0XA6, 0X60, 0X9E, 0X40, 0XAE, 0X60, 0XAE, 0XA0, 0XAE, 0X80,
+    0XAE, 0X60, 0XAE, 0X60, 0XAE, 0X60, 0XAE, 0X60, 0XAE, 0X60, 0XAE, 0X60, 0XAE, 0X60, 0XAE, 0X61,
+    0XB6, 0X42, 0XB6, 0X24, 0XB6, 0X25, 0XB6, 0X24, 0XB6, 0X41, 0XB6, 0X40, 0XB6, 0X41, 0XB6, 0X41,
+    0XAE, 0X21, 0XB6, 0X43, 0XAE, 0X24, 0XBE, 0X8B, 0XE7, 0X96, 0XFF, 0XFD, 0XFF, 0XFF, 0XFF, 0XFF,
+    0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
+    0XFF, 0XFF, 0XEF, 0X7D, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XDF, 0XFF, 0XFF,
+    0XF7, 0X9E, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XB5, 0X96, 0X21, 0X24, 0X18, 0XA2,
+    0X21, 0X04, 0X29, 0X24, 0XA5, 0X14, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
+    0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
+    0XFF, 0XFF, 0XFF, 0XDF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XF7, 0XBE, 0XFF, 0XFF, 0X9C, 0XD3,
+    0X10, 0X82, 0X18, 0XE3, 0X52, 0X8A, 0X9C, 0XD3, 0XE6, 0XFC, 0XFF, 0XDF, 0XF7, 0XBE, 0XFF, 0XFF,
+    0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XDF, 0XFF, 0XFF, 0XFF, 0XFF,
+    0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
+    0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
+    0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XDF, 0XFF, 0XFF, 0XE7, 0X1C, 0X84, 0X30, 0X31, 0X65, 0X18, 0XC3,
+    0X18, 0XA2, 0X29, 0X65, 0XFF, 0XDE, 0XFF, 0XFF, 0XF7, 0XBE, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
+    0XFF, 0XDF, 0XF7, 0XBE, 0XFF, 0XFF, 0XFF, 0XDF, 0XFF, 0XDF, 0XFF, 0XDF, 0XFF, 0XFF, 0XFF, 0XFF,
+    0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
+    0XFF, 0XFF, 0XFF, 0XDF, 0XFF, 0XFF, 0XFF, 0XDF, 0XFF, 0XFF, 0XFF, 0XFF, 0XF7, 0XBE, 0XFF, 0XFF,
+    0XD6, 0X79, 0X73, 0X6D, 0X94, 0X92, 0XEF, 0X5D, 0XFF, 0XBE, 0XDE, 0X9A, 0X94, 0X71, 0X4A, 0X49,
+    0X18, 0XA2, 0X18, 0XC3, 0X18, 0XC3, 0X18, 0XC3, 0X42, 0X08, 0XDE, 0XFB, 0XF7, 0XBE, 0XFF, 0XFF,
+    0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
+    0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFC, 0XEF, 0XD4, 0XC6, 0XCA, 0XAE, 0X22, 0XAE, 0X60,
+    0XAE, 0X80, 0XAE, 0X60, 0XAE, 0X60, 0XAE, 0X60, 0XAE, 0X60, 0XAE, 0X60, 0XAE, 0X60, 0XAE, 0X60,
+    0XAE, 0X60, 0XAE, 0X60, 0XAE, 0X40, 0XAE, 0X40, 0XAE, 0X40, 0XAE, 0X21, 0XAE, 0X22, 0XAE, 0X42,
+    0XB6, 0X63, 0XB6, 0X82, 0XAE, 0X40, 0XAE, 0X60, 0XAE, 0X60, 0XAE, 0X60, 0XAE, 0X60, 0XAE, 0X40,
+    0XAE, 0X41, 0XA6, 0X41, 0XB6, 0XA2, 0XA6, 0X41, 0XA6, 0X20, 0XAE, 0X61, 0XB6, 0XA2, 0XB6, 0X82,
+    0XA6, 0X41, 0X9D, 0XE0, 0XAE, 0X41, 0XAE, 0X41, 0XAE, 0X41, 0XAE, 0X41, 0XAE, 0X41, 0XAE, 0X41,
+    0XAE, 0X40, 0XAE, 0X21, 0XAE, 0X23, 0XAE, 0X04, 0XAE, 0X05, 0XAE, 0X05, 0XAE, 0X23, 0XAE, 0X42,
+    0XAE, 0X22, 0XAE, 0X23, 0XB6, 0X64, 0XAE, 0X24, 0XAE, 0X26, 0XCE, 0XED, 0XF7, 0XF7, 0XFF, 0XFD,
+    0XFF, 0XDE, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
+    0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XF7, 0X9E, 0XF7, 0XBE, 0XFF, 0XFF,
+    0XFF, 0XFF, 0XEF, 0X7D, 0XFF, 0XFF, 0XFF, 0XFF, 0XF7, 0X9E, 0XFF, 0XDF, 0XEF, 0X7D, 0XA5, 0X14,
+    0X21, 0X24, 0X18, 0XE3, 0X08, 0X20, 0X31, 0X66, 0XAD, 0X75, 0XFF, 0XDF, 0XFF, 0XFF, 0XFF, 0XFF,
+    0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
+    0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XF7, 0XBE, 0XFF, 0XFF, 0XFF, 0XFF,
+    0XFF, 0XDF, 0X63, 0X0C, 0X29, 0X45, 0X18, 0XC3, 0X18, 0XC3, 0X18, 0XC3, 0X63, 0X0C, 0XE7, 0X3C,
+    0XFF, 0XFF, 0XF7, 0X7E, 0XFF, 0XFF, 0XFF, 0XDF, 0XFF, 0XDF, 0XFF, 0XDF, 0XFF, 0XFF, 0XFF, 0XFF,
+    0XF7, 0X7E, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
+    0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
+    0XFF, 0XFF, 0XFF, 0XFF, 0XF7, 0XBE, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XDF, 0XB5, 0X75, 0X31, 0XA6,
+    0X00, 0X00, 0X21, 0X04, 0X18, 0XE3, 0X5A, 0XEB, 0XE7, 0X1C, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
+    0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XF7, 0X9E, 0XF7, 0XBE, 0XFF, 0XFF, 0XFF, 0XFF,
+    0XFF, 0XDF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
+    0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XDE, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XDF, 0XFF, 0XFF, 0XFF, 0XDF,
+    0XFF, 0XFF, 0XC6, 0X38, 0X52, 0X8A, 0X20, 0XE3, 0X52, 0X69, 0XAD, 0X34, 0X9C, 0X92, 0X4A, 0X28,
+    0X18, 0XC3, 0X18, 0XA2, 0X39, 0XA7, 0X29, 0X45, 0X18, 0XC3, 0X20, 0XE4, 0X94, 0X92, 0XFF, 0XFF,
+    0XFF, 0XDF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
+    0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFC, 0XEF, 0XD4, 0XC6, 0XCA,
+    0XAE, 0X22, 0XAE, 0X60, 0XAE, 0X80, 0XAE, 0X60, 0XAE, 0X60, 0XAE, 0X60, 0XAE, 0X60, 0XAE, 0X60,
+    0XAE, 0X60, 0XAE, 0X60, 0XAE, 0X61, 0XAE, 0X60, 0XAE, 0X60, 0XAE, 0X60, 0XAE, 0X80, 0XAE, 0X61,
+    0XAE, 0X22, 0XA6, 0X02, 0XA6, 0X03, 0XA6, 0X02, 0XAE, 0X22, 0XAE, 0X22, 0XAE, 0X41, 0XAE, 0X41,
+    0XAE, 0X42, 0XAE, 0X43, 0XAE, 0X43, 0XAE, 0X23, 0XAE, 0X02, 0XAE, 0X01, 0XAE, 0X01, 0XAE, 0X22,
+    0XAE, 0X23, 0XAE, 0X23, 0XA6, 0X23, 0XA6, 0X23, 0XAE, 0X44, 0XAE, 0X44, 0XAE, 0X44, 0XAE, 0X43,
+    0XB6, 0X43, 0XB6, 0X43, 0XB6, 0X43, 0XB6, 0X43, 0XAE, 0X63, 0XAE, 0X64, 0XA6, 0X46, 0XA6, 0X46,
+    0XA6, 0X64, 0XA6, 0X83, 0XA6, 0X64, 0XA6, 0X65, 0X9E, 0X04, 0X9D, 0XE4, 0XA6, 0X05, 0XC6, 0XCC,
+    0XEF, 0XD6, 0XFF, 0XFB, 0XFF, 0XFD, 0XFF, 0XFE, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
+    0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XDF, 0XFF, 0XDF, 0XFF, 0XDF,
+    0XFF, 0XFF, 0XF7, 0X9E, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XDF, 0XFF, 0XFF, 0XFF, 0XDF,
+    0XBD, 0XF7, 0X73, 0XAE, 0X10, 0XA2, 0X18, 0XC3, 0X31, 0X86, 0X7B, 0XAE, 0XDE, 0XDB, 0XFF, 0XFF,
+    0XFF, 0XDF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XDF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
+    0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XF7, 0XBE,
+    0XFF, 0XFF, 0XFF, 0XFF, 0XEF, 0X7D, 0X5A, 0XCB, 0X10, 0X82, 0X08, 0X41, 0X18, 0XA3, 0X21, 0X04,
+    0X6B, 0X2C, 0XD6, 0X9A, 0XFF, 0XFF, 0XFF, 0XDF, 0XFF, 0XBE, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XBF,
+    0XFF, 0XFF, 0XFF, 0XFF, 0XF7, 0X9E, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
+    0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
+    0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XDE, 0XFF, 0XFF,
+    0XDE, 0XBA, 0X73, 0X6D, 0X21, 0X03, 0X21, 0X03, 0X5A, 0XAA, 0XCE, 0X58, 0XFF, 0XBE, 0XFF, 0XDE,
+    0XF7, 0X7D, 0XC6, 0X18, 0XBD, 0XB6, 0XAD, 0X55, 0XB5, 0XB6, 0XEF, 0X7D, 0XF7, 0XBE, 0XFF, 0XFF,
+    0XFF, 0XFF, 0XFF, 0XFF, 0XF7, 0XBE, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
+    0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XDE, 0XFF, 0XFF,
+    0XFF, 0XFF, 0XFF, 0XDE, 0XD6, 0X9A, 0X63, 0X0C, 0X10, 0X81, 0X20, 0XE3, 0X31, 0X85, 0X41, 0XE7,
+    0X20, 0XE3, 0X08, 0X40, 0X39, 0XA6, 0X6B, 0X4D, 0X73, 0X8E, 0X29, 0X24, 0X21, 0X04, 0X4A, 0X49,
+    0XD6, 0XBA, 0XFF, 0XFF, 0XFF, 0XDF, 0XFF, 0XDF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
+    0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFC,
+    0XEF, 0XD4, 0XC6, 0XCA, 0XAE, 0X22, 0XAE, 0X60, 0XAE, 0X80, 0XAE, 0X60, 0XAE, 0X60, 0XAE, 0X61,
+    0XAE, 0X61, 0XAE, 0X60, 0XAE, 0X60, 0XAE, 0X60, 0XAE, 0X61, 0XAE, 0X60, 0XB6, 0XA0, 0XAE, 0X80,
+    0XAE, 0X60, 0XAE, 0X42, 0XAE, 0X24, 0XAE, 0X26, 0XAE, 0X27, 0XB6, 0X27, 0XBE, 0XA9, 0XC6, 0XA9,
+    0XC6, 0XC9, 0XC6, 0XE9, 0XCE, 0XEA, 0XCF, 0X0B, 0XCF, 0X0C, 0XD6, 0XED, 0XCE, 0XAB, 0XDF, 0X0C,
+    0XDF, 0X0D, 0XCE, 0XEC, 0XC6, 0XCD, 0XC7, 0X0E, 0XC7, 0X50, 0XC7, 0X30, 0XB7, 0X0F, 0XB7, 0X0F,
+    0XBF, 0X0F, 0XBF, 0X0E, 0XBF, 0X0E, 0XBE, 0XEE, 0XC6, 0XED, 0XBF, 0X0D, 0XB7, 0X2C, 0XB7, 0X4D,
+    0XB7, 0X2E, 0XAF, 0X2F, 0XAF, 0X4D, 0XAF, 0X4D, 0XAF, 0X4E, 0XAF, 0X2F, 0XBF, 0X70, 0XBF, 0X4F,
+    0XBF, 0X0E, 0XCF, 0X31, 0XF7, 0XFA, 0XFF, 0XFD, 0XFF, 0XFE, 0XFF, 0XDE, 0XFF, 0XDF, 0XFF, 0XFF,
+    0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XF7, 0XBE, 0XFF, 0XFF,
+    0XFF, 0XFF, 0XF7, 0XBE, 0XFF, 0XFF, 0XF7, 0X9E, 0XFF, 0XFF, 0XFF, 0XDF, 0XF7, 0X9E, 0XFF, 0XFF,
+    0XFF, 0XFF, 0XAD, 0X55, 0X31, 0XA6, 0X18, 0XC3, 0X08, 0X61, 0X4A, 0X28, 0X9C, 0XD3, 0XD6, 0XBA,
+    0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XDF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XDF, 0XFF, 0XFF, 0XFF, 0XFF,
+    0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XDF,
+    0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XF7, 0XBE, 0XF7, 0XBE, 0XAD, 0X75, 0X31, 0X65, 0X18, 0XC3,
+    0X20, 0XE3, 0X4A, 0X49, 0XB5, 0X75, 0XFF, 0XBE, 0XFF, 0XDF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
+    0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XDF, 0XFF, 0XBE, 0XFF, 0XFF, 0XFF, 0XFF,
+    0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XDF, 0XFF, 0XFF,
+    0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
+    0XFF, 0XFF, 0XFF, 0XFF, 0XF7, 0X9D, 0XAD, 0X54, 0X4A, 0X28, 0X10, 0X61, 0X73, 0X8D, 0XF7, 0X9D,
+    0XE7, 0X1B, 0XBD, 0XB6, 0X8C, 0X30, 0X62, 0XEB, 0X42, 0X07, 0X29, 0X65, 0X4A, 0X49, 0XAD, 0X55,
+    0XFF, 0XFF, 0XFF, 0XFF, 0XF7, 0X9E, 0XFF, 0XFF, 0XFF, 0XDF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
+    0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XF7, 0XDE,
+    0XF7, 0XBE, 0XFF, 0XFF, 0XF7, 0X7D, 0XE7, 0X3C, 0X63, 0X0B, 0X18, 0XA2, 0X18, 0XA2, 0X20, 0XE3,
+    0X20, 0XE3, 0X20, 0XE3, 0X18, 0XA2, 0X42, 0X07, 0XA4, 0XD3, 0XCE, 0X38, 0X73, 0X8E, 0X10, 0X82,
+    0X52, 0X8A, 0XAD, 0X55, 0XFF, 0XDF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
+    0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
+    0XFF, 0XFF, 0XFF, 0XFD, 0XEF, 0XD5, 0XC6, 0XAB, 0XAE, 0X23, 0XAE, 0X41, 0XAE, 0X81, 0XAE, 0X41,
+    0XAE, 0X42, 0XAE, 0X42, 0XAE, 0X42, 0XAE, 0X42, 0XAE, 0X61, 0XAE, 0X61, 0XAE, 0X61, 0XAE, 0X60,
+    0XB6, 0X80, 0XAE, 0X60, 0XA6, 0X21, 0XAE, 0X24, 0XBE, 0X69, 0XCF, 0X0E, 0XDF, 0X72, 0XE7, 0XB4,
+    0XEF, 0XB4, 0XEF, 0XB4, 0XEF, 0XD5, 0XF7, 0XF5, 0XF7, 0XF6, 0XF7, 0XF8, 0XF7, 0XF9, 0XFF, 0XFA,
+    0XFF, 0XFB, 0XFF, 0XDB, 0XF7, 0XDB, 0XF7, 0XFD, 0XE7, 0XFD, 0XCF, 0X7C, 0XAE, 0XDB, 0X96, 0X5A,
+    0XA6, 0XDC, 0X9E, 0XFC, 0X9E, 0XDC, 0XA6, 0XDC, 0XA6, 0XDB, 0XA6, 0XDB, 0XA6, 0XDA, 0XA6, 0XF9,
+    0X9F, 0X17, 0X9F, 0X37, 0X9F, 0X1A, 0X97, 0X1A, 0X97, 0X39, 0X97, 0X39, 0X97, 0X1A, 0X9F, 0X1A,
+    0X9E, 0XD9, 0X9E, 0XB7, 0XAE, 0X96, 0XCF, 0X3A, 0XF7, 0XFF, 0XFF, 0XDF, 0XFF, 0X9F, 0XFF, 0X9F,
+    0XFF, 0XDF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XDF,
+    0XFF, 0XFF, 0XFF, 0XDF, 0XF7, 0XBE, 0XF7, 0XBE, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XF7, 0XBE,
+    0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XDF, 0X9C, 0XB3, 0X29, 0X45, 0X20, 0XE4, 0X29, 0X65, 0X8C, 0X71,
+    0XE7, 0X3C, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XDF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
+    0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
+    0XFF, 0XFF, 0XF7, 0XBE, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XF7, 0XBE, 0XFF, 0XFF, 0XF7, 0XBE,
+    0X8C, 0X30, 0X29, 0X45, 0X39, 0XC7, 0XAD, 0X35, 0XFF, 0XDF, 0XFF, 0XFF, 0XFF, 0XDF, 0XFF, 0XFF,
+    0XFF, 0XDF, 0XCE, 0X38, 0XBD, 0XD7, 0XF7, 0X9E, 0XFF, 0XBF, 0XF7, 0X7D, 0XFF, 0XFF, 0XFF, 0XDF,
+    0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
+    0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XDF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
+    0XFF, 0XDF, 0XFF, 0XFF, 0XFF, 0XDE, 0XFF, 0XDE, 0XFF, 0XFF, 0XCE, 0X59, 0X62, 0XEB, 0X10, 0X81,
+    0X4A, 0X48, 0X7B, 0XAE, 0X4A, 0X48, 0X29, 0X24, 0X10, 0X61, 0X20, 0XE3, 0X10, 0X82, 0X10, 0XA2,
+    0X21, 0X04, 0X52, 0XAA, 0XF7, 0X9E, 0XFF, 0XFF, 0XF7, 0X9E, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
+    0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
+    0XFF, 0XFF, 0XFF, 0XDE, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XDE, 0XAD, 0X34, 0X20, 0XE3, 0X10, 0X82,
+    0X18, 0XC2, 0X20, 0XE3, 0X18, 0XA2, 0X10, 0X61, 0X4A, 0X07, 0XC5, 0XF7, 0XEF, 0X3C, 0X9C, 0XB2,
+    0X29, 0X04, 0X29, 0X24, 0X94, 0XB2, 0XF7, 0X9E, 0XFF, 0XFF, 0XFF, 0XDF, 0XFF, 0XFF, 0XFF, 0XDF,
+    0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
+    0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFD, 0XEF, 0XB5, 0XC6, 0XAB, 0XAE, 0X23, 0XAE, 0X41,
+    0XAE, 0X61, 0XAE, 0X41, 0XAE, 0X42, 0XAE, 0X43, 0XAE, 0X42, 0XAE, 0X42, 0XAE, 0X61, 0XAE, 0X61,
+    0XAE, 0X60, 0XAE, 0X60, 0XA6, 0X20, 0XAE, 0X42, 0XBE, 0XA7, 0XD7, 0X2D, 0XEF, 0XB3, 0XF7, 0XF8,
+    0XFF, 0XFB, 0XFF, 0XFB, 0XFF, 0XFC, 0XFF, 0XFC, 0XFF, 0XFC, 0XFF, 0XFC, 0XFF, 0XFD, 0XFF, 0XFD,
+    0XFF, 0XFE, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XDF, 0XF7, 0XFF, 0XEF, 0XFF, 0XC7, 0X5F, 0X75, 0X7A,
+    0X44, 0X57, 0X3C, 0X79, 0X2C, 0X38, 0X2C, 0X39, 0X2C, 0X59, 0X2C, 0X59, 0X2C, 0X38, 0X34, 0X37,
+    0X34, 0X37, 0X34, 0X56, 0X2C, 0X74, 0X2C, 0X74, 0X2C, 0X56, 0X2C, 0X57, 0X24, 0X76, 0X24, 0X76,
+    0X2C, 0X57, 0X34, 0X57, 0X34, 0X15, 0X44, 0X33, 0X75, 0X35, 0XC6, 0XFC, 0XF7, 0XFF, 0XFF, 0X7F,
+    0XFF, 0X5F, 0XFF, 0XBF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
+    0XFF, 0XDF, 0XF7, 0X9E, 0XBD, 0XF7, 0X73, 0X8E, 0X6B, 0X4D, 0X9C, 0XD3, 0XD6, 0X9A, 0XFF, 0XDF,
+    0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XF7, 0XBE, 0XFF, 0XFF, 0XEF, 0X5D, 0XBD, 0XD7, 0X8C, 0X71,
+    0X52, 0XAA, 0XB5, 0X96, 0XFF, 0XFF, 0XFF, 0XFF, 0XF7, 0XBE, 0XFF, 0XDF, 0XFF, 0XFF, 0XFF, 0XFF,
+    0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
+    0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XDF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
+    0XFF, 0XFF, 0XE6, 0XFB, 0X73, 0X8E, 0X62, 0XEB, 0XC5, 0XF7, 0XF7, 0X9E, 0XC5, 0XF8, 0XC6, 0X18,
+    0XFF, 0XBE, 0XFF, 0XFF, 0XD6, 0X9A, 0X6B, 0X2C, 0X52, 0X8A, 0X9C, 0XD3, 0X94, 0X92, 0X73, 0X8E,
+    0XB5, 0X76, 0XF7, 0X9E, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
+    0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
+    0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XBE, 0XBD, 0XB6,
+    0X52, 0X89, 0X18, 0XC2, 0X18, 0XA2, 0X18, 0XC2, 0X18, 0XA2, 0X41, 0XE7, 0X5A, 0XAA, 0X5A, 0XCB,
+    0X29, 0X44, 0X29, 0X24, 0X10, 0X82, 0X31, 0XA6, 0XDE, 0XDB, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
+    0XFF, 0XDF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
+    0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XDE, 0XFF, 0XFF, 0XFF, 0XFF, 0XF7, 0XBE, 0XFF, 0XFF, 0X5A, 0XCA,
+    0X18, 0XA2, 0X20, 0XE3, 0X20, 0XC3, 0X10, 0X81, 0X29, 0X24, 0X4A, 0X28, 0XAD, 0X14, 0XFF, 0XFF,
+    0XCE, 0X38, 0X41, 0XE7, 0X20, 0XE3, 0X94, 0X92, 0XE7, 0X1C, 0XFF, 0XFF, 0XFF, 0XDF, 0XFF, 0XFF,
+    0XF7, 0X9E, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
+    0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFD, 0XEF, 0XD5, 0XC6, 0XAB,
+    0XAE, 0X23, 0XAE, 0X41, 0XAE, 0X81, 0XAE, 0X40, 0XAE, 0X42, 0XAE, 0X42, 0XAE, 0X42, 0XAE, 0X61,
+    0XAE, 0X60, 0XAE, 0X60, 0XAE, 0X60, 0XAE, 0X60, 0XA5, 0XE2, 0XBE, 0X88, 0XDF, 0X90, 0XFF, 0XF6,
+    0XFF, 0XFB, 0XFF, 0XFD, 0XFF, 0XFF, 0XFF, 0XDF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
+    0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XDF, 0XFF, 0XFF, 0XF7, 0XFE, 0XF7, 0XFF, 0XE7, 0XFF, 0XBF, 0X7F,
+    0X75, 0XB9, 0X2C, 0X14, 0X0B, 0XB4, 0X0C, 0X37, 0X04, 0X59, 0X04, 0X59, 0X04, 0X79, 0X04, 0X59,
+    0X04, 0X59, 0X04, 0X58, 0X04, 0X58, 0X0C, 0X57, 0X0C, 0X56, 0X0C, 0X57, 0X0C, 0X39, 0X0C, 0X3A,
+    0X0C, 0X39, 0X0C, 0X39, 0X0C, 0X39, 0X14, 0X18, 0X24, 0X16, 0X55, 0X18, 0X96, 0X9A, 0XD7, 0XFE,
+    0XF7, 0XFF, 0XFF, 0XBF, 0XFF, 0X9E, 0XFF, 0XDE, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
+    0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XDF, 0XEF, 0X7D, 0X63, 0X0C, 0X18, 0XE3, 0X08, 0X41, 0X10, 0XA2,
+    0X52, 0X8A, 0XF7, 0X9E, 0XFF, 0XFF, 0XF7, 0X9E, 0XFF, 0XFF, 0XF7, 0X9E, 0XFF, 0XFF, 0XFF, 0XFF,
+    0XFF, 0XFF, 0XC6, 0X18, 0X63, 0X0C, 0XD6, 0X7A, 0XFF, 0XFF, 0XFF, 0XFF, 0XF7, 0XBE, 0XFF, 0XFF,
+    0XFF, 0XFF, 0XFF, 0XDF, 0XFF, 0XFF, 0XFF, 0XDF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
+    0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XDF,
+    0XFF, 0XFF, 0XFF, 0XFF, 0XD6, 0X9A, 0X84, 0X30, 0X63, 0X0C, 0XC6, 0X18, 0XFF, 0XBF, 0X9C, 0X92,
+    0X52, 0X8A, 0XBD, 0X96, 0XFF, 0XFF, 0XFF, 0X9E, 0XBD, 0XB7, 0X31, 0X86, 0X18, 0XA2, 0X39, 0XA6,
+    0X31, 0X66, 0X08, 0X21, 0X29, 0X24, 0XBD, 0XB6, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
+    0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
+    0XFF, 0XFF, 0XFF, 0XFF, 0XF7, 0X9E, 0XDE, 0XDB, 0XF7, 0X7D, 0XFF, 0XFF, 0XFF, 0XDE, 0XC6, 0X17,
+    0X84, 0X0F, 0X41, 0XE7, 0X18, 0XA2, 0X18, 0XA2, 0X18, 0XC2, 0X63, 0X0B, 0XA4, 0XF3, 0XE7, 0X1B,
+    0XF7, 0X7D, 0X9C, 0XD2, 0X31, 0X85, 0X18, 0XC2, 0X21, 0X24, 0X7B, 0XEF, 0XEF, 0X5D, 0XFF, 0XFF,
+    0XFF, 0XFF, 0XFF, 0XDF, 0XFF, 0XDF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
+    0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XF7, 0X9D, 0XFF, 0XFF, 0XF7, 0XBD, 0XF7, 0X9D,
+    0XF7, 0X9D, 0X63, 0X0B, 0X18, 0XC2, 0X18, 0XC2, 0X20, 0XE3, 0X10, 0X61, 0X62, 0XCB, 0XCE, 0X38,
+    0XFF, 0XFF, 0XE6, 0XDA, 0X41, 0XE7, 0X18, 0XC2, 0X52, 0X8A, 0XCE, 0X38, 0XFF, 0XDF, 0XFF, 0XFF,
+    0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
+    0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFD,
+    0XEF, 0XD5, 0XC6, 0XAB, 0XAE, 0X23, 0XAE, 0X60, 0XAE, 0X80, 0XAE, 0X60, 0XAE, 0X60, 0XAE, 0X61,
+    0XAE, 0X61, 0XAE, 0X61, 0XAE, 0X60, 0XAE, 0X60, 0XAE, 0X60, 0XAE, 0X61, 0XAE, 0X65, 0XC6, 0XEC,
+    0XEF, 0XB4, 0XFF, 0XFA, 0XFF, 0XFD, 0XFF, 0XDF, 0XFF, 0XDF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
+    0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XDF, 0XFF, 0XFF, 0XE7, 0XFF, 0XE7, 0XFF,
+    0XBF, 0XBF, 0X6D, 0X98, 0X24, 0X34, 0X14, 0X36, 0X14, 0X98, 0X04, 0X79, 0X04, 0X9A, 0X04, 0X9A,
+    0X04, 0X9A, 0X04, 0X9A, 0X04, 0X9A, 0X04, 0X9A, 0X04, 0X99, 0X04, 0X99, 0X04, 0X79, 0X04, 0X5A,
+    0X04, 0X5C, 0X04, 0X5C, 0X04, 0X7B, 0X04, 0X7B, 0X04, 0X5A, 0X14, 0X38, 0X3C, 0XB8, 0X96, 0XDE,
+    0XDF, 0XFF, 0XEF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFE, 0XFF, 0XDD, 0XFF, 0XFF, 0XFF, 0XFF,
+    0XFF, 0XFF, 0XFF, 0XDF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XEF, 0X7D, 0XA5, 0X34, 0X39, 0XE7,
+    0X18, 0XC3, 0X18, 0XC3, 0X31, 0X86, 0XE7, 0X1C, 0XFF, 0XDF, 0XFF, 0XFF, 0XFF, 0XBF, 0XFF, 0XFF,
+    0XFF, 0XFF, 0XFF, 0XBE, 0XFF, 0XFF, 0XC6, 0X18, 0X63, 0X0C, 0XE7, 0X1C, 0XFF, 0XDF, 0XFF, 0XFF,
+    0XFF, 0XBF, 0XFF, 0XFF, 0XFF, 0XFF, 0XF7, 0XBE, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
+    0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
+    0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XDF, 0XEF, 0X5D, 0X94, 0XB2, 0X41, 0XE7, 0XDE, 0XBA, 0XE6, 0XFC,
+    0X94, 0X92, 0X52, 0X6A, 0XAD, 0X35, 0XFF, 0XFF, 0XFF, 0X9E, 0XF7, 0X7D, 0XAD, 0X35, 0X29, 0X24,
+    0X18, 0XA3, 0X29, 0X24, 0X5A, 0XAB, 0X52, 0X69, 0X20, 0XE3, 0XB5, 0X75, 0XFF, 0XFF, 0XFF, 0XFF,
+    0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
+    0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XF7, 0X9E, 0XC6, 0X18, 0X94, 0XB2, 0XE7, 0X1B, 0XEF, 0X3C,
+    0XA5, 0X13, 0X42, 0X07, 0X18, 0XC2, 0X20, 0XE3, 0X20, 0XE3, 0X20, 0XE3, 0X52, 0X69, 0XDE, 0X99,
+    0XFF, 0XDE, 0XFF, 0X9D, 0XCE, 0X58, 0X5A, 0XCA, 0X18, 0XA2, 0X29, 0X24, 0X63, 0X2C, 0XF7, 0X9E,
+    0XFF, 0XFF, 0XFF, 0XFF, 0XF7, 0XBE, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
+    0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
+    0XFF, 0XDE, 0XFF, 0XFF, 0XF7, 0X9D, 0XC6, 0X17, 0X39, 0XA6, 0X29, 0X44, 0X29, 0X45, 0X73, 0XAD,
+    0XD6, 0X99, 0XEF, 0X1B, 0XFF, 0XFF, 0XBD, 0XD6, 0X18, 0XA2, 0X20, 0XE3, 0X39, 0XC7, 0X7B, 0XCE,
+    0XC6, 0X17, 0XF7, 0X9E, 0XFF, 0XDF, 0XFF, 0XDF, 0XFF, 0XFF, 0XF7, 0XBE, 0XFF, 0XFF, 0XFF, 0XFF,
+    0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
+    0XFF, 0XFF, 0XFF, 0XFD, 0XEF, 0XD6, 0XC6, 0XAB, 0XA6, 0X03, 0XAE, 0X40, 0XAE, 0X80, 0XAE, 0X60,
+    0XAE, 0X60, 0XAE, 0X60, 0XAE, 0X41, 0XAE, 0X41, 0XAE, 0X41, 0XAE, 0X41, 0XAE, 0X41, 0XA6, 0X42,
+    0X9E, 0X44, 0XC7, 0X4D, 0XF7, 0XF8, 0XFF, 0XFD, 0XFF, 0XDE, 0XFF, 0XBF, 0XFF, 0XDF, 0XFF, 0XFF,
+    0XFF, 0XFF, 0XFF, 0XFF, 0XF7, 0XFF, 0XF7, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XDF, 0XF7, 0XBF,
+    0XE7, 0XFF, 0XB7, 0XBF, 0X6D, 0XFC, 0X2C, 0X56, 0X0B, 0XD6, 0X04, 0X38, 0X04, 0X7A, 0X04, 0X5A,
+    0X04, 0X7B, 0X04, 0X7A, 0X04, 0X7A, 0X04, 0X7A, 0X04, 0X7A, 0X04, 0X7A, 0X04, 0X9B, 0X04, 0X7B,
+    0X0C, 0X5B, 0X04, 0X1A, 0X04, 0X5C, 0X04, 0XBD, 0X04, 0XBC, 0X04, 0X39, 0X0C, 0X58, 0X34, 0XB7,
+    0XA7, 0X3F, 0XD7, 0XBF, 0XFF, 0XFF, 0XFF, 0XFE, 0XFF, 0XDE, 0XFF, 0XDF, 0XFF, 0XFF, 0XFF, 0XFF,
+    0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
+    0XEF, 0X7D, 0XAD, 0X75, 0X5A, 0XEB, 0X4A, 0X49, 0X8C, 0X51, 0XE7, 0X3C, 0XFF, 0XFF, 0XFF, 0XDF,
+    0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XDF, 0XFF, 0XBE, 0XCE, 0X58, 0X7B, 0XAE, 0XF7, 0X9D,
+    0XFF, 0XBE, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XDF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
+    0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
+    0XFF, 0XFF, 0XEF, 0X7D, 0XFF, 0XFF, 0XFF, 0XFF, 0XEF, 0X7D, 0XB5, 0XB6, 0X4A, 0X69, 0XAD, 0X55,
+    0XBD, 0XB6, 0X7B, 0XCF, 0X39, 0XA6, 0X9C, 0XB2, 0XF7, 0X7D, 0XFF, 0XDF, 0XFF, 0XFF, 0XD6, 0X9A,
+    0X84, 0X10, 0X20, 0XE3, 0X18, 0XC2, 0X6B, 0X2C, 0XCE, 0X38, 0X41, 0XE7, 0X29, 0X45, 0XEF, 0X3C,
+    0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XF7, 0XBE, 0XFF, 0XFF,
+    0XFF, 0XDF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XDF, 0XE7, 0X3C, 0X7B, 0XCF, 0X39, 0XC7,
+    0XA5, 0X14, 0X7B, 0XEF, 0X42, 0X08, 0X52, 0X89, 0X5A, 0XAA, 0X73, 0X8D, 0X39, 0X85, 0X20, 0XE3,
+    0X4A, 0X07, 0XC5, 0XD7, 0XFF, 0XFF, 0XD6, 0X59, 0X62, 0XEB, 0X31, 0X85, 0X29, 0X45, 0X73, 0XAE,
+    0XE7, 0X3C, 0XF7, 0XBE, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
+    0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
+    0XFF, 0XFF, 0XF7, 0XDE, 0XF7, 0X9E, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XDE, 0XC6, 0X38, 0X94, 0X91,
+    0XA5, 0X13, 0XE7, 0X3C, 0XFF, 0XDE, 0XFF, 0XFF, 0XFF, 0XFF, 0XB5, 0XB6, 0X39, 0XC7, 0X08, 0X40,
+    0X20, 0XE3, 0X29, 0X24, 0X42, 0X07, 0XAD, 0X34, 0XFF, 0XFF, 0XF7, 0XBE, 0XFF, 0XFF, 0XFF, 0XDF,
+    0XFF, 0XDE, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XDF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XF7, 0XBE,
+    0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFE, 0XFF, 0XFC, 0XEF, 0XB6, 0XC6, 0XAC, 0XAE, 0X24, 0XAE, 0X61,
+    0XB6, 0XA0, 0XAE, 0X80, 0XAE, 0X80, 0XAE, 0X60, 0XAE, 0X61, 0XAE, 0X42, 0XAE, 0X42, 0XAE, 0X42,
+    0XAE, 0X61, 0XAE, 0X62, 0X9E, 0X44, 0XC7, 0X4D, 0XEF, 0XF8, 0XFF, 0XFE, 0XFF, 0XDF, 0XFF, 0XDF,
+    0XFF, 0XFE, 0XFF, 0XFE, 0XFF, 0XFE, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFE, 0XFF, 0XDE,
+    0XFF, 0XDF, 0XF7, 0XFF, 0XBF, 0X9F, 0X6D, 0XFD, 0X2C, 0X78, 0X1C, 0X58, 0X14, 0X7B, 0X04, 0X5B,
+    0X04, 0X3A, 0X04, 0X7B, 0X04, 0X7B, 0X04, 0X7A, 0X04, 0X5A, 0X04, 0X7A, 0X04, 0X7A, 0X04, 0X7A,
+    0X04, 0X7B, 0X04, 0X7B, 0X0C, 0X5B, 0X04, 0X1B, 0X04, 0X3B, 0X04, 0X7B, 0X04, 0X39, 0X04, 0X17,
+    0X35, 0X19, 0X7E, 0X7D, 0XCF, 0XDF, 0XF7, 0XFF, 0XFF, 0XFF, 0XFF, 0XDE, 0XFF, 0XDE, 0XFF, 0XFF,
+    0XFF, 0XFF, 0XF7, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
+    0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XF7, 0X9E, 0XD6, 0XBA, 0XCE, 0X59, 0XE7, 0X1C, 0XFF, 0XFF,
+    0XFF, 0XFF, 0XFF, 0XFF, 0XF7, 0XBE, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XDF, 0XD6, 0X9A,
+    0XA4, 0XD3, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
+    0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
+    0XFF, 0XFF, 0XFF, 0XFF, 0XEF, 0X7D, 0XFF, 0XFF, 0XFF, 0XDF, 0XFF, 0XFF, 0XD6, 0X9A, 0X52, 0X8A,
+    0X4A, 0X69, 0X73, 0XAE, 0X4A, 0X49, 0X10, 0X82, 0X84, 0X10, 0XEF, 0X5D, 0XFF, 0XFF, 0XFF, 0XFF,
+    0XCE, 0X38, 0XEF, 0X3C, 0X52, 0X8A, 0X10, 0X61, 0X39, 0XA6, 0XA5, 0X13, 0X94, 0X71, 0X39, 0XA6,
+    0X73, 0X8D, 0XF7, 0XBE, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XDF, 0XF7, 0XBE, 0XFF, 0XFF, 0XFF, 0XFF,
+    0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XF7, 0XBE, 0XFF, 0XDF, 0XFF, 0XFF, 0XCE, 0X79,
+    0X5A, 0XCB, 0X21, 0X04, 0X5A, 0XEB, 0X9C, 0XD3, 0XBD, 0XD7, 0XC6, 0X18, 0XD6, 0X9A, 0X73, 0X8D,
+    0X29, 0X03, 0X20, 0XC2, 0X10, 0X61, 0X94, 0X50, 0XF7, 0X7D, 0X7B, 0XCE, 0X4A, 0X29, 0X8C, 0X30,
+    0XBD, 0XF7, 0XCE, 0X79, 0XF7, 0X9E, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XDF, 0XFF, 0XFF,
+    0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
+    0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
+    0XF7, 0XDE, 0XF7, 0X9E, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XDF, 0X1B,
+    0XA5, 0X13, 0X73, 0XAD, 0X18, 0XC2, 0X10, 0X61, 0X21, 0X03, 0X52, 0X89, 0XF7, 0X7D, 0XFF, 0XFF,
+    0XFF, 0XBE, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XF7, 0X9E,
+    0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFE, 0XFF, 0XFD, 0XEF, 0XB6, 0XC6, 0XAD,
+    0XAE, 0X05, 0XAE, 0X41, 0XAE, 0X80, 0XAE, 0X60, 0XAE, 0X60, 0XAE, 0X60, 0XAE, 0X41, 0XAE, 0X42,
+    0XAE, 0X42, 0XAE, 0X41, 0XAE, 0X41, 0XAE, 0X41, 0XA6, 0X44, 0XCF, 0X2D, 0XF7, 0XF9, 0XFF, 0XFE,
+    0XFF, 0XFF, 0XFF, 0XDF, 0XFF, 0XFF, 0XFF, 0XFE, 0XFF, 0XDD, 0XFF, 0XFE, 0XFF, 0XFF, 0XF7, 0XFE,
+    0XF7, 0XFF, 0XF7, 0XFF, 0XF7, 0XFF, 0XD7, 0XBF, 0X75, 0XDD, 0X2C, 0X78, 0X03, 0X96, 0X0C, 0X39,
+    0X14, 0XBC, 0X04, 0X5B, 0X04, 0X3B, 0X04, 0X9C, 0X04, 0X7B, 0X04, 0X7A, 0X04, 0X5A, 0X04, 0X7A,
+    0X04, 0X7A, 0X04, 0X7A, 0X04, 0X7B, 0X04, 0X7B, 0X04, 0X5A, 0X04, 0X7B, 0X04, 0X5B, 0X04, 0X19,
+    0X0B, 0XD7, 0X34, 0XB9, 0X86, 0X7E, 0XCF, 0XFF, 0XEF, 0XFF, 0XF7, 0XFF, 0XFF, 0XFF, 0XFF, 0XFE,
+    0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XF7, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
+    0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
+    0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XF7, 0X9D, 0XFF, 0XFF,
+    0XE6, 0XFB, 0XB5, 0X96, 0XAD, 0X34, 0XFF, 0XDF, 0XFF, 0XFF, 0XFF, 0XBE, 0XFF, 0XDF, 0XFF, 0XFF,
+    0XFF, 0XDF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
+    0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XDF, 0XEF, 0X7D,
+    0XC6, 0X18, 0X39, 0XC7, 0X39, 0XC7, 0X73, 0X8E, 0X62, 0XEB, 0X62, 0XEB, 0XC6, 0X18, 0XFF, 0XFF,
+    0XFF, 0XFF, 0XD6, 0X99, 0XDE, 0XBA, 0XC5, 0XF7, 0X29, 0X24, 0X10, 0X82, 0X4A, 0X28, 0XAD, 0X55,
+    0X41, 0XE7, 0X18, 0XC3, 0X94, 0X71, 0XF7, 0XBE, 0XFF, 0XBF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XDF,
+    0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XDF, 0XFF, 0XFF, 0XFF, 0XFF,
+    0XFF, 0XFF, 0XA5, 0X34, 0X29, 0X65, 0X08, 0X61, 0X5A, 0XCB, 0XCE, 0X79, 0XFF, 0XFF, 0XEF, 0X3C,
+    0XB5, 0X55, 0X39, 0XA6, 0X18, 0XA2, 0X20, 0XE3, 0X29, 0X24, 0XA4, 0XD2, 0XFF, 0XBE, 0XCE, 0X58,
+    0XC6, 0X18, 0XDE, 0XFB, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
+    0XFF, 0XDF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
+    0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XF7, 0XBE, 0XFF, 0XDF, 0XFF, 0XFF, 0XFF, 0XDF,
+    0XFF, 0XDE, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XF7, 0XBE, 0XFF, 0XFF, 0XFF, 0XFF,
+    0XFF, 0XFF, 0XFF, 0XFF, 0XF7, 0XBE, 0XCE, 0X38, 0X63, 0X0B, 0X18, 0X81, 0X20, 0XE3, 0X18, 0XC2,
+    0XC5, 0XF7, 0XFF, 0XFF, 0XFF, 0XDE, 0XFF, 0XDF, 0XFF, 0XBE, 0XEF, 0X7D, 0XF7, 0XBE, 0XFF, 0XDF,
+    0XFF, 0XDF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFE, 0XFF, 0XFC,
+    0XEF, 0X95, 0XC6, 0X8D, 0XAE, 0X05, 0XAE, 0X22, 0XAE, 0X60, 0XAE, 0X60, 0XAE, 0X60, 0XAE, 0X61,
+    0XAE, 0X61, 0XAE, 0X42, 0XAE, 0X61, 0XAE, 0X61, 0XAE, 0X60, 0XAE, 0X61, 0XAE, 0X24, 0XD7, 0X2E,
+    0XF7, 0XF9, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFE, 0XFF, 0XDD, 0XFF, 0XFE,
+    0XFF, 0XFE, 0XEF, 0XDD, 0XEF, 0XFF, 0XE7, 0XFF, 0XC7, 0X7F, 0X7D, 0XBD, 0X2C, 0X57, 0X1C, 0X58,
+    0X0C, 0X39, 0X04, 0X3A, 0X04, 0X5B, 0X04, 0X7B, 0X04, 0X7C, 0X04, 0X7B, 0X04, 0X7B, 0X04, 0X7A,
+    0X04, 0X7A, 0X04, 0X59, 0X04, 0X7A, 0X04, 0X7A, 0X04, 0X7A, 0X04, 0X7A, 0X04, 0X59, 0X04, 0XBB,
+    0X0C, 0X79, 0X13, 0XF7, 0X3C, 0X78, 0X8E, 0X3E, 0XCF, 0XBF, 0XEF, 0XFF, 0XF7, 0XFF, 0XFF, 0XFF,
+    0XFF, 0XFF, 0XFF, 0XFE, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
+    0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
+    0XFF, 0XDF, 0XFF, 0XDF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XF7, 0X9E, 0XFF, 0XFF,
+    0XFF, 0XFF, 0XC6, 0X17, 0X73, 0X8E, 0X41, 0XC7, 0X83, 0XEF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XDF,
+    0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XF7, 0XDE, 0XFF, 0XFF, 0XFF, 0XFF,
+    0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XF7, 0XBE,
+    0XFF, 0XFF, 0XFF, 0XFF, 0XF7, 0XBE, 0XDE, 0XDB, 0XD6, 0XBA, 0XC6, 0X18, 0X52, 0X69, 0X9C, 0XD2,
+    0X73, 0X6D, 0XB5, 0X75, 0XD6, 0X79, 0XC5, 0XF7, 0XFF, 0XFF, 0XBD, 0XD7, 0X21, 0X03, 0X29, 0X45,
+    0X4A, 0X28, 0X84, 0X10, 0X39, 0XA6, 0X10, 0X82, 0X39, 0XA6, 0X73, 0X8D, 0XDE, 0XFB, 0XFF, 0XDF,
+    0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XDF, 0XFF, 0XFF, 0XFF, 0XFF,
+    0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XDF, 0X7B, 0XEF, 0X18, 0XC3, 0X18, 0XE3, 0X52, 0X8A, 0XDE, 0XDB,
+    0XFF, 0XFF, 0XEF, 0X5D, 0X41, 0XE7, 0X10, 0X61, 0X20, 0XC2, 0X18, 0X81, 0X62, 0XCB, 0XF7, 0X5C,
+    0XFF, 0XDE, 0XFF, 0XFF, 0XF7, 0X9E, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
+    0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
+    0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
+    0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XDE, 0XFF, 0XFF, 0XF7, 0XBE,
+    0XFF, 0XFF, 0XFF, 0XFF, 0XF7, 0X9E, 0XFF, 0XFF, 0XFF, 0XFF, 0XF7, 0X9D, 0X94, 0X71, 0X10, 0X81,
+    0X20, 0XE3, 0X18, 0XC2, 0X83, 0XEF, 0XE7, 0X1B, 0XF7, 0XBE, 0XDE, 0XBA, 0XDE, 0XFB, 0XF7, 0X7D,
+    0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XEF, 0X7D, 0XFF, 0XFF, 0XFF, 0XFF,
+    0XFF, 0XFC, 0XFF, 0XFA, 0XE7, 0X94, 0XC6, 0X8C, 0XAE, 0X06, 0XAE, 0X23, 0XB6, 0X61, 0XAE, 0X61,
+    0XAE, 0X61, 0XAE, 0X61, 0XAE, 0X62, 0XAE, 0X62, 0XAE, 0X61, 0XAE, 0X60, 0XAE, 0X80, 0XAE, 0X61,
+    0XAD, 0XE4, 0XD6, 0XEE, 0XFF, 0XFA, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XDF, 0XFF, 0XFF, 0XFF, 0XFE,
+    0XFF, 0XDD, 0XFF, 0XFD, 0XFF, 0XFE, 0XF7, 0XFF, 0XE7, 0XFF, 0XBF, 0XBF, 0X75, 0XFE, 0X2C, 0X18,
+    0X0B, 0XD7, 0X14, 0X9A, 0X14, 0XBB, 0X04, 0X5A, 0X04, 0X3A, 0X04, 0X7C, 0X04, 0X9C, 0X04, 0X5B,
+    0X04, 0X7B, 0X04, 0X7A, 0X04, 0X7A, 0X04, 0X59, 0X04, 0X7A, 0X04, 0X7A, 0X04, 0X7A, 0X04, 0X7A,
+    0X04, 0X99, 0X04, 0X58, 0X0C, 0X37, 0X44, 0XB8, 0X96, 0X1D, 0XDF, 0X9F, 0XFF, 0XFF, 0XFF, 0XDF,
+    0XFF, 0XDF, 0XFF, 0XFF, 0XF7, 0XFF, 0XF7, 0XFF, 0XF7, 0XFF, 0XF7, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
+    0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
+    0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
+    0XFF, 0XFF, 0XFF, 0XFF, 0XEF, 0X3C, 0X52, 0X8A, 0X18, 0XC3, 0X10, 0X61, 0X62, 0XAB, 0XBD, 0X96,
+    0X9C, 0XD3, 0XC5, 0XF7, 0XF7, 0X7D, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
+    0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
+    0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XDF, 0XFF, 0XFF, 0XEF, 0X5D, 0XFF, 0XDF, 0XE7, 0X3C, 0X42, 0X08,
+    0XA5, 0X14, 0XCE, 0X38, 0X31, 0X65, 0X4A, 0X49, 0X7B, 0XAE, 0XCE, 0X38, 0XF7, 0X9E, 0XD6, 0X99,
+    0X31, 0X65, 0X10, 0X81, 0X10, 0X82, 0X29, 0X24, 0X31, 0X65, 0X31, 0X65, 0X21, 0X04, 0X4A, 0X28,
+    0XCE, 0X39, 0XEF, 0X7D, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
+    0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XF7, 0XBE, 0XEF, 0X5D, 0X73, 0X8E, 0X10, 0XA2, 0X21, 0X24,
+    0X39, 0XE8, 0XD6, 0XBB, 0XF7, 0XBE, 0XEF, 0X5C, 0X31, 0X65, 0X18, 0XC2, 0X29, 0X03, 0X29, 0X03,
+    0X8C, 0X0F, 0XD6, 0X79, 0XFF, 0XBE, 0XFF, 0XFF, 0XFF, 0XBE, 0XFF, 0XDF, 0XFF, 0XDF, 0XF7, 0XBF,
+    0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
+    0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
+    0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XDF, 0XFF, 0XDF, 0XFF, 0XFF, 0XFF, 0XFF,
+    0XFF, 0XDF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XF7, 0XBE, 0XEF, 0X3C, 0XE7, 0X1B,
+    0X7B, 0XAE, 0X29, 0X24, 0X18, 0XC2, 0X18, 0XC2, 0X18, 0XC2, 0X4A, 0X28, 0X4A, 0X49, 0X29, 0X65,
+    0X31, 0X85, 0X6B, 0X6D, 0XDE, 0XDB, 0XFF, 0XFF, 0XF7, 0X9E, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
+    0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFD, 0XFF, 0XFB, 0XE7, 0X96, 0XC6, 0XAF, 0XAE, 0X08, 0XAE, 0X06,
+    0XAE, 0X24, 0XAE, 0X23, 0XAE, 0X24, 0XAE, 0X24, 0XAE, 0X25, 0XAE, 0X25, 0XAE, 0X24, 0XAE, 0X23,
+    0XAE, 0X42, 0XAE, 0X23, 0XBD, 0XE7, 0XDE, 0XD0, 0XFF, 0XDA, 0XFF, 0XFF, 0XFF, 0XDF, 0XFF, 0XDF,
+    0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFE, 0XFF, 0XFD, 0XFF, 0XFF, 0XEF, 0XFF, 0XBF, 0XBF, 0X6D, 0XDB,
+    0X2C, 0X79, 0X14, 0X19, 0X0C, 0X5A, 0X04, 0X5A, 0X04, 0X5A, 0X04, 0X7B, 0X04, 0X7C, 0X04, 0X7C,
+    0X04, 0X7C, 0X04, 0X5B, 0X04, 0X7B, 0X04, 0X7A, 0X04, 0X5A, 0X04, 0X7A, 0X04, 0X7A, 0X04, 0X7A,
+    0X04, 0X7A, 0X04, 0X7A, 0X04, 0XB9, 0X04, 0X36, 0X2C, 0X77, 0X86, 0X3D, 0XDF, 0XBF, 0XFF, 0XFF,
+    0XFF, 0XDF, 0XFF, 0XBF, 0XFF, 0XDF, 0XFF, 0XFF, 0XF7, 0XFF, 0XF7, 0XFF, 0XF7, 0XFF, 0XF7, 0XFF,
+    0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
+    0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XDF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XDF,
+    0XFF, 0XDF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XD6, 0X9A, 0X29, 0X24, 0X18, 0X82, 0X29, 0X04,
+    0X41, 0XA7, 0X41, 0XC7, 0X18, 0XA2, 0X83, 0XEF, 0XDE, 0XDA, 0XFF, 0XDF, 0XFF, 0XFF, 0XFF, 0XFF,
+    0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
+    0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XDF, 0XFF, 0XFF, 0XFF, 0XDF, 0XFF, 0XFF, 0XFF, 0XFF, 0XEF, 0X5D,
+    0X8C, 0X51, 0X63, 0X2C, 0XF7, 0X7D, 0XEF, 0X3C, 0X52, 0X8A, 0X18, 0XA2, 0X9C, 0XB2, 0XF7, 0X7D,
+    0XFF, 0XFF, 0XDE, 0XBA, 0X4A, 0X49, 0X52, 0X89, 0XAD, 0X34, 0XD6, 0X79, 0XEF, 0X3C, 0XE7, 0X1B,
+    0XD6, 0X79, 0XD6, 0X99, 0XE7, 0X1C, 0XFF, 0XDF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
+    0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XDF, 0XEF, 0X7D, 0X84, 0X30,
+    0X18, 0XC3, 0X08, 0X41, 0X5A, 0XEB, 0XE7, 0X1C, 0XFF, 0XDF, 0XE6, 0XFB, 0X83, 0XCF, 0X31, 0X65,
+    0X10, 0X61, 0X31, 0X44, 0X31, 0X65, 0X41, 0XC6, 0XD6, 0X99, 0XFF, 0XDF, 0XF7, 0X9E, 0XFF, 0XDF,
+    0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XDF, 0XFF, 0XDF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
+    0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
+    0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XBE, 0XFF, 0XBE, 0XFF, 0XDF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XDF,
+    0XF7, 0X7D, 0XEF, 0X3C, 0XEF, 0X5C, 0XF7, 0X9E, 0XDE, 0XDA, 0XC5, 0XF7, 0XBD, 0XB6, 0X8C, 0X30,
+    0X4A, 0X28, 0X39, 0XA6, 0X20, 0XE3, 0X29, 0X44, 0X18, 0XC2, 0X21, 0X03, 0X18, 0XA2, 0X20, 0XE3,
+    0X10, 0XA2, 0X18, 0XE3, 0X08, 0X41, 0X31, 0X85, 0XB5, 0XB6, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
+    0XF7, 0XBE, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XF7, 0XBB, 0XDF, 0X15,
+    0XCE, 0XB1, 0XC6, 0XAF, 0XC6, 0XAE, 0XC6, 0X8D, 0XC6, 0XAE, 0XC6, 0XAE, 0XC6, 0XAE, 0XC6, 0XAE,
+    0XC6, 0XCE, 0XC6, 0XCD, 0XC6, 0XCC, 0XCE, 0XCC, 0XD6, 0XCF, 0XEF, 0X55, 0XFF, 0XDB, 0XFF, 0XDE,
+    0XFF, 0XDF, 0XFF, 0XDF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XF7, 0XFF, 0XEF, 0XFF, 0XC7, 0XBF,
+    0X7E, 0X3B, 0X2C, 0X77, 0X0B, 0XF9, 0X0C, 0X7C, 0X0C, 0X9B, 0X04, 0X5A, 0X04, 0X3A, 0X04, 0X7B,
+    0X04, 0XBC, 0X04, 0X9C, 0X04, 0X7B, 0X04, 0X7B, 0X04, 0X7B, 0X04, 0X7A, 0X04, 0X7A, 0X04, 0X7A,
+    0X04, 0X7A, 0X04, 0X7A, 0X04, 0X7A, 0X04, 0X79, 0X0C, 0X98, 0X2C, 0XF8, 0X76, 0X3C, 0XC7, 0XBF,
+    0XF7, 0XFF, 0XFF, 0XDF, 0XFF, 0X9E, 0XFF, 0XDE, 0XFF, 0XDF, 0XFF, 0XFF, 0XF7, 0XFF, 0XF7, 0XFF,
+    0XF7, 0XFF, 0XF7, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
+    0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
+    0XFF, 0XDF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XEF, 0X7D, 0XFF, 0XDF, 0XBD, 0XB6, 0X39, 0XC6,
+    0X18, 0XA2, 0X18, 0XA2, 0X20, 0XE3, 0X28, 0XE4, 0X41, 0XE7, 0XBD, 0X96, 0XFF, 0XDF, 0XFF, 0XFF,
+    0XFF, 0XFF, 0XFF, 0XFF, 0XF7, 0XBE, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
+    0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XF7, 0X9E,
+    0XFF, 0XFF, 0XAD, 0X55, 0X4A, 0X69, 0XD6, 0XBA, 0XFF, 0XDE, 0XFF, 0XDF, 0XBD, 0XB6, 0X7B, 0XAE,
+    0XEF, 0X5D, 0XF7, 0X7D, 0XD6, 0X9A, 0X73, 0X8D, 0X8C, 0X30, 0XB5, 0X95, 0XF7, 0X9E, 0XFF, 0XFF,
+    0XFF, 0XFF, 0XFF, 0XBE, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
+    0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XDF, 0XFF, 0XFF, 0XFF, 0XDF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
+    0XFF, 0XDF, 0XC6, 0X18, 0X63, 0X2C, 0X4A, 0X69, 0X9C, 0XF3, 0XEF, 0X7E, 0XFF, 0XFF, 0XF7, 0XBE,
+    0XE6, 0XFB, 0X7B, 0XCE, 0X29, 0X03, 0X18, 0X81, 0X5A, 0XAA, 0X94, 0X71, 0XD6, 0X59, 0X9C, 0XD3,
+    0X9C, 0XB3, 0XCE, 0X59, 0XFF, 0XDF, 0XF7, 0X9E, 0XFF, 0XFF, 0XFF, 0XDF, 0XFF, 0XFF, 0XFF, 0XFF,
+    0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
+    0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XDF, 0XFF, 0XBE,
+    0XE6, 0XFB, 0XBD, 0XD7, 0X9C, 0XB2, 0X8C, 0X10, 0X62, 0XEB, 0X5A, 0XCB, 0X41, 0XC7, 0X29, 0X24,
+    0X31, 0X65, 0X20, 0XE3, 0X10, 0X61, 0X18, 0XC2, 0X10, 0X61, 0X21, 0X03, 0X10, 0X82, 0X10, 0X61,
+    0X29, 0X44, 0X52, 0X69, 0X52, 0XAA, 0X5A, 0XCA, 0X4A, 0X48, 0X39, 0XE7, 0XA5, 0X34, 0XF7, 0X9E,
+    0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XDF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XDF, 0XFF, 0XFF,
+    0XFF, 0XFF, 0XF7, 0XDC, 0XF7, 0XDA, 0XF7, 0XF9, 0XFF, 0XF9, 0XF7, 0XF9, 0XFF, 0XFA, 0XFF, 0XFA,
+    0XFF, 0XFA, 0XFF, 0XFA, 0XFF, 0XF9, 0XFF, 0XF8, 0XFF, 0XF7, 0XFF, 0XF7, 0XF7, 0XB7, 0XFF, 0XFA,
+    0XFF, 0XFD, 0XFF, 0XDE, 0XFF, 0XDF, 0XFF, 0XDF, 0XFF, 0XFF, 0XFF, 0XDF, 0XEF, 0XFF, 0XEF, 0XFF,
+    0XCF, 0XFF, 0X86, 0X5C, 0X34, 0XB7, 0X0B, 0XF7, 0X04, 0X1A, 0X04, 0X7C, 0X04, 0X5B, 0X04, 0X9B,
+    0X04, 0X9B, 0X04, 0X7B, 0X04, 0X7B, 0X04, 0X7B, 0X04, 0X9B, 0X04, 0X7B, 0X04, 0X7B, 0X04, 0X7A,
+    0X04, 0X7A, 0X04, 0X7A, 0X04, 0X5A, 0X04, 0X5A, 0X04, 0X5A, 0X0C, 0X58, 0X1C, 0X36, 0X76, 0X3D,
+    0XC7, 0XFF, 0XE7, 0XFF, 0XFF, 0XFF, 0XFF, 0XDD, 0XFF, 0XDD, 0XFF, 0XDD, 0XFF, 0XFE, 0XFF, 0XFF,
+    0XF7, 0XFF, 0XF7, 0XFF, 0XF7, 0XFF, 0XF7, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
+    0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
+    0XFF, 0XFF, 0XFF, 0XDF, 0XFF, 0XDF, 0XFF, 0XFF, 0XFF, 0XFF, 0XF7, 0XBE, 0XFF, 0XFF, 0XDE, 0XDA,
+    0X4A, 0X28, 0X18, 0XA2, 0X20, 0XC3, 0X20, 0XE3, 0X28, 0XE4, 0X31, 0X45, 0X94, 0X71, 0XF7, 0X7D,
+    0XFF, 0XFF, 0XF7, 0X7D, 0XFF, 0XFF, 0XFF, 0XFF, 0XF7, 0XDE, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
+    0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
+    0XFF, 0XFF, 0XFF, 0XFF, 0XCE, 0X79, 0X63, 0X0C, 0X94, 0XB2, 0XEF, 0X7D, 0XFF, 0XFF, 0XFF, 0XDF,
+    0XF7, 0X9E, 0XFF, 0XBE, 0XE6, 0XFB, 0XDE, 0XBA, 0X6B, 0X2C, 0X6B, 0X2C, 0XD6, 0X9A, 0XFF, 0XFF,
+    0XFF, 0XDF, 0XF7, 0X9D, 0XFF, 0XFF, 0XFF, 0XDF, 0XFF, 0XDF, 0XFF, 0XDF, 0XFF, 0XFF, 0XFF, 0XFF,
+    0XF7, 0XBE, 0XFF, 0XDF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
+    0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XDF, 0XFF, 0XFF, 0XDE, 0XDB, 0XD6, 0XBA, 0XEF, 0X7D, 0XFF, 0XFF,
+    0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XDF, 0XDE, 0XDA, 0X7B, 0XAE, 0X31, 0X65, 0X4A, 0X28, 0XAD, 0X13,
+    0X31, 0X65, 0X18, 0XA2, 0X29, 0X45, 0X42, 0X28, 0XAD, 0X55, 0XFF, 0XDF, 0XFF, 0XFF, 0XFF, 0XFF,
+    0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XDF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
+    0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
+    0XFF, 0XBE, 0XCE, 0X18, 0X7B, 0XAE, 0X31, 0X65, 0X18, 0XA2, 0X18, 0XC3, 0X18, 0XA2, 0X20, 0XC3,
+    0X20, 0XC3, 0X18, 0XA2, 0X18, 0X82, 0X18, 0XA2, 0X29, 0X04, 0X39, 0X86, 0X42, 0X07, 0X20, 0XE3,
+    0X20, 0XE3, 0X18, 0XA2, 0X62, 0XEB, 0XCE, 0X38, 0XFF, 0XDF, 0XDE, 0XFB, 0XD6, 0X99, 0XB5, 0X95,
+    0XEF, 0X7D, 0XFF, 0XFF, 0XF7, 0XBE, 0XFF, 0XFF, 0XFF, 0XDF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
+    0XFF, 0XDF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFE, 0XFF, 0XFD, 0XFF, 0XFD, 0XFF, 0XFD,
+    0XFF, 0XFE, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFE, 0XFF, 0XFD, 0XFF, 0XFC, 0XFF, 0XFC,
+    0XFF, 0XFD, 0XFF, 0XFD, 0XFF, 0XDD, 0XFF, 0XDD, 0XFF, 0XFE, 0XFF, 0XDF, 0XFF, 0XFF, 0XEF, 0XDF,
+    0XE7, 0XFF, 0XC7, 0XFF, 0X86, 0X7D, 0X34, 0X97, 0X0B, 0XF6, 0X0C, 0X7A, 0X0C, 0XBC, 0X04, 0X3A,
+    0X04, 0X7A, 0X04, 0X7A, 0X04, 0X7A, 0X04, 0X7A, 0X04, 0X7A, 0X04, 0X7A, 0X04, 0X7A, 0X04, 0X7B,
+    0X04, 0X9B, 0X04, 0X5A, 0X04, 0X5A, 0X04, 0X5A, 0X0C, 0X5A, 0X04, 0X39, 0X0C, 0X39, 0X1C, 0X58,
+    0X7E, 0X3E, 0XBF, 0X5F, 0XE7, 0XFF, 0XF7, 0XFF, 0XFF, 0XFE, 0XFF, 0XFD, 0XFF, 0XFC, 0XFF, 0XBC,
+    0XFF, 0XFE, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
+    0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XF7, 0XBE, 0XFF, 0XFF, 0XFF, 0XFF, 0XF7, 0X9E, 0XFF, 0XDF,
+    0XFF, 0XDF, 0XFF, 0XFF, 0XF7, 0XBE, 0XDE, 0XFB, 0XEF, 0X7D, 0XFF, 0XFF, 0XF7, 0XBE, 0XFF, 0XDF,
+    0XBD, 0XD6, 0X62, 0XEB, 0X21, 0X04, 0X18, 0XA2, 0X18, 0XA2, 0X18, 0XA2, 0X39, 0X65, 0X7B, 0X6D,
+    0XEF, 0X1C, 0XFF, 0X9E, 0XFF, 0XDF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XF7, 0XBE, 0XFF, 0XFF,
+    0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
+    0XFF, 0XDF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XDF, 0X8C, 0X71, 0X63, 0X2C, 0XDE, 0XDB, 0XF7, 0XBE,
+    0XFF, 0XFF, 0XFF, 0XDF, 0XFF, 0XFF, 0XFF, 0XFF, 0XD6, 0X99, 0X62, 0XEB, 0X4A, 0X28, 0XDE, 0XDA,
+    0XEF, 0X5D, 0XBD, 0XD6, 0X94, 0X92, 0X83, 0XEF, 0XA4, 0XF3, 0XFF, 0XFF, 0XFF, 0XBE, 0XFF, 0XDE,
+    0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
+    0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
+    0XFF, 0XFF, 0XF7, 0XBF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XBE, 0XBD, 0X96, 0X4A, 0X07,
+    0X29, 0X03, 0X29, 0X04, 0X31, 0X65, 0X31, 0X85, 0X18, 0XC3, 0X08, 0X41, 0X8C, 0X71, 0XEF, 0X5D,
+    0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XDF, 0XFF, 0XFF, 0XFF, 0XFF,
+    0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
+    0XFF, 0XFF, 0XFF, 0XDF, 0XBD, 0XB6, 0X52, 0X49, 0X29, 0X24, 0X29, 0X24, 0X20, 0XC3, 0X29, 0X24,
+    0X29, 0X24, 0X08, 0X20, 0X18, 0X82, 0X20, 0XC3, 0X31, 0X65, 0X5A, 0XAA, 0X7B, 0XCF, 0XB5, 0X75,
+    0X9C, 0XB2, 0X31, 0X85, 0X18, 0XC2, 0X20, 0XE3, 0X9C, 0XD2, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
+    0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
+    0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFE, 0XFF, 0XFE,
+    0XFF, 0XFE, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
+    0XFF, 0XFE, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFE, 0XFF, 0XFD, 0XFF, 0XFE, 0XFF, 0XBE,
+    0XF7, 0XDF, 0XEF, 0XFF, 0XCF, 0XFF, 0X7E, 0X7E, 0X34, 0XD8, 0X14, 0X58, 0X0C, 0X79, 0X04, 0X5A,
+    0X04, 0X5A, 0X04, 0X7B, 0X04, 0X7A, 0X04, 0X7A, 0X04, 0X7A, 0X04, 0X7A, 0X04, 0X7A, 0X04, 0X7A,
+    0X04, 0X7A, 0X04, 0X7A, 0X04, 0X7B, 0X04, 0X3A, 0X04, 0X3A, 0X0C, 0X7A, 0X0C, 0X18, 0X03, 0XD7,
+    0X2C, 0XBA, 0X6D, 0XFE, 0XBF, 0X5F, 0XE7, 0XDF, 0XF7, 0XFF, 0XF7, 0XFF, 0XF7, 0XFD, 0XFF, 0XFD,
+    0XFF, 0XFC, 0XFF, 0XFD, 0XFF, 0XFE, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
+    0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XF7, 0XBE, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
+    0XFF, 0XFF, 0XFF, 0XFF, 0XF7, 0X9E, 0XB5, 0X96, 0X73, 0X8E, 0XB5, 0XB6, 0XFF, 0XDF, 0XFF, 0XFF,
+    0XF7, 0X9E, 0X9C, 0XD3, 0X4A, 0X28, 0X18, 0XC3, 0X18, 0XA2, 0X29, 0X04, 0X20, 0XC3, 0X10, 0X61,
+    0X20, 0XE3, 0X5A, 0X8A, 0X73, 0X6D, 0XAD, 0X34, 0XDE, 0X9A, 0XFF, 0XDE, 0XF7, 0XBE, 0XFF, 0XFF,
+    0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
+    0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XF7, 0XBE, 0XAD, 0X55, 0X63, 0X0C, 0X94, 0X92,
+    0XF7, 0XBE, 0XFF, 0XFF, 0XFF, 0XDE, 0XFF, 0XFF, 0XFF, 0XFF, 0XE6, 0XFB, 0X73, 0X6D, 0X4A, 0X28,
+    0X9C, 0XB2, 0XB5, 0X75, 0X73, 0X6D, 0X41, 0XE7, 0X29, 0X24, 0X18, 0XC3, 0X39, 0XC7, 0XA4, 0XF3,
+    0XFF, 0XDF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
+    0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
+    0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XCE, 0X39, 0XFF, 0XDF, 0XFF, 0XBE, 0XDE, 0XDA,
+    0X7B, 0XAE, 0X29, 0X24, 0X29, 0X24, 0X7B, 0XAE, 0XBD, 0XB6, 0X73, 0X8D, 0X21, 0X04, 0X21, 0X04,
+    0X7B, 0XF0, 0XEF, 0X5D, 0XFF, 0XFF, 0XFF, 0XDF, 0XF7, 0XBE, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
+    0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
+    0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XDF, 0XE6, 0XDB, 0X7B, 0X8E, 0X4A, 0X28, 0X7B, 0XAE, 0XAD, 0X34,
+    0XBD, 0XB6, 0XA5, 0X14, 0X94, 0X71, 0X94, 0X92, 0X94, 0X92, 0X9C, 0X92, 0XBD, 0XB6, 0XE6, 0XDB,
+    0XEF, 0X3C, 0XFF, 0XDF, 0XA4, 0XF3, 0X31, 0X65, 0X20, 0XE3, 0X29, 0X24, 0XC6, 0X17, 0XFF, 0XFF,
+    0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
+    0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFE, 0XFF, 0XFE, 0XFF, 0XFD, 0XFF, 0XFD,
+    0XFF, 0XFD, 0XFF, 0XFD, 0XFF, 0XFD, 0XFF, 0XFE, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
+    0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFE, 0XFF, 0XFF, 0XFF, 0XDF, 0XFF, 0XFF, 0XFF, 0XFE, 0XFF, 0XFD,
+    0XFF, 0XFE, 0XFF, 0XFF, 0XEF, 0XFF, 0XD7, 0XFF, 0X86, 0X7F, 0X34, 0XD9, 0X03, 0XD6, 0X04, 0X59,
+    0X04, 0X9B, 0X04, 0X5A, 0X04, 0X39, 0X04, 0X9B, 0X04, 0X7A, 0X04, 0X79, 0X04, 0X79, 0X04, 0X79,
+    0X04, 0X79, 0X04, 0X5A, 0X04, 0X7A, 0X04, 0X7A, 0X04, 0X7B, 0X04, 0X5A, 0X0C, 0X7A, 0X14, 0X39,
+    0X0B, 0XD7, 0X24, 0X37, 0X65, 0XFE, 0XB7, 0XBF, 0XF7, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XF7, 0XFF,
+    0XF7, 0XFE, 0XF7, 0XFD, 0XF7, 0XFD, 0XFF, 0XFD, 0XFF, 0XFE, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XDF,
+    0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XDF, 0XFF, 0XFF, 0XFF, 0XDF,
+    0XFF, 0XFF, 0XFF, 0XFF, 0XEF, 0X5D, 0XC6, 0X18, 0X8C, 0X71, 0X4A, 0X69, 0X39, 0XE7, 0XBD, 0XD7,
+    0XFF, 0XFF, 0XFF, 0XFF, 0XEF, 0X7D, 0X9C, 0XB3, 0X18, 0XC3, 0X29, 0X24, 0X4A, 0X28, 0X41, 0XE7,
+    0X29, 0X04, 0X20, 0XA2, 0X20, 0XA2, 0X31, 0X24, 0X20, 0XA2, 0X29, 0X24, 0X62, 0XCB, 0XDE, 0XDB,
+    0XFF, 0XFF, 0XFF, 0XDF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
+    0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XF7, 0XBE, 0XF7, 0X9E, 0X94, 0X92,
+    0X73, 0XAE, 0XD6, 0X9A, 0XFF, 0XDF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XBE, 0XAD, 0X34,
+    0X29, 0X45, 0X31, 0X65, 0X73, 0X8D, 0X31, 0X86, 0X18, 0XA2, 0X18, 0XA2, 0X18, 0XC3, 0X18, 0XA2,
+    0X18, 0XA2, 0X41, 0XE7, 0XEF, 0X3C, 0XFF, 0XBE, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
+    0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
+    0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XD6, 0XBB, 0X7B, 0XCF, 0XFF, 0XFF,
+    0XFF, 0XBE, 0XF7, 0X7D, 0X94, 0X50, 0X29, 0X03, 0X39, 0X85, 0X73, 0X6D, 0XE6, 0XFB, 0X6B, 0X4C,
+    0X18, 0XA2, 0X29, 0X65, 0X9C, 0XF4, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
+    0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
+    0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XC5, 0XF7, 0X62, 0XEB, 0X9C, 0XB2,
+    0XEF, 0X5D, 0XFF, 0XBE, 0XFF, 0XFF, 0XFF, 0XDF, 0XF7, 0X9E, 0XFF, 0XFF, 0XF7, 0X7D, 0XEF, 0X3C,
+    0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XDF, 0XF7, 0X9D, 0X94, 0X71, 0X20, 0XE3, 0X18, 0XA2, 0X31, 0X85,
+    0XEF, 0X3C, 0XFF, 0XBE, 0XFF, 0XDF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
+    0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFE, 0XFF, 0XFE,
+    0XFF, 0XFD, 0XFF, 0XFD, 0XFF, 0XFD, 0XFF, 0XFD, 0XFF, 0XFE, 0XFF, 0XFE, 0XFF, 0XFF, 0XFF, 0XFF,
+    0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
+    0XFF, 0XFF, 0XEF, 0XBC, 0XF7, 0XFF, 0XEF, 0XFF, 0XCF, 0XBF, 0X8E, 0X5F, 0X34, 0X79, 0X14, 0X58,
+    0X04, 0X39, 0X04, 0X7A, 0X04, 0X9B, 0X04, 0X7B, 0X04, 0X5A, 0X04, 0X7A, 0X04, 0X7A, 0X04, 0X79,
+    0X04, 0X79, 0X04, 0X59, 0X04, 0X59, 0X04, 0X7A, 0X04, 0X7A, 0X04, 0X5A, 0X04, 0X5A, 0X14, 0X9B,
+    0X14, 0X5A, 0X13, 0XF7, 0X2C, 0X57, 0X6D, 0XDC, 0XAF, 0X9F, 0XE7, 0XFF, 0XFF, 0XFF, 0XFF, 0XBF,
+    0XFF, 0XDF, 0XFF, 0XFF, 0XF7, 0XFF, 0XF7, 0XFE, 0XF7, 0XFE, 0XF7, 0XFE, 0XFF, 0XFF, 0XFF, 0XFF,
+    0XFF, 0XFF, 0XFF, 0XDF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
+    0XFF, 0XFF, 0XFF, 0XDF, 0XFF, 0XFF, 0XE7, 0X1C, 0X7B, 0XEF, 0X31, 0X86, 0X18, 0XE3, 0X29, 0X65,
+    0X94, 0X92, 0XEF, 0X5D, 0XFF, 0XFF, 0XFF, 0XFF, 0XEF, 0X7D, 0XEF, 0X3C, 0XB5, 0X96, 0XCE, 0X38,
+    0XBD, 0XB6, 0X52, 0X69, 0X10, 0X20, 0X39, 0X86, 0X7B, 0X8E, 0X9C, 0X72, 0X5A, 0XAA, 0X10, 0X61,
+    0X18, 0X82, 0XC6, 0X17, 0XFF, 0XFF, 0XF7, 0XBE, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
+    0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XF7, 0XBE,
+    0XFF, 0XFF, 0XDE, 0XDB, 0XDE, 0XDB, 0XFF, 0XFF, 0XFF, 0XDF, 0XFF, 0XFF, 0XFF, 0XFF, 0XF7, 0X9E,
+    0XC6, 0X18, 0X52, 0X8A, 0X18, 0XA2, 0X20, 0XE3, 0X18, 0XC2, 0X31, 0X65, 0X84, 0X0F, 0X8C, 0X30,
+    0X52, 0X8A, 0X29, 0X24, 0X18, 0XC3, 0X08, 0X41, 0XE6, 0XFB, 0XF7, 0XBE, 0XFF, 0XFF, 0XFF, 0XFF,
+    0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
+    0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XC6, 0X38,
+    0X39, 0XC7, 0XE7, 0X3C, 0XFF, 0XBE, 0XFF, 0XBE, 0X9C, 0XB2, 0X31, 0X44, 0X10, 0X40, 0X31, 0X45,
+    0XB5, 0X95, 0X39, 0XC6, 0X18, 0XC3, 0X52, 0XAA, 0XE7, 0X1C, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
+    0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XDF, 0XFF, 0XFF, 0XFF, 0XDF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
+    0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XDE, 0XDA,
+    0XB5, 0X75, 0XEF, 0X7D, 0XFF, 0XFF, 0XFF, 0XDE, 0XFF, 0XDF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
+    0XFF, 0XBE, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XBE, 0XFF, 0XDF, 0XE6, 0XFB, 0X6B, 0X4C, 0X18, 0XA2,
+    0X10, 0X81, 0X4A, 0X48, 0XFF, 0XDE, 0XFF, 0XDE, 0XFF, 0XBE, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
+    0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
+    0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
+    0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
+    0XFF, 0XDF, 0XFF, 0XDF, 0XF7, 0XFE, 0XEF, 0XFE, 0XE7, 0XFF, 0XCF, 0XFF, 0X86, 0X3F, 0X34, 0X7A,
+    0X0B, 0XD7, 0X0C, 0X59, 0X04, 0X9A, 0X04, 0X9B, 0X04, 0X7B, 0X04, 0X7B, 0X04, 0X7A, 0X04, 0X5A,
+    0X04, 0X7A, 0X04, 0X7A, 0X04, 0X7A, 0X04, 0X7A, 0X04, 0X7A, 0X04, 0X5A, 0X04, 0X5A, 0X04, 0X5A,
+    0X04, 0X5A, 0X0C, 0X39, 0X13, 0XF7, 0X2C, 0X57, 0X75, 0XBB, 0XBF, 0X9F, 0XE7, 0XFF, 0XF7, 0XFF,
+    0XFF, 0XFF, 0XFF, 0XDE, 0XFF, 0XFF, 0XFF, 0XFF, 0XF7, 0XFF, 0XF7, 0XFF, 0XF7, 0XFF, 0XFF, 0XFF,
+    0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
+    0XFF, 0XDF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0X9C, 0XF3, 0X18, 0XE3, 0X00, 0X20,
+    0X29, 0X65, 0X84, 0X10, 0XE7, 0X1C, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XDF, 0XFF, 0XFF,
+    0XFF, 0XFF, 0XBD, 0X96, 0X5A, 0XAA, 0X10, 0X61, 0X39, 0X66, 0XBD, 0X75, 0XFF, 0X7D, 0XEF, 0X1C,
+    0X73, 0X4D, 0X29, 0X04, 0X18, 0X82, 0XB5, 0X96, 0XFF, 0XDF, 0XFF, 0XDF, 0XFF, 0XFF, 0XFF, 0XDE,
+    0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
+    0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XDF, 0XFF, 0XFF,
+    0XFF, 0XFF, 0XEF, 0X3C, 0X84, 0X10, 0X18, 0XA2, 0X18, 0XC3, 0X21, 0X04, 0X39, 0XC7, 0XC5, 0XF7,
+    0XF7, 0X9E, 0XFF, 0XBE, 0X73, 0X6D, 0X18, 0XA2, 0X20, 0XE3, 0X10, 0X61, 0XE6, 0XFB, 0XFF, 0XFF,
+    0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
+    0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
+    0XFF, 0XDF, 0XEF, 0X5D, 0X21, 0X04, 0X63, 0X0C, 0XBD, 0X96, 0XA4, 0XF3, 0X41, 0XE7, 0X20, 0XC2,
+    0X31, 0X44, 0X83, 0XEF, 0XA4, 0XD3, 0X20, 0XE3, 0X31, 0X65, 0X9C, 0XD3, 0XFF, 0XFF, 0XEF, 0X7E,
+    0XFF, 0XFF, 0XF7, 0XBE, 0XFF, 0XFF, 0XF7, 0X9E, 0XFF, 0XDF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XDF,
+    0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
+    0XF7, 0XBE, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XDE, 0XFF, 0XDF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XDF,
+    0XFF, 0XDF, 0XFF, 0XDF, 0XFF, 0XDE, 0XFF, 0XFF, 0XFF, 0XDF, 0XFF, 0XFF, 0XFF, 0XFF, 0XBD, 0XD6,
+    0X41, 0XE7, 0X18, 0XC2, 0X10, 0X81, 0X73, 0X6D, 0XFF, 0XDE, 0XFF, 0XFF, 0XFF, 0XDF, 0XFF, 0XFF,
+    0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
+    0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
+    0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
+    0XFF, 0XFF, 0XFF, 0XDF, 0XFF, 0XBF, 0XFF, 0X7F, 0XF7, 0XFF, 0XEF, 0XFF, 0XD7, 0XFF, 0X7E, 0X5C,
+    0X34, 0X9A, 0X13, 0XFA, 0X0C, 0X7B, 0X04, 0X5A, 0X04, 0X39, 0X04, 0X7A, 0X04, 0X7B, 0X04, 0X5B,
+    0X04, 0X5A, 0X04, 0X7A, 0X04, 0X7A, 0X04, 0X7A, 0X04, 0X7A, 0X04, 0X7A, 0X04, 0X7A, 0X04, 0X5A,
+    0X04, 0X5A, 0X04, 0X5A, 0X0C, 0X5A, 0X0B, 0XD8, 0X24, 0X38, 0X65, 0XBC, 0XB7, 0X5F, 0XEF, 0XFF,
+    0XFF, 0XFF, 0XFF, 0XFE, 0XFF, 0XFD, 0XFF, 0XFE, 0XFF, 0XFF, 0XFF, 0XFF, 0XF7, 0XFF, 0XF7, 0XFF,
+    0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
+    0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XDF, 0XFF, 0XDF, 0XFF, 0XFF, 0XC6, 0X38,
+    0X63, 0X0C, 0X5A, 0XEB, 0X94, 0X92, 0XF7, 0X9E, 0XFF, 0XDF, 0XFF, 0XFF, 0XFF, 0XFF, 0XF7, 0XBE,
+    0XFF, 0XFF, 0XFF, 0XBF, 0XDE, 0XBA, 0X6B, 0X0C, 0X29, 0X04, 0X18, 0XA2, 0X31, 0X25, 0X62, 0XCB,
+    0X83, 0XAE, 0X83, 0XAE, 0X31, 0X25, 0X10, 0X41, 0X39, 0X86, 0XD6, 0X9A, 0XFF, 0XFF, 0XFF, 0XFF,
+    0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
+    0XFF, 0XFF, 0XFF, 0XFF, 0XF7, 0XBE, 0XFF, 0XFF, 0XF7, 0XBE, 0XFF, 0XFF, 0XFF, 0XFF, 0XF7, 0X9E,
+    0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XCE, 0X38, 0X42, 0X08, 0X10, 0X82, 0X20, 0XE3, 0X18, 0XC3,
+    0X5A, 0XAA, 0XA5, 0X14, 0XD6, 0X79, 0XFF, 0XDF, 0X7B, 0XAE, 0X18, 0XC3, 0X21, 0X04, 0X29, 0X45,
+    0XE6, 0XFB, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
+    0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
+    0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XDF, 0XF7, 0X9E, 0X4A, 0X49, 0X10, 0X82, 0X41, 0XC7, 0X39, 0X86,
+    0X10, 0X61, 0X18, 0X82, 0X41, 0XC6, 0XA4, 0XF3, 0X42, 0X07, 0X18, 0XA2, 0X63, 0X0C, 0XDE, 0XDB,
+    0XFF, 0XDF, 0XFF, 0XFF, 0XFF, 0XDF, 0XFF, 0XFF, 0XFF, 0XFF, 0XEF, 0X5D, 0XE7, 0X1C, 0XFF, 0XFF,
+    0XFF, 0XDF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
+    0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XF7, 0XBE, 0XF7, 0X9E, 0XFF, 0XFF,
+    0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XF7, 0XBE, 0XFF, 0XFF,
+    0XD6, 0X9A, 0X62, 0XEB, 0X18, 0XC2, 0X20, 0XC2, 0X18, 0XA2, 0X94, 0X92, 0XFF, 0XBE, 0XFF, 0XFF,
+    0XFF, 0XDF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
+    0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
+    0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
+    0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XBF, 0XFF, 0XBF, 0XF7, 0XFF, 0XDF, 0XFF,
+    0X96, 0XDC, 0X3C, 0XD8, 0X0B, 0XF9, 0X0C, 0X5C, 0X0C, 0XBC, 0X04, 0X5A, 0X04, 0X38, 0X04, 0X59,
+    0X04, 0X7B, 0X04, 0X5B, 0X04, 0X5A, 0X04, 0X9B, 0X04, 0X7B, 0X04, 0X7B, 0X04, 0X7B, 0X04, 0X7B,
+    0X04, 0X7B, 0X04, 0X5B, 0X04, 0X5B, 0X04, 0X5A, 0X0C, 0X3A, 0X24, 0X9A, 0X5D, 0XBD, 0XAF, 0X5F,
+    0XE7, 0XFF, 0XFF, 0XFF, 0XFF, 0XDC, 0XFF, 0XFB, 0XFF, 0XFC, 0XFF, 0XFD, 0XFF, 0XFF, 0XFF, 0XDF,
+    0XFF, 0XDF, 0XFF, 0XDF, 0XFF, 0XDF, 0XFF, 0XDF, 0XFF, 0XDF, 0XFF, 0XFF, 0XFF, 0XFE, 0XFF, 0XFE,
+    0XFF, 0XFF, 0XFF, 0XFF, 0XF7, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XF7, 0XBE,
+    0XFF, 0XFF, 0XFF, 0XFF, 0XDE, 0XFB, 0XC6, 0X38, 0XE7, 0X1C, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
+    0XFF, 0XDF, 0XF7, 0XBE, 0XFF, 0XFF, 0XDE, 0XDB, 0X94, 0X92, 0X29, 0X45, 0X29, 0X04, 0X5A, 0X8A,
+    0X52, 0X49, 0X31, 0X45, 0X20, 0XC3, 0X28, 0XE4, 0X20, 0XE3, 0X18, 0XA2, 0X4A, 0X08, 0XC5, 0XF7,
+    0XFF, 0XBE, 0XFF, 0XDF, 0XEF, 0X7D, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
+    0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
+    0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XDF, 0XF7, 0X7D, 0X83, 0XEF, 0X18, 0XA2, 0X18, 0XA2,
+    0X18, 0XC3, 0X18, 0XA2, 0X31, 0X85, 0X20, 0XE3, 0X7B, 0XAE, 0XBD, 0XB6, 0X5A, 0XCB, 0X18, 0XC2,
+    0X10, 0X82, 0X5A, 0XAA, 0XF7, 0X9E, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
+    0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
+    0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XEF, 0X7D, 0XA4, 0XF3, 0X29, 0X45,
+    0X08, 0X00, 0X18, 0XA2, 0X20, 0XE3, 0X29, 0X03, 0X20, 0XC2, 0X62, 0XEB, 0X21, 0X03, 0X62, 0XEB,
+    0XCE, 0X38, 0XFF, 0XDF, 0XEF, 0X7E, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XDF, 0XBD, 0XF7,
+    0XB5, 0XB6, 0XEF, 0X7D, 0XFF, 0XDF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
+    0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XF7, 0XBE, 0XF7, 0XBE, 0XFF, 0XFF,
+    0XFF, 0XFF, 0XFF, 0XDF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
+    0XFF, 0XFF, 0XE7, 0X1B, 0X84, 0X10, 0X31, 0X85, 0X10, 0X81, 0X18, 0XC2, 0X18, 0XC3, 0XB5, 0X75,
+    0XFF, 0XBE, 0XFF, 0XFF, 0XFF, 0XDE, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
+    0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
+    0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
+    0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFE, 0XFF, 0XFF, 0XFF, 0XDF, 0XFF, 0XFF,
+    0XDF, 0XFF, 0X96, 0XBA, 0X45, 0X17, 0X14, 0X16, 0X04, 0X1A, 0X04, 0X7D, 0X04, 0X3B, 0X04, 0X7B,
+    0X0C, 0X9A, 0X04, 0X7A, 0X04, 0X5A, 0X04, 0X5B, 0X04, 0X9B, 0X04, 0X9B, 0X04, 0X7A, 0X04, 0X7B,
+    0X04, 0X7B, 0X04, 0X7C, 0X04, 0X5C, 0X04, 0X5B, 0X04, 0X5A, 0X0C, 0X59, 0X13, 0XF7, 0X55, 0X7C,
+    0XAF, 0X5F, 0XDF, 0XFF, 0XF7, 0XFF, 0XFF, 0XFF, 0XFF, 0XDD, 0XFF, 0XDC, 0XFF, 0XFC, 0XFF, 0XFD,
+    0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XDF, 0XFF, 0XDF, 0XFF, 0X9F, 0XFF, 0XDF, 0XFF, 0XFF,
+    0XFF, 0XFE, 0XFF, 0XFE, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XF7, 0X5D,
+    0XFF, 0XFF, 0XFF, 0XFF, 0XF7, 0X9E, 0XFF, 0XDF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XEF, 0X7D,
+    0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XBE, 0XFF, 0XFF, 0XEF, 0X5D, 0XBD, 0XD7, 0X41, 0XC6, 0X20, 0XA2,
+    0X73, 0X6D, 0XCE, 0X18, 0XA4, 0XB3, 0X41, 0XC7, 0X18, 0X62, 0X18, 0XC3, 0X20, 0XC3, 0X20, 0XC3,
+    0X20, 0XC3, 0X4A, 0X28, 0X9C, 0XB2, 0XFF, 0XBE, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
+    0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XF7, 0XDE,
+    0XFF, 0XFF, 0XFF, 0XFF, 0XF7, 0XDE, 0XFF, 0XFF, 0XFF, 0XFF, 0XF7, 0XBE, 0XEF, 0X3C, 0X52, 0X8A,
+    0X20, 0XE3, 0X20, 0XE3, 0X29, 0X45, 0X4A, 0X28, 0X39, 0XC6, 0X31, 0X65, 0X29, 0X44, 0X63, 0X0B,
+    0X31, 0X45, 0X20, 0XE3, 0X29, 0X24, 0X9C, 0XD2, 0XFF, 0XFF, 0XF7, 0X9E, 0XFF, 0XFF, 0XFF, 0XFF,
+    0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
+    0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
+    0XE7, 0X1C, 0X52, 0X89, 0X21, 0X03, 0X29, 0X45, 0X10, 0X82, 0X31, 0X45, 0X83, 0XEF, 0XA4, 0XF3,
+    0XB5, 0X75, 0XCE, 0X59, 0XFF, 0XDF, 0XF7, 0XBE, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XE6, 0XFB,
+    0XB5, 0X96, 0X73, 0X8E, 0X9C, 0XD3, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XDF, 0XFF, 0XFF, 0XFF, 0XFF,
+    0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XDF, 0XFF, 0XFF,
+    0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XEF, 0X7D, 0XFF, 0XFF, 0XFF, 0XDE, 0XFF, 0XFF, 0XFF, 0XFF,
+    0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XDE, 0XA5, 0X13, 0X21, 0X04, 0X10, 0XA2, 0X20, 0XE3, 0X20, 0XE3,
+    0X29, 0X24, 0XC6, 0X18, 0XFF, 0XFF, 0XFF, 0XDF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
+    0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
+    0XF7, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
+    0XFF, 0XBF, 0XFF, 0XFF, 0XFF, 0XDF, 0XFF, 0XDF, 0XFF, 0XDF, 0XFF, 0XFF, 0XFF, 0XFD, 0XFF, 0XFE,
+    0XEF, 0XFF, 0XCF, 0XFF, 0X8E, 0XBD, 0X3C, 0XD7, 0X13, 0XF5, 0X0C, 0X59, 0X0C, 0X7C, 0X04, 0X1B,
+    0X04, 0X5B, 0X04, 0X5B, 0X04, 0X5A, 0X04, 0X5A, 0X04, 0X5B, 0X04, 0X7B, 0X04, 0X7B, 0X04, 0X7B,
+    0X04, 0X58, 0X04, 0X79, 0X04, 0X7B, 0X04, 0X3C, 0X04, 0X5D, 0X0C, 0X7D, 0X14, 0X5A, 0X13, 0XF6,
+    0X5D, 0X79, 0XAF, 0X3F, 0XEF, 0XFF, 0XF7, 0XFF, 0XFF, 0XDF, 0XFF, 0XDF, 0XFF, 0XDF, 0XFF, 0XBE,
+    0XFF, 0XFD, 0XFF, 0XFD, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
+    0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFE, 0XFF, 0XFE, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
+    0XFF, 0XDE, 0XFF, 0XDF, 0XFF, 0XFF, 0XF7, 0XFF, 0XFF, 0XFF, 0XFF, 0XDF, 0XFF, 0XDF, 0XFF, 0XDF,
+    0XFF, 0XFF, 0XEF, 0XBD, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0X9E, 0XFF, 0XDF, 0XDE, 0X9A, 0X63, 0X0B,
+    0X20, 0X80, 0X72, 0XEA, 0XB5, 0X33, 0XB5, 0X55, 0X73, 0X6E, 0X39, 0XA7, 0X29, 0X66, 0X39, 0XE8,
+    0X4A, 0X29, 0X39, 0X86, 0X18, 0XC3, 0X18, 0XA2, 0X39, 0X86, 0X9C, 0XB2, 0XFF, 0XFF, 0XFF, 0XFF,
+    0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFE, 0XFF, 0XFE, 0XF7, 0XFF, 0XFF, 0XFF, 0XFF, 0XFE, 0XFF, 0XFE,
+    0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFE, 0XFF, 0XFE, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
+    0XEF, 0X7D, 0X8C, 0X51, 0X18, 0XE3, 0X10, 0X82, 0X73, 0X8D, 0XD6, 0X58, 0XCE, 0X17, 0X94, 0X30,
+    0X20, 0XC2, 0X31, 0X44, 0X20, 0XA1, 0X10, 0X20, 0X5A, 0XA9, 0XDE, 0XBA, 0XFF, 0XFF, 0XFF, 0XDE,
+    0XF7, 0XFF, 0XF7, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFE, 0XFF, 0XFE, 0XFF, 0XFF, 0XFF, 0XFF,
+    0XFF, 0XFF, 0XF7, 0XFF, 0XF7, 0XFF, 0XF7, 0XFF, 0XF7, 0XFF, 0XFF, 0XFF, 0XF7, 0XFE, 0XF7, 0XFF,
+    0XF7, 0XFF, 0XF7, 0XFF, 0XFF, 0XFF, 0XD6, 0XBA, 0XA4, 0XF3, 0X73, 0X6E, 0X41, 0XE8, 0X39, 0XC8,
+    0XCE, 0X5A, 0XEF, 0X5E, 0XFF, 0XFF, 0XFF, 0XDF, 0XF7, 0XDF, 0XF7, 0XFF, 0XEF, 0XDF, 0XDF, 0X5D,
+    0XBD, 0XD7, 0X73, 0X6D, 0X39, 0X86, 0X63, 0X0C, 0XCE, 0X59, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
+    0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
+    0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
+    0XFF, 0XDE, 0XFF, 0XDE, 0XFF, 0XFF, 0XEF, 0X5D, 0X9C, 0XD2, 0X39, 0XA6, 0X10, 0X81, 0X21, 0X03,
+    0X10, 0XA1, 0X21, 0X23, 0X6B, 0X4C, 0XD6, 0X99, 0XFF, 0XFF, 0XFF, 0XDE, 0XFF, 0X9E, 0XFF, 0XFF,
+    0XFF, 0XDF, 0XFF, 0XDF, 0XFF, 0XDF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
+    0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
+    0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XDF, 0XFF, 0XBF, 0XFF, 0XBF, 0XFF, 0XDF, 0XFF, 0XFF, 0XFF, 0XDE,
+    0XFF, 0XDD, 0XF7, 0XFF, 0XD7, 0XFF, 0X86, 0XBE, 0X3C, 0XF8, 0X1C, 0X57, 0X0C, 0X59, 0X04, 0X5A,
+    0X04, 0X5B, 0X04, 0X5C, 0X04, 0X5B, 0X04, 0X5B, 0X04, 0X5A, 0X04, 0X5A, 0X04, 0X5A, 0X04, 0X7B,
+    0X04, 0X7B, 0X04, 0X7B, 0X0C, 0XFA, 0X04, 0X79, 0X04, 0X3B, 0X04, 0X7D, 0X04, 0X3D, 0X03, 0XDA,
+    0X24, 0X58, 0X55, 0X18, 0XAF, 0X3E, 0XE7, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XDF, 0XFF, 0XBF,
+    0XFF, 0XBF, 0XFF, 0XDF, 0XFF, 0XFE, 0XFF, 0XFE, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
+    0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XDF, 0XFF, 0XDF, 0XFF, 0XFE, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
+    0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XDF, 0XFF, 0XDF, 0XFF, 0XFF, 0XF7, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
+    0XFF, 0XDF, 0XFF, 0XFF, 0XFF, 0XFF, 0XF7, 0XFE, 0XFF, 0XFF, 0XFF, 0XDF, 0XFF, 0X9E, 0XFF, 0XBF,
+    0XF7, 0X7E, 0XAD, 0X75, 0XA4, 0X90, 0XD5, 0XF5, 0XFF, 0X7C, 0XFF, 0XBD, 0XDE, 0XDB, 0XC6, 0X39,
+    0XC6, 0X7A, 0XDE, 0XFC, 0XEF, 0X5D, 0XB5, 0X76, 0X5A, 0XAA, 0X21, 0X04, 0X20, 0XE3, 0X7B, 0X8E,
+    0XE6, 0XFC, 0XFF, 0XBE, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
+    0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
+    0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XD6, 0XBB, 0X94, 0XB3, 0X8C, 0X71, 0XBD, 0XB6, 0XCE, 0X18,
+    0X8B, 0XEF, 0X31, 0X24, 0X28, 0XE2, 0X10, 0X60, 0X18, 0X81, 0X5A, 0XA9, 0XBD, 0XB5, 0XFF, 0XBE,
+    0XFF, 0XFF, 0XF7, 0X9D, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
+    0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XF7, 0XFF, 0XF7, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
+    0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XF7, 0XFF, 0XFF, 0XFF, 0XF7, 0XBE, 0XF7, 0X9D, 0XD6, 0X79,
+    0X63, 0X2D, 0X18, 0XA3, 0X42, 0X29, 0X63, 0X0D, 0X7B, 0XF0, 0X84, 0X30, 0X84, 0X0F, 0X73, 0XAE,
+    0X4A, 0XCA, 0X31, 0XE7, 0X39, 0XA7, 0X18, 0XC3, 0X29, 0X45, 0X8C, 0X51, 0XEF, 0X5D, 0XFF, 0XFF,
+    0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
+    0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
+    0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XDE, 0XBA, 0X73, 0X8E, 0X29, 0X24, 0X18, 0XA2,
+    0X18, 0XA2, 0X10, 0X61, 0X19, 0X03, 0X63, 0X4B, 0XC6, 0X17, 0XFF, 0XDE, 0XFF, 0XFF, 0XFF, 0XFF,
+    0XFF, 0XBF, 0XFF, 0XDF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
+    0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
+    0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XDF, 0XFF, 0XDF, 0XFF, 0XDF, 0XFF, 0XDF,
+    0XFF, 0XFF, 0XF7, 0XFF, 0XEF, 0XFF, 0XDF, 0XFF, 0X96, 0XFE, 0X45, 0X18, 0X0B, 0XB4, 0X0C, 0X17,
+    0X0C, 0X7A, 0X04, 0X5A, 0X04, 0X3B, 0X04, 0X9C, 0X04, 0X5B, 0X04, 0X5A, 0X04, 0X5A, 0X04, 0X5A,
+    0X04, 0X5A, 0X04, 0X7A, 0X04, 0X7B, 0X04, 0X7A, 0X04, 0XBA, 0X04, 0X79, 0X04, 0X5B, 0X0C, 0X5C,
+    0X0C, 0X1B, 0X1B, 0XF9, 0X5D, 0X5B, 0XA7, 0X1F, 0XE7, 0XFF, 0XF7, 0XFF, 0XFF, 0XFF, 0XFF, 0XDF,
+    0XFF, 0XDF, 0XFF, 0XDF, 0XFF, 0XDF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
+    0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
+    0XFF, 0XFF, 0XFF, 0XDF, 0XFF, 0XDF, 0XFF, 0XBF, 0XFF, 0XBF, 0XFF, 0XDF, 0XF7, 0XFF, 0XF7, 0XFF,
+    0XFF, 0XFF, 0XFF, 0XDF, 0XFF, 0XDF, 0XFF, 0XDF, 0XF7, 0XFF, 0XEF, 0XFE, 0XF7, 0XDE, 0XFF, 0XDF,
+    0XFF, 0X9E, 0XFF, 0XBF, 0XFF, 0XDF, 0XEF, 0X7D, 0XFF, 0X9D, 0XFF, 0XDD, 0XFF, 0XFE, 0XFF, 0XFF,
+    0XFF, 0XDF, 0XF7, 0XBF, 0XF7, 0XDF, 0XFF, 0XFF, 0XF7, 0X9E, 0XFF, 0XFF, 0XF7, 0X9E, 0XAD, 0X34,
+    0X4A, 0X08, 0X52, 0X49, 0XC5, 0XF8, 0XFF, 0XFF, 0XFF, 0XDF, 0XFF, 0XDF, 0XFF, 0XDF, 0XFF, 0XDF,
+    0XFF, 0XDF, 0XFF, 0XDF, 0XFF, 0XDE, 0XFF, 0XDE, 0XFF, 0XDF, 0XFF, 0XDF, 0XFF, 0XDF, 0XFF, 0XDF,
+    0XFF, 0XDF, 0XFF, 0XDF, 0XFF, 0XDF, 0XFF, 0XDF, 0XFF, 0XDF, 0XF7, 0XDF, 0XF7, 0XBF, 0XFF, 0XDF,
+    0XFF, 0XFF, 0XE6, 0XFB, 0X84, 0X0F, 0X29, 0X44, 0X29, 0X04, 0X20, 0XE3, 0X52, 0X49, 0XB5, 0X75,
+    0XF7, 0X9E, 0XFF, 0XDF, 0XFF, 0XBE, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XDF, 0XFF, 0XDF,
+    0XFF, 0XDF, 0XFF, 0XDF, 0XFF, 0XDF, 0XFF, 0XDF, 0XFF, 0XDF, 0XFF, 0XDF, 0XFF, 0XFF, 0XFF, 0XFF,
+    0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFE, 0XFF, 0XFE, 0XFF, 0XDE, 0XFF, 0XFE, 0XFF, 0XDE,
+    0XFF, 0XFE, 0XFF, 0XFF, 0XB5, 0X75, 0X6B, 0X2C, 0X31, 0X65, 0X31, 0X44, 0X28, 0XE3, 0X20, 0XC2,
+    0X20, 0XE2, 0X21, 0X03, 0X21, 0X03, 0X18, 0XE2, 0X18, 0XA2, 0X18, 0XC3, 0X63, 0X0C, 0XD6, 0X9A,
+    0XFF, 0XFF, 0XFF, 0XFF, 0XF7, 0XFF, 0XFF, 0XFF, 0XF7, 0XFF, 0XF7, 0XFF, 0XF7, 0XFF, 0XFF, 0XFF,
+    0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
+    0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XA5, 0X14, 0X4A, 0X49, 0X29, 0X45,
+    0X29, 0X25, 0X31, 0XA7, 0X63, 0X2C, 0X9C, 0XD3, 0XCE, 0X58, 0XEF, 0X9D, 0XFF, 0XFF, 0XFF, 0XFF,
+    0XF7, 0XDF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
+    0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFE, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
+    0XFF, 0XFF, 0XFF, 0XFF, 0XF7, 0XFF, 0XF7, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XDF, 0XFF, 0XDF,
+    0XFF, 0XDF, 0XFF, 0XBF, 0XFF, 0XFF, 0XEF, 0XFF, 0XD7, 0XDF, 0X9E, 0XFE, 0X3C, 0XD7, 0X1C, 0X77,
+    0X0C, 0X17, 0X04, 0X38, 0X04, 0X7A, 0X04, 0X7B, 0X04, 0X7C, 0X04, 0X7C, 0X04, 0X5B, 0X04, 0X5A,
+    0X04, 0X5A, 0X04, 0X5A, 0X04, 0X5A, 0X04, 0X7A, 0X04, 0X7A, 0X04, 0X7A, 0X04, 0X38, 0X04, 0X9A,
+    0X0C, 0X9B, 0X0B, 0XFA, 0X1C, 0X19, 0X5D, 0X5C, 0XAF, 0X1F, 0XE7, 0XFF, 0XEF, 0XFF, 0XFF, 0XFF,
+    0XFF, 0XDE, 0XFF, 0XDF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
+    0XFF, 0XDF, 0XFF, 0XDF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
+    0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XDF, 0XFF, 0XDF, 0XFF, 0XFF, 0XFF, 0XDF, 0XFF, 0XFF,
+    0XF7, 0XFF, 0XF7, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XF7, 0XFF, 0XF7, 0XFF,
+    0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XDF, 0XFF, 0XDF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
+    0XFF, 0XDE, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
+    0XFF, 0XFF, 0XFF, 0XFF, 0XE6, 0XFB, 0XCE, 0X79, 0XEF, 0X5D, 0XEF, 0X7E, 0XFF, 0XFF, 0XFF, 0XFF,
+    0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
+    0XFF, 0XFF, 0XFF, 0XDF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
+    0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XE7, 0X3C, 0XC6, 0X38, 0XA5, 0X14, 0XB5, 0XB6,
+    0XDE, 0XDB, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
+    0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XDF, 0XFF, 0XDF, 0XFF, 0XDF, 0XFF, 0XDF, 0XFF, 0XFF,
+    0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XDE, 0XFF, 0XFE,
+    0XFF, 0XFE, 0XFF, 0XFE, 0XFF, 0XDE, 0XFF, 0XFF, 0XFF, 0XDE, 0XF7, 0X9D, 0XE6, 0XFB, 0XDE, 0XDA,
+    0XDE, 0XDA, 0XDE, 0XB9, 0XD6, 0X37, 0XB5, 0X33, 0X8C, 0X0E, 0X73, 0X6C, 0X52, 0X8A, 0X62, 0XEC,
+    0XA5, 0X14, 0XEF, 0X9E, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
+    0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
+    0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XCE, 0X79,
+    0XA5, 0X14, 0XA5, 0X35, 0XCE, 0X39, 0XEF, 0X3D, 0XFF, 0XBF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
+    0XFF, 0XDE, 0XFF, 0XDE, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XF7, 0XDF, 0XFF, 0XFF, 0XFF, 0XFF,
+    0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
+    0XFF, 0XFE, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XF7, 0XFF, 0XF7, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
+    0XFF, 0XBE, 0XFF, 0XDF, 0XFF, 0XDF, 0XFF, 0XDF, 0XEF, 0XFF, 0XD7, 0XFF, 0X8E, 0XBE, 0X45, 0X19,
+    0X0B, 0XF6, 0X0C, 0X58, 0X14, 0X9A, 0X04, 0X9B, 0X04, 0X7B, 0X04, 0X7C, 0X04, 0X7C, 0X04, 0X7C,
+    0X04, 0X7B, 0X04, 0X5A, 0X04, 0X5A, 0X04, 0X5A, 0X04, 0X7A, 0X04, 0X7A, 0X04, 0X7A, 0X04, 0X7A,
+    0X04, 0X7A, 0X04, 0X9A, 0X0C, 0X39, 0X1B, 0XF8, 0X55, 0X1B, 0XAE, 0XFF, 0XE7, 0XFF, 0XF7, 0XFF,
+    0XF7, 0XFE, 0XFF, 0XFE, 0XFF, 0XFF, 0XFF, 0XDE, 0XFF, 0XFF, 0XFF, 0XFF, 0XF7, 0XFD, 0XF7, 0XFC,
+    0XFF, 0XFE, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFD, 0XFF, 0XFD, 0XFF, 0XFE, 0XFF, 0XFE,
+    0XFF, 0XFD, 0XFF, 0XFD, 0XFF, 0XFD, 0XFF, 0XFE, 0XFF, 0XDF, 0XFF, 0XDF, 0XFF, 0XFF, 0XFF, 0XFF,
+    0XFF, 0XDF, 0XFF, 0XFF, 0XEF, 0XFF, 0XEF, 0XFF, 0XF7, 0XFF, 0XF7, 0XFF, 0XF7, 0XFF, 0XF7, 0XFF,
+    0XE7, 0XDF, 0XEF, 0XFF, 0XF7, 0XFF, 0XF7, 0XFF, 0XFF, 0XFF, 0XFF, 0XDF, 0XEF, 0XDF, 0XF7, 0XFF,
+    0XF7, 0XFF, 0XF7, 0XFF, 0XF7, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
+    0XF7, 0XDE, 0XFF, 0XFF, 0XFF, 0XDF, 0XFF, 0XFF, 0XFF, 0XFF, 0XF7, 0XBF, 0XFF, 0XFF, 0XFF, 0XFF,
+    0XFF, 0XDF, 0XFF, 0XDF, 0XFF, 0XDF, 0XFF, 0XDF, 0XFF, 0XDF, 0XFF, 0XDF, 0XFF, 0XDF, 0XFF, 0XDF,
+    0XFF, 0XFF, 0XFF, 0XDF, 0XFF, 0XFF, 0XFF, 0XDF, 0XFF, 0XDF, 0XFF, 0XDF, 0XFF, 0XDF, 0XFF, 0XFF,
+    0XF7, 0XDF, 0XF7, 0XFF, 0XF7, 0XFF, 0XEF, 0XDF, 0XF7, 0XDF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
+    0XF7, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XF7, 0XFF, 0XF7, 0XFF, 0XF7, 0XFF, 0XF7, 0XFF, 0XEF, 0XDF,
+    0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
+    0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
+    0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XDE, 0XFF, 0XFF, 0XFF, 0XFF, 0XF7, 0XDF, 0XFF, 0XFF, 0XFF, 0XFF,
+    0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XDE, 0XFF, 0XDE, 0XFF, 0XDE, 0XFF, 0XBE, 0XFF, 0XDE, 0XFF, 0XFE,
+    0XFF, 0XBE, 0XF7, 0X9E, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XF7, 0XBE, 0XFF, 0XDE, 0XF7, 0XBD,
+    0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
+    0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
+    0XEF, 0X7D, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XBE, 0XFF, 0XBE, 0XFF, 0XFF, 0XFF, 0XFF, 0XF7, 0X7D,
+    0XFF, 0XBE, 0XFF, 0XBD, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
+    0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XDF, 0XFF, 0XDE, 0XFF, 0XDE, 0XFF, 0XDE,
+    0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XDE, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XF7, 0XFF, 0XFF, 0XFF,
+    0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XDF, 0XFF, 0XBE, 0XFF, 0XFF, 0XF7, 0XFF, 0XDF, 0XFF, 0X96, 0XDF,
+    0X45, 0X1A, 0X14, 0X17, 0X0C, 0X59, 0X04, 0X39, 0X04, 0X5A, 0X04, 0X9B, 0X04, 0X7C, 0X04, 0X5B,
+    0X04, 0X5B, 0X04, 0X7C, 0X04, 0X7B, 0X04, 0X7A, 0X04, 0X7A, 0X04, 0X7A, 0X04, 0X7A, 0X04, 0X7A,
+    0X04, 0X7A, 0X04, 0X7A, 0X04, 0XBA, 0X04, 0X38, 0X13, 0XF7, 0X4C, 0XFB, 0XA6, 0XBF, 0XE7, 0XFF,
+    0XFF, 0XFF, 0XFF, 0XFE, 0XFF, 0XDD, 0XFF, 0XFE, 0XFF, 0XFF, 0XFF, 0XDE, 0XFF, 0XFE, 0XFF, 0XFD,
+    0XF7, 0XFA, 0XF7, 0XFA, 0XFF, 0XFB, 0XFF, 0XFB, 0XFF, 0XFD, 0XFF, 0XFC, 0XFF, 0XFA, 0XFF, 0XF9,
+    0XFF, 0XFA, 0XFF, 0XFA, 0XFF, 0XFA, 0XFF, 0XFA, 0XFF, 0XF9, 0XFF, 0XFB, 0XFF, 0XFF, 0XFF, 0XDF,
+    0XFF, 0XDF, 0XFF, 0XDF, 0XFF, 0XFF, 0XF7, 0XFF, 0XEF, 0XFF, 0XEF, 0XFF, 0XF7, 0XFF, 0XF7, 0XFF,
+    0XF7, 0XFF, 0XF7, 0XFF, 0XE7, 0XFF, 0XEF, 0XFF, 0XEF, 0XFF, 0XEF, 0XFF, 0XF7, 0XFF, 0XF7, 0XFF,
+    0XF7, 0XFF, 0XEF, 0XFF, 0XEF, 0XFF, 0XEF, 0XFF, 0XF7, 0XFF, 0XF7, 0XFF, 0XF7, 0XFF, 0XEF, 0XFF,
+    0XF7, 0XDF, 0XF7, 0XDF, 0XFF, 0XFF, 0XFF, 0XFF, 0XEF, 0XBF, 0XFF, 0XFF, 0XF7, 0XFF, 0XF7, 0XFF,
+    0XF7, 0XFF, 0XF7, 0XFF, 0XF7, 0XFF, 0XF7, 0XFF, 0XF7, 0XFF, 0XF7, 0XFF, 0XF7, 0XFF, 0XF7, 0XFF,
+    0XF7, 0XFF, 0XF7, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XF7, 0XFF, 0XF7, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
+    0XFF, 0XFF, 0XF7, 0XFF, 0XEF, 0XDF, 0XF7, 0XFF, 0XF7, 0XFF, 0XF7, 0XFF, 0XF7, 0XFF, 0XF7, 0XFF,
+    0XF7, 0XFF, 0XEF, 0XDF, 0XEF, 0XFF, 0XEF, 0XFF, 0XEF, 0XFF, 0XEF, 0XDF, 0XEF, 0XFF, 0XF7, 0XFF,
+    0XEF, 0XFF, 0XF7, 0XFF, 0XF7, 0XFF, 0XF7, 0XFF, 0XF7, 0XFF, 0XF7, 0XFF, 0XF7, 0XFF, 0XF7, 0XFF,
+    0XF7, 0XFF, 0XF7, 0XFF, 0XF7, 0XFF, 0XF7, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XF7, 0XFF, 0XF7, 0XFF,
+    0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XEF, 0XDF, 0XF7, 0XFF, 0XF7, 0XFF, 0XEF, 0XFF,
+    0XF7, 0XFF, 0XF7, 0XFF, 0XEF, 0XFF, 0XF7, 0XFF, 0XF7, 0XFF, 0XF7, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
+    0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XF7, 0XFF, 0XF7, 0XFF,
+    0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
+    0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XF7, 0XFF, 0XF7, 0XFF, 0XF7, 0XFF, 0XF7, 0XFF, 0XF7, 0XFF,
+    0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XF7, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XF7, 0XDF,
+    0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XF7, 0XFF, 0XEF, 0XDF, 0XEF, 0XDF,
+    0XEF, 0XFF, 0XF7, 0XFF, 0XF7, 0XFF, 0XF7, 0XFF, 0XF7, 0XFF, 0XF7, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
+    0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XDF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
+    0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XF7, 0XFF, 0XDF, 0XFF,
+    0X9E, 0XFF, 0X4D, 0X3A, 0X14, 0X38, 0X04, 0X39, 0X0C, 0X9B, 0X04, 0X5A, 0X04, 0X3A, 0X04, 0X7B,
+    0X04, 0X7C, 0X04, 0X5B, 0X04, 0X5B, 0X04, 0X7B, 0X04, 0X7B, 0X04, 0X7A, 0X04, 0X7A, 0X04, 0X7A,
+    0X04, 0X7A, 0X04, 0X7A, 0X04, 0X7A, 0X04, 0X79, 0X0C, 0X58, 0X14, 0X37, 0X44, 0XFA, 0X9E, 0XBF,
+    0XE7, 0XFF, 0XF7, 0XFF, 0XFF, 0XFF, 0XFF, 0XFE, 0XFF, 0XDD, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
+    0XF7, 0XFD, 0XE7, 0X98, 0XDF, 0X73, 0XE7, 0XB3, 0XE7, 0X92, 0XE7, 0X73, 0XE7, 0X74, 0XE7, 0X73,
+    0XE7, 0X91, 0XE7, 0X90, 0XE7, 0X91, 0XE7, 0X91, 0XE7, 0XB2, 0XE7, 0X91, 0XDF, 0X71, 0XEF, 0XB5,
+    0XFF, 0XFB, 0XFF, 0XFF, 0XF7, 0XBF, 0XE7, 0X5E, 0XC6, 0X9C, 0XBE, 0XBC, 0XBE, 0XBC, 0XBE, 0XBC,
+    0XBE, 0XBC, 0XBE, 0XBC, 0XC6, 0X9C, 0XBE, 0XBC, 0XB6, 0XBC, 0XBE, 0XDC, 0XBE, 0XDD, 0XBE, 0XBC,
+    0XBE, 0X9C, 0XC6, 0XBC, 0XC6, 0XDC, 0XBE, 0XDC, 0XAE, 0XBC, 0XAE, 0XDD, 0XBE, 0XBD, 0XBE, 0XBC,
+    0XBE, 0XBC, 0XBE, 0XDB, 0XCE, 0XBC, 0XD6, 0XFC, 0XBE, 0X7A, 0XC6, 0XFC, 0XC6, 0XBB, 0XCE, 0XDC,
+    0XC6, 0XFD, 0XBE, 0X9B, 0XC6, 0X9B, 0XBE, 0XBC, 0XBE, 0XDC, 0XB6, 0XDD, 0XB6, 0XDD, 0XB6, 0XDD,
+    0XBE, 0XDC, 0XBE, 0XDC, 0XB6, 0XDD, 0XB6, 0XDD, 0XBE, 0XBB, 0XBE, 0XBB, 0XBE, 0XDC, 0XBE, 0XDC,
+    0XBE, 0XBB, 0XBE, 0XBB, 0XBE, 0XBB, 0XBE, 0XBC, 0XCF, 0X1D, 0XC6, 0XDC, 0XBE, 0X9C, 0XBE, 0X7B,
+    0XBE, 0X7B, 0XBE, 0X9B, 0XC6, 0XDC, 0XCF, 0X1D, 0XC6, 0XDC, 0XC6, 0XDD, 0XC6, 0XFD, 0XC6, 0XFD,
+    0XBE, 0XDD, 0XBE, 0XBD, 0XBE, 0XBD, 0XBE, 0XDD, 0XBE, 0XDC, 0XBE, 0XDC, 0XB6, 0XFC, 0XB6, 0XFC,
+    0XBE, 0XDD, 0XBE, 0XDD, 0XB6, 0XDD, 0XB6, 0XFD, 0XB6, 0XDC, 0XBE, 0XDC, 0XC6, 0XBB, 0XC6, 0XBB,
+    0XBE, 0XDB, 0XBE, 0XDB, 0XC6, 0XBB, 0XC6, 0XBB, 0XC6, 0X9B, 0XCE, 0XDD, 0XB6, 0X9D, 0XBE, 0XFE,
+    0XB6, 0XDE, 0XA6, 0X7C, 0XB6, 0XDD, 0XB6, 0XDC, 0XB6, 0XBC, 0XBE, 0XDC, 0XBE, 0XFD, 0XBE, 0XDD,
+    0XBE, 0XBC, 0XC6, 0X9B, 0XCE, 0X7A, 0XC6, 0X5A, 0XBE, 0X9D, 0XBE, 0XDE, 0XB6, 0XBD, 0XB6, 0X9D,
+    0XB6, 0XBE, 0XB6, 0XDD, 0XB6, 0X9D, 0XB6, 0XBD, 0XBE, 0XDD, 0XBE, 0XDD, 0XBE, 0XDD, 0XBE, 0XBD,
+    0XBE, 0XBD, 0XBE, 0XBD, 0XBE, 0XBD, 0XBE, 0XBD, 0XB6, 0XDD, 0XB6, 0XDD, 0XB6, 0XDE, 0XB6, 0XDD,
+    0XB6, 0XDE, 0XB6, 0XDD, 0XBE, 0XDE, 0XBE, 0XDD, 0XB6, 0X9D, 0XB6, 0X9D, 0XB6, 0X9D, 0XB6, 0XBD,
+    0XBE, 0XDE, 0XBE, 0XFE, 0XB6, 0XBD, 0XAE, 0X5C, 0XB6, 0X5C, 0XBE, 0X9D, 0XBE, 0XBD, 0XBE, 0XDE,
+    0XBF, 0X1E, 0XBF, 0X3F, 0XB7, 0X1E, 0XA6, 0XBD, 0XAE, 0XFE, 0XAE, 0XFE, 0XB6, 0XDE, 0XB6, 0XDD,
+    0XBE, 0XDD, 0XBE, 0XBE, 0XBE, 0XBD, 0XC6, 0XBC, 0XF7, 0XDF, 0XFF, 0XDF, 0XFF, 0XFF, 0XFF, 0XFF,
+    0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XF7, 0XFF, 0XEF, 0XFF,
+    0XDF, 0XFF, 0XA7, 0X1F, 0X55, 0X3A, 0X14, 0X17, 0X03, 0XF8, 0X0C, 0X7B, 0X04, 0X5A, 0X04, 0X7B,
+    0X04, 0X7B, 0X04, 0X5B, 0X04, 0X5B, 0X04, 0X7B, 0X04, 0X7B, 0X04, 0X5B, 0X04, 0X7B, 0X04, 0X7B,
+    0X04, 0X7A, 0X04, 0X7A, 0X04, 0X7A, 0X04, 0X7A, 0X04, 0X7A, 0X04, 0X59, 0X0B, 0XF5, 0X45, 0X19,
+    0X96, 0XBF, 0XDF, 0XFF, 0XF7, 0XFF, 0XF7, 0XBF, 0XFF, 0X9D, 0XFF, 0XFE, 0XFF, 0XFF, 0XFF, 0XFF,
+    0XFF, 0XFF, 0XFF, 0XFF, 0XF7, 0XFB, 0XCE, 0XD2, 0XB6, 0X0B, 0XBE, 0X49, 0XB6, 0X48, 0XB6, 0X49,
+    0XB6, 0X4A, 0XB6, 0X49, 0XB6, 0X67, 0XB6, 0X67, 0XB6, 0X67, 0XB6, 0X68, 0XB6, 0X68, 0XAE, 0X07,
+    0XB6, 0X28, 0XCE, 0XEF, 0XF7, 0XD8, 0XFF, 0XFD, 0XF7, 0XDE, 0XDF, 0X3D, 0XB6, 0X7B, 0XAE, 0X9C,
+    0XAE, 0X9B, 0XB6, 0X9B, 0XB6, 0X7B, 0XB6, 0X7B, 0XB6, 0X7B, 0XB6, 0X7B, 0XB6, 0XBC, 0XAE, 0X7C,
+    0XAE, 0X9C, 0XB6, 0XDD, 0XB6, 0X9C, 0XAE, 0X7B, 0XB6, 0X7B, 0XAE, 0X9C, 0XAE, 0XDE, 0XA6, 0XDF,
+    0XAE, 0XBE, 0XAE, 0X9D, 0XAE, 0XBC, 0XAE, 0X9B, 0XBE, 0X5B, 0XBE, 0X7B, 0XB6, 0XBB, 0XBE, 0XFC,
+    0XB6, 0X5B, 0XB6, 0X5B, 0XB6, 0XBC, 0XAE, 0X7B, 0XBE, 0X9C, 0XB6, 0X9C, 0XAE, 0XBC, 0XA6, 0XBD,
+    0XA6, 0XDD, 0XA6, 0XBD, 0XAE, 0XBC, 0XAE, 0XBC, 0XA6, 0XBD, 0XA6, 0XBD, 0XAE, 0X9B, 0XB6, 0X9B,
+    0XA6, 0XBC, 0XA6, 0XBC, 0XAE, 0X9B, 0XB6, 0X9B, 0XAE, 0X9B, 0XAE, 0X9B, 0XB6, 0X7B, 0XB6, 0X7B,
+    0XBE, 0X9C, 0XBE, 0XBC, 0XBE, 0XBC, 0XB6, 0X9B, 0XB6, 0X5B, 0XB6, 0X7B, 0XB6, 0X7C, 0XB6, 0X9C,
+    0XB6, 0X9C, 0XAE, 0X7C, 0XAE, 0X7C, 0XB6, 0XBD, 0XAE, 0X9D, 0XAE, 0X5B, 0XB6, 0X9B, 0XAE, 0XBB,
+    0XA6, 0XDC, 0XA6, 0XDC, 0XA6, 0XBD, 0XAE, 0XBD, 0XA6, 0XDD, 0XA6, 0XDC, 0XA6, 0XDC, 0XAE, 0XBB,
+    0XBE, 0X9B, 0XBE, 0X9A, 0XAE, 0XBA, 0XAE, 0XBA, 0XB6, 0X9A, 0XBE, 0X7B, 0XB6, 0X3B, 0XC6, 0XDE,
+    0XAE, 0X9E, 0XA6, 0XBF, 0XA6, 0XBF, 0X9E, 0X9D, 0XB6, 0XFE, 0XA6, 0X7B, 0XAE, 0X9B, 0XAE, 0XBC,
+    0XAE, 0XBD, 0XA6, 0X9D, 0XAE, 0X7D, 0XBE, 0X9C, 0XC6, 0X7B, 0XC6, 0X5B, 0XB6, 0X7C, 0XB6, 0XBE,
+    0XAE, 0X7D, 0XAE, 0X9D, 0XBE, 0XDE, 0XAE, 0X9D, 0XA6, 0X5C, 0XBE, 0XDE, 0XB6, 0X9D, 0XB6, 0X9D,
+    0XB6, 0X9C, 0XB6, 0X9C, 0XB6, 0X9C, 0XB6, 0X9C, 0XB6, 0X9C, 0XB6, 0X9C, 0XAE, 0X9D, 0XAE, 0X9D,
+    0XAE, 0X9D, 0XAE, 0X9D, 0XAE, 0X9D, 0XAE, 0X9D, 0XAE, 0X9D, 0XAE, 0X9D, 0XB6, 0XBD, 0XB6, 0XDE,
+    0XB6, 0XBE, 0XB6, 0X9D, 0XAE, 0X7C, 0XAE, 0X7D, 0XB6, 0XBD, 0XBE, 0XBE, 0XBE, 0X9D, 0XB6, 0X7C,
+    0XB6, 0X7D, 0XB6, 0X9D, 0XAE, 0X9D, 0XA6, 0X7C, 0XA6, 0X9C, 0XAE, 0XFD, 0XA6, 0XBD, 0XA6, 0XBD,
+    0XAE, 0XBD, 0XAE, 0XBD, 0XB6, 0X9D, 0XB6, 0X9D, 0XBE, 0X9D, 0XBE, 0X9C, 0XF7, 0XBF, 0XFF, 0XDF,
+    0XF7, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XDF, 0XFF, 0XDE, 0XFF, 0XFE, 0XFF, 0XFF, 0XF7, 0XFF,
+    0XEF, 0XFF, 0XD7, 0XFF, 0X9E, 0XFF, 0X4D, 0X3A, 0X1C, 0X37, 0X0C, 0X38, 0X0C, 0X5A, 0X04, 0X5A,
+    0X04, 0X5A, 0X04, 0X7A, 0X04, 0X7A, 0X04, 0X7A, 0X04, 0X7A, 0X04, 0X7B, 0X04, 0X7B, 0X04, 0X7B,
+    0X04, 0X7B, 0X04, 0X5A, 0X04, 0X5A, 0X04, 0X7B, 0X04, 0X9B, 0X04, 0X7A, 0X04, 0X7A, 0X14, 0X58,
+    0X3C, 0XB7, 0X96, 0X9D, 0XD7, 0XFF, 0XEF, 0XFF, 0XF7, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFE,
+    0XFF, 0XFF, 0XFF, 0XFF, 0XF7, 0XFF, 0XFF, 0XFF, 0XF7, 0XF9, 0XCE, 0XAF, 0XB5, 0XC6, 0XB6, 0X03,
+    0XB6, 0X23, 0XAE, 0X43, 0XAE, 0X24, 0XAE, 0X24, 0XAE, 0X42, 0XAE, 0X41, 0XAE, 0X42, 0XAE, 0X43,
+    0XAE, 0X23, 0XAE, 0X24, 0XAE, 0X25, 0XC6, 0XAC, 0XEF, 0XB7, 0XFF, 0XFD, 0XFF, 0XFF, 0XF7, 0XFF,
+    0XE7, 0XFF, 0XB6, 0XFE, 0XE7, 0XFF, 0XD7, 0XBF, 0XE7, 0XFF, 0XE7, 0XFF, 0XE7, 0XFF, 0XD7, 0XBF,
+    0XC7, 0X3F, 0XCF, 0X9F, 0XBF, 0X3F, 0XBF, 0X1F, 0XC7, 0X7F, 0XE7, 0XFF, 0XE7, 0XFF, 0XD7, 0XFF,
+    0XBF, 0XBF, 0XA7, 0X3F, 0XBF, 0X7F, 0XC7, 0X9F, 0XBF, 0X9F, 0XCF, 0XDF, 0XEF, 0XFF, 0XE7, 0XFF,
+    0XB7, 0X3E, 0XCF, 0XFF, 0XE7, 0XFF, 0XE7, 0XFF, 0XBF, 0X3F, 0XC7, 0X5F, 0XE7, 0XFF, 0XC7, 0X3F,
+    0XB7, 0X3E, 0XB7, 0X5F, 0XAF, 0X3F, 0XBF, 0XBF, 0XCF, 0XDF, 0XDF, 0XFF, 0XB7, 0X9F, 0XC7, 0XDF,
+    0XD7, 0XFF, 0XDF, 0XFF, 0XD7, 0XFF, 0XB7, 0X5F, 0XDF, 0XFF, 0XD7, 0XFF, 0XD7, 0XFF, 0XBF, 0X5F,
+    0XE7, 0XFF, 0XD7, 0X9F, 0XDF, 0XDF, 0XD7, 0X7F, 0XDF, 0XDF, 0XDF, 0XFF, 0XE7, 0XFF, 0XD7, 0XDF,
+    0XCF, 0X7F, 0XD7, 0XBF, 0XD7, 0XBF, 0XD7, 0XFF, 0XC7, 0X5F, 0XC7, 0X7F, 0XB6, 0XDE, 0XD7, 0XBF,
+    0XD7, 0X9F, 0XE7, 0XFF, 0XB7, 0XBF, 0XAF, 0X7F, 0XC7, 0X9F, 0XB7, 0X3F, 0XAF, 0X3F, 0XBF, 0XFF,
+    0XC7, 0XFF, 0XE7, 0XFF, 0XEF, 0XFF, 0XE7, 0XDF, 0XE7, 0XFF, 0XDF, 0XFF, 0XE7, 0XFF, 0XEF, 0XFF,
+    0XDF, 0X9F, 0XEF, 0XFF, 0XDF, 0XFF, 0XAF, 0X3F, 0XAF, 0X5F, 0XBF, 0XBF, 0XB7, 0X1E, 0XD7, 0XFF,
+    0XD7, 0XDF, 0XDF, 0XFF, 0XB7, 0X5F, 0XCF, 0XFF, 0XDF, 0XFF, 0XDF, 0XDF, 0XEF, 0XDF, 0XF7, 0XDF,
+    0XF7, 0XFF, 0XEF, 0XDF, 0XEF, 0XDF, 0XF7, 0XFF, 0XF7, 0XFF, 0XE7, 0XBF, 0XEF, 0XBF, 0XF7, 0XFF,
+    0XEF, 0XBF, 0XF7, 0XFF, 0XEF, 0XBF, 0XEF, 0XDF, 0XF7, 0XDF, 0XEF, 0XBF, 0XF7, 0XDF, 0XF7, 0XFF,
+    0XE7, 0XBF, 0XF7, 0XFF, 0XEF, 0XDF, 0XEF, 0XDF, 0XE7, 0XBF, 0XEF, 0XDF, 0XF7, 0XFF, 0XE7, 0XBF,
+    0XF7, 0XFF, 0XEF, 0XFF, 0XE7, 0X7E, 0XF7, 0XFF, 0XF7, 0XFF, 0XEF, 0XDF, 0XFF, 0XFF, 0XEF, 0XBF,
+    0XF7, 0XBF, 0XFF, 0XFF, 0XEF, 0XBF, 0XE7, 0X7E, 0XEF, 0XFF, 0XEF, 0XFF, 0XE7, 0XFF, 0XE7, 0XFF,
+    0XEF, 0XFF, 0XDF, 0XDF, 0XE7, 0XFF, 0XF7, 0XFF, 0XF7, 0XFF, 0XEF, 0X9F, 0XF7, 0XBF, 0XFF, 0XFF,
+    0XFF, 0XFF, 0XFF, 0XFF, 0XF7, 0XFF, 0XF7, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XDE, 0XFF, 0XBD,
+    0XFF, 0XDE, 0XF7, 0XFF, 0XDF, 0XFF, 0X97, 0X1F, 0X4D, 0X7B, 0X1C, 0X79, 0X0C, 0X39, 0X04, 0X5A,
+    0X04, 0X5A, 0X04, 0X5A, 0X04, 0X5A, 0X04, 0X5A, 0X04, 0X5A, 0X04, 0X5A, 0X04, 0X7A, 0X04, 0X7A,
+    0X04, 0X7A, 0X04, 0X7B, 0X04, 0X9C, 0X04, 0X7B, 0X04, 0X7B, 0X04, 0X7A, 0X04, 0X39, 0X04, 0X18,
+    0X14, 0X59, 0X34, 0XB9, 0X9E, 0XDE, 0XD7, 0XBF, 0XEF, 0XFF, 0XF7, 0XFF, 0XF7, 0XDF, 0XFF, 0XFF,
+    0XFF, 0XFF, 0XFF, 0XDF, 0XFF, 0XFF, 0XF7, 0XFF, 0XF7, 0XFF, 0XFF, 0XFE, 0XF7, 0XF8, 0XD6, 0XCD,
+    0XBD, 0XE3, 0XBE, 0X20, 0XB6, 0X40, 0XAE, 0X60, 0XAE, 0X42, 0XAE, 0X42, 0XAE, 0X60, 0XAE, 0X60,
+    0XAE, 0X60, 0XAE, 0X41, 0XAE, 0X41, 0XAE, 0X42, 0XAE, 0X24, 0XC6, 0XCB, 0XEF, 0XB7, 0XFF, 0XFD,
+    0XFF, 0XFF, 0XF7, 0XFF, 0XAE, 0XBD, 0X85, 0XB9, 0XD7, 0XDF, 0XE7, 0XFF, 0XEF, 0XFF, 0XEF, 0XFF,
+    0XD7, 0XBF, 0XA6, 0X3A, 0X53, 0XB1, 0X6C, 0X95, 0X5C, 0X54, 0X64, 0X75, 0X75, 0X16, 0XCF, 0XBF,
+    0XE7, 0XFF, 0XCF, 0X7F, 0X75, 0X9A, 0X4C, 0X96, 0X4B, 0XF4, 0X54, 0X34, 0X5C, 0XB4, 0XAF, 0X1D,
+    0XE7, 0XFF, 0XCF, 0X3F, 0X7D, 0X98, 0X9E, 0XFE, 0XCF, 0XBF, 0XBF, 0X1F, 0X7D, 0X58, 0XB7, 0X1E,
+    0XC7, 0X1E, 0XAE, 0X5B, 0X6C, 0X94, 0X5C, 0X94, 0X5C, 0XB6, 0X5C, 0X95, 0XB6, 0XDC, 0XCF, 0X9F,
+    0X85, 0XFB, 0X85, 0XDA, 0XE7, 0XFF, 0XE7, 0XFF, 0XB7, 0X5F, 0X75, 0X58, 0XBF, 0X3E, 0XE7, 0XFF,
+    0XCF, 0XBF, 0X6C, 0XB5, 0XBF, 0X1E, 0XE7, 0XFF, 0XD7, 0XBF, 0X9D, 0XFA, 0XAE, 0X9C, 0XDF, 0XFF,
+    0XDF, 0XFF, 0XB6, 0XFE, 0X85, 0X58, 0XCF, 0XBF, 0XE7, 0XFF, 0XA6, 0X5C, 0X5C, 0X33, 0X64, 0X75,
+    0X5C, 0X34, 0X6C, 0X74, 0XC7, 0X1E, 0XE7, 0XFF, 0X96, 0X9B, 0X54, 0X94, 0X5C, 0X75, 0X64, 0X96,
+    0X54, 0X95, 0X54, 0X94, 0XB7, 0X7F, 0XE7, 0XFF, 0XF7, 0XDF, 0XF7, 0XDF, 0XEF, 0XFF, 0XE7, 0XFF,
+    0XEF, 0XFF, 0XF7, 0XFF, 0XF7, 0XFF, 0XEF, 0XFF, 0XCF, 0XBF, 0X64, 0XD8, 0X4C, 0X35, 0X54, 0X75,
+    0X64, 0X73, 0X8D, 0X97, 0XE7, 0XFF, 0XCF, 0XBF, 0X7D, 0X57, 0XA6, 0XBE, 0XD7, 0XFF, 0XE7, 0XFF,
+    0XFF, 0XFF, 0XFF, 0XFF, 0XF7, 0XDF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
+    0XFF, 0XFF, 0XFF, 0XDF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
+    0XF7, 0XDF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
+    0XFF, 0XFF, 0XFF, 0XFF, 0XF7, 0XBE, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XDF, 0XEF, 0X7D,
+    0XFF, 0XFF, 0XFF, 0XFF, 0XF7, 0X9E, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XF7, 0XFF, 0XEF, 0XDE,
+    0XEF, 0XFE, 0XF7, 0XFF, 0XEF, 0XFE, 0XF7, 0XFF, 0XEF, 0XBE, 0XEF, 0XDE, 0XFF, 0XFF, 0XFF, 0XFF,
+    0XFF, 0XDF, 0XFF, 0XDF, 0XFF, 0XFF, 0XFF, 0XFF, 0XF7, 0XFF, 0XF7, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
+    0XFF, 0XDE, 0XFF, 0XDF, 0XF7, 0XFF, 0XE7, 0XFF, 0X9F, 0X1F, 0X4D, 0X7B, 0X0C, 0X17, 0X04, 0X18,
+    0X04, 0X7A, 0X04, 0X5A, 0X04, 0X5A, 0X0C, 0X7A, 0X04, 0X5A, 0X04, 0X5A, 0X04, 0X5A, 0X04, 0X5A,
+    0X04, 0X5A, 0X04, 0X7A, 0X04, 0X7A, 0X04, 0X7B, 0X04, 0X5A, 0X04, 0X5A, 0X04, 0X7B, 0X0C, 0X7A,
+    0X03, 0XF7, 0X0C, 0X17, 0X3D, 0X3B, 0X7E, 0X5E, 0XDF, 0XFF, 0XF7, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
+    0XFF, 0XDF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XF7, 0XFF, 0XF7, 0XFF, 0XF7, 0XFF, 0XFF, 0XFE,
+    0XF7, 0XF7, 0XD6, 0XCC, 0XBE, 0X02, 0XBE, 0X40, 0XB6, 0X60, 0XAE, 0X60, 0XAE, 0X41, 0XAE, 0X41,
+    0XAE, 0X60, 0XAE, 0X60, 0XAE, 0X60, 0XAE, 0X61, 0XAE, 0X41, 0XAE, 0X42, 0XAE, 0X24, 0XC6, 0XCB,
+    0XEF, 0XB7, 0XFF, 0XFE, 0XFF, 0XFF, 0XF7, 0XFF, 0X9E, 0X5C, 0X6C, 0XF6, 0XCF, 0X7F, 0XE7, 0XFF,
+    0XEF, 0XFF, 0XEF, 0XFF, 0XD7, 0XBF, 0X8D, 0X77, 0X8D, 0X99, 0XCF, 0X7F, 0XBF, 0X5F, 0X96, 0X5C,
+    0X5C, 0X94, 0XC7, 0X9F, 0XE7, 0XFF, 0XC7, 0X3F, 0X65, 0X18, 0X8E, 0X7E, 0XC7, 0XBF, 0XBF, 0X3F,
+    0X5C, 0XD5, 0XA6, 0XBC, 0XEF, 0XFF, 0XD7, 0X7F, 0X6D, 0X58, 0X96, 0XDE, 0XDF, 0XFF, 0X95, 0XFC,
+    0X64, 0XD6, 0XCF, 0XFF, 0XDF, 0XFF, 0XDF, 0X7F, 0XCF, 0X5F, 0XBE, 0XFF, 0X8D, 0XDB, 0X6C, 0XB6,
+    0XDF, 0XBF, 0XEF, 0XFF, 0X85, 0XDB, 0X85, 0X9A, 0XDF, 0XBF, 0XEF, 0XFF, 0XB7, 0X3F, 0X64, 0X96,
+    0XB6, 0X9C, 0XEF, 0XFF, 0XD7, 0XDF, 0X5C, 0X34, 0XAE, 0X9C, 0XE7, 0XFF, 0XCF, 0X9F, 0X74, 0XD5,
+    0X85, 0X58, 0XD7, 0XFF, 0XDF, 0XFF, 0XA6, 0X9D, 0X64, 0X74, 0XCF, 0XDF, 0XDF, 0XFF, 0X9E, 0X3B,
+    0X74, 0XD6, 0XBF, 0X1F, 0XCF, 0XDF, 0XD7, 0XBF, 0XEF, 0XDF, 0XEF, 0XFF, 0XA6, 0XBC, 0X6D, 0X17,
+    0XAE, 0X5E, 0XCF, 0X5F, 0XA6, 0XBF, 0X75, 0X58, 0XB6, 0XDD, 0XE7, 0XFF, 0XFF, 0XBF, 0XFF, 0XDF,
+    0XF7, 0XFF, 0XF7, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XDF, 0XF7, 0XFF, 0XDF, 0XDF, 0X6C, 0XD7,
+    0X8D, 0XDB, 0XBF, 0X3F, 0XDF, 0XBF, 0XF7, 0XFF, 0XF7, 0XFF, 0XDF, 0XBF, 0X6C, 0X74, 0XAE, 0XDE,
+    0XE7, 0XFF, 0XEF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFE, 0XFF, 0XFF, 0XFF, 0XFF, 0XF7, 0XFF, 0XF7, 0XBE,
+    0XF7, 0XDF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XF7, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
+    0XFF, 0XFF, 0XF7, 0XDF, 0XEF, 0XDF, 0XF7, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
+    0XFF, 0XFF, 0XFF, 0XFF, 0XF7, 0XDF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
+    0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
+    0XFF, 0XFF, 0XFF, 0XFF, 0XEF, 0XDE, 0XD7, 0X3C, 0XDF, 0X3C, 0XF7, 0XFF, 0XFF, 0XFF, 0XF7, 0XFF,
+    0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XEF, 0XFF, 0XF7, 0XFF,
+    0XFF, 0XFF, 0XF7, 0XBE, 0XFF, 0XDF, 0XF7, 0XFF, 0XE7, 0XFF, 0XAF, 0X3F, 0X4D, 0X3A, 0X1C, 0X79,
+    0X04, 0X38, 0X04, 0X7A, 0X04, 0X9B, 0X04, 0X5A, 0X04, 0X3A, 0X0C, 0X9B, 0X04, 0X5A, 0X04, 0X5A,
+    0X04, 0X5A, 0X04, 0X5A, 0X04, 0X5A, 0X04, 0X5A, 0X04, 0X7A, 0X04, 0X7B, 0X04, 0X19, 0X04, 0X7A,
+    0X0C, 0X9B, 0X0C, 0X39, 0X14, 0X17, 0X3C, 0XD9, 0X86, 0X9F, 0XCF, 0XFF, 0XEF, 0XFF, 0XFF, 0XBF,
+    0XF7, 0XBF, 0XFF, 0XDF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XF7, 0XFF, 0XF7, 0XFF, 0XF7, 0XFF,
+    0XF7, 0XFF, 0XFF, 0XFD, 0XF7, 0XF6, 0XD6, 0XEB, 0XBE, 0X21, 0XB6, 0X40, 0XB6, 0X60, 0XAE, 0X60,
+    0XAE, 0X41, 0XAE, 0X41, 0XAE, 0X60, 0XAE, 0X60, 0XAE, 0X60, 0XAE, 0X61, 0XAE, 0X41, 0XAE, 0X42,
+    0XAE, 0X24, 0XC6, 0XCB, 0XEF, 0XB7, 0XFF, 0XFF, 0XFF, 0XFF, 0XEF, 0XFF, 0XAE, 0XFF, 0X6C, 0XF6,
+    0XD7, 0X7F, 0XEF, 0XFF, 0XEF, 0XFF, 0XEF, 0XFF, 0XDF, 0XFF, 0X8D, 0X77, 0X8D, 0X58, 0XDF, 0XFF,
+    0XDF, 0XFF, 0XB7, 0X5F, 0X4C, 0X33, 0XC7, 0XBF, 0XEF, 0XFF, 0XC7, 0X3F, 0X6D, 0X38, 0XA7, 0X1F,
+    0XDF, 0XFF, 0XDF, 0XFF, 0X54, 0X73, 0X96, 0X5B, 0XE7, 0XFF, 0XCF, 0X5F, 0X65, 0X78, 0X8E, 0XDE,
+    0XCF, 0XDF, 0X6C, 0X97, 0X8D, 0XFA, 0XD7, 0XFF, 0XEF, 0XFF, 0XF7, 0XFF, 0XEF, 0XFF, 0XE7, 0XFF,
+    0X8D, 0XBB, 0X7C, 0XF7, 0XEF, 0XDF, 0XE7, 0XBF, 0X85, 0X7A, 0X8D, 0XBB, 0XE7, 0X9F, 0XF7, 0XFF,
+    0XC7, 0X9F, 0X75, 0X19, 0XBE, 0XBD, 0XE7, 0XFF, 0XCF, 0X7F, 0X64, 0X75, 0XB6, 0XFE, 0XE7, 0XFF,
+    0XCF, 0X7F, 0X74, 0XF6, 0X6C, 0XB5, 0XBF, 0X5F, 0XDF, 0XFF, 0XAE, 0XDE, 0X7D, 0X58, 0XCF, 0XFF,
+    0XD7, 0XFF, 0X8D, 0XDA, 0X75, 0X17, 0XCF, 0X9F, 0XDF, 0XFF, 0XE7, 0XFF, 0XF7, 0XDF, 0XEF, 0XDF,
+    0X96, 0X1A, 0X75, 0X58, 0XDF, 0XBF, 0XE7, 0XFF, 0XBF, 0X5F, 0X6D, 0X17, 0XB6, 0XBD, 0XF7, 0XFF,
+    0XFF, 0XBF, 0XFF, 0XBF, 0XFF, 0XFF, 0XF7, 0XFF, 0XFF, 0XDF, 0XFF, 0XDF, 0XFF, 0XFF, 0XFF, 0XFF,
+    0XE7, 0XFF, 0X64, 0X95, 0XA6, 0X7D, 0XDF, 0XFF, 0XF7, 0XFF, 0XEF, 0XBD, 0XFF, 0XFE, 0XEF, 0XDF,
+    0X6C, 0X73, 0XB7, 0X1E, 0XE7, 0XFF, 0XE7, 0XDF, 0XFF, 0XFF, 0XFF, 0X9C, 0XFF, 0XFF, 0XF7, 0XFF,
+    0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
+    0XFF, 0XFF, 0XF7, 0XFF, 0XEF, 0X9E, 0XCE, 0XDB, 0XEF, 0XFF, 0XF7, 0XFF, 0XF7, 0XFF, 0XF7, 0XFF,
+    0XFF, 0XFF, 0XF7, 0XDE, 0XFF, 0XFF, 0XFF, 0XFF, 0XF7, 0XBE, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
+    0XF7, 0X9E, 0XF7, 0XDE, 0XFF, 0XFF, 0XFF, 0XFF, 0XF7, 0XBE, 0XF7, 0XDF, 0XFF, 0XFF, 0XEF, 0XDF,
+    0XEF, 0XDF, 0XEF, 0XBE, 0XF7, 0XDF, 0XFF, 0XFF, 0XDF, 0X5C, 0XA5, 0X54, 0XCE, 0XB9, 0XFF, 0XFF,
+    0XF7, 0XFF, 0XFF, 0XFF, 0XF7, 0XFF, 0XEF, 0XBE, 0XFF, 0XFF, 0XF7, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
+    0XF7, 0XFF, 0XFF, 0XFF, 0XF7, 0XFF, 0XF7, 0XDF, 0XF7, 0XFF, 0XE7, 0XFF, 0XAE, 0XFF, 0X5D, 0X5A,
+    0X1C, 0X17, 0X04, 0X38, 0X04, 0X9A, 0X04, 0XBC, 0X04, 0XBB, 0X04, 0X5B, 0X04, 0X5A, 0X04, 0X7B,
+    0X04, 0X5A, 0X04, 0X5A, 0X04, 0X5A, 0X04, 0X5A, 0X04, 0X5A, 0X04, 0X7A, 0X04, 0X7A, 0X04, 0X7B,
+    0X04, 0X7B, 0X0C, 0X7B, 0X0C, 0X39, 0X14, 0X17, 0X44, 0XB8, 0X86, 0X5D, 0XC7, 0XBF, 0XEF, 0XFF,
+    0XFF, 0XFF, 0XFF, 0XBF, 0XFF, 0XDF, 0XFF, 0XFF, 0XFF, 0XFF, 0XF7, 0XFF, 0XF7, 0XFF, 0XFF, 0XFF,
+    0XF7, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFC, 0XF7, 0XF6, 0XD6, 0XEB, 0XB6, 0X42, 0XAE, 0X60,
+    0XAE, 0X60, 0XAE, 0X60, 0XAE, 0X42, 0XAE, 0X42, 0XAE, 0X60, 0XAE, 0X60, 0XAE, 0X41, 0XAE, 0X41,
+    0XAE, 0X41, 0XAE, 0X42, 0XAE, 0X24, 0XC6, 0XCB, 0XEF, 0XB7, 0XFF, 0XFE, 0XFF, 0XFF, 0XEF, 0XFF,
+    0XA6, 0XDE, 0X64, 0XF6, 0XDF, 0XBF, 0XF7, 0XFF, 0XF7, 0XFF, 0XEF, 0XFF, 0XDF, 0XFF, 0X85, 0X36,
+    0XA5, 0XFB, 0XE7, 0XFF, 0XDF, 0XFF, 0XBF, 0X7F, 0X54, 0X74, 0XD7, 0XFF, 0XEF, 0XFF, 0XB6, 0X9B,
+    0X7D, 0X78, 0XA6, 0XBE, 0XE7, 0XFF, 0XDF, 0XDF, 0X6C, 0XF4, 0XAE, 0XDC, 0XF7, 0XFF, 0XD7, 0X7F,
+    0X5D, 0X38, 0X8E, 0XBE, 0X9E, 0X5E, 0X6C, 0X97, 0XC7, 0X7F, 0XDF, 0XFF, 0XF7, 0XFF, 0XF7, 0X9F,
+    0XEF, 0XDF, 0XDF, 0XDF, 0X74, 0XD7, 0XA6, 0X5D, 0XF7, 0XFF, 0XE7, 0XDF, 0X85, 0XBB, 0X8D, 0XFC,
+    0XEF, 0XDF, 0XEF, 0XDF, 0XB7, 0X1F, 0X6C, 0XF9, 0XBE, 0XDE, 0XEF, 0XFF, 0XC7, 0X5F, 0X5C, 0X55,
+    0XBF, 0X3F, 0XDF, 0XFF, 0XC7, 0X9F, 0X7D, 0X58, 0X54, 0X33, 0X9E, 0X5C, 0XDF, 0XFF, 0XAE, 0XDE,
+    0X6C, 0XD6, 0XC7, 0XBF, 0XDF, 0XFF, 0X9E, 0X5C, 0X85, 0X58, 0XCF, 0XBF, 0XE7, 0XFF, 0XEF, 0XFF,
+    0XFF, 0XFF, 0XFF, 0XFF, 0X9E, 0X7B, 0X75, 0X37, 0XD7, 0X5F, 0XE7, 0XFF, 0XB7, 0X1F, 0X6D, 0X17,
+    0XB6, 0XBC, 0XF7, 0XFF, 0XFF, 0XBF, 0XFF, 0XBF, 0XFF, 0XFF, 0XF7, 0XFF, 0XFF, 0XBF, 0XFF, 0XDF,
+    0XFF, 0XBE, 0XF7, 0XFF, 0XE7, 0XFF, 0X5C, 0X34, 0X9E, 0X3C, 0XE7, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
+    0XFF, 0XBE, 0XFF, 0XFF, 0X6C, 0X53, 0XAE, 0XDE, 0XDF, 0XFF, 0XE7, 0XFF, 0XFF, 0XFF, 0XFF, 0XFE,
+    0XFF, 0XFE, 0XFF, 0XDE, 0XF7, 0XDE, 0XFF, 0XDE, 0XFF, 0XDE, 0XFF, 0XDE, 0XFF, 0XDF, 0XFF, 0XFF,
+    0XF7, 0XBE, 0XFF, 0XFF, 0XEF, 0XBF, 0XEF, 0XBE, 0XCE, 0XBB, 0X95, 0X14, 0XDF, 0X9E, 0XEF, 0XDF,
+    0XF7, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
+    0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XF7, 0XBE, 0XF7, 0XBE, 0XFF, 0XFF,
+    0XFF, 0XFF, 0XF7, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XF7, 0XDE, 0XFF, 0XFF, 0XF7, 0X9D, 0XCE, 0X78,
+    0XF7, 0X9D, 0XF7, 0XBE, 0XF7, 0XBE, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XF7, 0XFF, 0XF7, 0XDF,
+    0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFE, 0XF7, 0XFE, 0XF7, 0XFF, 0XF7, 0XFF, 0XE7, 0XFF, 0XB7, 0X1F,
+    0X5D, 0X5B, 0X24, 0X17, 0X0C, 0X17, 0X04, 0X79, 0X04, 0X9A, 0X04, 0X9B, 0X04, 0X9B, 0X04, 0X9C,
+    0X04, 0X7B, 0X04, 0X5B, 0X04, 0X7B, 0X04, 0X7B, 0X04, 0X7A, 0X04, 0X7A, 0X04, 0X7A, 0X04, 0X7A,
+    0X04, 0X7B, 0X04, 0X7B, 0X0C, 0X9B, 0X04, 0X39, 0X0B, 0XF7, 0X34, 0X78, 0X86, 0X1D, 0XCF, 0XDF,
+    0XEF, 0XFF, 0XF7, 0XFF, 0XFF, 0XDF, 0XFF, 0XDF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XF7, 0XFF,
+    0XF7, 0XFE, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFE, 0XFF, 0XFC, 0XF7, 0XD5, 0XC6, 0XEB,
+    0XA6, 0X63, 0XAE, 0X80, 0XAE, 0X60, 0XAE, 0X60, 0XAE, 0X42, 0XAE, 0X42, 0XAE, 0X41, 0XAE, 0X61,
+    0XAE, 0X41, 0XAE, 0X42, 0XAE, 0X41, 0XAE, 0X42, 0XAE, 0X24, 0XC6, 0XCB, 0XEF, 0XB7, 0XFF, 0XFD,
+    0XFF, 0XFF, 0XEF, 0XFF, 0XA6, 0XBD, 0X64, 0XF6, 0XDF, 0X9F, 0XF7, 0XFF, 0XF7, 0XFF, 0XEF, 0XFF,
+    0XE7, 0XFF, 0X8D, 0X77, 0X95, 0X79, 0XDF, 0XDF, 0XD7, 0XFF, 0XB7, 0X3F, 0X4C, 0X53, 0XCF, 0XFF,
+    0XEF, 0XFF, 0XCF, 0X1D, 0X75, 0X16, 0XAE, 0XDD, 0XF7, 0XFF, 0XF7, 0XFF, 0X9E, 0X79, 0XBF, 0X3D,
+    0XE7, 0X9F, 0XD7, 0X5F, 0X65, 0X58, 0X86, 0XBE, 0X6C, 0XB8, 0X9D, 0XDB, 0XDF, 0XFF, 0XE7, 0XFF,
+    0XFF, 0XFF, 0XFF, 0XFF, 0XF7, 0XFF, 0XC6, 0XFE, 0X5C, 0X55, 0XBF, 0X5F, 0XF7, 0XFF, 0XE7, 0XDF,
+    0X7D, 0XBB, 0X7D, 0X9A, 0XEF, 0XFF, 0XEF, 0XFF, 0XB7, 0X5F, 0X64, 0XF9, 0XB6, 0XFE, 0XE7, 0XFF,
+    0XCF, 0XDF, 0X5C, 0X95, 0XB6, 0XFE, 0XDF, 0XFF, 0XCF, 0XFF, 0X7D, 0X58, 0X54, 0X34, 0X85, 0XBA,
+    0XD7, 0XFF, 0X9E, 0X9D, 0X6C, 0XF6, 0XD7, 0XFF, 0XDF, 0XFF, 0X9E, 0X3B, 0X7D, 0X16, 0XCF, 0X9F,
+    0XE7, 0XFF, 0XEF, 0XFF, 0XF7, 0XBF, 0XF7, 0XFF, 0X9E, 0X9B, 0X64, 0XF6, 0XCF, 0X7F, 0XE7, 0XFF,
+    0XC7, 0XDF, 0X75, 0X58, 0XB6, 0XDC, 0XF7, 0XFF, 0XFF, 0XBF, 0XFF, 0X9E, 0XFF, 0XFF, 0XF7, 0XFF,
+    0XFF, 0XDF, 0XFF, 0XDF, 0XFF, 0XFF, 0XF7, 0XFF, 0XE7, 0XFF, 0X5C, 0X75, 0X9E, 0X5D, 0XE7, 0XFF,
+    0XFF, 0XFF, 0XFF, 0XDE, 0XFF, 0XFF, 0XFF, 0XFF, 0X6C, 0X74, 0XAE, 0XDF, 0XDF, 0XFF, 0XE7, 0XFF,
+    0XEF, 0XFF, 0XF7, 0XDD, 0XF7, 0XFF, 0XF7, 0XFF, 0XF7, 0XFF, 0XF7, 0XFF, 0XF7, 0XFF, 0XF7, 0XFF,
+    0XF7, 0XFF, 0XF7, 0XFF, 0XEF, 0XDF, 0XF7, 0XFF, 0XF7, 0XFF, 0XEF, 0XFF, 0XBE, 0XBC, 0X74, 0XB4,
+    0XCF, 0X9F, 0XE7, 0XFF, 0XEF, 0XFF, 0XF7, 0XFF, 0XEF, 0XDF, 0XEF, 0XFF, 0XEF, 0XBF, 0XEF, 0XDF,
+    0XF7, 0XFF, 0XEF, 0XFF, 0XF7, 0XFF, 0XEF, 0X9E, 0XF7, 0XDF, 0XF7, 0XDF, 0XF7, 0XDF, 0XFF, 0XFF,
+    0XFF, 0XFF, 0XF7, 0XFF, 0XEF, 0XFF, 0XDF, 0XDF, 0XE7, 0XFF, 0XEF, 0XFF, 0XF7, 0XFF, 0XF7, 0XFF,
+    0XFF, 0XFF, 0XF7, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XF7, 0XFF, 0XF7, 0XFF, 0XE7, 0XBF, 0XE7, 0XDF,
+    0XE7, 0XFF, 0XEF, 0XFF, 0XF7, 0XFF, 0XFF, 0XFF, 0XFF, 0XFC, 0XFF, 0XFD, 0XFF, 0XFF, 0XE7, 0XFF,
+    0XB7, 0X1F, 0X65, 0X7C, 0X2C, 0X58, 0X13, 0XF8, 0X0C, 0X59, 0X04, 0X7A, 0X04, 0X7A, 0X04, 0X7A,
+    0X04, 0X9B, 0X04, 0X9B, 0X04, 0X7C, 0X04, 0X5B, 0X04, 0X7C, 0X04, 0X7B, 0X04, 0X7B, 0X04, 0X7B,
+    0X04, 0X7B, 0X04, 0X7B, 0X04, 0X7B, 0X04, 0X7B, 0X04, 0X3A, 0X0C, 0X39, 0X2C, 0XBA, 0X76, 0X1E,
+    0XC7, 0XBF, 0XEF, 0XFF, 0XFF, 0XFF, 0XFF, 0XDE, 0XFF, 0XBF, 0XFF, 0XBF, 0XFF, 0XDF, 0XFF, 0XFF,
+    0XF7, 0XFF, 0XF7, 0XFF, 0XF7, 0XFE, 0XFF, 0XFE, 0XFF, 0XDD, 0XFF, 0XFE, 0XFF, 0XFD, 0XFF, 0XDA,
+    0XDF, 0X53, 0XB6, 0X8A, 0X9E, 0X43, 0XA6, 0XA1, 0XAE, 0X60, 0XAE, 0X60, 0XAE, 0X42, 0XAE, 0X43,
+    0XAE, 0X41, 0XAE, 0X41, 0XAE, 0X41, 0XAE, 0X41, 0XAE, 0X41, 0XAE, 0X41, 0XAE, 0X43, 0XC6, 0XC9,
+    0XEF, 0XD5, 0XFF, 0XFC, 0XFF, 0XFF, 0XEF, 0XFF, 0XAE, 0XFE, 0X6D, 0X17, 0XD7, 0X7F, 0XF7, 0XDF,
+    0XF7, 0XFF, 0XF7, 0XFF, 0XE7, 0XFF, 0X95, 0XB7, 0X9D, 0X99, 0XEF, 0XFF, 0XDF, 0XFF, 0XB7, 0X5F,
+    0X4C, 0X53, 0XBF, 0X7E, 0XEF, 0XFF, 0XCF, 0X1D, 0X8D, 0X76, 0XBE, 0XFD, 0XF7, 0XDF, 0XF7, 0XFF,
+    0XD7, 0XFF, 0XE7, 0XFF, 0XFF, 0XFF, 0XE7, 0XBF, 0X65, 0X58, 0X5D, 0X79, 0X64, 0X35, 0XC6, 0XDF,
+    0XDF, 0XFF, 0XEF, 0XFF, 0XFF, 0XFE, 0XFF, 0XFE, 0XF7, 0XFF, 0X8D, 0XB8, 0X6D, 0X17, 0XCF, 0XFF,
+    0XE7, 0XFF, 0XE7, 0XFF, 0X7E, 0X3C, 0X6D, 0XBA, 0XD7, 0XBF, 0XE7, 0XFF, 0XAF, 0X9F, 0X5D, 0X39,
+    0XAE, 0XFE, 0XDF, 0XFF, 0XB7, 0XBF, 0X4C, 0X54, 0XAE, 0XFE, 0XDF, 0XFF, 0XD7, 0XFF, 0X7D, 0X58,
+    0X7D, 0X58, 0X7D, 0X58, 0XC7, 0X9F, 0XA6, 0XBD, 0X6C, 0XF6, 0XCF, 0XBF, 0XDF, 0XFF, 0X95, 0XFA,
+    0X7D, 0X16, 0XCF, 0X9F, 0XE7, 0XFF, 0XEF, 0XFF, 0XFF, 0XFF, 0XEF, 0XFF, 0X9E, 0XDC, 0X65, 0X77,
+    0XCF, 0XDF, 0XDF, 0XFF, 0XAF, 0X5F, 0X5C, 0XF6, 0XAE, 0XFC, 0XEF, 0XFF, 0XFF, 0XDF, 0XFF, 0XBE,
+    0XF7, 0XFF, 0XF7, 0XFF, 0XFF, 0XFF, 0XFF, 0XDF, 0XF7, 0XFF, 0XDF, 0XDF, 0XD7, 0XFF, 0X5C, 0XB7,
+    0X96, 0X9F, 0XDF, 0XFF, 0XEF, 0XFF, 0XFF, 0XFF, 0XFF, 0XDF, 0XE7, 0X9F, 0X5C, 0X55, 0XA6, 0XFF,
+    0XCF, 0XFF, 0XCF, 0XFF, 0XA5, 0XF8, 0XAD, 0XF7, 0X95, 0X97, 0X9D, 0XFA, 0XBF, 0X1F, 0XE7, 0XFF,
+    0XDF, 0XFF, 0XB6, 0XBE, 0X95, 0XBA, 0X8D, 0X9A, 0X95, 0XFB, 0X9E, 0X5D, 0XD7, 0XFF, 0XBF, 0X5F,
+    0X85, 0XDB, 0X43, 0XF4, 0X85, 0XFC, 0XAF, 0X1F, 0XD7, 0XFF, 0XBF, 0X5F, 0X9E, 0X3B, 0XB6, 0XDE,
+    0X9E, 0X3B, 0X9E, 0X1B, 0XDF, 0XFF, 0XD7, 0XFF, 0XBE, 0XFE, 0X9E, 0X1A, 0XA6, 0X3B, 0X95, 0XDA,
+    0XA6, 0X3B, 0XDF, 0XFF, 0XE7, 0XFF, 0XB6, 0XDE, 0X96, 0X5C, 0X96, 0X5C, 0X8D, 0XFA, 0X95, 0XFA,
+    0XBF, 0X3F, 0XE7, 0XFF, 0XD7, 0XBF, 0XB6, 0X9D, 0XCF, 0X3F, 0XE7, 0XFF, 0XE7, 0XFF, 0X9E, 0X3C,
+    0X95, 0XFA, 0X96, 0X5C, 0X85, 0XFB, 0XC7, 0X7F, 0XF7, 0XFF, 0XFF, 0XFF, 0XFF, 0XBD, 0XFF, 0XFE,
+    0XF7, 0XFF, 0XC7, 0X1D, 0X7D, 0X58, 0X3C, 0X15, 0X2B, 0XF5, 0X24, 0X57, 0X1C, 0X37, 0X14, 0X57,
+    0X14, 0X57, 0X14, 0X78, 0X14, 0X58, 0X0C, 0X38, 0X0C, 0X19, 0X14, 0X59, 0X0C, 0X59, 0X0C, 0X58,
+    0X14, 0X58, 0X14, 0X58, 0X14, 0X38, 0X14, 0X37, 0X14, 0X37, 0X14, 0X37, 0X13, 0XF6, 0X2C, 0X77,
+    0X76, 0X1C, 0XC7, 0XFF, 0XE7, 0XFF, 0XF7, 0XFF, 0XFF, 0XBD, 0XFF, 0XFE, 0XFF, 0XDF, 0XFF, 0XDF,
+    0XFF, 0XFF, 0XFF, 0XFF, 0XF7, 0XFF, 0XF7, 0XFE, 0XF7, 0XFC, 0XF7, 0XFB, 0XFF, 0XDA, 0XFF, 0XFB,
+    0XFF, 0XFA, 0XF7, 0X95, 0XCF, 0X0F, 0XA6, 0X27, 0X96, 0X22, 0X9E, 0X81, 0XAE, 0X60, 0XAE, 0X61,
+    0XAE, 0X42, 0XAE, 0X43, 0XAE, 0X42, 0XAE, 0X41, 0XAE, 0X42, 0XAE, 0X42, 0XAE, 0X41, 0XAE, 0X41,
+    0XAE, 0X42, 0XC6, 0XC9, 0XEF, 0XD5, 0XFF, 0XFC, 0XFF, 0XFF, 0XEF, 0XFF, 0XA6, 0XDD, 0X6D, 0X16,
+    0XD7, 0X7F, 0XF7, 0XFF, 0XF7, 0XFF, 0XF7, 0XFF, 0XDF, 0XDF, 0X8D, 0X56, 0X95, 0X38, 0XE7, 0XFF,
+    0XDF, 0XFF, 0XAE, 0XFF, 0X5C, 0XB4, 0XCF, 0XDF, 0XF7, 0XFF, 0XC6, 0XBB, 0X74, 0XD4, 0XBF, 0X1D,
+    0XFF, 0XFF, 0XFF, 0XFF, 0XE7, 0XFF, 0XEF, 0XFF, 0XEF, 0X7F, 0XD7, 0X3F, 0X5D, 0X38, 0X3C, 0X55,
+    0X7D, 0X39, 0XE7, 0XFF, 0XE7, 0XFF, 0XDF, 0XDF, 0XFF, 0XFE, 0XFF, 0X9D, 0XE7, 0XFF, 0X5C, 0X93,
+    0X96, 0X7B, 0XDF, 0XFF, 0XEF, 0XFF, 0XE7, 0XFF, 0X6D, 0XDB, 0X4C, 0XF8, 0X85, 0X97, 0X8D, 0XB7,
+    0X6D, 0X99, 0X44, 0X96, 0XB7, 0X3E, 0XDF, 0XFF, 0XB7, 0XDF, 0X4C, 0XB6, 0XAE, 0XFE, 0XDF, 0XFF,
+    0XC7, 0XBF, 0X75, 0X58, 0X9E, 0X5C, 0X6C, 0XF6, 0XA6, 0XBE, 0XA6, 0XFF, 0X6D, 0X37, 0XC7, 0XDF,
+    0XE7, 0XFF, 0XA6, 0X5B, 0X6C, 0XB5, 0X96, 0X1A, 0XA6, 0X3A, 0XBE, 0X9B, 0XF7, 0XFF, 0XE7, 0XFF,
+    0X96, 0XDC, 0X65, 0X77, 0XAE, 0XFF, 0X96, 0X1E, 0X75, 0XDB, 0X54, 0XF5, 0XAE, 0XFC, 0XF7, 0XFF,
+    0XFF, 0XDF, 0XFF, 0XDE, 0XF7, 0XFF, 0XF7, 0XFF, 0XFF, 0XFF, 0XFF, 0XDF, 0XFF, 0XFF, 0XEF, 0XFF,
+    0XDF, 0XFF, 0X54, 0X76, 0X65, 0X18, 0XA6, 0X9D, 0XB6, 0X5B, 0XDF, 0X1D, 0XFF, 0XFF, 0XE7, 0X9F,
+    0X5C, 0X95, 0X9F, 0X5F, 0XC7, 0XFF, 0XB7, 0X7F, 0X74, 0XF5, 0X8D, 0X97, 0X8D, 0XDA, 0X6D, 0X17,
+    0X95, 0XFB, 0XD7, 0XFF, 0XC7, 0XDF, 0X7D, 0X79, 0X6C, 0X97, 0X95, 0XDC, 0X6D, 0X18, 0X65, 0X18,
+    0XD7, 0XFF, 0XB7, 0X3F, 0X7D, 0XDB, 0X44, 0X56, 0X6D, 0X7A, 0XA7, 0X1F, 0XDF, 0XFF, 0X9E, 0X7D,
+    0X5C, 0X95, 0X7D, 0X79, 0X64, 0X75, 0X64, 0X54, 0XCF, 0XBF, 0XCF, 0XFF, 0X7D, 0X79, 0X6C, 0XF7,
+    0X8D, 0X9A, 0X6C, 0XB6, 0X64, 0XD6, 0XC7, 0XBF, 0XDF, 0XFF, 0XA6, 0XBE, 0X54, 0X96, 0X75, 0XBB,
+    0X65, 0X59, 0X54, 0X96, 0X9E, 0X7D, 0XDF, 0XFF, 0XBF, 0X7F, 0X75, 0X38, 0XBE, 0XFF, 0XE7, 0XFF,
+    0XC7, 0X9F, 0X5C, 0X95, 0X6D, 0X18, 0X7D, 0XBA, 0X4C, 0X75, 0X9E, 0X9C, 0XF7, 0XFF, 0XFF, 0XFF,
+    0XFF, 0XBF, 0XFF, 0XFF, 0XE7, 0X7E, 0XB6, 0X58, 0X95, 0X95, 0X85, 0X75, 0X75, 0X55, 0X65, 0X15,
+    0X6D, 0X77, 0X6D, 0X77, 0X6D, 0X97, 0X6D, 0X97, 0X6D, 0X77, 0X6D, 0X78, 0X6D, 0X59, 0X6D, 0X59,
+    0X6D, 0X78, 0X6D, 0X78, 0X6D, 0X77, 0X6D, 0X77, 0X6D, 0X77, 0X6D, 0X77, 0X6D, 0X77, 0X75, 0X76,
+    0X7D, 0X97, 0X9E, 0X7A, 0XCF, 0XBE, 0XE7, 0XFF, 0XEF, 0XFF, 0XF7, 0XFE, 0XF7, 0XFD, 0XFF, 0XFD,
+    0XFF, 0XFE, 0XFF, 0XFE, 0XFF, 0XFE, 0XFF, 0XFD, 0XFF, 0XFC, 0XFF, 0XFB, 0XF7, 0XF9, 0XF7, 0XF7,
+    0XF7, 0XF5, 0XEF, 0X92, 0XD7, 0X0E, 0XBE, 0X8A, 0XAE, 0X26, 0XA6, 0X24, 0XA6, 0X42, 0XA6, 0X61,
+    0XAE, 0X61, 0XAE, 0X41, 0XAE, 0X42, 0XAE, 0X42, 0XAE, 0X42, 0XAE, 0X42, 0XAE, 0X42, 0XAE, 0X42,
+    0XAE, 0X40, 0XAE, 0X40, 0XAE, 0X42, 0XC6, 0XC9, 0XEF, 0XD6, 0XFF, 0XFD, 0XFF, 0XFF, 0XEF, 0XFF,
+    0XA6, 0XFD, 0X64, 0XF6, 0XDF, 0XDF, 0XF7, 0XFF, 0XF7, 0XFF, 0XEF, 0XFF, 0XDF, 0XFF, 0X8D, 0X96,
+    0X9D, 0XB9, 0XE7, 0XFF, 0XDF, 0XFF, 0XAF, 0X1F, 0X54, 0XB4, 0XCF, 0XFF, 0XF7, 0XFF, 0XCF, 0X1C,
+    0X75, 0X15, 0XBF, 0X5E, 0XF7, 0XFF, 0XEF, 0X9F, 0XEF, 0XFF, 0XEF, 0XFF, 0XFF, 0XFF, 0XD7, 0X3F,
+    0X4C, 0XF7, 0X3C, 0XB6, 0X6D, 0X18, 0XD7, 0XDF, 0XDF, 0XFF, 0XDF, 0XFF, 0XFF, 0XDF, 0XFF, 0X9E,
+    0XC7, 0X5E, 0X54, 0X73, 0XC7, 0XBF, 0XE7, 0XFF, 0XFF, 0XFE, 0XEF, 0XFF, 0X75, 0XDB, 0X44, 0XD8,
+    0X7D, 0X77, 0X85, 0X97, 0X6D, 0X78, 0X4C, 0X53, 0XBE, 0XFB, 0XE7, 0XFF, 0XB7, 0XFF, 0X54, 0XB8,
+    0XB6, 0XDE, 0XE7, 0XFF, 0XBF, 0XDF, 0X65, 0X17, 0XB6, 0XDD, 0X9D, 0XFA, 0X75, 0X99, 0X9E, 0XFF,
+    0X65, 0X38, 0XBF, 0XDF, 0XE7, 0XFF, 0XAE, 0X7C, 0X4C, 0X12, 0X64, 0XF5, 0X74, 0XB4, 0X9D, 0X77,
+    0XF7, 0XFF, 0XE7, 0XFF, 0X9E, 0XDD, 0X5C, 0XD6, 0XB7, 0X1F, 0X5C, 0X36, 0X65, 0X38, 0X96, 0X7C,
+    0XD7, 0XBF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XDE, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
+    0XFF, 0XFF, 0XEF, 0XFF, 0XD7, 0XFF, 0X54, 0X73, 0X5C, 0XB4, 0X75, 0X16, 0X8C, 0XF5, 0XD6, 0X7C,
+    0XFF, 0XBF, 0XEF, 0X9F, 0X5C, 0XB3, 0X97, 0X5E, 0XC7, 0XFF, 0X9E, 0X9E, 0X7D, 0X58, 0XC7, 0X9F,
+    0XD7, 0XFF, 0X96, 0X1B, 0X8D, 0X59, 0XDF, 0XFF, 0XC7, 0XFF, 0X6C, 0XF6, 0XBE, 0X9E, 0XEF, 0XFF,
+    0XAF, 0X3F, 0X5C, 0XD5, 0XD7, 0X7F, 0XEF, 0XFF, 0XAE, 0XDE, 0X6C, 0XF6, 0XC7, 0X7F, 0XE7, 0XFF,
+    0XE7, 0XFF, 0XA6, 0X7D, 0X75, 0X77, 0XC7, 0XDF, 0XD7, 0X3F, 0X74, 0X13, 0XC7, 0X7F, 0XCF, 0XFF,
+    0X75, 0X57, 0XA6, 0X9D, 0XE7, 0XFF, 0XCF, 0X5F, 0X4C, 0X33, 0XD7, 0XFF, 0XDF, 0XFF, 0XAE, 0X3C,
+    0X85, 0X79, 0XBF, 0XBF, 0XC7, 0XFF, 0X6D, 0X58, 0X9D, 0XFB, 0XDF, 0XFF, 0XAF, 0X7F, 0X75, 0X78,
+    0XAE, 0X5C, 0XEF, 0XFF, 0XBF, 0X9F, 0X54, 0X93, 0XD7, 0XDF, 0XD7, 0XBF, 0X85, 0X98, 0X9E, 0X39,
+    0XF7, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFE, 0XDF, 0X78, 0XCF, 0X35, 0XCF, 0X96,
+    0XD7, 0XF8, 0XCF, 0XD8, 0XC7, 0X98, 0XC7, 0XB8, 0XC7, 0XB7, 0XC7, 0XB7, 0XC7, 0XB7, 0XCF, 0X97,
+    0XCF, 0X98, 0XCF, 0X99, 0XC7, 0X98, 0XC7, 0X98, 0XC7, 0X98, 0XCF, 0X97, 0XCF, 0X97, 0XCF, 0X97,
+    0XCF, 0X97, 0XCF, 0X96, 0XCF, 0X75, 0XD7, 0X96, 0XDF, 0XB6, 0XDF, 0XB6, 0XDF, 0X96, 0XDF, 0X95,
+    0XE7, 0XB6, 0XE7, 0XD7, 0XE7, 0X96, 0XE7, 0X96, 0XE7, 0X75, 0XDF, 0X74, 0XDF, 0X53, 0XD7, 0X31,
+    0XD7, 0X0F, 0XCF, 0X0E, 0XBE, 0XAA, 0XBE, 0X89, 0XB6, 0X66, 0XAE, 0X44, 0XA6, 0X22, 0XAE, 0X41,
+    0XAE, 0X61, 0XB6, 0X81, 0XAE, 0X61, 0XAE, 0X41, 0XAE, 0X42, 0XAE, 0X42, 0XAE, 0X41, 0XAE, 0X41,
+    0XAE, 0X42, 0XAE, 0X42, 0XAE, 0X60, 0XAE, 0X60, 0XAE, 0X42, 0XC6, 0XC9, 0XEF, 0XB7, 0XFF, 0XFE,
+    0XFF, 0XFF, 0XEF, 0XFF, 0XA6, 0XDD, 0X5C, 0XF6, 0XD7, 0X9F, 0XEF, 0XDF, 0XF7, 0XFF, 0XEF, 0XFF,
+    0XDF, 0XFF, 0X85, 0X36, 0X95, 0X79, 0XE7, 0XFF, 0XDF, 0XFF, 0XB7, 0X3F, 0X54, 0X53, 0XBF, 0X9F,
+    0XEF, 0XFF, 0XC6, 0XFC, 0X6C, 0XF5, 0XB7, 0X1E, 0XF7, 0XFF, 0XFF, 0XFF, 0XEF, 0XFF, 0XE7, 0XDF,
+    0XFF, 0XDF, 0XDF, 0X3F, 0X55, 0X18, 0X5D, 0XBB, 0X54, 0X75, 0XC7, 0X5F, 0XDF, 0XFF, 0XEF, 0XFF,
+    0XFF, 0XDF, 0XFF, 0XDF, 0X9E, 0X1A, 0X6D, 0X17, 0XDF, 0XFF, 0XF7, 0XFF, 0XFF, 0XFD, 0XF7, 0XDE,
+    0X86, 0X1D, 0X6D, 0XDD, 0XCF, 0XFF, 0XD7, 0XFF, 0XAF, 0X1E, 0X75, 0X15, 0XC6, 0XFB, 0XEF, 0XFF,
+    0XB7, 0X9F, 0X4C, 0X57, 0XBF, 0X1F, 0XE7, 0XFF, 0XBF, 0XFF, 0X6D, 0X98, 0XB6, 0XBD, 0XBE, 0XDE,
+    0X6D, 0X58, 0X86, 0X7D, 0X5D, 0X38, 0XCF, 0XFF, 0XE7, 0XFF, 0XB6, 0X7C, 0X65, 0X17, 0XB7, 0X9F,
+    0XD7, 0XBF, 0XEF, 0XFF, 0XF7, 0XFF, 0XE7, 0XFF, 0X9E, 0XDD, 0X65, 0X38, 0XC7, 0X7F, 0X7D, 0X1A,
+    0X7D, 0XDB, 0XCF, 0XFF, 0XE7, 0XDF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFE, 0XFF, 0XFF, 0XFF, 0XFF,
+    0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XF7, 0XFF, 0XE7, 0XFF, 0X64, 0XD4, 0X8E, 0X3A, 0XCF, 0XFF,
+    0XDF, 0X9F, 0XFF, 0XFF, 0XFF, 0X9F, 0XF7, 0XBF, 0X54, 0XD3, 0X9F, 0X9E, 0XCF, 0XFF, 0XB7, 0X1F,
+    0X7D, 0X5A, 0XAE, 0XDF, 0XC7, 0XBF, 0X85, 0XB9, 0X8D, 0X38, 0XE7, 0XFF, 0XCF, 0XFF, 0X6D, 0X15,
+    0XBE, 0X3C, 0XE7, 0XBF, 0XC7, 0XFF, 0XA6, 0XFC, 0XE7, 0X9F, 0XF7, 0XFF, 0XB6, 0XFC, 0X75, 0X15,
+    0XD7, 0X9F, 0XEF, 0XFF, 0XEF, 0XFF, 0XAE, 0X7C, 0X6D, 0X36, 0XC7, 0XBF, 0XEF, 0X9F, 0XB5, 0XD9,
+    0XDF, 0XFF, 0XC7, 0XDF, 0X75, 0X77, 0X9E, 0X7C, 0XE7, 0XDF, 0XD7, 0X3F, 0X43, 0XF2, 0XC7, 0XFF,
+    0XDF, 0XDF, 0XB6, 0X3B, 0X8D, 0X79, 0XC7, 0XBF, 0XCF, 0XFF, 0X75, 0X58, 0XA5, 0XFB, 0XE7, 0XFF,
+    0XB7, 0XBF, 0X75, 0X98, 0XBE, 0X9D, 0XF7, 0XFF, 0XBF, 0X7F, 0X54, 0X52, 0XD7, 0X5F, 0XEF, 0XFF,
+    0XBE, 0XDC, 0XC7, 0X1D, 0XF7, 0XFF, 0XFF, 0XFF, 0XF7, 0XDD, 0XFF, 0XFB, 0XE7, 0XB6, 0XBE, 0XCE,
+    0XA6, 0X28, 0XA6, 0X67, 0XA6, 0X88, 0X9E, 0X67, 0X9E, 0X88, 0X9E, 0X87, 0X9E, 0XA6, 0X9E, 0XA6,
+    0X9E, 0XA5, 0X9E, 0XA5, 0XA6, 0X86, 0XA6, 0X87, 0X9E, 0X88, 0X9E, 0X88, 0X9E, 0X88, 0X9E, 0X87,
+    0XA6, 0X87, 0XA6, 0X87, 0XA6, 0X67, 0XA6, 0X67, 0XAE, 0XA7, 0XAE, 0X87, 0XA6, 0X66, 0XA6, 0X45,
+    0XA6, 0X45, 0XAE, 0X45, 0XAE, 0X45, 0XA6, 0X25, 0XAE, 0X46, 0XB6, 0X46, 0XB6, 0X47, 0XB6, 0X46,
+    0XAE, 0X46, 0XAE, 0X25, 0XAE, 0X24, 0XAE, 0X23, 0XAE, 0X23, 0XA6, 0X22, 0XA6, 0X21, 0XA6, 0X40,
+    0XAE, 0X40, 0XAE, 0X60, 0XAE, 0X80, 0XAE, 0X80, 0XAE, 0X60, 0XAE, 0X60, 0XAE, 0X60, 0XAE, 0X60,
+    0XAE, 0X60, 0XAE, 0X60, 0XAE, 0X41, 0XAE, 0X41, 0XAE, 0X60, 0XAE, 0X60, 0XAE, 0X41, 0XC6, 0XC9,
+    0XEF, 0XD6, 0XFF, 0XFD, 0XFF, 0XFF, 0XEF, 0XFF, 0XAE, 0XFF, 0X6C, 0XF8, 0XD7, 0X7F, 0XEF, 0XDF,
+    0XF7, 0XFF, 0XF7, 0XFF, 0XE7, 0XFF, 0X8D, 0X78, 0X9D, 0X7A, 0XEF, 0XFF, 0XE7, 0XFF, 0XBF, 0X5F,
+    0X54, 0X55, 0XCF, 0XBF, 0XEF, 0XFF, 0XCE, 0XFE, 0X7D, 0X38, 0XB6, 0XFF, 0XF7, 0XFF, 0XFF, 0XFF,
+    0XCF, 0X1F, 0XDF, 0X7F, 0XFF, 0XDF, 0XE7, 0X5F, 0X65, 0X19, 0X86, 0X7F, 0X64, 0X76, 0X9D, 0XDB,
+    0XE7, 0XFF, 0XEF, 0XFF, 0XFF, 0X9F, 0XFF, 0XBF, 0X7C, 0XD6, 0X96, 0X1B, 0XE7, 0XFF, 0XFF, 0XFF,
+    0XFF, 0XBD, 0XFF, 0X9E, 0X85, 0XBC, 0X7D, 0XDE, 0XDF, 0XFF, 0XE7, 0XFF, 0XC7, 0X5F, 0X7C, 0XF6,
+    0XCE, 0X9B, 0XF7, 0XFF, 0XC7, 0XBF, 0X5C, 0XB8, 0XC7, 0X1F, 0XDF, 0XFF, 0XBF, 0XFF, 0X75, 0XB9,
+    0XAE, 0X7C, 0XD7, 0XBF, 0X6D, 0X58, 0X65, 0X59, 0X54, 0XF7, 0XC7, 0XFF, 0XDF, 0XFF, 0X9D, 0XFA,
+    0X65, 0X17, 0XC7, 0XFF, 0XE7, 0XFF, 0XF7, 0XFF, 0XF7, 0XFF, 0XE7, 0XFF, 0X9E, 0XBC, 0X6D, 0X78,
+    0XCF, 0X9F, 0X95, 0XBC, 0X75, 0X99, 0XD7, 0XFF, 0XEF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFE,
+    0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XF7, 0XBF, 0XF7, 0XFF, 0XDF, 0XFF, 0X54, 0X93,
+    0X8E, 0X7B, 0XDF, 0XFF, 0XEF, 0XFF, 0XF7, 0XDF, 0XFF, 0X9F, 0XEF, 0XBF, 0X54, 0XB3, 0X97, 0X7E,
+    0XCF, 0XFF, 0XAF, 0X1F, 0X64, 0XB7, 0X85, 0XBB, 0X8D, 0XFA, 0X74, 0XF5, 0X95, 0X78, 0XDF, 0XFF,
+    0XC7, 0XFF, 0X75, 0X55, 0XC6, 0XBC, 0XF7, 0XFF, 0XD7, 0XFF, 0XDF, 0XFF, 0XEF, 0XBF, 0XF7, 0XFF,
+    0XBE, 0XFB, 0X75, 0X13, 0XD7, 0X9E, 0XEF, 0XFF, 0XEF, 0XFF, 0XAE, 0X7C, 0X6D, 0X56, 0XC7, 0XDF,
+    0XF7, 0XFF, 0XEF, 0X9F, 0XE7, 0XFF, 0XC7, 0XBF, 0X85, 0XD9, 0X9E, 0X5C, 0XE7, 0XDF, 0XD7, 0X7F,
+    0X44, 0X33, 0XC7, 0XFF, 0XE7, 0XFF, 0XB6, 0X7D, 0X8D, 0X39, 0XD7, 0XBF, 0XD7, 0XFF, 0X7D, 0X37,
+    0XAD, 0XBB, 0XF7, 0XFF, 0XBF, 0X9F, 0X7D, 0X58, 0XD6, 0XDF, 0XF7, 0XDF, 0XCF, 0XDF, 0X5C, 0X73,
+    0XD7, 0X3F, 0XF7, 0XFF, 0XEF, 0XFF, 0XEF, 0XFF, 0XF7, 0XFF, 0XFF, 0XFF, 0XFF, 0XFD, 0XFF, 0XFA,
+    0XF7, 0XF4, 0XC6, 0XEB, 0XA6, 0X44, 0XA6, 0X62, 0XA6, 0X82, 0X9E, 0X61, 0X9E, 0X82, 0X9E, 0X81,
+    0X9E, 0X80, 0X9E, 0XA0, 0X9E, 0XA0, 0XA6, 0X80, 0XA6, 0X80, 0XA6, 0X80, 0XA6, 0X81, 0X9E, 0X81,
+    0X9E, 0X81, 0XA6, 0X61, 0XA6, 0X81, 0XA6, 0X61, 0XA6, 0X61, 0XA6, 0X61, 0XA6, 0X60, 0XA6, 0X60,
+    0XA6, 0X60, 0XAE, 0X81, 0XB6, 0XA1, 0XB6, 0XA1, 0XAE, 0X60, 0XA6, 0X40, 0XA6, 0X20, 0XA6, 0X20,
+    0XA6, 0X40, 0XAE, 0X40, 0XAE, 0X60, 0XAE, 0X61, 0XAE, 0X61, 0XAE, 0X61, 0XAE, 0X60, 0XAE, 0X80,
+    0XAE, 0X80, 0XAE, 0X80, 0XAE, 0X80, 0XAE, 0X60, 0XAE, 0X60, 0XA6, 0X40, 0XAE, 0X60, 0XAE, 0X60,
+    0XAE, 0X60, 0XAE, 0X60, 0XAE, 0X60, 0XAE, 0X60, 0XAE, 0X41, 0XAE, 0X61, 0XAE, 0X60, 0XAE, 0X60,
+    0XAE, 0X42, 0XC6, 0XCA, 0XEF, 0XB7, 0XFF, 0XFE, 0XFF, 0XFF, 0XEF, 0XFF, 0XA6, 0X9D, 0X64, 0XD7,
+    0XD7, 0X5F, 0XEF, 0XBF, 0XEF, 0XFF, 0XEF, 0XFF, 0XDF, 0XFF, 0X8D, 0X58, 0X95, 0X59, 0XE7, 0XFF,
+    0XDF, 0XFF, 0XB6, 0XFF, 0X54, 0X14, 0XD7, 0XDF, 0XEF, 0XFF, 0XC6, 0XBD, 0X75, 0X38, 0XAE, 0XDF,
+    0XE7, 0XBF, 0XEF, 0XDF, 0X8D, 0X78, 0XB6, 0XBD, 0XF7, 0XBF, 0XD7, 0X1F, 0X6D, 0X39, 0X96, 0XBF,
+    0X9D, 0XFC, 0X74, 0X96, 0XCF, 0X9F, 0XE7, 0XFF, 0XFF, 0XFF, 0XDF, 0X1E, 0X6C, 0X95, 0XB7, 0X1F,
+    0XDF, 0XDF, 0XFF, 0XFF, 0XFF, 0XDE, 0XFF, 0XDF, 0X7D, 0X5B, 0X75, 0X9D, 0XD7, 0XBF, 0XE7, 0XFF,
+    0XBF, 0X3F, 0X7C, 0XD5, 0XC6, 0X7A, 0XF7, 0XFF, 0XC7, 0X7F, 0X54, 0X37, 0XC6, 0XFF, 0XE7, 0XFF,
+    0XC7, 0XFF, 0X75, 0X99, 0XAE, 0X5C, 0XE7, 0XFF, 0X8E, 0X3C, 0X44, 0X55, 0X65, 0X9A, 0XCF, 0XFF,
+    0XE7, 0XFF, 0XA6, 0X5C, 0X6D, 0X58, 0XC7, 0XFF, 0XDF, 0XFF, 0XF7, 0XFF, 0XF7, 0XFF, 0XE7, 0XFF,
+    0X9E, 0X9B, 0X75, 0X58, 0XD7, 0XBF, 0XAE, 0X9F, 0X64, 0XF7, 0XAF, 0X1E, 0XF7, 0XFF, 0XFF, 0XFF,
+    0XFF, 0XDE, 0XFF, 0XFE, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XF7, 0XFF,
+    0XE7, 0XFF, 0X64, 0XF5, 0X96, 0XBC, 0XDF, 0XFF, 0XE7, 0XFF, 0XF7, 0XFF, 0XFF, 0XDF, 0XEF, 0XBF,
+    0X54, 0XB3, 0X9F, 0X7E, 0XD7, 0XFF, 0XA6, 0XDF, 0X64, 0XB7, 0X8D, 0XFC, 0XA6, 0X9C, 0XA6, 0X7B,
+    0XCF, 0X3E, 0XEF, 0XFF, 0XBF, 0X9E, 0X75, 0X35, 0XC6, 0X9C, 0XE7, 0XBF, 0XD7, 0XFF, 0XDF, 0XFF,
+    0XEF, 0XFF, 0XF7, 0XFF, 0XBE, 0XFC, 0X74, 0XF3, 0XD7, 0X7E, 0XEF, 0XFF, 0XE7, 0XFF, 0XAE, 0X7C,
+    0X7D, 0XB8, 0XD7, 0XFF, 0XEF, 0XDF, 0XFF, 0XFF, 0XE7, 0XFF, 0XC7, 0XDF, 0X7D, 0X98, 0X96, 0X1B,
+    0XDF, 0XBF, 0XC7, 0X3F, 0X44, 0X13, 0XC7, 0XFF, 0XDF, 0XFF, 0XAE, 0X1B, 0X8D, 0X38, 0XD7, 0XBF,
+    0XDF, 0XFF, 0X7D, 0X17, 0XA5, 0XBB, 0XF7, 0XFF, 0XBF, 0X9F, 0X75, 0X57, 0XBE, 0X5D, 0XEF, 0X9F,
+    0XCF, 0XBF, 0X5C, 0X53, 0XCF, 0X1F, 0XF7, 0XDF, 0XE7, 0XFF, 0XEF, 0XFF, 0XF7, 0XFF, 0XFF, 0XFF,
+    0XFF, 0XBE, 0XFF, 0XFC, 0XEF, 0X94, 0XC6, 0X8A, 0XA6, 0X23, 0XA6, 0X61, 0XAE, 0XA2, 0XA6, 0X81,
+    0XA6, 0X61, 0XA6, 0X61, 0XA6, 0X81, 0XA6, 0X80, 0XAE, 0X80, 0XAE, 0X60, 0XAE, 0X60, 0XAE, 0X60,
+    0XAE, 0X60, 0XA6, 0X61, 0XA6, 0X61, 0XAE, 0X60, 0XAE, 0X60, 0XAE, 0X60, 0XAE, 0X60, 0XAE, 0X60,
+    0XAE, 0X60, 0XAE, 0X60, 0XAE, 0X40, 0XAE, 0X40, 0XAE, 0X40, 0XAE, 0X40, 0XAE, 0X60, 0XAE, 0X60,
+    0XAE, 0X80, 0XAE, 0X80, 0XAE, 0X80, 0XAE, 0X80, 0XAE, 0X80, 0XAE, 0X60, 0XAE, 0X60, 0XAE, 0X60,
+    0XAE, 0X40, 0XAE, 0X40, 0XAE, 0X60, 0XAE, 0X60, 0XAE, 0X60, 0XAE, 0X60, 0XAE, 0X60, 0XAE, 0X60,
+    0XAE, 0X60, 0XAE, 0X60, 0XAE, 0X61, 0XAE, 0X60, 0XAE, 0X60, 0XAE, 0X60, 0XAE, 0X41, 0XAE, 0X41,
+    0XAE, 0X60, 0XAE, 0X40, 0XAE, 0X42, 0XC6, 0XCB, 0XEF, 0XB8, 0XFF, 0XFF, 0XFF, 0XFF, 0XF7, 0XFF,
+    0XA6, 0X9C, 0X6D, 0X16, 0XD7, 0X9F, 0XF7, 0XFF, 0XF7, 0XFF, 0XEF, 0XFF, 0XDF, 0XFF, 0X8D, 0X56,
+    0X95, 0X99, 0XE7, 0XFF, 0XE7, 0XFF, 0XB7, 0X1F, 0X54, 0X33, 0XD7, 0XFF, 0XF7, 0XFF, 0XBE, 0XDD,
+    0X6D, 0X38, 0XB7, 0X7F, 0XE7, 0XFF, 0XDF, 0XFF, 0X5C, 0XD5, 0X9E, 0X7B, 0XEF, 0XFF, 0XD7, 0X9F,
+    0X65, 0X38, 0X8E, 0XBF, 0XCF, 0XDF, 0X6C, 0X96, 0X8E, 0X3C, 0XDF, 0XFF, 0XE7, 0XFF, 0XAE, 0X5B,
+    0X64, 0XF7, 0XC7, 0XFF, 0XDF, 0XFF, 0XEF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0X7D, 0X9C, 0X75, 0XDD,
+    0XD7, 0XFF, 0XE7, 0XFF, 0XBF, 0X7F, 0X75, 0X16, 0XC6, 0XDB, 0XEF, 0XFF, 0XC7, 0XBF, 0X54, 0X56,
+    0XBE, 0XDE, 0XEF, 0XFF, 0XCF, 0XFF, 0X75, 0X38, 0XB6, 0X7C, 0XE7, 0XFF, 0XBF, 0X9F, 0X44, 0X14,
+    0X5D, 0X18, 0XC7, 0XDF, 0XDF, 0XFF, 0XA6, 0X3B, 0X6D, 0X38, 0XBF, 0XBF, 0XDF, 0XFF, 0XEF, 0XFF,
+    0XF7, 0XFF, 0XEF, 0XFF, 0X9E, 0X7B, 0X75, 0X37, 0XDF, 0XDF, 0XDF, 0XBF, 0X7D, 0X78, 0X8E, 0X19,
+    0XEF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFE, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XDF, 0XFF, 0XFF,
+    0XF7, 0XDF, 0XEF, 0XFF, 0XDF, 0XFF, 0X5C, 0XB4, 0X96, 0X7B, 0XD7, 0XFF, 0XDF, 0XFF, 0XF7, 0XFF,
+    0XFF, 0XDF, 0XEF, 0XBF, 0X54, 0XB3, 0X9F, 0X9E, 0XD7, 0XFF, 0XAE, 0XFF, 0X7D, 0X5A, 0XBF, 0X5F,
+    0XDF, 0XFF, 0XC7, 0X5F, 0XDF, 0X9F, 0XEF, 0XFF, 0XBF, 0X7F, 0X7D, 0X37, 0XC6, 0X7D, 0XEF, 0XDF,
+    0XCF, 0XBF, 0XA6, 0XBC, 0XEF, 0XFF, 0XF7, 0XFF, 0XBE, 0XDD, 0X74, 0XD5, 0XDF, 0X7F, 0XF7, 0XFF,
+    0XE7, 0XFF, 0XA6, 0X5B, 0X7D, 0X77, 0XD7, 0XFF, 0XEF, 0XBF, 0XF7, 0XFF, 0XDF, 0XFF, 0XCF, 0XDF,
+    0X75, 0X78, 0X9E, 0X5C, 0XE7, 0XFF, 0XC7, 0X3F, 0X4C, 0X33, 0XC7, 0XFF, 0XDF, 0XFF, 0XA6, 0X3C,
+    0X8D, 0X58, 0XCF, 0XBF, 0XD7, 0XFF, 0X75, 0X37, 0XA5, 0XDB, 0XE7, 0XFF, 0XBF, 0XBF, 0X75, 0X77,
+    0XB6, 0X7D, 0XEF, 0XFF, 0XBF, 0XBF, 0X54, 0X73, 0XD7, 0X9F, 0XE7, 0XFF, 0XB6, 0XFE, 0XC7, 0X3E,
+    0XF7, 0XFF, 0XFF, 0XFF, 0XFF, 0XDF, 0XFF, 0XFD, 0XF7, 0XD6, 0XC6, 0XAB, 0XAE, 0X23, 0XAE, 0X40,
+    0XAE, 0X80, 0XA6, 0X40, 0XA6, 0X41, 0XA6, 0X41, 0XA6, 0X41, 0XAE, 0X41, 0XAE, 0X40, 0XAE, 0X40,
+    0XAE, 0X40, 0XAE, 0X40, 0XAE, 0X40, 0XAE, 0X40, 0XAE, 0X40, 0XAE, 0X40, 0XAE, 0X40, 0XAE, 0X40,
+    0XAE, 0X40, 0XAE, 0X40, 0XB6, 0X60, 0XB6, 0X81, 0XB6, 0X80, 0XB6, 0X80, 0XB6, 0X60, 0XB6, 0X60,
+    0XB6, 0X80, 0XBE, 0XA0, 0XAE, 0X60, 0XAE, 0X60, 0XAE, 0X60, 0XAE, 0X60, 0XA6, 0X40, 0XA6, 0X40,
+    0XA6, 0X40, 0XA6, 0X20, 0XAE, 0X40, 0XAE, 0X40, 0XAE, 0X40, 0XAE, 0X40, 0XAE, 0X41, 0XAE, 0X61,
+    0XAE, 0X61, 0XAE, 0X61, 0XAE, 0X60, 0XAE, 0X60, 0XAE, 0X60, 0XAE, 0X60, 0XAE, 0X60, 0XAE, 0X60,
+    0XAE, 0X41, 0XAE, 0X41, 0XAE, 0X60, 0XAE, 0X40, 0XAE, 0X43, 0XC6, 0XCB, 0XEF, 0XB8, 0XFF, 0XFF,
+    0XFF, 0XFF, 0XEF, 0XFF, 0XA6, 0XBD, 0X6D, 0X36, 0XC7, 0X9F, 0XE7, 0XFF, 0XE7, 0XFF, 0XE7, 0XFF,
+    0XD7, 0XFF, 0X85, 0X77, 0X8D, 0X98, 0XD7, 0XFF, 0XDF, 0XFF, 0XAE, 0XFF, 0X54, 0X74, 0XC7, 0X9F,
+    0XE7, 0XFF, 0XBF, 0X1E, 0X64, 0XF7, 0XA7, 0X3F, 0XDF, 0XFF, 0XCF, 0XFF, 0X4C, 0XB4, 0X8E, 0X9A,
+    0XE7, 0XFF, 0XD7, 0XFF, 0X5D, 0X17, 0X96, 0XBE, 0XDF, 0XFF, 0X95, 0XDA, 0X5C, 0XB6, 0XC7, 0XFF,
+    0XCF, 0XFF, 0X7D, 0X97, 0X6D, 0X79, 0XBF, 0XFF, 0XD7, 0XFF, 0XE7, 0XFF, 0XF7, 0XDF, 0XEF, 0XFF,
+    0X7D, 0XBB, 0X75, 0XFD, 0XCF, 0XFF, 0XDF, 0XFF, 0XB7, 0X5F, 0X6C, 0XF5, 0XBE, 0XDB, 0XEF, 0XFF,
+    0XC7, 0XDF, 0X5C, 0X97, 0XBE, 0XBC, 0XEF, 0XFF, 0XCF, 0XBF, 0X75, 0X17, 0XB6, 0X7C, 0XE7, 0XDF,
+    0XDF, 0XFF, 0X5C, 0XD6, 0X64, 0XF7, 0XD7, 0XFF, 0XE7, 0XFF, 0XAE, 0X5C, 0X6D, 0X18, 0XC7, 0XDF,
+    0XE7, 0XFF, 0XEF, 0XFF, 0XF7, 0XFF, 0XF7, 0XFF, 0X9E, 0X7A, 0X6C, 0XF5, 0XDF, 0X7F, 0XE7, 0XFF,
+    0X96, 0X3B, 0X7D, 0X56, 0XE7, 0X9F, 0XFF, 0XDF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
+    0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XF7, 0XFF, 0XE7, 0XFF, 0X64, 0XB4, 0X96, 0X7B, 0XDF, 0XFF,
+    0XE7, 0XFF, 0XF7, 0XFF, 0XFF, 0XBF, 0XEF, 0X9F, 0X5C, 0XB3, 0X9F, 0X5D, 0XD7, 0XFF, 0XAE, 0XDF,
+    0X7D, 0X59, 0XBF, 0X5F, 0XD7, 0XFF, 0X96, 0X1C, 0XA6, 0X1C, 0XD7, 0XDF, 0XC7, 0XBF, 0X7D, 0X79,
+    0XB6, 0X5D, 0XEF, 0XFF, 0XA6, 0XDE, 0X75, 0X17, 0XDF, 0XBF, 0XE7, 0X9F, 0XB6, 0XDE, 0X74, 0XF6,
+    0XC7, 0X1F, 0XEF, 0XFF, 0XEF, 0XFF, 0XA6, 0X1A, 0X75, 0X15, 0XD7, 0XDF, 0XEF, 0XDF, 0XFF, 0XFF,
+    0XE7, 0XFF, 0XCF, 0XBF, 0X75, 0X57, 0X9E, 0X7C, 0XE7, 0XFF, 0XBE, 0XFF, 0X54, 0X74, 0XC7, 0XFF,
+    0XDF, 0XFF, 0XB6, 0X9D, 0X85, 0X78, 0XC7, 0X9F, 0XCF, 0XFF, 0X75, 0X57, 0X9D, 0XFA, 0XE7, 0XFF,
+    0XB7, 0X9F, 0X6D, 0X77, 0XBE, 0XFE, 0XE7, 0XFF, 0XB7, 0X7F, 0X54, 0XB4, 0XC7, 0X9F, 0XD7, 0XDF,
+    0X8D, 0XD9, 0X9E, 0X3A, 0XF7, 0XFF, 0XFF, 0XFF, 0XFF, 0XDF, 0XFF, 0XFE, 0XEF, 0XB5, 0XC6, 0XAB,
+    0XAE, 0X23, 0XAE, 0X60, 0XB6, 0XA0, 0XAE, 0X80, 0XAE, 0X61, 0XAE, 0X42, 0XAE, 0X42, 0XAE, 0X42,
+    0XB6, 0X41, 0XB6, 0X41, 0XB6, 0X42, 0XB6, 0X41, 0XB6, 0X41, 0XB6, 0X41, 0XB6, 0X41, 0XB6, 0X41,
+    0XB6, 0X41, 0XB6, 0X41, 0XB6, 0X41, 0XB6, 0X61, 0XA5, 0XE0, 0XAE, 0X00, 0XAE, 0X20, 0XB6, 0X40,
+    0XAE, 0X40, 0XAE, 0X40, 0XAE, 0X40, 0XAE, 0X20, 0XAE, 0X61, 0XAE, 0X61, 0XAE, 0X61, 0XAE, 0X61,
+    0XAE, 0X81, 0XB6, 0X82, 0XB6, 0X82, 0XB6, 0X82, 0XAE, 0X62, 0XAE, 0X61, 0XAE, 0X61, 0XAE, 0X61,
+    0XAE, 0X61, 0XAE, 0X60, 0XAE, 0X60, 0XAE, 0X60, 0XAE, 0X60, 0XAE, 0X60, 0XAE, 0X60, 0XAE, 0X60,
+    0XAE, 0X60, 0XAE, 0X60, 0XAE, 0X61, 0XAE, 0X41, 0XAE, 0X60, 0XAE, 0X40, 0XAE, 0X43, 0XC6, 0XCB,
+    0XEF, 0XB8, 0XFF, 0XFE, 0XFF, 0XFF, 0XEF, 0XFF, 0X9E, 0XBD, 0X4C, 0XB5, 0X86, 0X3B, 0X9E, 0X9C,
+    0X9E, 0X9C, 0XC7, 0XDF, 0XC7, 0XFF, 0X7D, 0XD9, 0X6D, 0X38, 0X8E, 0X3C, 0X96, 0X9E, 0X7D, 0XFB,
+    0X54, 0XD6, 0XAF, 0X7F, 0XDF, 0XFF, 0XAF, 0X1E, 0X64, 0XF7, 0X75, 0XBA, 0X96, 0X5B, 0X96, 0X9B,
+    0X4C, 0XB3, 0X8E, 0XBA, 0XDF, 0XFF, 0XC7, 0X7D, 0X6D, 0X57, 0XA6, 0XDE, 0XDF, 0XFF, 0XC7, 0X3F,
+    0X64, 0XF6, 0XA7, 0X3E, 0XB7, 0XBF, 0X6D, 0X76, 0X6D, 0X98, 0X96, 0X9D, 0XA6, 0XBD, 0XB6, 0XBC,
+    0XD7, 0X3C, 0XEF, 0XFF, 0X7D, 0XBA, 0X7D, 0XFB, 0XD7, 0XFF, 0XDF, 0XFF, 0XBF, 0X7F, 0X75, 0X15,
+    0XBE, 0XBA, 0XE7, 0XFF, 0XBF, 0X7F, 0X64, 0X75, 0XC6, 0XBC, 0XF7, 0XFF, 0XCF, 0X9F, 0X8D, 0X78,
+    0XBE, 0X7B, 0XEF, 0XDF, 0XE7, 0XFF, 0X96, 0X3B, 0X6C, 0XF7, 0XCF, 0XBF, 0XE7, 0XFF, 0XA6, 0X1A,
+    0X5C, 0X55, 0X96, 0X3C, 0XA6, 0X3B, 0XBE, 0X5B, 0XE7, 0X9F, 0XF7, 0XFF, 0XA6, 0X9B, 0X7D, 0X16,
+    0XDF, 0X7F, 0XE7, 0XDF, 0XAE, 0XDD, 0X7D, 0X35, 0XD7, 0X1D, 0XFF, 0XBF, 0XFF, 0XFF, 0XFF, 0XDE,
+    0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XF7, 0XBF, 0XEF, 0XFF, 0XE7, 0XFF, 0X5C, 0X52,
+    0X7D, 0X56, 0XA6, 0X7B, 0XA5, 0XFA, 0XCE, 0X9C, 0XFF, 0X9F, 0XFF, 0XDF, 0X64, 0XF3, 0XA7, 0X1C,
+    0XDF, 0XFF, 0XBE, 0XDE, 0X74, 0XF7, 0X96, 0X1C, 0XA6, 0XFF, 0X6D, 0X38, 0X8D, 0XDB, 0XCF, 0XFF,
+    0XBF, 0XFF, 0X75, 0X98, 0X85, 0X79, 0X9E, 0X5C, 0X7D, 0XFA, 0X65, 0X37, 0XCF, 0XBF, 0XDF, 0XFF,
+    0XB7, 0X5F, 0X6D, 0X37, 0X96, 0X1B, 0XCF, 0X9F, 0XE7, 0XFF, 0XB6, 0X7B, 0X85, 0X55, 0XDF, 0XDF,
+    0XF7, 0XDF, 0XFF, 0XFF, 0XEF, 0XFF, 0XCF, 0XBF, 0X85, 0X77, 0X85, 0X78, 0XAE, 0X3C, 0X95, 0X79,
+    0X5C, 0X74, 0XCF, 0XFF, 0XD7, 0XBF, 0XAE, 0X5B, 0X8D, 0X98, 0XC7, 0XBF, 0XD7, 0XFF, 0X7D, 0X76,
+    0XA6, 0X3A, 0XE7, 0XFF, 0XB7, 0X9F, 0X7D, 0XB7, 0XB6, 0XFD, 0XE7, 0XFF, 0XAF, 0X5E, 0X5C, 0XD4,
+    0X8D, 0XF9, 0X9E, 0X5B, 0X6C, 0XF6, 0X95, 0XF9, 0XF7, 0XFF, 0XFF, 0XFF, 0XFF, 0XDF, 0XFF, 0XFE,
+    0XEF, 0XB5, 0XC6, 0XAB, 0XAE, 0X22, 0XAE, 0X60, 0XAE, 0X60, 0XAE, 0X40, 0XAE, 0X61, 0XAE, 0X42,
+    0XAE, 0X42, 0XAE, 0X42, 0XB6, 0X41, 0XB6, 0X41, 0XB6, 0X41, 0XB6, 0X41, 0XB6, 0X41, 0XB6, 0X40,
+    0XB6, 0X40, 0XB6, 0X40, 0XB6, 0X41, 0XB6, 0X41, 0XB6, 0X41, 0XAE, 0X41, 0XB6, 0X82, 0XB6, 0X61,
+    0XAE, 0X41, 0XAE, 0X41, 0XAE, 0X41, 0XAE, 0X61, 0XAE, 0X61, 0XAE, 0X61, 0XAE, 0X42, 0XAE, 0X42,
+    0XAE, 0X42, 0XAE, 0X42, 0XAE, 0X42, 0XAE, 0X41, 0XAE, 0X41, 0XAE, 0X41, 0XAE, 0X41, 0XAE, 0X40,
+    0XAE, 0X41, 0XAE, 0X60, 0XAE, 0X60, 0XAE, 0X60, 0XAE, 0X60, 0XAE, 0X60, 0XAE, 0X60, 0XAE, 0X60,
+    0XAE, 0X60, 0XAE, 0X60, 0XAE, 0X60, 0XAE, 0X60, 0XAE, 0X61, 0XAE, 0X41, 0XAE, 0X60, 0XAE, 0X41,
+    0XAE, 0X43, 0XC6, 0XCB, 0XEF, 0XB7, 0XFF, 0XFD, 0XFF, 0XFE, 0XF7, 0XFF, 0XBF, 0X5E, 0X54, 0X74,
+    0X75, 0X36, 0X7D, 0X57, 0X85, 0X97, 0XCF, 0XBF, 0XDF, 0XFF, 0XAE, 0XDD, 0X75, 0X37, 0X64, 0XD6,
+    0X64, 0XD6, 0X6D, 0X37, 0X85, 0X99, 0XD7, 0XFF, 0XE7, 0XFF, 0XC7, 0X5F, 0X96, 0X1C, 0X6C, 0XF7,
+    0X64, 0X94, 0X7D, 0X76, 0X6D, 0X76, 0XBF, 0XBE, 0XE7, 0XFF, 0XD7, 0X9D, 0X95, 0XD9, 0XC7, 0X1E,
+    0XEF, 0XDF, 0XEF, 0XFF, 0X9E, 0X1A, 0X96, 0X3A, 0XC7, 0XDF, 0X7D, 0XB7, 0X6D, 0X16, 0X64, 0XB5,
+    0X74, 0XF5, 0X95, 0X56, 0XD6, 0XDB, 0XF7, 0XFF, 0X9E, 0X3B, 0X96, 0X1B, 0XD7, 0XDF, 0XE7, 0XFF,
+    0XCF, 0X9E, 0X95, 0X96, 0XDF, 0X5C, 0XF7, 0XFF, 0XDF, 0XFF, 0X8D, 0X57, 0XD7, 0X1D, 0XF7, 0XFF,
+    0XDF, 0XBF, 0XAE, 0X1A, 0XCE, 0X9B, 0XFF, 0XFF, 0XEF, 0XFF, 0XCF, 0X7F, 0X9D, 0XDA, 0XE7, 0XFF,
+    0XF7, 0XFF, 0XCE, 0XFD, 0X74, 0XB6, 0X85, 0X38, 0X74, 0X94, 0X95, 0X15, 0XDF, 0X1D, 0XEF, 0XFF,
+    0XB6, 0XFB, 0X95, 0XB8, 0XF7, 0XFF, 0XF7, 0XFF, 0XD7, 0XBF, 0X95, 0XD8, 0XCE, 0XBB, 0XFF, 0XBF,
+    0XFF, 0XFF, 0XFF, 0XDE, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XDF, 0XFF, 0XFF, 0XF7, 0XFF,
+    0XEF, 0XFF, 0X7C, 0XF4, 0X7C, 0XF5, 0X74, 0XD4, 0X7C, 0X93, 0XC6, 0X7B, 0XFF, 0X7F, 0XFF, 0XFF,
+    0X7D, 0X34, 0XB7, 0X5C, 0XEF, 0XFF, 0XDF, 0X9F, 0X85, 0X17, 0X85, 0X58, 0X75, 0X37, 0X74, 0XF6,
+    0XB6, 0XBD, 0XE7, 0XFF, 0XD7, 0XFF, 0X8D, 0XF9, 0X85, 0X37, 0X7C, 0XF6, 0X75, 0X56, 0X8E, 0X19,
+    0XDF, 0XFF, 0XEF, 0XFF, 0XCF, 0XDF, 0X7D, 0X57, 0X7D, 0X16, 0XB6, 0X9B, 0XE7, 0XDF, 0XC6, 0XDC,
+    0X9D, 0XD7, 0XE7, 0XFF, 0XF7, 0XDF, 0XF7, 0XBF, 0XF7, 0XFF, 0XDF, 0XBF, 0XA6, 0X5A, 0X7C, 0XF5,
+    0X84, 0XB5, 0X7C, 0X95, 0X7D, 0X36, 0XE7, 0XFF, 0XE7, 0XFF, 0XBE, 0X9C, 0XA5, 0XF8, 0XDF, 0XDF,
+    0XE7, 0XFF, 0X95, 0XB7, 0XBE, 0X9B, 0XEF, 0XFF, 0XC7, 0XBF, 0X8D, 0XF8, 0XC7, 0X1E, 0XEF, 0XFF,
+    0XD7, 0XFF, 0X85, 0X97, 0X74, 0XB4, 0X85, 0X37, 0X7D, 0X36, 0XBE, 0XFC, 0XF7, 0XFF, 0XFF, 0XFF,
+    0XFF, 0XFF, 0XFF, 0XFD, 0XE7, 0X94, 0XC6, 0XAB, 0XAE, 0X43, 0XA6, 0X60, 0XAE, 0X80, 0XAE, 0X80,
+    0XAE, 0X60, 0XAE, 0X60, 0XAE, 0X60, 0XAE, 0X60, 0XAE, 0X60, 0XAE, 0X60, 0XB6, 0X40, 0XB6, 0X40,
+    0XB6, 0X40, 0XAE, 0X40, 0XB6, 0X40, 0XAE, 0X40, 0XAE, 0X40, 0XAE, 0X40, 0XAE, 0X41, 0XAE, 0X41,
+    0XAE, 0X41, 0XAE, 0X41, 0XAE, 0X41, 0XAE, 0X41, 0XAE, 0X41, 0XAE, 0X41, 0XAE, 0X61, 0XAE, 0X41,
+    0XAE, 0X42, 0XAE, 0X42, 0XAE, 0X42, 0XAE, 0X42, 0XAE, 0X41, 0XAE, 0X61, 0XAE, 0X61, 0XAE, 0X60,
+    0XAE, 0X60, 0XAE, 0X60, 0XAE, 0X60, 0XAE, 0X60, 0XAE, 0X60, 0XAE, 0X60, 0XAE, 0X60, 0XAE, 0X60,
+    0XAE, 0X60, 0XAE, 0X61, 0XAE, 0X60, 0XAE, 0X60, 0XAE, 0X60, 0XAE, 0X60, 0XAE, 0X41, 0XAE, 0X42,
+    0XAE, 0X61, 0XAE, 0X61, 0XAE, 0X43, 0XC6, 0XCB, 0XF7, 0XD7, 0XFF, 0XFC, 0XFF, 0XFC, 0XFF, 0XFD,
+    0XF7, 0XFF, 0XF7, 0XFF, 0XF7, 0XFF, 0XF7, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
+    0XF7, 0XFF, 0XF7, 0XFF, 0XF7, 0XFF, 0XF7, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
+    0XF7, 0XFF, 0XF7, 0XFF, 0XF7, 0XFF, 0XEF, 0XFF, 0XE7, 0XFF, 0XEF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
+    0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XDF, 0XFF, 0XDF, 0XF7, 0XFF, 0XEF, 0XFF, 0XEF, 0XFF, 0XE7, 0XFF,
+    0XE7, 0XFF, 0XEF, 0XFF, 0XF7, 0XFF, 0XFF, 0XFF, 0XFF, 0XDF, 0XFF, 0XDF, 0XF7, 0XFF, 0XEF, 0XFF,
+    0XF7, 0XFF, 0XFF, 0XFF, 0XF7, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
+    0XFF, 0XFF, 0XFF, 0XFF, 0XF7, 0XFF, 0XF7, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XF7, 0XFF, 0XF7, 0XFF,
+    0XEF, 0XFF, 0XF7, 0XFF, 0XF7, 0XFF, 0XF7, 0XFF, 0XEF, 0XFF, 0XEF, 0XFF, 0XF7, 0XFF, 0XF7, 0XFF,
+    0XFF, 0XFF, 0XF7, 0XFF, 0XE7, 0XFF, 0XEF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XEF, 0XFF, 0XEF, 0XFF,
+    0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
+    0XFF, 0XFF, 0XFF, 0XFF, 0XF7, 0XFF, 0XF7, 0XFF, 0XEF, 0XFF, 0XEF, 0XFF, 0XF7, 0XFF, 0XFF, 0XFF,
+    0XFF, 0XDF, 0XFF, 0XDF, 0XEF, 0XFF, 0XE7, 0XFF, 0XF7, 0XFF, 0XFF, 0XFF, 0XEF, 0XFF, 0XEF, 0XFF,
+    0XF7, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XF7, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
+    0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
+    0XFF, 0XFF, 0XFF, 0XFF, 0XF7, 0XFF, 0XF7, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XF7, 0XFF,
+    0XEF, 0XFF, 0XEF, 0XFF, 0XF7, 0XFF, 0XF7, 0XFF, 0XEF, 0XFF, 0XEF, 0XFF, 0XF7, 0XFF, 0XFF, 0XFF,
+    0XFF, 0XFF, 0XFF, 0XFF, 0XF7, 0XFF, 0XF7, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XF7, 0XFF, 0XF7, 0XFF,
+    0XFF, 0XFF, 0XFF, 0XFF, 0XF7, 0XFF, 0XEF, 0XFF, 0XF7, 0XFF, 0XF7, 0XFF, 0XF7, 0XFF, 0XF7, 0XFF,
+    0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFD, 0XE7, 0X95, 0XBE, 0XAC, 0XAE, 0X45, 0XA6, 0X42,
+    0XA6, 0X42, 0XA6, 0X42, 0XA6, 0X22, 0XA6, 0X23, 0XAE, 0X22, 0XAE, 0X22, 0XAE, 0X21, 0XAE, 0X21,
+    0XAE, 0X22, 0XAE, 0X22, 0XAE, 0X23, 0XAE, 0X23, 0XAE, 0X23, 0XAE, 0X23, 0XAE, 0X23, 0XAE, 0X23,
+    0XAE, 0X23, 0XAE, 0X23, 0XAE, 0X23, 0XAE, 0X23, 0XAE, 0X23, 0XA6, 0X23, 0XAE, 0X24, 0XA6, 0X24,
+    0XA6, 0X24, 0XA6, 0X24, 0XAE, 0X24, 0XAE, 0X24, 0XAE, 0X24, 0XAE, 0X23, 0XAE, 0X23, 0XAE, 0X23,
+    0XAE, 0X23, 0XAE, 0X22, 0XAE, 0X22, 0XAE, 0X22, 0XAE, 0X22, 0XAE, 0X22, 0XAE, 0X22, 0XAE, 0X22,
+    0XAE, 0X22, 0XAE, 0X22, 0XAE, 0X23, 0XAE, 0X23, 0XAE, 0X23, 0XAE, 0X23, 0XAE, 0X22, 0XAE, 0X22,
+    0XAE, 0X04, 0XAE, 0X04, 0XAE, 0X03, 0XAE, 0X04, 0XAE, 0X05, 0XC6, 0X8C, 0XEF, 0X97, 0XFF, 0XFD,
+    0XFF, 0XFC, 0XFF, 0XFD, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XDF,
+    0XFF, 0XDF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XDF, 0XFF, 0XDF,
+    0XFF, 0XDF, 0XFF, 0XFF, 0XFF, 0XDF, 0XFF, 0XDF, 0XFF, 0XFF, 0XFF, 0XFF, 0XF7, 0XFF, 0XF7, 0XFF,
+    0XFF, 0XFE, 0XFF, 0XDE, 0XFF, 0XDF, 0XFF, 0XDF, 0XFF, 0XBF, 0XFF, 0XBF, 0XFF, 0XDF, 0XFF, 0XFF,
+    0XF7, 0XFF, 0XF7, 0XFF, 0XF7, 0XFF, 0XF7, 0XFF, 0XFF, 0XFF, 0XFF, 0XDF, 0XFF, 0XDF, 0XFF, 0XDF,
+    0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XDF, 0XFF, 0XDF,
+    0XFF, 0XDF, 0XFF, 0XDF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
+    0XFF, 0XFF, 0XFF, 0XFF, 0XF7, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XF7, 0XFF, 0XF7, 0XFF,
+    0XF7, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XEF, 0XFF, 0XEF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
+    0XEF, 0XFF, 0XEF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
+    0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XF7, 0XFF, 0XF7, 0XFF, 0XF7, 0XFF,
+    0XF7, 0XFF, 0XFF, 0XFF, 0XFF, 0XDF, 0XFF, 0XDF, 0XF7, 0XFF, 0XEF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
+    0XF7, 0XFF, 0XF7, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XDF, 0XFF, 0XDF, 0XFF, 0XFF, 0XFF, 0XFF,
+    0XFF, 0XDF, 0XFF, 0XDF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XDF, 0XFF, 0XDF, 0XFF, 0XFF, 0XFF, 0XFF,
+    0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
+    0XFF, 0XFF, 0XFF, 0XFF, 0XF7, 0XFF, 0XF7, 0XFF, 0XF7, 0XFF, 0XF7, 0XFF, 0XF7, 0XFF, 0XF7, 0XFF,
+    0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XDF, 0XFF, 0XDF,
+    0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
+    0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XEF, 0XD9, 0XD7, 0X32,
+    0XC6, 0XED, 0XBE, 0XEB, 0XBE, 0XEB, 0XBE, 0XCB, 0XBE, 0XAB, 0XBE, 0XAB, 0XBE, 0XAB, 0XBE, 0XCB,
+    0XC6, 0XAB, 0XC6, 0XAB, 0XC6, 0XAC, 0XC6, 0XAD, 0XC6, 0XAC, 0XC6, 0XAC, 0XC6, 0XAC, 0XC6, 0XAC,
+    0XC6, 0XAC, 0XC6, 0XAC, 0XC6, 0XAC, 0XC6, 0XAC, 0XC6, 0XAC, 0XBE, 0XAC, 0XBE, 0XAC, 0XBE, 0XAC,
+    0XBE, 0XAD, 0XBE, 0XAD, 0XBE, 0XAD, 0XBE, 0XAC, 0XC6, 0XAB, 0XC6, 0XAB, 0XC6, 0XAB, 0XC6, 0XAB,
+    0XC6, 0XAB, 0XC6, 0XAB, 0XC6, 0XAB, 0XC6, 0XAB, 0XC6, 0XAB, 0XC6, 0XAB, 0XC6, 0XAB, 0XC6, 0XAB,
+    0XC6, 0XAB, 0XC6, 0XAB, 0XC6, 0XAB, 0XC6, 0XAC, 0XC6, 0XAC, 0XC6, 0XAC, 0XC6, 0XAC, 0XC6, 0XAB,
+    0XC6, 0XAB, 0XC6, 0XAB, 0XC6, 0X8D, 0XC6, 0X8D, 0XC6, 0X8C, 0XC6, 0XAC, 0XC6, 0XAD, 0XD7, 0X13,
+    0XF7, 0XBC, 0XFF, 0XFF, 0XFF, 0XFE, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XF7, 0XFF, 0XF7, 0XFF,
+    0XF7, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XF7, 0XFF, 0XF7, 0XFF, 0XF7, 0XFF, 0XFF, 0XFF,
+    0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XDF, 0XFF, 0XDF, 0XFF, 0XFF, 0XFF, 0XFF,
+    0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFE, 0XFF, 0XFE, 0XFF, 0XDF, 0XFF, 0XDF, 0XFF, 0XBE, 0XFF, 0XDE,
+    0XFF, 0XDF, 0XFF, 0XFF, 0XFF, 0XFF, 0XF7, 0XFF, 0XF7, 0XFF, 0XF7, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
+    0XFF, 0XDF, 0XFF, 0XDF, 0XFF, 0XDF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
+    0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XDF, 0XFF, 0XFF, 0XFF, 0XFE, 0XFF, 0XFE, 0XFF, 0XFF, 0XFF, 0XFF,
+    0XFF, 0XFE, 0XFF, 0XFE, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFE, 0XFF, 0XFF,
+    0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XEF, 0XFF, 0XF7, 0XFF,
+    0XFF, 0XDF, 0XFF, 0XDF, 0XF7, 0XFF, 0XF7, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
+    0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFE, 0XFF, 0XFF, 0XFF, 0XFF,
+    0XFF, 0XFF, 0XF7, 0XFF, 0XF7, 0XFF, 0XFF, 0XFF, 0XFF, 0XDF, 0XFF, 0XDF, 0XF7, 0XFF, 0XF7, 0XFF,
+    0XFF, 0XFF, 0XFF, 0XDF, 0XFF, 0XFF, 0XF7, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
+    0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
+    0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
+    0XFF, 0XFE, 0XFF, 0XFE, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
+    0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
+    0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
+    0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
+    0XFF, 0XFC, 0XEF, 0XF8, 0XE7, 0XD5, 0XEF, 0XF5, 0XEF, 0XF5, 0XEF, 0XF6, 0XE7, 0XD6, 0XE7, 0XD6,
+    0XE7, 0XD5, 0XE7, 0XD5, 0XEF, 0XD5, 0XEF, 0XB6, 0XEF, 0XB8, 0XEF, 0XB8, 0XEF, 0XB7, 0XEF, 0XB6,
+    0XEF, 0XB6, 0XEF, 0XB6, 0XEF, 0XB6, 0XEF, 0XB6, 0XEF, 0XB6, 0XEF, 0XB6, 0XEF, 0XB6, 0XEF, 0XB6,
+    0XEF, 0XB6, 0XEF, 0XB6, 0XEF, 0XB6, 0XEF, 0XB6, 0XEF, 0XB6, 0XEF, 0XB6, 0XEF, 0XD5, 0XEF, 0XD5,
+    0XEF, 0XD5, 0XEF, 0XD5, 0XEF, 0XD5, 0XEF, 0XD5, 0XEF, 0XD5, 0XEF, 0XD5, 0XEF, 0XD5, 0XEF, 0XB6,
+    0XEF, 0XB6, 0XEF, 0XB6, 0XEF, 0XB7, 0XEF, 0XB7, 0XEF, 0XB7, 0XEF, 0XB7, 0XEF, 0XB7, 0XEF, 0XB6,
+    0XEF, 0XB6, 0XEF, 0XB6, 0XEF, 0XB5, 0XEF, 0XB5, 0XEF, 0XB7, 0XEF, 0X98, 0XEF, 0XB6, 0XEF, 0XD7,
+    0XEF, 0XB7, 0XF7, 0XBA, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
+    0XF7, 0XFF, 0XEF, 0XFF, 0XF7, 0XFF, 0XF7, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XF7, 0XFF, 0XEF, 0XFF,
+    0XF7, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
+    0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFE, 0XFF, 0XFE, 0XFF, 0XDF, 0XFF, 0XDF,
+    0XFF, 0XFE, 0XFF, 0XFE, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XF7, 0XFF, 0XF7, 0XFF,
+    0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
+    0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFE, 0XFF, 0XFE,
+    0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFE, 0XFF, 0XFD, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XDF, 0XFF, 0XFF,
+    0XFF, 0XFE, 0XFF, 0XFE, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
+    0XF7, 0XFF, 0XF7, 0XFF, 0XFF, 0XDF, 0XFF, 0XDF, 0XF7, 0XFF, 0XF7, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
+    0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFE, 0XFF, 0XFE,
+    0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XDF, 0XFF, 0XDE,
+    0XFF, 0XFE, 0XFF, 0XFE, 0XFF, 0XDF, 0XFF, 0XDF, 0XFF, 0XFF, 0XF7, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
+    0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
+    0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
+    0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFE, 0XFF, 0XFE, 0XFF, 0XFE, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
+    0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFE, 0XFF, 0XFE, 0XFF, 0XFF, 0XFF, 0XFF,
+    0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
+    0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
+    0XFF, 0XFE, 0XFF, 0XFE, 0XFF, 0XFC, 0XFF, 0XFB, 0XFF, 0XFB, 0XFF, 0XFB, 0XFF, 0XFC, 0XFF, 0XFD,
+    0XFF, 0XFD, 0XFF, 0XFD, 0XFF, 0XFC, 0XFF, 0XFC, 0XFF, 0XFD, 0XFF, 0XFE, 0XFF, 0XFF, 0XFF, 0XFF,
+    0XFF, 0XFD, 0XFF, 0XFC, 0XFF, 0XFC, 0XFF, 0XFC, 0XFF, 0XFC, 0XFF, 0XFC, 0XFF, 0XFC, 0XFF, 0XFC,
+    0XFF, 0XFC, 0XFF, 0XFC, 0XFF, 0XFD, 0XFF, 0XFC, 0XFF, 0XFC, 0XFF, 0XFC, 0XFF, 0XFC, 0XFF, 0XFD,
+    0XFF, 0XFD, 0XFF, 0XFD, 0XFF, 0XFD, 0XFF, 0XFD, 0XFF, 0XFD, 0XFF, 0XFD, 0XFF, 0XFD, 0XFF, 0XFD,
+    0XFF, 0XFD, 0XFF, 0XFE, 0XFF, 0XFE, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
+    0XFF, 0XFE, 0XFF, 0XFE, 0XFF, 0XFD, 0XFF, 0XFD, 0XFF, 0XFC, 0XFF, 0XFD, 0XFF, 0XFF, 0XFF, 0XFF,
+    0XFF, 0XFE, 0XFF, 0XFD, 0XFF, 0XFD, 0XFF, 0XFF, 0XFF, 0XDF, 0XFF, 0XDF, 0XFF, 0XDF, 0XFF, 0XFF,
+    0XFF, 0XFF, 0XFF, 0XFF, 0XF7, 0XFF, 0XF7, 0XFF, 0XF7, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
+    0XF7, 0XFF, 0XF7, 0XFF, 0XF7, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XF7, 0XFF,
+    0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFE, 0XFF, 0XFE,
+    0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFE, 0XFF, 0XFD, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XF7, 0XFF,
+    0XF7, 0XFF, 0XF7, 0XFF, 0XF7, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
+    0XFF, 0XFF, 0XF7, 0XFF, 0XF7, 0XFF, 0XF7, 0XFF, 0XF7, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
+    0XFF, 0XFE, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFE, 0XFF, 0XFE, 0XFF, 0XFF, 0XFF, 0XDF,
+    0XFF, 0XDF, 0XFF, 0XFF, 0XFF, 0XFE, 0XFF, 0XFE, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
+    0XFF, 0XFF, 0XFF, 0XFF, 0XF7, 0XFF, 0XFF, 0XFF, 0XFF, 0XDF, 0XFF, 0XDF, 0XFF, 0XFF, 0XF7, 0XFF,
+    0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
+    0XFF, 0XFE, 0XFF, 0XFE, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XF7, 0XFF, 0XFF, 0XFF,
+    0XFF, 0XDF, 0XFF, 0XDE, 0XFF, 0XFE, 0XFF, 0XFE, 0XFF, 0XDF, 0XFF, 0XDF, 0XFF, 0XFF, 0XF7, 0XFF,
+    0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
+    0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
+    0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFE, 0XFF, 0XFE, 0XFF, 0XFE, 0XFF, 0XFF,
+    0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFE, 0XFF, 0XFE,
+    0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
+    0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XF7, 0XFF, 0XF7, 0XFF, 0XFF, 0XFF,
+    0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFE, 0XFF, 0XFE, 0XFF, 0XFD, 0XFF, 0XFC, 0XFF, 0XFC, 0XFF, 0XFD,
+    0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFE, 0XFF, 0XFE, 0XFF, 0XFF, 0XFF, 0XFF,
+    0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFE, 0XFF, 0XFE, 0XFF, 0XFE, 0XFF, 0XFE, 0XFF, 0XFE,
+    0XFF, 0XFE, 0XFF, 0XFE, 0XFF, 0XFE, 0XFF, 0XFE, 0XFF, 0XFE, 0XFF, 0XFE, 0XFF, 0XFE, 0XFF, 0XFE,
+    0XFF, 0XFE, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
+    0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XDF,
+    0XFF, 0XDF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
+    0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XDF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XDF, 0XFF, 0XDF, 0XFF, 0XBF,
+    0XFF, 0XDF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFE, 0XF7, 0XFE, 0XF7, 0XFE, 0XF7, 0XFF, 0XFF, 0XFF,
+    0XFF, 0XFF, 0XFF, 0XFE, 0XF7, 0XFE, 0XF7, 0XFE, 0XFF, 0XFE, 0XFF, 0XFE, 0XFF, 0XDE, 0XFF, 0XFE,
+    0XFF, 0XFF, 0XF7, 0XFF, 0XF7, 0XFF, 0XF7, 0XFF, 0XF7, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
+    0XFF, 0XFF, 0XF7, 0XFE, 0XF7, 0XFF, 0XF7, 0XFF, 0XF7, 0XFE, 0XF7, 0XFD, 0XF7, 0XFF, 0XF7, 0XFF,
+    0XFF, 0XFF, 0XF7, 0XFF, 0XF7, 0XFF, 0XEF, 0XFF, 0XF7, 0XFF, 0XF7, 0XFF, 0XF7, 0XFF, 0XFF, 0XFF,
+    0XFF, 0XFF, 0XFF, 0XFE, 0XF7, 0XFF, 0XF7, 0XFF, 0XF7, 0XFF, 0XF7, 0XFF, 0XF7, 0XFF, 0XF7, 0XFF,
+    0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFE, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFE, 0XFF, 0XFE,
+    0XFF, 0XFF, 0XFF, 0XDF, 0XFF, 0XDF, 0XFF, 0XFF, 0XFF, 0XFE, 0XFF, 0XFE, 0XFF, 0XFF, 0XFF, 0XFF,
+    0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XF7, 0XFF, 0XFF, 0XFF, 0XFF, 0XDF, 0XFF, 0XBE,
+    0XFF, 0XFF, 0XF7, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
+    0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFE, 0XFF, 0XFE, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
+    0XF7, 0XFF, 0XFF, 0XFF, 0XFF, 0XDF, 0XFF, 0XDE, 0XFF, 0XFE, 0XFF, 0XFE, 0XFF, 0XDF, 0XFF, 0XBF,
+    0XFF, 0XFF, 0XF7, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
+    0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
+    0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFE,
+    0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
+    0XFF, 0XFE, 0XFF, 0XFE, 0XFF, 0XFF, 0XF7, 0XFF, 0XFF, 0XFF, 0XF7, 0XFF, 0XF7, 0XFF, 0XF7, 0XFF,
+    0XFF, 0XFF, 0XF7, 0XFF, 0XF7, 0XFF, 0XF7, 0XFF, 0XF7, 0XFF, 0XF7, 0XFF, 0XF7, 0XFF, 0XF7, 0XFF,
+    0XF7, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF
+};
+
+#endif
@@ -0,0 +1,33 @@
+/*
+ * Copyright (c) 2022 FuZhou Lockzhiner Electronic Co., Ltd. All rights reserved.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+/* 主机模拟器用的hal_base.h，只保留LCD驱动用到的GPIO寄存器。
+ * 模拟器编译时LCD_REG_WRITE被替换为lcd_sim_reg_write()，不会访问这里的寄存器
+ */
+#ifndef _HAL_BASE_H_
+#define _HAL_BASE_H_
+
+#include <stdint.h>
+
+struct GPIO_REG {
+    volatile uint32_t SWPORT_DR_L;
+    volatile uint32_t SWPORT_DR_H;
+    volatile uint32_t SWPORT_DDR_L;
+    volatile uint32_t SWPORT_DDR_H;
+};
+
+extern struct GPIO_REG g_lcd_sim_gpio0;
+#define GPIO0                   (&g_lcd_sim_gpio0)
+
+#endif
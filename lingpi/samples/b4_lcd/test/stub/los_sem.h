@@ -0,0 +1,26 @@
+/*
+ * Copyright (c) 2022 FuZhou Lockzhiner Electronic Co., Ltd. All rights reserved.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+/* 主机模拟器用的los_sem.h，信号量由POSIX信号量实现 */
+#ifndef _LOS_SEM_H_
+#define _LOS_SEM_H_
+
+#include <stdint.h>
+
+unsigned int LOS_SemCreate(uint16_t count, uint32_t *semHandle);
+unsigned int LOS_SemDelete(uint32_t semHandle);
+unsigned int LOS_SemPend(uint32_t semHandle, uint32_t timeout);
+unsigned int LOS_SemPost(uint32_t semHandle);
+
+#endif
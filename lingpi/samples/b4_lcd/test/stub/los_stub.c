@@ -0,0 +1,174 @@
+/*
+ * Copyright (c) 2022 FuZhou Lockzhiner Electronic Co., Ltd. All rights reserved.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+/* 主机模拟器用的LiteOS接口：任务为pthread线程，信号量为POSIX信号量 */
+#include <pthread.h>
+#include <semaphore.h>
+#include <time.h>
+#include "los_task.h"
+#include "los_sem.h"
+#include "los_tick.h"
+
+#define TASK_MAX                8
+#define SEM_MAX                 16
+#define MSEC_PER_SEC            1000
+#define NSEC_PER_MSEC           1000000
+
+/* 任务号从1开始，0表示不是由LOS_TaskCreate()创建的线程 */
+typedef struct {
+    pthread_t thread;
+    TSK_INIT_PARAM_S param;
+    uint32_t id;
+} los_task_t;
+
+static los_task_t m_tasks[TASK_MAX];
+static uint32_t m_task_num = 0;
+static __thread uint32_t m_cur_task = 0;
+
+static int m_task_fail = 0;
+
+static sem_t m_sems[SEM_MAX];
+static uint32_t m_sem_num = 0;
+
+static pthread_mutex_t m_task_lock;
+static pthread_once_t m_task_lock_once = PTHREAD_ONCE_INIT;
+
+
+static void *los_task_entry(void *arg)
+{
+    los_task_t *task = arg;
+    
+    m_cur_task = task->id;
+    task->param.pfnTaskEntry(task->param.uwArg);
+    return NULL;
+}
+
+
+unsigned int LOS_TaskCreate(unsigned int *taskID, TSK_INIT_PARAM_S *initParam)
+{
+    los_task_t *task = NULL;
+    
+    if (m_task_fail || (m_task_num >= TASK_MAX)) {
+        return LOS_NOK;
+    }
+    task = &m_tasks[m_task_num];
+    task->param = *initParam;
+    task->id = ++m_task_num;
+    if (pthread_create(&task->thread, NULL, los_task_entry, task) != 0) {
+        m_task_num--;
+        return LOS_NOK;
+    }
+    pthread_detach(task->thread);
+    *taskID = task->id;
+    return LOS_OK;
+}
+
+
+void los_stub_set_task_fail(int fail)
+{
+    m_task_fail = fail;
+}
+
+
+uint32_t LOS_CurTaskIDGet(void)
+{
+    return m_cur_task;
+}
+
+
+unsigned int LOS_Msleep(unsigned int msecs)
+{
+    (void)msecs;
+    /* 面板复位等待不影响模拟结果，直接返回 */
+    return LOS_OK;
+}
+
+
+/* LOS_TaskLock()可以嵌套调用，用递归互斥锁模拟 */
+static void los_task_lock_init(void)
+{
+    pthread_mutexattr_t attr;
+    
+    pthread_mutexattr_init(&attr);
+    pthread_mutexattr_settype(&attr, PTHREAD_MUTEX_RECURSIVE);
+    pthread_mutex_init(&m_task_lock, &attr);
+    pthread_mutexattr_destroy(&attr);
+}
+
+
+void LOS_TaskLock(void)
+{
+    pthread_once(&m_task_lock_once, los_task_lock_init);
+    pthread_mutex_lock(&m_task_lock);
+}
+
+
+void LOS_TaskUnlock(void)
+{
+    pthread_mutex_unlock(&m_task_lock);
+}
+
+
+uint64_t LOS_TickCountGet(void)
+{
+    struct timespec ts;
+    
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint64_t)ts.tv_sec * MSEC_PER_SEC + (uint64_t)ts.tv_nsec / NSEC_PER_MSEC;
+}
+
+
+unsigned int LOS_SemCreate(uint16_t count, uint32_t *semHandle)
+{
+    if (m_sem_num >= SEM_MAX) {
+        return LOS_NOK;
+    }
+    if (sem_init(&m_sems[m_sem_num], 0, count) != 0) {
+        return LOS_NOK;
+    }
+    *semHandle = m_sem_num++;
+    return LOS_OK;
+}
+
+
+unsigned int LOS_SemDelete(uint32_t semHandle)
+{
+    if (semHandle >= m_sem_num) {
+        return LOS_NOK;
+    }
+    sem_destroy(&m_sems[semHandle]);
+    return LOS_OK;
+}
+
+
+unsigned int LOS_SemPend(uint32_t semHandle, uint32_t timeout)
+{
+    (void)timeout;
+    if (semHandle >= m_sem_num) {
+        return LOS_NOK;
+    }
+    while (sem_wait(&m_sems[semHandle]) != 0) {
+    }
+    return LOS_OK;
+}
+
+
+unsigned int LOS_SemPost(uint32_t semHandle)
+{
+    if (semHandle >= m_sem_num) {
+        return LOS_NOK;
+    }
+    sem_post(&m_sems[semHandle]);
+    return LOS_OK;
+}
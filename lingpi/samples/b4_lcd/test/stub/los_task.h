@@ -0,0 +1,45 @@
+/*
+ * Copyright (c) 2022 FuZhou Lockzhiner Electronic Co., Ltd. All rights reserved.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+/* 主机模拟器用的los_task.h，任务由pthread线程实现 */
+#ifndef _LOS_TASK_H_
+#define _LOS_TASK_H_
+
+#include <stdint.h>
+
+#define LOS_OK                  0
+#define LOS_NOK                 1
+#define LOS_WAIT_FOREVER        0xFFFFFFFF
+
+typedef void *(*TSK_ENTRY_FUNC)(uint32_t arg);
+
+typedef struct {
+    TSK_ENTRY_FUNC pfnTaskEntry;
+    uint16_t usTaskPrio;
+    uint32_t uwArg;
+    uint32_t uwStackSize;
+    char *pcName;
+} TSK_INIT_PARAM_S;
+
+unsigned int LOS_TaskCreate(unsigned int *taskID, TSK_INIT_PARAM_S *initParam);
+uint32_t LOS_CurTaskIDGet(void);
+unsigned int LOS_Msleep(unsigned int msecs);
+/* 主机上用递归互斥锁模拟禁止任务调度 */
+void LOS_TaskLock(void);
+void LOS_TaskUnlock(void);
+
+/* 仅主机模拟器：fail非0时LOS_TaskCreate()返回失败，用于测试创建任务失败的处理 */
+void los_stub_set_task_fail(int fail);
+
+#endif
@@ -0,0 +1,109 @@
+/*
+ * Copyright (c) 2022 FuZhou Lockzhiner Electronic Co., Ltd. All rights reserved.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+/* 主机模拟器用的lz_hardware.h，只声明LCD驱动用到的部分，由lcd_sim.c实现。
+ * 与SDK一样包含string.h和los_task.h */
+#ifndef _LZ_HARDWARE_H_
+#define _LZ_HARDWARE_H_
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <stdio.h>
+#include <string.h>
+#include "los_task.h"
+
+#define LZ_HARDWARE_SUCCESS     0
+
+/* GPIO0_PC0~GPIO0_PC7对应GPIO0 SWPORT_DR_H寄存器的bit0~bit7 */
+enum {
+    GPIO0_PA0 = 0,
+    GPIO0_PB0 = 8,
+    GPIO0_PC0 = 16,
+    GPIO0_PC1,
+    GPIO0_PC2,
+    GPIO0_PC3,
+    GPIO0_PC4,
+    GPIO0_PC5,
+    GPIO0_PC6,
+    GPIO0_PC7,
+    GPIO_PIN_NUM,
+    INVALID_GPIO = 0xFF
+};
+
+typedef enum {
+    LZGPIO_LEVEL_LOW = 0,
+    LZGPIO_LEVEL_HIGH,
+    LZGPIO_LEVEL_KEEP
+} LzGpioValue;
+
+typedef enum {
+    LZGPIO_DIR_IN = 0,
+    LZGPIO_DIR_OUT,
+    LZGPIO_DIR_KEEP
+} LzGpioDir;
+
+enum {
+    MUX_FUNC4 = 4,
+    PULL_UP = 1,
+    DRIVE_KEEP = 0,
+    FUNC_ID_SPI0 = 0,
+    FUNC_MODE_M1 = 1
+};
+
+enum {
+    SPI_PERWORD_8BITS = 8,
+    SPI_MSB = 0,
+    SPI_MODE_3 = 3,
+    SPI_CMS_ONE_CYCLES = 1
+};
+
+typedef struct {
+    uint32_t gpio;
+    uint32_t func;
+    uint32_t type;
+    uint32_t drv;
+    uint32_t dir;
+    uint32_t val;
+} PinIo;
+
+typedef struct {
+    PinIo cs;
+    PinIo clk;
+    PinIo mosi;
+    PinIo miso;
+    uint32_t id;
+    uint32_t mode;
+} SpiBusIo;
+
+typedef struct {
+    uint32_t bitsPerWord;
+    uint32_t firstBit;
+    uint32_t mode;
+    uint32_t csm;
+    uint32_t speed;
+    bool isSlave;
+} LzSpiConfig;
+
+unsigned int LzGpioInit(uint32_t id);
+unsigned int LzGpioDeinit(uint32_t id);
+unsigned int LzGpioSetDir(uint32_t id, LzGpioDir dir);
+unsigned int LzGpioSetVal(uint32_t id, LzGpioValue val);
+unsigned int LzGpioGetVal(uint32_t id, LzGpioValue *val);
+
+unsigned int SpiIoInit(SpiBusIo bus);
+unsigned int LzSpiInit(unsigned int id, LzSpiConfig conf);
+unsigned int LzSpiDeinit(unsigned int id);
+unsigned int LzSpiWrite(unsigned int id, unsigned int cs, const void *buf, unsigned int len);
+
+#endif
@@ -0,0 +1,693 @@
+#!/usr/bin/env python3
+# Copyright (c) 2022 FuZhou Lockzhiner Electronic Co., Ltd. All rights reserved.
+# Licensed under the Apache License, Version 2.0 (the "License");
+# you may not use this file except in compliance with the License.
+# You may obtain a copy of the License at
+#
+#     http://www.apache.org/licenses/LICENSE-2.0
+#
+# Unless required by applicable law or agreed to in writing, software
+# distributed under the License is distributed on an "AS IS" BASIS,
+# WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+# See the License for the specific language governing permissions and
+# limitations under the License.
+
+"""LCD字体编译工具
+
+从字体源文件中只取出固件用到的字符，生成lcd_show_text()使用的字体
+（lcd_text.h中的lcd_font_t）：每个字形只保存有笔画的最小矩形，点阵按位
+紧密排列，不按字节补齐；字形表按Unicode码点升序排列，记录每个字形在
+点阵中的位偏移。
+
+字体源文件支持：
+    *.ttf/*.otf     TrueType轮廓字体（glyf表），可以生成任意像素高度
+    *.bdf           BDF点阵字体，使用字体自身的大小
+    lcd_font.h      本例程原有的点阵字库，需用--size选择12/16/24/32
+
+--bpp 2/4生成抗锯齿字体，每个像素保存笔画覆盖的比例（4位为16级灰度），
+由lcd_show_text()按灰度混合字的颜色和背景色；灰度只能从轮廓字体得到，
+点阵字体生成的仍是单色点阵。
+
+用到的字符可以用以下方式指定，可以组合使用：
+    --chars TEXT    直接给出字符
+    --text FILE     文本文件中的全部字符
+    --scan FILE     C源文件中全部字符串常量里的字符
+    --ascii         全部可显示ASCII字符（0x20~0x7E）
+
+--hz-index根据lcd_font.h中的汉字表生成按码点排序的下标表lcd_font_index.h，
+lcd_show_chinese()用它二分查找汉字，修改汉字表后需要重新生成。
+
+示例：
+    python3 lcd_font_tool.py ../include/lcd_font.h --hz-index -o ../include/lcd_font_index.h
+    python3 lcd_font_tool.py NotoSansSC.ttf --size 20 --ascii --scan ../lcd_example.c \\
+        -n font_sc20 -o ../src/font_sc20.c
+    python3 lcd_font_tool.py NotoSansSC.ttf --size 16 --bpp 4 --ascii -n font_sc16aa -o ../src/font_sc16aa.c
+    python3 lcd_font_tool.py ../include/lcd_font.h --size 24 --scan ../lcd_example.c \\
+        -n font_legacy24 -o font_legacy24.c
+"""
+
+import argparse
+import os
+import re
+import struct
+import sys
+
+# 轮廓字体光栅化时每个像素在每个方向上的采样数
+TTF_SUPERSAMPLE = 4
+# 二次贝塞尔曲线展开为直线段的数目
+TTF_CURVE_STEPS = 8
+
+# 原有点阵字库支持的字号
+LEGACY_SIZES = (12, 16, 24, 32)
+
+LICENSE_HEADER = """/*
+ * Copyright (c) 2022 FuZhou Lockzhiner Electronic Co., Ltd. All rights reserved.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+"""
+
+
+class Glyph(object):
+    """一个字符在字符格（advance * 行高）中的点阵，pixels[行][列]为0~max_level"""
+
+    def __init__(self, code, advance, height, pixels, max_level):
+        self.code = code
+        self.advance = advance
+        self.height = height
+        self.pixels = pixels
+        self.max_level = max_level
+
+
+class FontSource(object):
+    """字体源文件的公共接口：height为行高，ascent为基线到行顶的距离"""
+
+    height = 0
+    ascent = 0
+
+    def glyph(self, code):
+        raise NotImplementedError
+
+
+# ---------------------------------------------------------------------------
+# TrueType轮廓字体
+
+class TrueTypeFont(FontSource):
+    def __init__(self, path, size):
+        self.data = open(path, 'rb').read()
+        self.tables = {}
+        num = struct.unpack('>H', self.data[4:6])[0]
+        for i in range(num):
+            tag, _, offset, length = struct.unpack('>4sIII', self.data[12 + 16 * i:28 + 16 * i])
+            self.tables[tag.decode('latin-1')] = (offset, length)
+        if 'glyf' not in self.tables:
+            raise ValueError('%s: only TrueType outlines (glyf table) are supported' % path)
+
+        head = self.table('head')
+        self.units_per_em = struct.unpack('>H', head[18:20])[0]
+        self.long_loca = struct.unpack('>h', head[50:52])[0] == 1
+        hhea = self.table('hhea')
+        asc, desc = struct.unpack('>hh', hhea[4:8])
+        self.num_hmetrics = struct.unpack('>H', hhea[34:36])[0]
+        self.num_glyphs = struct.unpack('>H', self.table('maxp')[4:6])[0]
+
+        # 行高为size像素，按上升部和下降部之和缩放
+        self.scale = float(size) / (asc - desc)
+        self.height = size
+        self.ascent = int(round(asc * self.scale))
+        self.origin = asc
+        self.cmap = self.load_cmap()
+
+    def table(self, tag):
+        offset, length = self.tables[tag]
+        return self.data[offset:offset + length]
+
+    def load_cmap(self):
+        """返回码点到字形序号的查找函数，优先使用Unicode完整字符集子表"""
+        cmap = self.table('cmap')
+        num = struct.unpack('>H', cmap[2:4])[0]
+        subtables = {}
+        for i in range(num):
+            platform, encoding, offset = struct.unpack('>HHI', cmap[4 + 8 * i:12 + 8 * i])
+            fmt = struct.unpack('>H', cmap[offset:offset + 2])[0]
+            subtables[(platform, encoding, fmt)] = offset
+        for key in ((3, 10, 12), (0, 4, 12), (3, 1, 4), (0, 3, 4), (0, 1, 4)):
+            if key in subtables:
+                offset = subtables[key]
+                if key[2] == 12:
+                    return lambda code: self.cmap12(cmap, offset, code)
+                return lambda code: self.cmap4(cmap, offset, code)
+        raise ValueError('no Unicode cmap subtable')
+
+    @staticmethod
+    def cmap4(cmap, offset, code):
+        if code > 0xFFFF:
+            return 0
+        seg_count = struct.unpack('>H', cmap[offset + 6:offset + 8])[0] // 2
+        ends = offset + 14
+        starts = ends + seg_count * 2 + 2
+        deltas = starts + seg_count * 2
+        ranges = deltas + seg_count * 2
+        for i in range(seg_count):
+            end = struct.unpack('>H', cmap[ends + 2 * i:ends + 2 * i + 2])[0]
+            if code > end:
+                continue
+            start = struct.unpack('>H', cmap[starts + 2 * i:starts + 2 * i + 2])[0]
+            if code < start:
+                return 0
+            delta = struct.unpack('>h', cmap[deltas + 2 * i:deltas + 2 * i + 2])[0]
+            range_offset = struct.unpack('>H', cmap[ranges + 2 * i:ranges + 2 * i + 2])[0]
+            if range_offset == 0:
+                return (code + delta) & 0xFFFF
+            pos = ranges + 2 * i + range_offset + 2 * (code - start)
+            index = struct.unpack('>H', cmap[pos:pos + 2])[0]
+            return (index + delta) & 0xFFFF if index else 0
+        return 0
+
+    @staticmethod
+    def cmap12(cmap, offset, code):
+        groups = struct.unpack('>I', cmap[offset + 12:offset + 16])[0]
+        for i in range(groups):
+            start, end, glyph = struct.unpack('>III', cmap[offset + 16 + 12 * i:offset + 28 + 12 * i])
+            if start <= code <= end:
+                return glyph + code - start
+        return 0
+
+    def advance(self, index):
+        hmtx = self.table('hmtx')
+        index = min(index, self.num_hmetrics - 1)
+        return struct.unpack('>H', hmtx[4 * index:4 * index + 2])[0]
+
+    def glyph_data(self, index):
+        loca = self.table('loca')
+        if self.long_loca:
+            start, end = struct.unpack('>II', loca[4 * index:4 * index + 8])
+        else:
+            start, end = [2 * v for v in struct.unpack('>HH', loca[2 * index:2 * index + 4])]
+        glyf_offset = self.tables['glyf'][0]
+        return self.data[glyf_offset + start:glyf_offset + end]
+
+    def contours(self, index, depth=0):
+        """返回轮廓列表，每个轮廓为[(x, y, 是否在曲线上), ...]，单位为字体单位"""
+        data = self.glyph_data(index)
+        if len(data) < 10 or depth > 8:
+            return []
+        num = struct.unpack('>h', data[0:2])[0]
+        if num >= 0:
+            return self.simple_contours(data, num)
+
+        # 组合字形：各部件的轮廓经过变换后合并
+        result = []
+        pos = 10
+        while True:
+            flags, component = struct.unpack('>HH', data[pos:pos + 4])
+            pos += 4
+            if flags & 0x0001:
+                dx, dy = struct.unpack('>hh', data[pos:pos + 4])
+                pos += 4
+            else:
+                dx, dy = struct.unpack('>bb', data[pos:pos + 2])
+                pos += 2
+            if not flags & 0x0002:
+                dx = dy = 0
+            a, b, c, d = 1.0, 0.0, 0.0, 1.0
+            if flags & 0x0008:
+                a = d = struct.unpack('>h', data[pos:pos + 2])[0] / 16384.0
+                pos += 2
+            elif flags & 0x0040:
+                a, d = [v / 16384.0 for v in struct.unpack('>hh', data[pos:pos + 4])]
+                pos += 4
+            elif flags & 0x0080:
+                a, b, c, d = [v / 16384.0 for v in struct.unpack('>hhhh', data[pos:pos + 8])]
+                pos += 8
+            for contour in self.contours(component, depth + 1):
+                result.append([(x * a + y * c + dx, x * b + y * d + dy, on) for x, y, on in contour])
+            if not flags & 0x0020:
+                break
+        return result
+
+    @staticmethod
+    def simple_contours(data, num):
+        ends = struct.unpack('>%dH' % num, data[10:10 + 2 * num])
+        points = ends[-1] + 1 if num else 0
+        pos = 10 + 2 * num
+        pos += 2 + struct.unpack('>H', data[pos:pos + 2])[0]
+
+        flags = []
+        while len(flags) < points:
+            flag = data[pos]
+            pos += 1
+            flags.append(flag)
+            if flag & 0x08:
+                flags += [flag] * data[pos]
+                pos += 1
+
+        coords = []
+        for short_bit, same_bit in ((0x02, 0x10), (0x04, 0x20)):
+            value = 0
+            values = []
+            for flag in flags[:points]:
+                if flag & short_bit:
+                    delta = data[pos]
+                    pos += 1
+                    value += delta if flag & same_bit else -delta
+                elif not flag & same_bit:
+                    value += struct.unpack('>h', data[pos:pos + 2])[0]
+                    pos += 2
+                values.append(value)
+            coords.append(values)
+
+        result = []
+        start = 0
+        for end in ends:
+            result.append([(coords[0][i], coords[1][i], bool(flags[i] & 0x01)) for i in range(start, end + 1)])
+            start = end + 1
+        return result
+
+    def edges(self, contours):
+        """把轮廓展开为像素坐标下的直线段"""
+        def to_px(x, y):
+            return x * self.scale, (self.origin - y) * self.scale
+
+        edges = []
+        for contour in contours:
+            if len(contour) < 2:
+                continue
+            # 在相邻的两个曲线外控制点之间插入隐含的曲线上的点
+            points = []
+            for i, (x, y, on) in enumerate(contour):
+                px, py, pon = contour[i - 1]
+                if not on and not pon:
+                    points.append(((x + px) / 2.0, (y + py) / 2.0, True))
+                points.append((x, y, on))
+            start = next((i for i, p in enumerate(points) if p[2]), None)
+            if start is None:
+                continue
+            points = points[start:] + points[:start] + [points[start]]
+
+            x0, y0 = to_px(points[0][0], points[0][1])
+            i = 1
+            while i < len(points):
+                x, y, on = points[i]
+                if on:
+                    x1, y1 = to_px(x, y)
+                    edges.append((x0, y0, x1, y1))
+                    x0, y0 = x1, y1
+                    i += 1
+                    continue
+                cx, cy = to_px(x, y)
+                x2, y2 = to_px(points[i + 1][0], points[i + 1][1])
+                for k in range(1, TTF_CURVE_STEPS + 1):
+                    t = float(k) / TTF_CURVE_STEPS
+                    x1 = (1 - t) * (1 - t) * x0 + 2 * (1 - t) * t * cx + t * t * x2
+                    y1 = (1 - t) * (1 - t) * y0 + 2 * (1 - t) * t * cy + t * t * y2
+                    edges.append((x0, y0, x1, y1))
+                    x0, y0 = x1, y1
+                i += 2
+        return edges
+
+    def glyph(self, code):
+        index = self.cmap(code)
+        if index == 0 or index >= self.num_glyphs:
+            return None
+        advance = int(round(self.advance(index) * self.scale))
+        edges = self.edges(self.contours(index))
+        return Glyph(code, advance, self.height, rasterize(edges, advance, self.height),
+                     TTF_SUPERSAMPLE * TTF_SUPERSAMPLE)
+
+
+def rasterize(edges, width, height):
+    """非零环绕规则超采样光栅化，返回每个像素被覆盖的采样数"""
+    ss = TTF_SUPERSAMPLE
+    cover = [[0] * width for _ in range(height)]
+    for sub in range(height * ss):
+        yc = (sub + 0.5) / ss
+        crossings = []
+        for x0, y0, x1, y1 in edges:
+            if (y0 <= yc < y1) or (y1 <= yc < y0):
+                crossings.append((x0 + (yc - y0) * (x1 - x0) / (y1 - y0), 1 if y1 > y0 else -1))
+        crossings.sort()
+        winding = 0
+        row = cover[sub // ss]
+        for i, (x, direction) in enumerate(crossings):
+            winding += direction
+            if winding == 0 or i + 1 >= len(crossings):
+                continue
+            # 采样点中心为(j + 0.5) / ss，统计落在[x, 下一个交点)内的采样点
+            first = max(0, int(-(-(x * ss - 0.5) // 1)))
+            last = min(width * ss, int(-(-(crossings[i + 1][0] * ss - 0.5) // 1)))
+            for j in range(first, last):
+                row[j // ss] += 1
+    return cover
+
+
+# ---------------------------------------------------------------------------
+# BDF点阵字体
+
+class BdfFont(FontSource):
+    def __init__(self, path):
+        self.chars = {}
+        ascent = descent = None
+        current = None
+        bitmap = None
+        for line in open(path, 'r', encoding='latin-1'):
+            words = line.split()
+            if not words:
+                continue
+            key = words[0]
+            if bitmap is not None:
+                if key == 'ENDCHAR':
+                    current['bitmap'] = bitmap
+                    if current.get('code', -1) >= 0:
+                        self.chars[current['code']] = current
+                    bitmap = current = None
+                else:
+                    bitmap.append(int(words[0], 16))
+            elif key == 'FONT_ASCENT':
+                ascent = int(words[1])
+            elif key == 'FONT_DESCENT':
+                descent = int(words[1])
+            elif key == 'STARTCHAR':
+                current = {}
+            elif current is not None and key == 'ENCODING':
+                current['code'] = int(words[1])
+            elif current is not None and key == 'DWIDTH':
+                current['advance'] = int(words[1])
+            elif current is not None and key == 'BBX':
+                current['bbx'] = [int(v) for v in words[1:5]]
+            elif current is not None and key == 'BITMAP':
+                bitmap = []
+        if ascent is None or descent is None:
+            raise ValueError('%s: FONT_ASCENT/FONT_DESCENT missing' % path)
+        self.ascent = ascent
+        self.height = ascent + descent
+
+    def glyph(self, code):
+        char = self.chars.get(code)
+        if char is None:
+            return None
+        w, h, xoff, yoff = char['bbx']
+        advance = char.get('advance', w)
+        row_bits = (w + 7) // 8 * 8
+        pixels = [[0] * advance for _ in range(self.height)]
+        for row, bits in enumerate(char['bitmap'][:h]):
+            y = self.ascent - (yoff + h) + row
+            for col in range(w):
+                x = xoff + col
+                if 0 <= y < self.height and 0 <= x < advance and bits & (1 << (row_bits - 1 - col)):
+                    pixels[y][x] = 1
+        return Glyph(code, advance, self.height, pixels, 1)
+
+
+# ---------------------------------------------------------------------------
+# 本例程原有的lcd_font.h点阵字库：每行占用整数个字节，低位在前
+
+class LegacyFont(FontSource):
+    def __init__(self, path, size):
+        if size not in LEGACY_SIZES:
+            raise ValueError('lcd_font.h only has sizes %s' % (LEGACY_SIZES,))
+        text = open(path, 'r', encoding='utf-8').read()
+        self.height = self.ascent = size
+        self.chars = {}
+
+        ascii_name = 'ascii_%d%02d' % (size, size // 2)
+        body = self.array_body(text, ascii_name)
+        stride = (size // 2 + 7) // 8 * size
+        # 每个字符一个{}，少写的字节按C语言的规则补0
+        for i, block in enumerate(re.findall(r'\{([^}]*)\}', body)):
+            data = [int(v, 16) for v in re.findall(r'0[xX]([0-9A-Fa-f]{2})', block)]
+            self.chars[0x20 + i] = (size // 2, (data + [0] * stride)[:stride])
+
+        # 汉字表的每一项为"字", 点阵字节...
+        body = self.array_body(text, 'tfont%d' % size)
+        tokens = re.findall(r'"([^"]*)"|0[xX]([0-9A-Fa-f]{2})', body)
+        current = None
+        for string, byte in tokens:
+            if string:
+                current = []
+                self.chars[ord(string[0])] = (size, current)
+            elif current is not None:
+                current.append(int(byte, 16))
+
+    @staticmethod
+    def array_body(text, name):
+        match = re.search(r'\b%s\s*\[[^=]*=\s*\{' % name, text)
+        if not match:
+            raise ValueError('array %s not found' % name)
+        end = text.index('\n};', match.end())
+        # 去掉注释，注释中的字符串会干扰解析
+        return re.sub(r'/\*.*?\*/', '', text[match.end():end], flags=re.S)
+
+    def glyph(self, code):
+        char = self.chars.get(code)
+        if char is None:
+            return None
+        width, data = char
+        stride = (width + 7) // 8
+        pixels = [[1 if data[row * stride + col // 8] & (1 << (col % 8)) else 0 for col in range(width)]
+                  for row in range(self.height)]
+        return Glyph(code, width, self.height, pixels, 1)
+
+
+def open_font(path, size):
+    lower = path.lower()
+    if lower.endswith('.ttf') or lower.endswith('.otf'):
+        if not size:
+            raise ValueError('--size is required for outline fonts')
+        return TrueTypeFont(path, size)
+    if lower.endswith('.bdf'):
+        return BdfFont(path)
+    if lower.endswith('.h'):
+        return LegacyFont(path, size)
+    raise ValueError('%s: unknown font format' % path)
+
+
+# ---------------------------------------------------------------------------
+# 字符集
+
+def scan_c_strings(path):
+    """取出C源文件中全部字符串常量里的字符，跳过注释"""
+    text = open(path, 'r', encoding='utf-8').read()
+    text = re.sub(r'/\*.*?\*/|//[^\n]*', '', text, flags=re.S)
+    chars = set()
+    for literal in re.findall(r'"((?:[^"\\\n]|\\.)*)"', text):
+        if literal.endswith('.h'):
+            continue
+        chars.update(re.sub(r'\\.', '', literal))
+    return chars
+
+
+def collect_codes(args):
+    chars = set(args.chars or '')
+    for path in args.text or []:
+        chars.update(open(path, 'r', encoding='utf-8').read())
+    for path in args.scan or []:
+        chars.update(scan_c_strings(path))
+    if args.ascii:
+        chars.update(chr(c) for c in range(0x20, 0x7F))
+    return sorted(ord(c) for c in chars if ord(c) >= 0x20)
+
+
+# ---------------------------------------------------------------------------
+# 打包
+
+def quantize(glyph, bpp):
+    """把采样数换算为bpp位的灰度等级，1位时以一半覆盖为界"""
+    top = (1 << bpp) - 1
+    if glyph.max_level == 1:
+        return [[top if v else 0 for v in row] for row in glyph.pixels]
+    if bpp == 1:
+        return [[1 if v * 2 >= glyph.max_level else 0 for v in row] for row in glyph.pixels]
+    return [[(v * top + glyph.max_level // 2) // glyph.max_level for v in row] for row in glyph.pixels]
+
+
+def crop(levels):
+    """返回有笔画的最小矩形(x, y, w, h)"""
+    rows = [y for y, row in enumerate(levels) if any(row)]
+    cols = [x for x in range(len(levels[0]) if levels else 0) if any(row[x] for row in levels)]
+    if not rows or not cols:
+        return 0, 0, 0, 0
+    return cols[0], rows[0], cols[-1] - cols[0] + 1, rows[-1] - rows[0] + 1
+
+
+class BitWriter(object):
+    """高位在前的位流"""
+
+    def __init__(self):
+        self.data = bytearray()
+        self.bits = 0
+
+    def write(self, value, count):
+        for i in range(count - 1, -1, -1):
+            if self.bits % 8 == 0:
+                self.data.append(0)
+            if value & (1 << i):
+                self.data[-1] |= 0x80 >> (self.bits % 8)
+            self.bits += 1
+
+
+def read_bits(data, offset, count):
+    """与lcd_text.c相同的取位过程，用于校验"""
+    value = 0
+    for i in range(count):
+        bit = offset + i
+        value = (value << 1) | ((data[bit // 8] >> (7 - bit % 8)) & 1)
+    return value
+
+
+def pack(glyphs, bpp):
+    """返回(位流, [(码点, 位偏移, 宽, 高, x, y, advance), ...])"""
+    writer = BitWriter()
+    table = []
+    for glyph in glyphs:
+        levels = quantize(glyph, bpp)
+        x, y, w, h = crop(levels)
+        offset = writer.bits
+        table.append((glyph.code, offset, w, h, x, y, glyph.advance))
+        for row in range(y, y + h):
+            for col in range(x, x + w):
+                writer.write(levels[row][col], bpp)
+        if any(read_bits(writer.data, offset + ((r - y) * w + c - x) * bpp, bpp) != levels[r][c]
+               for r in range(y, y + h) for c in range(x, x + w)):
+            raise RuntimeError('glyph U+%04X round-trip check failed' % glyph.code)
+    return bytes(writer.data), table
+
+
+def char_comment(code):
+    if code in (0x2A, 0x2F, 0x5C):
+        return 'U+%04X' % code
+    return "'%s'" % chr(code)
+
+
+def format_font(args, font, table, bitmap, bpp):
+    name = args.name
+    lines = [LICENSE_HEADER.rstrip('\n')]
+    lines.append('#include "lcd_text.h"')
+    lines.append('')
+    lines.append('/* %s：行高%d，%d位，%d个字符，点阵%d字节，由tools/lcd_font_tool.py从%s生成 */' % (
+        name, font.height, bpp, len(table), len(bitmap), os.path.basename(args.input)))
+    lines.append('static const uint8_t %s_bitmap[%d] = {' % (name, max(len(bitmap), 1)))
+    for i in range(0, len(bitmap), 16):
+        chunk = ', '.join('0X%02X' % b for b in bitmap[i:i + 16])
+        lines.append('    ' + chunk + (',' if i + 16 < len(bitmap) else ''))
+    if not bitmap:
+        lines.append('    0X00')
+    lines.append('};')
+    lines.append('')
+    lines.append('/* 位偏移，码点，宽，高，X偏移，Y偏移，字符宽度 */')
+    lines.append('static const lcd_glyph_t %s_glyphs[%d] = {' % (name, len(table)))
+    for i, (code, offset, w, h, x, y, advance) in enumerate(table):
+        lines.append('    {%d, 0x%04X, %d, %d, %d, %d, %d}%s /* %s */' % (
+            offset, code, w, h, x, y, advance, ',' if i + 1 < len(table) else ' ', char_comment(code)))
+    lines.append('};')
+    lines.append('')
+    lines.append('const lcd_font_t %s = {' % name)
+    lines.append('    %d, %d, %d, %d, %s_glyphs, %s_bitmap' % (
+        font.height, font.ascent, bpp, len(table), name, name))
+    lines.append('};')
+    return '\n'.join(lines) + '\n'
+
+
+def format_hz_index(path):
+    """lcd_font.h中每个汉字表按码点升序排列的(码点, 下标)"""
+    text = open(path, 'r', encoding='utf-8').read()
+    lines = [LICENSE_HEADER.rstrip('\n')]
+    lines.append('#ifndef _LCD_FONT_INDEX_H_')
+    lines.append('#define _LCD_FONT_INDEX_H_')
+    lines.append('')
+    lines.append('/* 由tools/lcd_font_tool.py --hz-index根据lcd_font.h生成，修改汉字表后需要重新生成 */')
+    lines.append('')
+    lines.append('/* 汉字的Unicode码点和在汉字表中的下标 */')
+    lines.append('typedef struct {')
+    lines.append('    unsigned short code;')
+    lines.append('    unsigned short index;')
+    lines.append('} typFNT_GB_INDEX;')
+    for size in LEGACY_SIZES:
+        body = LegacyFont.array_body(text, 'tfont%d' % size)
+        codes = [ord(s[0]) for s in re.findall(r'"([^"]+)"', body)]
+        if len(set(codes)) != len(codes):
+            raise ValueError('tfont%d has duplicate characters' % size)
+        entries = sorted((code, i) for i, code in enumerate(codes))
+        lines.append('')
+        lines.append('/* tfont%d按码点升序排列 */' % size)
+        lines.append('const typFNT_GB_INDEX tfont%d_index[] = {' % size)
+        for code, i in entries:
+            lines.append('    {0x%04X, %d}, /* "%s" */' % (code, i, chr(code)))
+        lines.append('};')
+    lines.append('')
+    lines.append('#endif')
+    return '\n'.join(lines) + '\n'
+
+
+def write_output(path, text):
+    if path:
+        open(path, 'w').write(text)
+    else:
+        sys.stdout.write(text)
+
+
+def main():
+    parser = argparse.ArgumentParser(description='LCD font compiler for lcd_show_text()')
+    parser.add_argument('input', help='font source: .ttf/.otf, .bdf or lcd_font.h')
+    parser.add_argument('-n', '--name', help='C variable name of the font')
+    parser.add_argument('-o', '--output', help='output C file, stdout if omitted')
+    parser.add_argument('--size', type=int, help='line height in pixels (outline fonts, lcd_font.h)')
+    parser.add_argument('--bpp', type=int, choices=(1, 2, 4), default=1,
+                        help='bits per pixel, 2 and 4 give anti-aliased fonts')
+    parser.add_argument('--chars', help='characters to include')
+    parser.add_argument('--text', action='append', help='text file whose characters are included')
+    parser.add_argument('--scan', action='append', help='C source whose string literals are included')
+    parser.add_argument('--ascii', action='store_true', help='include printable ASCII')
+    parser.add_argument('--hz-index', action='store_true',
+                        help='generate the sorted hanzi index of lcd_font.h instead of a font')
+    args = parser.parse_args()
+
+    if args.hz_index:
+        write_output(args.output, format_hz_index(args.input))
+        return
+    if not args.name:
+        parser.error('the following arguments are required: -n/--name')
+
+    font = open_font(args.input, args.size)
+    codes = collect_codes(args)
+    if not codes:
+        raise ValueError('no characters selected')
+    if font.height > 255:
+        raise ValueError('line height must be below 256')
+
+    glyphs = []
+    missing = []
+    for code in codes:
+        if code > 0xFFFF:
+            missing.append(code)
+            continue
+        glyph = font.glyph(code)
+        if glyph is None:
+            missing.append(code)
+        else:
+            glyphs.append(glyph)
+    if missing:
+        sys.stderr.write('warning: %d characters not in font: %s\n' % (
+            len(missing), ''.join(chr(c) for c in missing)))
+
+    bitmap, table = pack(glyphs, args.bpp)
+    write_output(args.output, format_font(args, font, table, bitmap, args.bpp))
+
+    # 与每行按字节补齐、保存整个字符格的点阵相比
+    padded = sum((g.advance * args.bpp + 7) // 8 * g.height for g in glyphs)
+    glyph_table = len(table) * 12
+    sys.stderr.write('%s: %d glyphs, height %d, bitmap %d bytes + table %d bytes (padded cells: %d bytes)\n' % (
+        args.name, len(table), font.height, len(bitmap), glyph_table, padded))
+
+
+if __name__ == '__main__':
+    main()
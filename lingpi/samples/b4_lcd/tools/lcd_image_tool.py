@@ -0,0 +1,422 @@
+#!/usr/bin/env python3
+# Copyright (c) 2022 FuZhou Lockzhiner Electronic Co., Ltd. All rights reserved.
+# Licensed under the Apache License, Version 2.0 (the "License");
+# you may not use this file except in compliance with the License.
+# You may obtain a copy of the License at
+#
+#     http://www.apache.org/licenses/LICENSE-2.0
+#
+# Unless required by applicable law or agreed to in writing, software
+# distributed under the License is distributed on an "AS IS" BASIS,
+# WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+# See the License for the specific language governing permissions and
+# limitations under the License.
+
+"""LCD图片资源转换工具
+
+把图片转换为b4_lcd驱动使用的C数组：
+    rle     RGB565行程编码图片，由lcd_show_picture_rle()显示
+    indexed 1/2/4/8位调色板索引图片，由lcd_show_indexed_picture()显示，
+            颜色超过调色板项数时用中位切分法量化
+
+输入图片支持：
+    *.png   8位RGB/RGBA/灰度/调色板PNG（不支持隔行扫描）
+    *.c     picture.c风格的RGB565字节数组（高字节在前），需指定--size
+    其他    RGB565原始数据（高字节在前），需指定--size
+
+示例：
+    python3 lcd_image_tool.py rle logo.png -n gImage_logo -o logo_rle.c
+    python3 lcd_image_tool.py rle lingzhi.png -n gImage_lingzhi_rle \
+        --header picture.h --size-macro IMAGE_RLE_SIZE_LINGZHI -o ../src/picture.c
+    python3 lcd_image_tool.py indexed icon.png --bpp 4 -n gImage_icon -o icon.c
+"""
+
+import argparse
+import re
+import struct
+import sys
+import zlib
+
+# 行程编码控制字节：最高位为1表示重复像素，低7位为像素数目减1
+RLE_RUN_FLAG = 0x80
+RLE_COUNT_MAX = 128
+
+# 索引图片支持的像素位数
+INDEXED_BPPS = (1, 2, 4, 8)
+
+LICENSE_HEADER = """/*
+ * Copyright (c) 2022 FuZhou Lockzhiner Electronic Co., Ltd. All rights reserved.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+"""
+
+
+def rgb_to_565(r, g, b):
+    return ((r & 0xF8) << 8) | ((g & 0xFC) << 3) | (b >> 3)
+
+
+def png_paeth(a, b, c):
+    p = a + b - c
+    pa, pb, pc = abs(p - a), abs(p - b), abs(p - c)
+    if pa <= pb and pa <= pc:
+        return a
+    return b if pb <= pc else c
+
+
+def read_png(path):
+    """读取PNG，返回(宽, 高, [(r, g, b, a), ...])"""
+    data = open(path, 'rb').read()
+    if data[:8] != b'\x89PNG\r\n\x1a\n':
+        raise ValueError('%s: not a PNG file' % path)
+
+    pos = 8
+    idat = b''
+    palette = []
+    trns = b''
+    width = height = depth = ctype = interlace = 0
+    while pos < len(data):
+        length, ctag = struct.unpack('>I4s', data[pos:pos + 8])
+        body = data[pos + 8:pos + 8 + length]
+        pos += length + 12
+        if ctag == b'IHDR':
+            width, height, depth, ctype, _, _, interlace = struct.unpack('>IIBBBBB', body)
+        elif ctag == b'PLTE':
+            palette = [tuple(body[i:i + 3]) for i in range(0, len(body), 3)]
+        elif ctag == b'tRNS':
+            trns = body
+        elif ctag == b'IDAT':
+            idat += body
+        elif ctag == b'IEND':
+            break
+
+    if depth != 8 or interlace != 0:
+        raise ValueError('%s: only 8-bit non-interlaced PNG is supported' % path)
+    channels = {0: 1, 2: 3, 3: 1, 4: 2, 6: 4}[ctype]
+    stride = width * channels
+    raw = zlib.decompress(idat)
+
+    rows = []
+    prev = bytearray(stride)
+    for y in range(height):
+        ftype = raw[y * (stride + 1)]
+        line = bytearray(raw[y * (stride + 1) + 1:(y + 1) * (stride + 1)])
+        for i in range(stride):
+            a = line[i - channels] if i >= channels else 0
+            b = prev[i]
+            c = prev[i - channels] if i >= channels else 0
+            if ftype == 1:
+                line[i] = (line[i] + a) & 0xFF
+            elif ftype == 2:
+                line[i] = (line[i] + b) & 0xFF
+            elif ftype == 3:
+                line[i] = (line[i] + ((a + b) >> 1)) & 0xFF
+            elif ftype == 4:
+                line[i] = (line[i] + png_paeth(a, b, c)) & 0xFF
+        rows.append(line)
+        prev = line
+
+    pixels = []
+    for line in rows:
+        for x in range(width):
+            p = line[x * channels:(x + 1) * channels]
+            if ctype == 0:
+                pixels.append((p[0], p[0], p[0], 255))
+            elif ctype == 2:
+                pixels.append((p[0], p[1], p[2], 255))
+            elif ctype == 3:
+                r, g, b = palette[p[0]]
+                alpha = trns[p[0]] if p[0] < len(trns) else 255
+                pixels.append((r, g, b, alpha))
+            elif ctype == 4:
+                pixels.append((p[0], p[0], p[0], p[1]))
+            else:
+                pixels.append((p[0], p[1], p[2], p[3]))
+    return width, height, pixels
+
+
+def parse_size(text):
+    match = re.match(r'^(\d+)[xX](\d+)$', text or '')
+    if not match:
+        raise ValueError('--size must look like 210x62')
+    return int(match.group(1)), int(match.group(2))
+
+
+def read_rgb565_bytes(path):
+    data = open(path, 'rb').read()
+    if path.endswith('.c') or path.endswith('.h'):
+        text = data.decode('utf-8', 'ignore')
+        text = text[text.index('{'):]
+        data = bytes(int(v, 16) for v in re.findall(r'0[xX]([0-9A-Fa-f]{2})', text))
+    return data
+
+
+def load_image(path, size):
+    """读取图片，返回(宽, 高, [RGB565像素], [是否透明])"""
+    if path.lower().endswith('.png'):
+        width, height, rgba = read_png(path)
+        pixels = [rgb_to_565(r, g, b) for r, g, b, _ in rgba]
+        transparent = [a < 128 for _, _, _, a in rgba]
+        return width, height, pixels, transparent
+
+    width, height = parse_size(size)
+    data = read_rgb565_bytes(path)
+    if len(data) < width * height * 2:
+        raise ValueError('%s: %d bytes, expected %d' % (path, len(data), width * height * 2))
+    pixels = [(data[i] << 8) | data[i + 1] for i in range(0, width * height * 2, 2)]
+    return width, height, pixels, [False] * len(pixels)
+
+
+def rle_encode(pixels):
+    """RGB565行程编码：重复像素编码为[0x80|n-1, 高字节, 低字节]，
+    其余像素编码为[n-1, 像素0高字节, 像素0低字节, ...]"""
+    out = bytearray()
+    i = 0
+    total = len(pixels)
+    while i < total:
+        run = 1
+        while i + run < total and run < RLE_COUNT_MAX and pixels[i + run] == pixels[i]:
+            run += 1
+        if run > 1:
+            out.append(RLE_RUN_FLAG | (run - 1))
+            out += struct.pack('>H', pixels[i])
+            i += run
+            continue
+
+        # 直到出现两个相同的相邻像素为止都作为原样像素
+        end = i + 1
+        while end < total and end - i < RLE_COUNT_MAX and not (end + 1 < total and pixels[end + 1] == pixels[end]):
+            end += 1
+        out.append(end - i - 1)
+        for pixel in pixels[i:end]:
+            out += struct.pack('>H', pixel)
+        i = end
+    return bytes(out)
+
+
+def rle_decode(data, count):
+    """与lcd_show_picture_rle()相同的解码过程，用于校验"""
+    pixels = []
+    pos = 0
+    while len(pixels) < count and pos < len(data):
+        ctrl = data[pos]
+        pos += 1
+        n = (ctrl & (RLE_RUN_FLAG - 1)) + 1
+        if ctrl & RLE_RUN_FLAG:
+            pixels += [(data[pos] << 8) | data[pos + 1]] * n
+            pos += 2
+        else:
+            pixels += [(data[pos + 2 * k] << 8) | data[pos + 2 * k + 1] for k in range(n)]
+            pos += 2 * n
+    return pixels[:count]
+
+
+def format_bytes(data):
+    lines = []
+    for i in range(0, len(data), 16):
+        chunk = ', '.join('0X%02X' % b for b in data[i:i + 16])
+        lines.append('    ' + chunk + (',' if i + 16 < len(data) else ''))
+    return lines
+
+
+def format_c_file(args, comment, arrays):
+    """arrays为[(类型, 名字, 长度, 行列表), ...]"""
+    lines = [LICENSE_HEADER.rstrip('\n')]
+    lines.append('#include "%s"' % args.header if args.header else '#include <stdint.h>')
+    lines.append('')
+    lines.append('/* %s */' % comment)
+    for ctype, name, length, body in arrays:
+        lines.append('const %s %s[%s] = {' % (ctype, name, length))
+        lines += body
+        lines.append('};')
+    return '\n'.join(lines) + '\n'
+
+
+def format_c_array(args, data, comment):
+    return format_c_file(args, comment, [
+        ('unsigned char', args.name, args.size_macro or len(data), format_bytes(data))])
+
+
+def cmd_rle(args):
+    width, height, pixels, _ = load_image(args.input, args.size)
+    data = rle_encode(pixels)
+    if rle_decode(data, width * height) != pixels:
+        raise RuntimeError('RLE round-trip check failed')
+
+    comment = '%dx%d RGB565 RLE图片，原始大小%d字节，压缩后%d字节，由tools/lcd_image_tool.py生成' % (
+        width, height, width * height * 2, len(data))
+    write_output(args.output, format_c_array(args, data, comment))
+    sys.stderr.write('%s: %dx%d, %d -> %d bytes (%.2fx)\n' % (
+        args.name, width, height, width * height * 2, len(data), width * height * 2.0 / len(data)))
+
+
+def rgb565_to_rgb(color):
+    return (color >> 11) & 0x1F, (color >> 5) & 0x3F, color & 0x1F
+
+
+def median_cut(colors, count):
+    """colors为{RGB565: 像素数}，把颜色切分为不超过count组，每组取加权平均色"""
+    boxes = [list(colors.items())]
+    while len(boxes) < count:
+        best = None
+        for i, box in enumerate(boxes):
+            if len(box) < 2:
+                continue
+            comps = [[rgb565_to_rgb(c)[k] for c, _ in box] for k in range(3)]
+            spans = [max(v) - min(v) for v in comps]
+            span = max(spans)
+            if best is None or span > best[0]:
+                best = (span, i, spans.index(span))
+        if best is None:
+            break
+        _, i, axis = best
+        box = sorted(boxes.pop(i), key=lambda item: rgb565_to_rgb(item[0])[axis])
+        total = sum(n for _, n in box)
+        acc = 0
+        cut = 1
+        for cut in range(1, len(box)):
+            acc += box[cut - 1][1]
+            if acc * 2 >= total:
+                break
+        boxes += [box[:cut], box[cut:]]
+
+    palette = []
+    for box in boxes:
+        total = sum(n for _, n in box)
+        avg = [int(round(sum(rgb565_to_rgb(c)[k] * n for c, n in box) / float(total))) for k in range(3)]
+        palette.append((avg[0] << 11) | (avg[1] << 5) | avg[2])
+    return palette
+
+
+def nearest(palette, color):
+    r, g, b = rgb565_to_rgb(color)
+    best = 0
+    best_dist = None
+    for i, entry in enumerate(palette):
+        pr, pg, pb = rgb565_to_rgb(entry)
+        # 把5位和6位分量换算到相同的量程再比较
+        dist = (4 * (r - pr)) ** 2 + (2 * (g - pg)) ** 2 + (4 * (b - pb)) ** 2
+        if best_dist is None or dist < best_dist:
+            best, best_dist = i, dist
+    return best
+
+
+def indexed_pack(indexes, width, height, bpp):
+    """每个字节内靠左的像素在高位，每行占用整数个字节"""
+    out = bytearray()
+    for y in range(height):
+        acc = 0
+        bits = 0
+        for x in range(width):
+            acc = (acc << bpp) | indexes[y * width + x]
+            bits += bpp
+            if bits == 8:
+                out.append(acc)
+                acc = bits = 0
+        if bits:
+            out.append(acc << (8 - bits))
+    return bytes(out)
+
+
+def indexed_unpack(data, width, height, bpp):
+    """与lcd_show_indexed_picture()相同的取索引过程，用于校验"""
+    stride = (width * bpp + 7) // 8
+    mask = (1 << bpp) - 1
+    indexes = []
+    for y in range(height):
+        for x in range(width):
+            byte = data[y * stride + x * bpp // 8]
+            indexes.append((byte >> (8 - bpp - x * bpp % 8)) & mask)
+    return indexes
+
+
+def cmd_indexed(args):
+    width, height, pixels, transparent = load_image(args.input, args.size)
+    has_key = any(transparent)
+    colors = {}
+    for pixel, clear in zip(pixels, transparent):
+        if not clear:
+            colors[pixel] = colors.get(pixel, 0) + 1
+
+    # 有透明像素时调色板第0项保留为透明色
+    reserved = 1 if has_key else 0
+    bpp = args.bpp
+    if bpp is None:
+        bpp = next((b for b in INDEXED_BPPS if len(colors) + reserved <= (1 << b)), 8)
+    capacity = (1 << bpp) - reserved
+
+    if len(colors) <= capacity:
+        palette = sorted(colors, key=lambda c: -colors[c])
+    else:
+        palette = median_cut(colors, capacity)
+    lookup = dict((c, nearest(palette, c) + reserved) for c in colors)
+    palette = [0] * reserved + palette
+    palette += [0] * ((1 << bpp) - len(palette))
+
+    indexes = [0 if clear else lookup[pixel] for pixel, clear in zip(pixels, transparent)]
+    data = indexed_pack(indexes, width, height, bpp)
+    if indexed_unpack(data, width, height, bpp) != indexes:
+        raise RuntimeError('indexed round-trip check failed')
+
+    key_text = '透明色索引0' if has_key else '无透明色'
+    comment = '%dx%d %d位索引图片，%s，原始大小%d字节，压缩后%d字节（含调色板），由tools/lcd_image_tool.py生成' % (
+        width, height, bpp, key_text, width * height * 2, len(data) + len(palette) * 2)
+    body = []
+    for i in range(0, len(palette), 8):
+        chunk = ', '.join('0X%04X' % c for c in palette[i:i + 8])
+        body.append('    ' + chunk + (',' if i + 8 < len(palette) else ''))
+    write_output(args.output, format_c_file(args, comment, [
+        ('uint16_t', args.name + '_palette', len(palette), body),
+        ('unsigned char', args.name, args.size_macro or len(data), format_bytes(data))]))
+    sys.stderr.write('%s: %dx%d, %d colors, %d bpp, key %s, %d -> %d bytes (%.2fx)\n' % (
+        args.name, width, height, len(colors), bpp, '0' if has_key else 'LCD_INDEX_NO_KEY',
+        width * height * 2, len(data) + len(palette) * 2,
+        width * height * 2.0 / (len(data) + len(palette) * 2)))
+
+
+def write_output(path, text):
+    if path:
+        open(path, 'w').write(text)
+    else:
+        sys.stdout.write(text)
+
+
+def main():
+    parser = argparse.ArgumentParser(description='LCD image asset converter')
+    sub = parser.add_subparsers(dest='command')
+    sub.required = True
+
+    rle = sub.add_parser('rle', help='RGB565 run-length encoded image for lcd_show_picture_rle()')
+    rle.add_argument('input')
+    rle.add_argument('-n', '--name', required=True, help='C array name')
+    rle.add_argument('-o', '--output', help='output C file (default: stdout)')
+    rle.add_argument('--size', help='WIDTHxHEIGHT for raw RGB565 input')
+    rle.add_argument('--header', help='header to #include at the top of the C file')
+    rle.add_argument('--size-macro', help='macro used as the array length instead of a number')
+    rle.set_defaults(func=cmd_rle)
+
+    indexed = sub.add_parser('indexed', help='palette-indexed image for lcd_show_indexed_picture()')
+    indexed.add_argument('input')
+    indexed.add_argument('-n', '--name', required=True, help='C array name, the palette is NAME_palette')
+    indexed.add_argument('-o', '--output', help='output C file (default: stdout)')
+    indexed.add_argument('--bpp', type=int, choices=INDEXED_BPPS, help='bits per pixel (default: fewest that fit)')
+    indexed.add_argument('--size', help='WIDTHxHEIGHT for raw RGB565 input')
+    indexed.add_argument('--header', help='header to #include at the top of the C file')
+    indexed.add_argument('--size-macro', help='macro used as the data array length instead of a number')
+    indexed.set_defaults(func=cmd_indexed)
+
+    args = parser.parse_args()
+    args.func(args)
+
+
+if __name__ == '__main__':
+    main()
@@ -15,6 +15,8 @@
 #ifndef _OLED_H_
 #define _OLED_H_
 
+#include <stdint.h>
+
 /* 定义OLED的行列数目 */
 #define OLED_COLUMN_MAX         128
 #define OLED_ROW_MAX            64
@@ -23,6 +25,44 @@
 #define OLED_CHR_SIZE_12        12
 #define OLED_CHR_SIZE_16        16
 
+/* 图形的颜色 */
+#define OLED_COLOR_BLACK        0   /* 熄灭像素 */
+#define OLED_COLOR_WHITE        1   /* 点亮像素 */
+#define OLED_COLOR_INVERT       2   /* 像素取反 */
+
+/* 点阵（图片、文字）的绘制模式 */
+#define OLED_DRAW_NORMAL        0   /* 点阵为1的像素点亮，为0的像素熄灭 */
+#define OLED_DRAW_INVERT        1   /* 反色：点阵为1的像素熄灭，为0的像素点亮 */
+#define OLED_DRAW_OVERLAY       2   /* 叠加：只点亮点阵为1的像素，其他像素不变 */
+
+/* 字体的最大高度 */
+#define OLED_FONT_HEIGHT_MAX    24
+
+/* 比例字体中一个字符的字形 */
+typedef struct {
+    uint8_t x;                              /* 字形在字符格中的起始列 */
+    uint8_t width;                          /* 字形的列数 */
+} oled_glyph_t;
+
+/* 字体。点阵与SSD1306的显存格式相同：每个字符格按页存储，
+ * 每页cell个字节，每个字节为一列中的8个像素，低位在上
+ */
+typedef struct {
+    const uint8_t *bitmap;                  /* 所有字符格的点阵 */
+    const oled_glyph_t *glyphs;             /* 比例字体的字形表，NULL表示等宽字体 */
+    uint8_t cell;                           /* 字符格的列数 */
+    uint8_t height;                         /* 字体的高度，最大为OLED_FONT_HEIGHT_MAX */
+    uint8_t first;                          /* 第一个字符 */
+    uint8_t num;                            /* 字符数目 */
+    uint8_t spacing;                        /* 比例字体的字间距 */
+} oled_font_t;
+
+/* 内置字体：6x8、8x16等宽字体，以及由它们去掉字形两侧空白列得到的比例字体 */
+extern const oled_font_t oled_font_6x8;
+extern const oled_font_t oled_font_8x16;
+extern const oled_font_t oled_font_6x8_prop;
+extern const oled_font_t oled_font_8x16_prop;
+
 /***************************************************************
  * 函数名称: oled_init
  * 说    明: oled初始化
@@ -61,16 +101,38 @@ void oled_display_off(void);
 
 /***************************************************************
  * 函数名称: oled_clear
- * 说    明: oled清空
+ * 说    明: oled清空，只清空影子缓冲区，调用oled_refresh()后显示
  * 参    数: 无
  * 返 回 值: 无
  ***************************************************************/
 void oled_clear(void);
 
 
+/***************************************************************
+ * 函数名称: oled_refresh
+ * 说    明: 把影子缓冲区中自上次刷新以来有变化的部分发送到oled。
+ *           包含所有变化的矩形窗口不比逐页发送多时，整个窗口在一次
+ *           传输中发送（全屏变化时为1024字节），否则每页发送一个窗口
+ * 参    数: 无
+ * 返 回 值: 无
+ ***************************************************************/
+void oled_refresh(void);
+
+
+/***************************************************************
+ * 函数名称: oled_fps_benchmark
+ * 说    明: 测量全屏刷新的帧率。每帧改变影子缓冲区的全部内容，
+ *           再调用oled_refresh()发送，会覆盖屏幕内容
+ * 参    数:
+ *       @frames：刷新的帧数
+ * 返 回 值: 每秒刷新的帧数，测量时间过短时返回0
+ ***************************************************************/
+uint32_t oled_fps_benchmark(uint16_t frames);
+
+
 /***************************************************************
  * 函数名称: oled_show_char
- * 说    明: oled显示字符
+ * 说    明: oled显示字符，写入影子缓冲区，调用oled_refresh()后显示
  * 参    数:
  *      @x：字符的X轴坐标
  *      @y：字符的Y轴坐标
@@ -83,7 +145,7 @@ void oled_show_char(uint8_t x, uint8_t y, uint8_t chr, uint8_t chr_size);
 
 /***************************************************************
  * 函数名称: oled_show_num
- * 说    明: oled显示数字
+ * 说    明: oled显示数字，写入影子缓冲区，调用oled_refresh()后显示
  * 参    数:
  *      @x：数字的X轴坐标
  *      @y：数字的Y轴坐标
@@ -97,7 +159,7 @@ void oled_show_num(uint8_t x, uint8_t y, uint32_t num, uint8_t len, uint8_t size
 
 /***************************************************************
  * 函数名称: oled_show_string
- * 说    明: oled显示字符串
+ * 说    明: oled显示字符串，写入影子缓冲区，调用oled_refresh()后显示
  * 参    数:
  *      @x：字符串的X轴坐标
  *      @y：字符串的Y轴坐标
@@ -110,7 +172,7 @@ void oled_show_string(uint8_t x, uint8_t y, uint8_t *p, uint8_t chr_size);
 
 /***************************************************************
  * 函数名称: oled_draw_bmp
- * 说    明: oled显示图片
+ * 说    明: oled显示图片，写入影子缓冲区，调用oled_refresh()后显示
  * 参    数:
  *      @x0：图片的起始点X轴坐标，取值为0~127
  *      @y0：图片的起始点Y轴坐标，取值为0~63
@@ -122,4 +184,125 @@ void oled_show_string(uint8_t x, uint8_t y, uint8_t *p, uint8_t chr_size);
 void oled_draw_bmp(unsigned char x0, unsigned char y0, unsigned char x1, unsigned char y1, unsigned char bmp[]);
 
 
+/***************************************************************
+ * 函数名称: oled_draw_point
+ * 说    明: 画点，写入影子缓冲区，超出屏幕的部分被忽略
+ * 参    数:
+ *      @x：点的X轴坐标
+ *      @y：点的Y轴坐标
+ *      @color：颜色，OLED_COLOR_BLACK、OLED_COLOR_WHITE或OLED_COLOR_INVERT
+ * 返 回 值: 无
+ ***************************************************************/
+void oled_draw_point(int16_t x, int16_t y, uint8_t color);
+
+
+/***************************************************************
+ * 函数名称: oled_draw_line
+ * 说    明: 画线，写入影子缓冲区，超出屏幕的部分被裁剪
+ * 参    数:
+ *      @x1：起始点X轴坐标
+ *      @y1：起始点Y轴坐标
+ *      @x2：结束点X轴坐标
+ *      @y2：结束点Y轴坐标
+ *      @color：颜色
+ * 返 回 值: 无
+ ***************************************************************/
+void oled_draw_line(int16_t x1, int16_t y1, int16_t x2, int16_t y2, uint8_t color);
+
+
+/***************************************************************
+ * 函数名称: oled_draw_rectangle
+ * 说    明: 画矩形边框，写入影子缓冲区，超出屏幕的部分被裁剪
+ * 参    数:
+ *      @x1：起始点X轴坐标
+ *      @y1：起始点Y轴坐标
+ *      @x2：结束点X轴坐标（包含）
+ *      @y2：结束点Y轴坐标（包含）
+ *      @color：颜色
+ * 返 回 值: 无
+ ***************************************************************/
+void oled_draw_rectangle(int16_t x1, int16_t y1, int16_t x2, int16_t y2, uint8_t color);
+
+
+/***************************************************************
+ * 函数名称: oled_fill_rectangle
+ * 说    明: 填充矩形，写入影子缓冲区，超出屏幕的部分被裁剪
+ * 参    数:
+ *      @x1：起始点X轴坐标
+ *      @y1：起始点Y轴坐标
+ *      @x2：结束点X轴坐标（包含）
+ *      @y2：结束点Y轴坐标（包含）
+ *      @color：颜色
+ * 返 回 值: 无
+ ***************************************************************/
+void oled_fill_rectangle(int16_t x1, int16_t y1, int16_t x2, int16_t y2, uint8_t color);
+
+
+/***************************************************************
+ * 函数名称: oled_draw_circle
+ * 说    明: 画圆，写入影子缓冲区，超出屏幕的部分被裁剪
+ * 参    数:
+ *      @x0：圆心X轴坐标
+ *      @y0：圆心Y轴坐标
+ *      @r：半径
+ *      @color：颜色
+ * 返 回 值: 无
+ ***************************************************************/
+void oled_draw_circle(int16_t x0, int16_t y0, uint8_t r, uint8_t color);
+
+
+/***************************************************************
+ * 函数名称: oled_fill_circle
+ * 说    明: 填充圆，写入影子缓冲区，超出屏幕的部分被裁剪
+ * 参    数:
+ *      @x0：圆心X轴坐标
+ *      @y0：圆心Y轴坐标
+ *      @r：半径
+ *      @color：颜色
+ * 返 回 值: 无
+ ***************************************************************/
+void oled_fill_circle(int16_t x0, int16_t y0, uint8_t r, uint8_t color);
+
+
+/***************************************************************
+ * 函数名称: oled_draw_bitmap
+ * 说    明: 在任意位置显示图片，写入影子缓冲区，超出屏幕的部分被裁剪
+ * 参    数:
+ *      @x：图片左上角的X轴坐标
+ *      @y：图片左上角的Y轴坐标，不需要按页对齐
+ *      @width：图片的宽度
+ *      @height：图片的高度
+ *      @bmp：图片，与oled_draw_bmp的格式相同，按页存储，每页width个字节
+ *      @mode：OLED_DRAW_NORMAL、OLED_DRAW_INVERT或OLED_DRAW_OVERLAY
+ * 返 回 值: 无
+ ***************************************************************/
+void oled_draw_bitmap(int16_t x, int16_t y, uint8_t width, uint8_t height, const uint8_t *bmp, uint8_t mode);
+
+
+/***************************************************************
+ * 函数名称: oled_draw_text
+ * 说    明: 用指定字体在任意位置显示字符串，写入影子缓冲区，
+ *           超出屏幕右边界的字符不显示
+ * 参    数:
+ *      @x：起始位置X轴坐标
+ *      @y：起始位置Y轴坐标，不需要按页对齐
+ *      @str：字符串
+ *      @font：字体，如oled_font_6x8_prop
+ *      @mode：OLED_DRAW_NORMAL、OLED_DRAW_INVERT或OLED_DRAW_OVERLAY
+ * 返 回 值: 字符串的显示宽度
+ ***************************************************************/
+uint16_t oled_draw_text(int16_t x, int16_t y, const char *str, const oled_font_t *font, uint8_t mode);
+
+
+/***************************************************************
+ * 函数名称: oled_text_width
+ * 说    明: 计算字符串用指定字体显示时的宽度
+ * 参    数:
+ *      @str：字符串
+ *      @font：字体
+ * 返 回 值: 字符串的显示宽度
+ ***************************************************************/
+uint16_t oled_text_width(const char *str, const oled_font_t *font);
+
+
 #endif /* _OLED_H_ */
\ No newline at end of file
@@ -1,6 +1,8 @@
 #ifndef _OLED_FONT_H_
 #define _OLED_FONT_H_
 
+#include "oled.h"
+
 /* F6X8的行长度 */
 #define F6X8_COLUMNS          6
 
@@ -203,4 +205,199 @@ const unsigned char F8X16[] = {
     0x00, 0x06, 0x01, 0x01, 0x02, 0x02, 0x04, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // ~ 94
 };
 
+/* F6x8的比例字体字形：字形在字符格中的起始列和列数 */
+const oled_glyph_t F6x8_PROP[] = {
+    {0, 2}, // sp
+    {3, 1}, // !
+    {2, 3}, // "
+    {1, 5}, // #
+    {1, 5}, // $
+    {1, 5}, // %
+    {1, 5}, // &
+    {2, 2}, // '
+    {2, 3}, // (
+    {2, 3}, // )
+    {1, 5}, // *
+    {1, 5}, // +
+    {3, 2}, // ,
+    {1, 5}, // -
+    {2, 2}, // .
+    {1, 5}, // /
+    {1, 5}, // 0
+    {2, 3}, // 1
+    {1, 5}, // 2
+    {1, 5}, // 3
+    {1, 5}, // 4
+    {1, 5}, // 5
+    {1, 5}, // 6
+    {1, 5}, // 7
+    {1, 5}, // 8
+    {1, 5}, // 9
+    {2, 2}, // :
+    {2, 2}, // ;
+    {1, 4}, // <
+    {1, 5}, // =
+    {2, 4}, // >
+    {1, 5}, // ?
+    {1, 5}, // @
+    {1, 5}, // A
+    {1, 5}, // B
+    {1, 5}, // C
+    {1, 5}, // D
+    {1, 5}, // E
+    {1, 5}, // F
+    {1, 5}, // G
+    {1, 5}, // H
+    {2, 3}, // I
+    {1, 5}, // J
+    {1, 5}, // K
+    {1, 5}, // L
+    {1, 5}, // M
+    {1, 5}, // N
+    {1, 5}, // O
+    {1, 5}, // P
+    {1, 5}, // Q
+    {1, 5}, // R
+    {1, 5}, // S
+    {1, 5}, // T
+    {1, 5}, // U
+    {1, 5}, // V
+    {1, 5}, // W
+    {1, 5}, // X
+    {1, 5}, // Y
+    {1, 5}, // Z
+    {2, 3}, // [
+    {1, 5}, // 55
+    {2, 3}, // ]
+    {1, 5}, // ^
+    {1, 5}, // _
+    {2, 3}, // '
+    {1, 5}, // a
+    {1, 5}, // b
+    {1, 5}, // c
+    {1, 5}, // d
+    {1, 5}, // e
+    {1, 5}, // f
+    {1, 5}, // g
+    {1, 5}, // h
+    {2, 3}, // i
+    {1, 4}, // j
+    {1, 4}, // k
+    {2, 3}, // l
+    {1, 5}, // m
+    {1, 5}, // n
+    {1, 5}, // o
+    {1, 5}, // p
+    {1, 5}, // q
+    {1, 5}, // r
+    {1, 5}, // s
+    {1, 5}, // t
+    {1, 5}, // u
+    {1, 5}, // v
+    {1, 5}, // w
+    {1, 5}, // x
+    {1, 5}, // y
+    {1, 5}, // z
+    {0, 6}, // horiz lines
+};
+
+/* F8X16的比例字体字形：字形在字符格中的起始列和列数 */
+const oled_glyph_t F8X16_PROP[] = {
+    {0, 3}, // 0
+    {3, 2}, // ! 1
+    {1, 6}, // " 2
+    {0, 7}, // # 3
+    {1, 5}, // $ 4
+    {0, 7}, // % 5
+    {0, 8}, // & 6
+    {0, 3}, // ' 7
+    {3, 4}, // ( 8
+    {1, 4}, // ) 9
+    {0, 7}, // * 10
+    {0, 7}, // + 11
+    {0, 3}, // , 12
+    {1, 7}, // - 13
+    {1, 2}, // . 14
+    {1, 7}, // / 15
+    {1, 6}, // 0 16
+    {1, 5}, // 1 17
+    {1, 6}, // 2 18
+    {1, 6}, // 3 19
+    {1, 6}, // 4 20
+    {1, 6}, // 5 21
+    {1, 6}, // 6 22
+    {1, 6}, // 7 23
+    {1, 6}, // 8 24
+    {1, 6}, // 9 25
+    {3, 2}, // : 26
+    {2, 2}, // ; 27
+    {1, 6}, // < 28
+    {0, 7}, // = 29
+    {1, 6}, // > 30
+    {1, 6}, // ? 31
+    {0, 7}, // @ 32
+    {0, 8}, // A 33
+    {0, 7}, // B 34
+    {0, 7}, // C 35
+    {0, 7}, // D 36
+    {0, 7}, // E 37
+    {0, 7}, // F 38
+    {0, 7}, // G 39
+    {0, 8}, // H 40
+    {1, 5}, // I 41
+    {0, 7}, // J 42
+    {0, 7}, // K 43
+    {0, 7}, // L 44
+    {0, 7}, // M 45
+    {0, 8}, // N 46
+    {0, 7}, // O 47
+    {0, 7}, // P 48
+    {0, 7}, // Q 49
+    {0, 8}, // R 50
+    {1, 6}, // S 51
+    {0, 7}, // T 52
+    {0, 8}, // U 53
+    {0, 8}, // V 54
+    {0, 7}, // W 55
+    {0, 8}, // X 56
+    {0, 7}, // Y 57
+    {0, 7}, // Z 58
+    {3, 4}, // [ 59
+    {1, 6}, // \ 60
+    {1, 4}, // ] 61
+    {2, 5}, // ^ 62
+    {0, 8}, // _ 63
+    {1, 3}, // ` 64
+    {1, 7}, // a 65
+    {0, 7}, // b 66
+    {1, 6}, // c 67
+    {1, 7}, // d 68
+    {1, 6}, // e 69
+    {1, 7}, // f 70
+    {1, 6}, // g 71
+    {0, 8}, // h 72
+    {1, 5}, // i 73
+    {1, 5}, // j 74
+    {0, 7}, // k 75
+    {1, 5}, // l 76
+    {0, 8}, // m 77
+    {0, 8}, // n 78
+    {1, 6}, // o 79
+    {0, 7}, // p 80
+    {1, 7}, // q 81
+    {0, 7}, // r 82
+    {1, 6}, // s 83
+    {1, 5}, // t 84
+    {0, 8}, // u 85
+    {0, 8}, // v 86
+    {0, 8}, // w 87
+    {1, 6}, // x 88
+    {0, 8}, // y 89
+    {1, 6}, // z 90
+    {4, 4}, // { 91
+    {4, 1}, // | 92
+    {1, 4}, // } 93
+    {1, 7}, // ~ 94
+};
+
 #endif
@@ -0,0 +1,158 @@
+/*
+ * Copyright (c) 2022 FuZhou Lockzhiner Electronic Co., Ltd. All rights reserved.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef _SOFT_I2C_H_
+#define _SOFT_I2C_H_
+
+#include <stdint.h>
+
+/* 常用的时钟频率 */
+#define SOFT_I2C_FREQ_STANDARD  100000
+#define SOFT_I2C_FREQ_FAST      400000
+#define SOFT_I2C_FREQ_FAST_PLUS 1000000
+
+/* GPIO模拟的i2c总线。SCL和SDA按开漏方式工作：输出寄存器固定为0，
+ * 引脚设为输出即拉低，设为输入即释放，由上拉电阻拉高。
+ * 除scl、sda外的成员由soft_i2c_init计算，调用者不需要设置
+ */
+typedef struct {
+    uint32_t scl;                           /* SCL引脚，如GPIO0_PC2 */
+    uint32_t sda;                           /* SDA引脚，如GPIO0_PC1 */
+    uint32_t freq;                          /* 按校准结果估算的实际时钟频率（Hz） */
+    uint32_t delay;                         /* 半个时钟周期的延时循环次数 */
+    volatile uint32_t *scl_ddr;             /* SCL的方向寄存器 */
+    volatile uint32_t *sda_ddr;             /* SDA的方向寄存器 */
+    volatile uint32_t *scl_in;              /* SCL的输入寄存器 */
+    volatile uint32_t *sda_in;              /* SDA的输入寄存器 */
+    uint32_t scl_low;                       /* 写入方向寄存器的值：拉低SCL */
+    uint32_t scl_high;                      /* 写入方向寄存器的值：释放SCL */
+    uint32_t sda_low;                       /* 写入方向寄存器的值：拉低SDA */
+    uint32_t sda_high;                      /* 写入方向寄存器的值：释放SDA */
+    uint32_t scl_mask;                      /* SCL在输入寄存器中的位 */
+    uint32_t sda_mask;                      /* SDA在输入寄存器中的位 */
+} soft_i2c_t;
+
+/***************************************************************
+ * 函数名称: soft_i2c_init
+ * 说    明: 初始化GPIO模拟的i2c总线，释放SCL和SDA。第一次调用时校准
+ *           寄存器写操作和延时循环的耗时（约20ms），之后按校准结果
+ *           计算指定频率对应的延时。SDA被从设备拉低时发送最多9个时钟
+ *           和结束条件恢复总线
+ * 参    数:
+ *       @bus：i2c总线
+ *       @scl：SCL引脚
+ *       @sda：SDA引脚
+ *       @freq：时钟频率（Hz），如SOFT_I2C_FREQ_FAST
+ * 返 回 值: 返回0为成功，反之为失败，包括恢复后SCL或SDA仍为低电平
+ ***************************************************************/
+unsigned int soft_i2c_init(soft_i2c_t *bus, uint32_t scl, uint32_t sda, uint32_t freq);
+
+
+/***************************************************************
+ * 函数名称: soft_i2c_deinit
+ * 说    明: 销毁GPIO模拟的i2c总线
+ * 参    数:
+ *       @bus：i2c总线
+ * 返 回 值: 返回0为成功，反之为失败
+ ***************************************************************/
+unsigned int soft_i2c_deinit(soft_i2c_t *bus);
+
+
+/***************************************************************
+ * 函数名称: soft_i2c_set_freq
+ * 说    明: 修改时钟频率，超过能达到的最高频率时按最高频率工作，
+ *           实际频率保存在bus->freq中。应在soft_i2c_init之后调用，
+ *           尚未校准时不修改
+ * 参    数:
+ *       @bus：i2c总线
+ *       @freq：时钟频率（Hz）
+ * 返 回 值: 无
+ ***************************************************************/
+void soft_i2c_set_freq(soft_i2c_t *bus, uint32_t freq);
+
+
+/***************************************************************
+ * 函数名称: soft_i2c_start
+ * 说    明: 发送起始条件（总线已被占用时为重复起始条件）和从设备地址
+ * 参    数:
+ *       @bus：i2c总线
+ *       @addr：7位从设备地址
+ *       @read：0为写操作；1为读操作
+ * 返 回 值: 返回0为从设备应答，反之为没有应答或等待SCL超时
+ ***************************************************************/
+unsigned int soft_i2c_start(soft_i2c_t *bus, uint8_t addr, uint8_t read);
+
+
+/***************************************************************
+ * 函数名称: soft_i2c_send
+ * 说    明: 在soft_i2c_start之后连续发送多个字节，每个字节检查应答，
+ *           没有应答或等待SCL超时时停止发送
+ * 参    数:
+ *       @bus：i2c总线
+ *       @buf：数据
+ *       @len：字节数
+ * 返 回 值: 返回0为成功，反之为从设备没有应答或等待SCL超时
+ ***************************************************************/
+unsigned int soft_i2c_send(soft_i2c_t *bus, const uint8_t *buf, uint32_t len);
+
+
+/***************************************************************
+ * 函数名称: soft_i2c_recv
+ * 说    明: 在soft_i2c_start之后连续接收多个字节，最后一个字节回复非应答，
+ *           等待SCL超时时停止接收
+ * 参    数:
+ *       @bus：i2c总线
+ *       @buf：数据
+ *       @len：字节数
+ * 返 回 值: 返回0为成功，反之为等待SCL超时
+ ***************************************************************/
+unsigned int soft_i2c_recv(soft_i2c_t *bus, uint8_t *buf, uint32_t len);
+
+
+/***************************************************************
+ * 函数名称: soft_i2c_stop
+ * 说    明: 发送结束条件，释放总线。等待SCL超时时仍然释放SCL和SDA
+ * 参    数:
+ *       @bus：i2c总线
+ * 返 回 值: 返回0为成功，反之为等待SCL超时
+ ***************************************************************/
+unsigned int soft_i2c_stop(soft_i2c_t *bus);
+
+
+/***************************************************************
+ * 函数名称: soft_i2c_write
+ * 说    明: 在一次传输中往从设备写入多个字节
+ * 参    数:
+ *       @bus：i2c总线
+ *       @addr：7位从设备地址
+ *       @buf：数据
+ *       @len：字节数
+ * 返 回 值: 返回0为成功，反之为从设备没有应答或等待SCL超时
+ ***************************************************************/
+unsigned int soft_i2c_write(soft_i2c_t *bus, uint8_t addr, const uint8_t *buf, uint32_t len);
+
+
+/***************************************************************
+ * 函数名称: soft_i2c_read
+ * 说    明: 在一次传输中从从设备读取多个字节
+ * 参    数:
+ *       @bus：i2c总线
+ *       @addr：7位从设备地址
+ *       @buf：数据
+ *       @len：字节数
+ * 返 回 值: 返回0为成功，反之为从设备没有应答或等待SCL超时
+ ***************************************************************/
+unsigned int soft_i2c_read(soft_i2c_t *bus, uint8_t addr, uint8_t *buf, uint32_t len);
+
+#endif /* _SOFT_I2C_H_ */
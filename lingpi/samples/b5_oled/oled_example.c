@@ -15,6 +15,7 @@
 #include "los_task.h"
 #include "ohos_init.h"
 #include "lz_hardware.h"
+#include "oled.h"
 
 /* 任务的堆栈大小 */
 #define TASK_STACK_SIZE         20480
@@ -24,6 +25,11 @@
 /* 循环等待时间 */
 #define WAIT_MSEC               1000
 
+/* 是否在启动时测量全屏刷新的帧率 */
+#define OLED_FPS_BENCHMARK      0
+/* 测量时刷新的帧数 */
+#define OLED_BENCHMARK_FRAMES   100
+
 /* 字符串最大长度 */
 #define STRING_MAXSIZE          32
 
@@ -53,6 +59,9 @@ void oled_process(void)
     int i = 0;
 
     oled_init();
+#if OLED_FPS_BENCHMARK
+    printf("oled: %u fps\n", oled_fps_benchmark(OLED_BENCHMARK_FRAMES));
+#endif
     oled_clear();
 
     while (1) {
@@ -63,6 +72,7 @@ void oled_process(void)
 
         snprintf(buffer, sizeof(buffer), "%d Sec!", i++);
         oled_show_string(OLED_STRING4_X, OLED_STRING4_Y, buffer, OLED_STRING4_SIZE);
+        oled_refresh();
 
         printf("\n\n");
         LOS_Msleep(WAIT_MSEC);
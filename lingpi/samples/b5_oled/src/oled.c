@@ -12,7 +12,9 @@
  * See the License for the specific language governing permissions and
  * limitations under the License.
  */
+#include <string.h>
 #include "lz_hardware.h"
+#include "los_tick.h"
 #include "oled.h"
 #include "oled_font.h"
 
@@ -20,28 +22,27 @@
  *    0 = gpio模拟i2c
  *    1 = i2c模块
  */
+#ifndef OLED_I2C_ENABLE
 #define OLED_I2C_ENABLE     1
+#endif
 
 /* OLED的从设备地址 */
 #define OLED_I2C_ADDRESS    0x3C
 
 #if !OLED_I2C_ENABLE
+#include "soft_i2c.h"
+
 /* GPIO0_C1 => I2C1_SDA_M1 */
 #define GPIO_I2C_SDA        GPIO0_PC1
 /* GPIO0_C2 => I2C1_SCL_M1 */
 #define GPIO_I2C_SCL        GPIO0_PC2
 
-/* SCLK引脚的输出高/低电平 */
-#define OLED_SCLK_Clr()     LzGpioSetVal(GPIO_I2C_SCL, LZGPIO_LEVEL_LOW)
-#define OLED_SCLK_Set()     LzGpioSetVal(GPIO_I2C_SCL, LZGPIO_LEVEL_HIGH)
-
-/* SDIN引脚的输出高/低电平 */
-#define OLED_SDIN_Clr()     LzGpioSetVal(GPIO_I2C_SDA, LZGPIO_LEVEL_LOW)
-#define OLED_SDIN_Set()     LzGpioSetVal(GPIO_I2C_SDA, LZGPIO_LEVEL_HIGH)
+/* gpio模拟i2c的时钟频率，SSD1306标称最高400KHz，
+ * 多数模块可以工作在SOFT_I2C_FREQ_FAST_PLUS（1MHz）
+ */
+#define OLED_SOFT_I2C_FREQ  SOFT_I2C_FREQ_FAST
 
-/* RST引脚的输出高/低电平 */
-#define OLED_RST_Clr()
-#define OLED_RST_Set()
+static soft_i2c_t m_i2c;
 #else
 #define OLED_I2C_BUS        1
 static I2cBusIo m_i2cBus = {
@@ -67,13 +68,110 @@ static I2cBusIo m_i2cBus = {
 static unsigned int m_i2c_freq = 400000;
 #endif
 
-/* 定义OLED读写操作 */
-#define OLED_CMD            0 // OLED的命令操作标记
-#define OLED_DATA           1 // OLED的数据操作标记
+/* 控制字节：Co=0，后面的字节都是命令或者都是数据 */
+#define OLED_CTRL_CMD       0x00 // OLED的命令操作标记
+#define OLED_CTRL_DATA      0x40 // OLED的数据操作标记
 
 /* 字节的bits数目 */
 #define BYTE_TO_BITS        8
 
+/* OLED的页数，每页为8行 */
+#define OLED_PAGE_MAX       (OLED_ROW_MAX / BYTE_TO_BITS)
+
+/* 一次传输最多的命令或数据字节数，为整个屏幕的字节数 */
+#define OLED_BURST_MAX      (OLED_PAGE_MAX * OLED_COLUMN_MAX)
+
+/* 水平寻址模式的窗口命令 */
+#define OLED_CMD_COLUMN     0x21 // 设置窗口的起始列和结束列
+#define OLED_CMD_PAGE       0x22 // 设置窗口的起始页和结束页
+
+/* 每个显示窗口的固定开销（字节）：命令传输的地址、控制字节和6个窗口命令，
+ * 以及数据传输的地址和控制字节
+ */
+#define OLED_WINDOW_COST    10
+
+/* 毫秒与秒的换算 */
+#define MSEC_PER_SEC        1000
+
+/* 每次处理的列数，影子缓冲区按32位字一次处理4列 */
+#define OLED_WORD_COLUMNS   4
+/* 把一个字节复制到32位字的4个字节中 */
+#define OLED_WORD_REPEAT    0x01010101U
+
+/* 显存的影子缓冲区，与SSD1306的显存格式相同：按页存储，
+ * 每个字节为一列中的8个像素，低位在上
+ */
+static uint8_t m_oled_buf[OLED_PAGE_MAX][OLED_COLUMN_MAX];
+
+/* 每页自上次刷新以来有变化的列范围（包含结束列），
+ * start为OLED_COLUMN_MAX、end为0表示没有变化
+ */
+typedef struct {
+    uint8_t start;
+    uint8_t end;
+} oled_dirty_t;
+static oled_dirty_t m_oled_dirty[OLED_PAGE_MAX];
+
+/* 内置字体 */
+const oled_font_t oled_font_6x8 = {
+    .bitmap = &F6x8[0][0],
+    .glyphs = NULL,
+    .cell = F6X8_COLUMNS,
+    .height = 8,
+    .first = ' ',
+    .num = sizeof(F6x8) / sizeof(F6x8[0]),
+    .spacing = 0,
+};
+const oled_font_t oled_font_8x16 = {
+    .bitmap = F8X16,
+    .glyphs = NULL,
+    .cell = 8,
+    .height = 16,
+    .first = ' ',
+    .num = sizeof(F8X16) / 16,
+    .spacing = 0,
+};
+const oled_font_t oled_font_6x8_prop = {
+    .bitmap = &F6x8[0][0],
+    .glyphs = F6x8_PROP,
+    .cell = F6X8_COLUMNS,
+    .height = 8,
+    .first = ' ',
+    .num = sizeof(F6x8_PROP) / sizeof(F6x8_PROP[0]),
+    .spacing = 1,
+};
+const oled_font_t oled_font_8x16_prop = {
+    .bitmap = F8X16,
+    .glyphs = F8X16_PROP,
+    .cell = 8,
+    .height = 16,
+    .first = ' ',
+    .num = sizeof(F8X16_PROP) / sizeof(F8X16_PROP[0]),
+    .spacing = 1,
+};
+
+/* SSD1306的启动配置，在一次传输中发送 */
+static const unsigned char m_oled_init_cmds[] = {
+    0xAE,       // --display off
+    0x20, 0x00, // --set memory addressing mode, horizontal
+    0x21, 0x00, 0x7F, // ---set column window 0~127
+    0x22, 0x00, 0x07, // ---set page window 0~7
+    0x40,       // --set start line address
+    0x81, 0xFF, // contract control, --128
+    0xA1,       // set segment remap
+    0xA6,       // --normal / reverse
+    0xA8, 0x3F, // --set multiplex ratio(1 to 64), --1/32 duty
+    0xC8,       // Com scan direction
+    0xD3, 0x00, // -set display offset
+    0xD5, 0x80, // set osc division
+    0xD8, 0x05, // set area color mode off
+    0xD9, 0xF1, // Set Pre-Charge Period
+    0xDA, 0x12, // set com pin configuartion
+    0xDB, 0x30, // set Vcomh
+    0x8D, 0x14, // set charge pump enable
+    0xAF,       // --turn on oled panel
+};
+
 /***************************************************************
  * 函数名称: oled_pow
  * 说    明: 计算m^n
@@ -96,198 +194,305 @@ static uint32_t oled_pow(uint8_t m, uint8_t n)
 
 #if !OLED_I2C_ENABLE
 /***************************************************************
- * 函数名称: iic_start
- * 说    明: i2c的起始条件
- * 参    数: 无
+ * 函数名称: write_iic_burst
+ * 说    明: 通过gpio模拟的i2c，在一次传输中往芯片写入一个控制字节和多行字节
+ * 参    数:
+ *      @ctrl：控制字节，OLED_CTRL_CMD或OLED_CTRL_DATA
+ *      @buf：命令或数据
+ *      @width：每行的字节数
+ *      @stride：buf中相邻两行的间隔
+ *      @rows：行数
  * 返 回 值: 无
  ***************************************************************/
-static inline void iic_start(void)
+static void write_iic_burst(unsigned char ctrl, const unsigned char *buf, unsigned int width,
+                            unsigned int stride, unsigned int rows)
 {
-    OLED_SCLK_Set();
-    OLED_SDIN_Set();
-    OLED_SDIN_Clr();
-    OLED_SCLK_Clr();
+    unsigned int ret;
+    unsigned int stop;
+    unsigned int r;
+
+    /* 从设备地址 + 写操作，然后通知芯片后面的字节都是命令或者都是数据。
+     * 没有应答或时钟延展超时时放弃剩余的字节，仍然发送结束条件释放总线 */
+    ret = soft_i2c_start(&m_i2c, OLED_I2C_ADDRESS, 0);
+    if (ret == 0) {
+        ret = soft_i2c_send(&m_i2c, &ctrl, 1);
+    }
+    for (r = 0; (r < rows) && (ret == 0); r++) {
+        ret = soft_i2c_send(&m_i2c, buf, width);
+        buf += stride;
+    }
+    stop = soft_i2c_stop(&m_i2c);
+    if (ret == 0) {
+        ret = stop;
+    }
+    if (ret != 0) {
+        printf("%s, %s, %d: soft_i2c transfer failed(%d)!\n", __FILE__, __func__, __LINE__, ret);
+    }
 }
-
-
+#else
 /***************************************************************
- * 函数名称: iic_stop
- * 说    明: i2c的结束条件
- * 参    数: 无
+ * 函数名称: write_iic_burst
+ * 说    明: 通过i2c通信协议，在一次传输中往芯片写入一个控制字节和多行字节
+ * 参    数:
+ *      @ctrl：控制字节，OLED_CTRL_CMD或OLED_CTRL_DATA
+ *      @buf：命令或数据
+ *      @width：每行的字节数
+ *      @stride：buf中相邻两行的间隔
+ *      @rows：行数，width * rows最大为OLED_BURST_MAX
  * 返 回 值: 无
  ***************************************************************/
-static inline void iic_stop(void)
+static void write_iic_burst(unsigned char ctrl, const unsigned char *buf, unsigned int width,
+                            unsigned int stride, unsigned int rows)
 {
-    OLED_SCLK_Set() ;
-    OLED_SDIN_Clr();
-    OLED_SDIN_Set();
+    /* 整个屏幕加控制字节，放在栈上太大 */
+    static unsigned char buffer[OLED_BURST_MAX + 1];
+    unsigned int len = 0;
+    unsigned int ret;
+    unsigned int r;
+
+    /* 填充数据，第一个字节是通知OLED芯片，后面的字节都是命令或者都是数据 */
+    buffer[0] = ctrl;
+    for (r = 0; r < rows; r++) {
+        memcpy(&buffer[1 + len], buf, width);
+        len += width;
+        buf += stride;
+    }
+    ret = LzI2cWrite(OLED_I2C_BUS, OLED_I2C_ADDRESS, buffer, len + 1);
+    if (ret != 0) {
+        printf("%s, %s, %d: LzI2cWrite failed(%d)!\n", __FILE__, __func__, __LINE__, ret);
+    }
 }
+#endif
 
 
 /***************************************************************
- * 函数名称: iic_wait_ack
- * 说    明: i2c的等待应答
- * 参    数: 无
+ * 函数名称: oled_write_cmds
+ * 说    明: 在一次传输中往芯片写入命令序列
+ * 参    数:
+ *      @cmds：命令序列
+ *      @len：字节数
  * 返 回 值: 无
  ***************************************************************/
-static inline void iic_wait_ack(void)
+static inline void oled_write_cmds(const unsigned char *cmds, unsigned int len)
 {
-    OLED_SCLK_Set();
-    OLED_SCLK_Clr();
+    write_iic_burst(OLED_CTRL_CMD, cmds, len, len, 1);
 }
 
 
 /***************************************************************
- * 函数名称: write_iic_byte
- * 说    明: i2c写单个字节
+ * 函数名称: oled_write_window
+ * 说    明: 设置水平寻址模式的列窗口和页窗口，把影子缓冲区中窗口内的
+ *           内容在一次传输中连续发送，芯片在窗口内自动换页
  * 参    数:
- *      @IIC_Byte：数值
+ *      @x0：起始列
+ *      @x1：结束列（包含）
+ *      @page0：起始页
+ *      @page1：结束页（包含）
  * 返 回 值: 无
  ***************************************************************/
-static inline void write_iic_byte(unsigned char iic_byte)
-{
-    unsigned char i;
-    unsigned char m, da;
-    da = iic_byte;
-    OLED_SCLK_Clr();
-    for (i = 0; i < BYTE_TO_BITS; i++) {
-        m = da;
-        m = m & 0x80;
-        if (m == 0x80) {
-            OLED_SDIN_Set();
-        } else {
-            OLED_SDIN_Clr();
-        }
-        da = da << 1;
-        OLED_SCLK_Set();
-        OLED_SCLK_Clr();
-    }
+static void oled_write_window(uint8_t x0, uint8_t x1, uint8_t page0, uint8_t page1)
+{
+    unsigned char cmds[6];
+
+    cmds[0] = OLED_CMD_COLUMN;
+    cmds[1] = x0;
+    cmds[2] = x1;
+    cmds[3] = OLED_CMD_PAGE;
+    cmds[4] = page0;
+    cmds[5] = page1;
+    oled_write_cmds(cmds, sizeof(cmds));
+    write_iic_burst(OLED_CTRL_DATA, &m_oled_buf[page0][x0], x1 - x0 + 1, OLED_COLUMN_MAX, page1 - page0 + 1);
 }
 
 
 /***************************************************************
- * 函数名称: write_iic_command
- * 说    明: 通过i2c通信协议，往芯片写入一个命令
+ * 函数名称: oled_mark_dirty
+ * 说    明: 把一页中的列范围记为有变化，与该页已有的范围合并
  * 参    数:
- *      @IIC_Command：命令数值
+ *      @page：页地址
+ *      @x0：起始列
+ *      @x1：结束列（包含）
  * 返 回 值: 无
  ***************************************************************/
-static inline void write_iic_command(unsigned char iic_command)
+static inline void oled_mark_dirty(uint8_t page, uint8_t x0, uint8_t x1)
 {
-    iic_start();
-    /* 从设备地址 + SA0, SA0=0表示写操作 */
-    write_iic_byte((OLED_I2C_ADDRESS << 1) | 0x0);
-    iic_wait_ack();
-    /* 通知芯片，下一个字节是命令 */
-    write_iic_byte(0x00);
-    iic_wait_ack();
-    write_iic_byte(iic_command);
-    iic_wait_ack();
-    iic_stop();
+    if (x0 < m_oled_dirty[page].start) {
+        m_oled_dirty[page].start = x0;
+    }
+    if (x1 > m_oled_dirty[page].end) {
+        m_oled_dirty[page].end = x1;
+    }
 }
 
 
 /***************************************************************
- * 函数名称: write_iic_data
- * 说    明: 通过i2c通信协议，往芯片写入一个数据
+ * 函数名称: oled_buf_write
+ * 说    明: 往影子缓冲区写入一列的8个像素，内容有变化时记为脏区域，
+ *           超出屏幕的部分被忽略
  * 参    数:
- *      @IIC_Data：数据数值
+ *      @x：列地址
+ *      @page：页地址
+ *      @dat：8个像素，低位在上
  * 返 回 值: 无
  ***************************************************************/
-static inline void write_iic_data(unsigned char iic_data)
+static inline void oled_buf_write(uint8_t x, uint8_t page, uint8_t dat)
 {
-    iic_start();
-    /* 从设备地址 + SA0, SA0=0表示写操作 */
-    write_iic_byte((OLED_I2C_ADDRESS << 1) | 0x0);
-    iic_wait_ack();
-    /* 通知芯片，下一个字节是数据 */
-    write_iic_byte(0x40);
-    iic_wait_ack();
-    write_iic_byte(iic_data);
-    iic_wait_ack();
-    iic_stop();
+    if ((x >= OLED_COLUMN_MAX) || (page >= OLED_PAGE_MAX) || (m_oled_buf[page][x] == dat)) {
+        return;
+    }
+
+    m_oled_buf[page][x] = dat;
+    oled_mark_dirty(page, x, x);
 }
-#else
+
+
 /***************************************************************
- * 函数名称: write_iic_command
- * 说    明: 通过i2c通信协议，往芯片写入一个命令
+ * 函数名称: oled_color_apply
+ * 说    明: 按颜色修改像素，可以同时处理一个字节或一个32位字
  * 参    数:
- *      @IIC_Command：命令数值
- * 返 回 值: 无
+ *      @old：原来的像素
+ *      @mask：要修改的像素
+ *      @color：颜色
+ * 返 回 值: 修改后的像素
  ***************************************************************/
-static inline void write_iic_command(unsigned char iic_command)
+static inline uint32_t oled_color_apply(uint32_t old, uint32_t mask, uint8_t color)
 {
-#define BUFFER_MAXSIZE      2 /* 字符串长度 */
-    unsigned char buffer[BUFFER_MAXSIZE];
-    unsigned int ret;
-
-    /* 填充数据，第一个字节是通知OLED芯片，下一个字节是命令 */
-    buffer[0] = 0x00;
-    buffer[1] = iic_command;
-    ret = LzI2cWrite(OLED_I2C_BUS, OLED_I2C_ADDRESS, buffer, BUFFER_MAXSIZE);
-    if (ret != 0) {
-        printf("%s, %s, %d: LzI2cWrite failed(%d)!\n", __FILE__, __func__, __LINE__, ret);
+    if (color == OLED_COLOR_WHITE) {
+        return old | mask;
     }
+    if (color == OLED_COLOR_INVERT) {
+        return old ^ mask;
+    }
+    return old & ~mask;
 }
 
 
 /***************************************************************
- * 函数名称: write_iic_data
- * 说    明: 通过i2c通信协议，往芯片写入一个数据
+ * 函数名称: oled_buf_fill
+ * 说    明: 按颜色修改一页中一段列的像素，每列修改的行相同。
+ *           对齐的部分每次读写一个32位字，即4列
  * 参    数:
- *      @iic_data：数据数值
+ *      @page：页地址
+ *      @x0：起始列
+ *      @x1：结束列（包含）
+ *      @mask：每列要修改的像素，低位在上
+ *      @color：颜色
  * 返 回 值: 无
  ***************************************************************/
-static inline void write_iic_data(unsigned char iic_data)
+static void oled_buf_fill(uint8_t page, uint8_t x0, uint8_t x1, uint8_t mask, uint8_t color)
 {
-    unsigned char buffer[2];
-    unsigned int ret;
+    uint32_t wmask = mask * OLED_WORD_REPEAT;
+    uint8_t start = OLED_COLUMN_MAX;
+    uint8_t end = 0;
+    uint32_t old, now;
+    uint8_t x = x0;
+
+    while (x <= x1) {
+        if (((x % OLED_WORD_COLUMNS) == 0) && (x + OLED_WORD_COLUMNS - 1 <= x1)) {
+            memcpy(&old, &m_oled_buf[page][x], sizeof(old));
+            now = oled_color_apply(old, wmask, color);
+            if (now != old) {
+                memcpy(&m_oled_buf[page][x], &now, sizeof(now));
+                start = (x < start) ? x : start;
+                end = x + OLED_WORD_COLUMNS - 1;
+            }
+            x += OLED_WORD_COLUMNS;
+            continue;
+        }
 
-    /* 填充数据，第一个字节是通知OLED芯片，下一个字节是数据 */
-    buffer[0] = 0x40;
-    buffer[1] = iic_data;
-    ret = LzI2cWrite(OLED_I2C_BUS, OLED_I2C_ADDRESS, buffer, 2);
-    if (ret != 0) {
-        printf("%s, %s, %d: LzI2cWrite failed(%d)!\n", __FILE__, __func__, __LINE__, ret);
+        old = m_oled_buf[page][x];
+        now = oled_color_apply(old, mask, color) & 0xFF;
+        if (now != old) {
+            m_oled_buf[page][x] = now;
+            start = (x < start) ? x : start;
+            end = x;
+        }
+        x++;
+    }
+
+    if (start <= end) {
+        oled_mark_dirty(page, start, end);
     }
 }
-#endif
 
 
 /***************************************************************
- * 函数名称: oled_wr_byte
- * 说    明: 往芯片写数据
+ * 函数名称: oled_buf_column
+ * 说    明: 修改一列中从y开始的最多OLED_FONT_HEIGHT_MAX个像素。
+ *           整列的像素放在一个32位字中，按y移位后拆分到各页
  * 参    数:
- *      @data：数据数值
- *      @cmd：该数据是命令，还是数据
+ *      @x：列地址
+ *      @y：第一个像素的行，可以为负数
+ *      @bits：像素，低位在上
+ *      @mask：要修改的像素
  * 返 回 值: 无
  ***************************************************************/
-static inline void oled_wr_byte(unsigned dat, unsigned cmd)
+static void oled_buf_column(int16_t x, int16_t y, uint32_t bits, uint32_t mask)
 {
-    if (cmd == OLED_DATA) {
-        write_iic_data(dat);
-    } else if (cmd == OLED_CMD) {
-        write_iic_command(dat);
-    } else {
-        printf("%s, %s, %d: cmd(%d) out of the range!\n", __FILE__, __func__, __LINE__, cmd);
+    uint8_t page;
+
+    if ((x < 0) || (x >= OLED_COLUMN_MAX) || (y >= OLED_ROW_MAX) || (y <= -OLED_FONT_HEIGHT_MAX)) {
+        return;
+    }
+    if (y < 0) {
+        bits >>= -y;
+        mask >>= -y;
+        y = 0;
+    }
+
+    bits <<= y % BYTE_TO_BITS;
+    mask <<= y % BYTE_TO_BITS;
+    for (page = y / BYTE_TO_BITS; (page < OLED_PAGE_MAX) && (mask != 0); page++) {
+        if (mask & 0xFF) {
+            oled_buf_write(x, page, (m_oled_buf[page][x] & ~mask) | (bits & mask));
+        }
+        bits >>= BYTE_TO_BITS;
+        mask >>= BYTE_TO_BITS;
     }
 }
 
 
 /***************************************************************
- * 函数名称: oled_set_pos
- * 说    明: 坐标设置
+ * 函数名称: oled_buf_band
+ * 说    明: 按绘制模式显示最多OLED_FONT_HEIGHT_MAX行的点阵，每列的
+ *           各页字节合并为一个32位字后写入
  * 参    数:
- *      @x：X轴坐标
- *      @y：Y轴坐标
+ *      @x：左上角的X轴坐标
+ *      @y：左上角的Y轴坐标
+ *      @width：列数
+ *      @height：行数，最大为OLED_FONT_HEIGHT_MAX
+ *      @src：点阵，按页存储，低位在上
+ *      @pitch：点阵中相邻两页的间隔
+ *      @mode：绘制模式
  * 返 回 值: 无
  ***************************************************************/
-static inline void oled_set_pos(unsigned char x, unsigned char y)
+static void oled_buf_band(int16_t x, int16_t y, uint8_t width, uint8_t height, const uint8_t *src,
+                          uint8_t pitch, uint8_t mode)
 {
-#define BYTE_DIV        4 /* 截取字节部分 */
-    oled_wr_byte(0xb0 + y, OLED_CMD);
-    oled_wr_byte(((x & 0xf0) >> BYTE_DIV) | 0x10, OLED_CMD);
-    oled_wr_byte((x & 0x0f), OLED_CMD);
+    uint32_t cell = ((uint32_t)1 << height) - 1;
+    uint8_t pages = (height + BYTE_TO_BITS - 1) / BYTE_TO_BITS;
+    uint32_t col;
+    uint8_t i, p;
+
+    for (i = 0; i < width; i++) {
+        if ((x + i < 0) || (x + i >= OLED_COLUMN_MAX)) {
+            continue;
+        }
+
+        col = 0;
+        for (p = 0; p < pages; p++) {
+            col |= (uint32_t)src[p * pitch + i] << (p * BYTE_TO_BITS);
+        }
+        col &= cell;
+
+        if (mode == OLED_DRAW_INVERT) {
+            oled_buf_column(x + i, y, ~col, cell);
+        } else if (mode == OLED_DRAW_OVERLAY) {
+            oled_buf_column(x + i, y, col, col);
+        } else {
+            oled_buf_column(x + i, y, col, cell);
+        }
+    }
 }
 
 /***************************************************************
@@ -299,60 +504,33 @@ static inline void oled_set_pos(unsigned char x, unsigned char y)
 unsigned int oled_init(void)
 {
     uint32_t sleep_msec = 200;
+    uint8_t i;
 #if !OLED_I2C_ENABLE
-    /* GPIO0_C1 => I2C1_SDA_M1 */
-    LzGpioInit(GPIO_I2C_SDA);
-    LzGpioSetDir(GPIO_I2C_SDA, LZGPIO_DIR_OUT);
-    /* GPIO0_C2 => I2C1_SCL_M1 */
-    LzGpioInit(GPIO_I2C_SCL);
-    LzGpioSetDir(GPIO_I2C_SCL, LZGPIO_DIR_OUT);
+    if (soft_i2c_init(&m_i2c, GPIO_I2C_SCL, GPIO_I2C_SDA, OLED_SOFT_I2C_FREQ) != 0) {
+        printf("%s, %d: soft_i2c_init failed!\n", __FILE__, __LINE__);
+        return __LINE__;
+    }
 #else
     if (I2cIoInit(m_i2cBus) != LZ_HARDWARE_SUCCESS) {
         printf("%s, %d: I2cIoInit failed!\n", __FILE__, __LINE__);
-        return __FILE__;
+        return __LINE__;
     }
     if (LzI2cInit(OLED_I2C_BUS, m_i2c_freq) != LZ_HARDWARE_SUCCESS) {
-        printf("%s, %d: I2cIoInit failed!\n", __FILE__, __LINE__);
-        return __FILE__;
+        printf("%s, %d: LzI2cInit failed!\n", __FILE__, __LINE__);
+        return __LINE__;
     }
 #endif
 
     LOS_Msleep(sleep_msec);
 
-    oled_wr_byte(0xAE, OLED_CMD); // --display off
-    oled_wr_byte(0x00, OLED_CMD); // ---set low column address
-    oled_wr_byte(0x10, OLED_CMD); // ---set high column address
-    oled_wr_byte(0x40, OLED_CMD); // --set start line address
-    oled_wr_byte(0xB0, OLED_CMD); // --set page address
-    oled_wr_byte(0x81, OLED_CMD); // contract control
-    oled_wr_byte(0xFF, OLED_CMD); // --128
-    oled_wr_byte(0xA1, OLED_CMD); // set segment remap
-    oled_wr_byte(0xA6, OLED_CMD); // --normal / reverse
-    oled_wr_byte(0xA8, OLED_CMD); // --set multiplex ratio(1 to 64)
-    oled_wr_byte(0x3F, OLED_CMD); // --1/32 duty
-    oled_wr_byte(0xC8, OLED_CMD); // Com scan direction
-    oled_wr_byte(0xD3, OLED_CMD); // -set display offset
-    oled_wr_byte(0x00, OLED_CMD);
+    oled_write_cmds(m_oled_init_cmds, sizeof(m_oled_init_cmds));
 
-    oled_wr_byte(0xD5, OLED_CMD); // set osc division
-    oled_wr_byte(0x80, OLED_CMD);
-
-    oled_wr_byte(0xD8, OLED_CMD); // set area color mode off
-    oled_wr_byte(0x05, OLED_CMD);
-
-    oled_wr_byte(0xD9, OLED_CMD); // Set Pre-Charge Period
-    oled_wr_byte(0xF1, OLED_CMD);
-
-    oled_wr_byte(0xDA, OLED_CMD); // set com pin configuartion
-    oled_wr_byte(0x12, OLED_CMD);
-
-    oled_wr_byte(0xDB, OLED_CMD); // set Vcomh
-    oled_wr_byte(0x30, OLED_CMD);
-
-    oled_wr_byte(0x8D, OLED_CMD); // set charge pump enable
-    oled_wr_byte(0x14, OLED_CMD);
-
-    oled_wr_byte(0xAF, OLED_CMD); // --turn on oled panel
+    /* 上电后显存的内容不确定，第一次刷新时发送整个屏幕 */
+    memset(m_oled_buf, 0, sizeof(m_oled_buf));
+    for (i = 0; i < OLED_PAGE_MAX; i++) {
+        m_oled_dirty[i].start = 0;
+        m_oled_dirty[i].end = OLED_COLUMN_MAX - 1;
+    }
 
     return 0;
 }
@@ -367,8 +545,7 @@ unsigned int oled_init(void)
 unsigned int oled_deinit(void)
 {
 #if !OLED_I2C_ENABLE
-    LzGpioDeinit(GPIO_I2C_SDA);
-    LzGpioDeinit(GPIO_I2C_SCL);
+    soft_i2c_deinit(&m_i2c);
 #else
     LzI2cDeinit(OLED_I2C_BUS);
 #endif
@@ -378,7 +555,7 @@ unsigned int oled_deinit(void)
 
 /***************************************************************
  * 函数名称: oled_clear
- * 说    明: oled清空
+ * 说    明: oled清空，只清空影子缓冲区，调用oled_refresh()后显示
  * 参    数: 无
  * 返 回 值: 无
  ***************************************************************/
@@ -386,17 +563,100 @@ void oled_clear(void)
 {
     uint8_t i, n;
 
-    for (i = 0; i < BYTE_TO_BITS; i++) {
-        oled_wr_byte(0xb0 + i, OLED_CMD);   // 设置页地址（0~7）
-        oled_wr_byte(0x00, OLED_CMD);       // 设置显示位置—列低地址
-        oled_wr_byte(0x10, OLED_CMD);       // 设置显示位置—列高地址
+    for (i = 0; i < OLED_PAGE_MAX; i++) {
         for (n = 0; n < OLED_COLUMN_MAX; n++) {
-            oled_wr_byte(0, OLED_DATA);
+            oled_buf_write(n, i, 0);
+        }
+    }
+}
+
+
+/***************************************************************
+ * 函数名称: oled_refresh
+ * 说    明: 把影子缓冲区中自上次刷新以来有变化的部分发送到oled。
+ *           包含所有变化的矩形窗口不比逐页发送多时，整个窗口在一次
+ *           传输中发送（全屏变化时为1024字节），否则每页发送一个窗口
+ * 参    数: 无
+ * 返 回 值: 无
+ ***************************************************************/
+void oled_refresh(void)
+{
+    uint8_t x0 = OLED_COLUMN_MAX;
+    uint8_t x1 = 0;
+    uint8_t page0 = OLED_PAGE_MAX;
+    uint8_t page1 = 0;
+    uint32_t cost_pages = 0;
+    uint32_t cost_union;
+    uint8_t page;
+
+    for (page = 0; page < OLED_PAGE_MAX; page++) {
+        if (m_oled_dirty[page].start > m_oled_dirty[page].end) {
+            continue;
+        }
+        if (page0 == OLED_PAGE_MAX) {
+            page0 = page;
         }
+        page1 = page;
+        x0 = (m_oled_dirty[page].start < x0) ? m_oled_dirty[page].start : x0;
+        x1 = (m_oled_dirty[page].end > x1) ? m_oled_dirty[page].end : x1;
+        cost_pages += OLED_WINDOW_COST + m_oled_dirty[page].end - m_oled_dirty[page].start + 1;
+    }
+    if (page0 == OLED_PAGE_MAX) {
+        return;
+    }
+
+    cost_union = OLED_WINDOW_COST + (uint32_t)(x1 - x0 + 1) * (page1 - page0 + 1);
+    if (cost_union <= cost_pages) {
+        oled_write_window(x0, x1, page0, page1);
+    } else {
+        for (page = page0; page <= page1; page++) {
+            if (m_oled_dirty[page].start <= m_oled_dirty[page].end) {
+                oled_write_window(m_oled_dirty[page].start, m_oled_dirty[page].end, page, page);
+            }
+        }
+    }
+
+    for (page = page0; page <= page1; page++) {
+        m_oled_dirty[page].start = OLED_COLUMN_MAX;
+        m_oled_dirty[page].end = 0;
     }
 }
 
 
+/***************************************************************
+ * 函数名称: oled_fps_benchmark
+ * 说    明: 测量全屏刷新的帧率。每帧改变影子缓冲区的全部内容，
+ *           再调用oled_refresh()发送，会覆盖屏幕内容
+ * 参    数:
+ *       @frames：刷新的帧数
+ * 返 回 值: 每秒刷新的帧数，测量时间过短时返回0
+ ***************************************************************/
+uint32_t oled_fps_benchmark(uint16_t frames)
+{
+    uint64_t start;
+    uint32_t msec;
+    uint16_t i;
+    uint8_t page, x;
+
+    start = LOS_TickCountGet();
+    for (i = 0; i < frames; i++) {
+        /* 棋盘格，相邻两帧互为反色 */
+        for (page = 0; page < OLED_PAGE_MAX; page++) {
+            for (x = 0; x < OLED_COLUMN_MAX; x++) {
+                oled_buf_write(x, page, ((x + i) & 1) ? 0xAA : 0x55);
+            }
+        }
+        oled_refresh();
+    }
+    msec = LOS_Tick2MS((uint32_t)(LOS_TickCountGet() - start));
+
+    if (msec == 0) {
+        return 0;
+    }
+    return (uint32_t)((uint64_t)frames * MSEC_PER_SEC / msec);
+}
+
+
 /***************************************************************
  * 函数名称: oled_display_on
  * 说    明: oled显示开启
@@ -405,9 +665,13 @@ void oled_clear(void)
  ***************************************************************/
 void oled_display_on(void)
 {
-    oled_wr_byte(0X8D, OLED_CMD); // SET DCDC命令
-    oled_wr_byte(0X14, OLED_CMD); // DCDC ON
-    oled_wr_byte(0XAF, OLED_CMD); // DISPLAY ON
+    static const unsigned char cmds[] = {
+        0X8D, // SET DCDC命令
+        0X14, // DCDC ON
+        0XAF, // DISPLAY ON
+    };
+
+    oled_write_cmds(cmds, sizeof(cmds));
 }
 
 
@@ -419,15 +683,19 @@ void oled_display_on(void)
  ***************************************************************/
 void oled_display_off(void)
 {
-    oled_wr_byte(0X8D, OLED_CMD); // SET DCDC命令
-    oled_wr_byte(0X10, OLED_CMD); // DCDC OFF
-    oled_wr_byte(0XAE, OLED_CMD); // DISPLAY OFF
+    static const unsigned char cmds[] = {
+        0X8D, // SET DCDC命令
+        0X10, // DCDC OFF
+        0XAE, // DISPLAY OFF
+    };
+
+    oled_write_cmds(cmds, sizeof(cmds));
 }
 
 
 /***************************************************************
  * 函数名称: oled_show_char
- * 说    明: oled显示字符
+ * 说    明: oled显示字符，写入影子缓冲区，调用oled_refresh()后显示
  * 参    数:
  *      @x：字符的X轴坐标
  *      @y：字符的Y轴坐标
@@ -452,18 +720,13 @@ void oled_show_char(uint8_t x, uint8_t y, uint8_t chr, uint8_t chr_size)
     }
 
     if (chr_size == OLED_CHR_SIZE_16) {
-        oled_set_pos(x, y);
-        for (i = 0; i < F8X16_LINE_DATA; i++) {
-            oled_wr_byte(F8X16[c * 16 + i], OLED_DATA);
-        }
-        oled_set_pos(x, y + 1);
         for (i = 0; i < F8X16_LINE_DATA; i++) {
-            oled_wr_byte(F8X16[c * CHAR_LEN + i + BYTE_BITS], OLED_DATA);
+            oled_buf_write(x + i, y, F8X16[c * CHAR_LEN + i]);
+            oled_buf_write(x + i, y + 1, F8X16[c * CHAR_LEN + i + BYTE_BITS]);
         }
     } else {
-        oled_set_pos(x, y);
         for (i = 0; i < F6X8_LINE_DATA; i++) {
-            oled_wr_byte(F6x8[c][i], OLED_DATA);
+            oled_buf_write(x + i, y, F6x8[c][i]);
         }
     }
 }
@@ -471,7 +734,7 @@ void oled_show_char(uint8_t x, uint8_t y, uint8_t chr, uint8_t chr_size)
 
 /***************************************************************
  * 函数名称: oled_show_num
- * 说    明: oled显示数字
+ * 说    明: oled显示数字，写入影子缓冲区，调用oled_refresh()后显示
  * 参    数:
  *      @x：数字的X轴坐标
  *      @y：数字的Y轴坐标
@@ -505,7 +768,7 @@ void oled_show_num(uint8_t x, uint8_t y, uint32_t num, uint8_t len, uint8_t size
 
 /***************************************************************
  * 函数名称: oled_show_string
- * 说    明: oled显示字符串
+ * 说    明: oled显示字符串，写入影子缓冲区，调用oled_refresh()后显示
  * 参    数:
  *      @x：字符串的X轴坐标
  *      @y：字符串的Y轴坐标
@@ -533,7 +796,7 @@ void oled_show_string(uint8_t x, uint8_t y, uint8_t *chr, uint8_t chr_size)
 
 /***************************************************************
  * 函数名称: oled_draw_bmp
- * 说    明: oled显示图片
+ * 说    明: oled显示图片，写入影子缓冲区，调用oled_refresh()后显示
  * 参    数:
  *      @x0：图片的起始点X轴坐标，取值为0~127
  *      @y0：图片的起始点Y轴坐标，取值为0~63
@@ -555,10 +818,382 @@ void oled_draw_bmp(unsigned char x0, unsigned char y0, unsigned char x1, unsigne
     }
 
     for (y = y0; y < y1; y++) {
-        oled_set_pos(x0, y);
-
         for (x = x0; x < x1; x++) {
-            oled_wr_byte(bmp[j++], OLED_DATA);
+            oled_buf_write(x, y, bmp[j++]);
         }
     }
 }
+
+
+/***************************************************************
+ * 函数名称: oled_draw_point
+ * 说    明: 画点，写入影子缓冲区，超出屏幕的部分被忽略
+ * 参    数:
+ *      @x：点的X轴坐标
+ *      @y：点的Y轴坐标
+ *      @color：颜色，OLED_COLOR_BLACK、OLED_COLOR_WHITE或OLED_COLOR_INVERT
+ * 返 回 值: 无
+ ***************************************************************/
+void oled_draw_point(int16_t x, int16_t y, uint8_t color)
+{
+    if ((x < 0) || (x >= OLED_COLUMN_MAX) || (y < 0) || (y >= OLED_ROW_MAX)) {
+        return;
+    }
+
+    oled_buf_fill(y / BYTE_TO_BITS, x, x, 1 << (y % BYTE_TO_BITS), color);
+}
+
+
+/***************************************************************
+ * 函数名称: oled_fill_rectangle
+ * 说    明: 填充矩形，写入影子缓冲区，超出屏幕的部分被裁剪。
+ *           每页只计算一次要修改的行，再按32位字处理各列
+ * 参    数:
+ *      @x1：起始点X轴坐标
+ *      @y1：起始点Y轴坐标
+ *      @x2：结束点X轴坐标（包含）
+ *      @y2：结束点Y轴坐标（包含）
+ *      @color：颜色
+ * 返 回 值: 无
+ ***************************************************************/
+void oled_fill_rectangle(int16_t x1, int16_t y1, int16_t x2, int16_t y2, uint8_t color)
+{
+    uint64_t rows;
+    int16_t t;
+    uint8_t page;
+
+    if (x1 > x2) {
+        t = x1;
+        x1 = x2;
+        x2 = t;
+    }
+    if (y1 > y2) {
+        t = y1;
+        y1 = y2;
+        y2 = t;
+    }
+    x1 = (x1 < 0) ? 0 : x1;
+    y1 = (y1 < 0) ? 0 : y1;
+    x2 = (x2 >= OLED_COLUMN_MAX) ? (OLED_COLUMN_MAX - 1) : x2;
+    y2 = (y2 >= OLED_ROW_MAX) ? (OLED_ROW_MAX - 1) : y2;
+    if ((x1 > x2) || (y1 > y2)) {
+        return;
+    }
+
+    /* 64行中要修改的行，第n页为第8n~8n+7位 */
+    rows = (~0ULL << y1) & (~0ULL >> (OLED_ROW_MAX - 1 - y2));
+    for (page = y1 / BYTE_TO_BITS; page <= y2 / BYTE_TO_BITS; page++) {
+        oled_buf_fill(page, x1, x2, (rows >> (page * BYTE_TO_BITS)) & 0xFF, color);
+    }
+}
+
+
+/***************************************************************
+ * 函数名称: oled_draw_line
+ * 说    明: 画线，写入影子缓冲区，超出屏幕的部分被裁剪。
+ *           平缓的线按水平线段、陡峭的线按垂直线段写入
+ * 参    数:
+ *      @x1：起始点X轴坐标
+ *      @y1：起始点Y轴坐标
+ *      @x2：结束点X轴坐标
+ *      @y2：结束点Y轴坐标
+ *      @color：颜色
+ * 返 回 值: 无
+ ***************************************************************/
+void oled_draw_line(int16_t x1, int16_t y1, int16_t x2, int16_t y2, uint8_t color)
+{
+    /* 端点的差可以超过int16_t的范围，误差项用int32_t计算 */
+    int32_t dx = (x2 > x1) ? ((int32_t)x2 - x1) : ((int32_t)x1 - x2);
+    int32_t dy = (y2 > y1) ? ((int32_t)y1 - y2) : ((int32_t)y2 - y1);
+    int16_t sx = (x1 < x2) ? 1 : -1;
+    int16_t sy = (y1 < y2) ? 1 : -1;
+    int32_t err = dx + dy;
+    int32_t e2;
+    uint8_t steep = (-dy > dx);
+    int16_t run_x = x1;
+    int16_t run_y = y1;
+    int16_t px, py;
+
+    /* Bresenham算法，主方向上连续的像素合并为一个线段 */
+    while ((x1 != x2) || (y1 != y2)) {
+        px = x1;
+        py = y1;
+        e2 = 2 * err;
+        if (e2 >= dy) {
+            err += dy;
+            x1 += sx;
+        }
+        if (e2 <= dx) {
+            err += dx;
+            y1 += sy;
+        }
+
+        /* 另一个方向的坐标改变时，上一个线段结束 */
+        if (steep && (x1 != px)) {
+            oled_fill_rectangle(px, run_y, px, py, color);
+            run_y = y1;
+        } else if (!steep && (y1 != py)) {
+            oled_fill_rectangle(run_x, py, px, py, color);
+            run_x = x1;
+        }
+    }
+
+    if (steep) {
+        oled_fill_rectangle(x1, run_y, x1, y1, color);
+    } else {
+        oled_fill_rectangle(run_x, y1, x1, y1, color);
+    }
+}
+
+
+/***************************************************************
+ * 函数名称: oled_draw_rectangle
+ * 说    明: 画矩形边框，写入影子缓冲区，超出屏幕的部分被裁剪
+ * 参    数:
+ *      @x1：起始点X轴坐标
+ *      @y1：起始点Y轴坐标
+ *      @x2：结束点X轴坐标（包含）
+ *      @y2：结束点Y轴坐标（包含）
+ *      @color：颜色
+ * 返 回 值: 无
+ ***************************************************************/
+void oled_draw_rectangle(int16_t x1, int16_t y1, int16_t x2, int16_t y2, uint8_t color)
+{
+    int16_t t;
+
+    if (x1 > x2) {
+        t = x1;
+        x1 = x2;
+        x2 = t;
+    }
+    if (y1 > y2) {
+        t = y1;
+        y1 = y2;
+        y2 = t;
+    }
+
+    /* 四条边不重叠，反色时每个像素只取反一次 */
+    oled_fill_rectangle(x1, y1, x2, y1, color);
+    if (y2 > y1) {
+        oled_fill_rectangle(x1, y2, x2, y2, color);
+    }
+    if (y2 - y1 > 1) {
+        oled_fill_rectangle(x1, y1 + 1, x1, y2 - 1, color);
+        if (x2 > x1) {
+            oled_fill_rectangle(x2, y1 + 1, x2, y2 - 1, color);
+        }
+    }
+}
+
+
+/***************************************************************
+ * 函数名称: oled_circle_points
+ * 说    明: 画以圆心对称的点(x0±a, y0±b)，重合的点只画一次
+ * 参    数:
+ *      @x0：圆心X轴坐标
+ *      @y0：圆心Y轴坐标
+ *      @a：X方向的偏移
+ *      @b：Y方向的偏移
+ *      @color：颜色
+ * 返 回 值: 无
+ ***************************************************************/
+static void oled_circle_points(int16_t x0, int16_t y0, int16_t a, int16_t b, uint8_t color)
+{
+    oled_draw_point(x0 + a, y0 + b, color);
+    if (a != 0) {
+        oled_draw_point(x0 - a, y0 + b, color);
+    }
+    if (b != 0) {
+        oled_draw_point(x0 + a, y0 - b, color);
+        if (a != 0) {
+            oled_draw_point(x0 - a, y0 - b, color);
+        }
+    }
+}
+
+
+/***************************************************************
+ * 函数名称: oled_draw_circle
+ * 说    明: 画圆，写入影子缓冲区，超出屏幕的部分被裁剪
+ * 参    数:
+ *      @x0：圆心X轴坐标
+ *      @y0：圆心Y轴坐标
+ *      @r：半径
+ *      @color：颜色
+ * 返 回 值: 无
+ ***************************************************************/
+void oled_draw_circle(int16_t x0, int16_t y0, uint8_t r, uint8_t color)
+{
+    int16_t a = 0;
+    int16_t b = r;
+    int16_t d = 1 - r;
+
+    /* 中点画圆法，每次计算八分之一圆弧上的一个点 */
+    while (a <= b) {
+        oled_circle_points(x0, y0, a, b, color);
+        if (a != b) {
+            oled_circle_points(x0, y0, b, a, color);
+        }
+        a++;
+        if (d < 0) {
+            d += 2 * a + 1;
+        } else {
+            b--;
+            d += 2 * (a - b) + 1;
+        }
+    }
+}
+
+
+/***************************************************************
+ * 函数名称: oled_fill_circle
+ * 说    明: 填充圆，写入影子缓冲区，超出屏幕的部分被裁剪。
+ *           每列作为一个垂直线段写入
+ * 参    数:
+ *      @x0：圆心X轴坐标
+ *      @y0：圆心Y轴坐标
+ *      @r：半径
+ *      @color：颜色
+ * 返 回 值: 无
+ ***************************************************************/
+void oled_fill_circle(int16_t x0, int16_t y0, uint8_t r, uint8_t color)
+{
+    int32_t r2 = (int32_t)r * r;
+    int16_t h = r;
+    int16_t a;
+
+    for (a = 0; a <= r; a++) {
+        /* h为该列到圆心的最大垂直距离，随a增大而减小 */
+        while ((int32_t)h * h + (int32_t)a * a > r2) {
+            h--;
+        }
+        oled_fill_rectangle(x0 + a, y0 - h, x0 + a, y0 + h, color);
+        if (a != 0) {
+            oled_fill_rectangle(x0 - a, y0 - h, x0 - a, y0 + h, color);
+        }
+    }
+}
+
+
+/***************************************************************
+ * 函数名称: oled_draw_bitmap
+ * 说    明: 在任意位置显示图片，写入影子缓冲区，超出屏幕的部分被裁剪
+ * 参    数:
+ *      @x：图片左上角的X轴坐标
+ *      @y：图片左上角的Y轴坐标，不需要按页对齐
+ *      @width：图片的宽度
+ *      @height：图片的高度
+ *      @bmp：图片，与oled_draw_bmp的格式相同，按页存储，每页width个字节
+ *      @mode：OLED_DRAW_NORMAL、OLED_DRAW_INVERT或OLED_DRAW_OVERLAY
+ * 返 回 值: 无
+ ***************************************************************/
+void oled_draw_bitmap(int16_t x, int16_t y, uint8_t width, uint8_t height, const uint8_t *bmp, uint8_t mode)
+{
+    uint16_t row;
+    uint8_t h;
+
+    /* 每次处理OLED_FONT_HEIGHT_MAX行，正好是整数页 */
+    for (row = 0; row < height; row += OLED_FONT_HEIGHT_MAX) {
+        h = (height - row > OLED_FONT_HEIGHT_MAX) ? OLED_FONT_HEIGHT_MAX : (height - row);
+        oled_buf_band(x, y + row, width, h, bmp + (row / BYTE_TO_BITS) * width, width, mode);
+    }
+}
+
+
+/***************************************************************
+ * 函数名称: oled_font_glyph
+ * 说    明: 查找字符的点阵和宽度
+ * 参    数:
+ *      @font：字体
+ *      @chr：字符
+ *      @width：返回字形的列数
+ * 返 回 值: 字形的点阵，字体中没有该字符时返回NULL
+ ***************************************************************/
+static const uint8_t *oled_font_glyph(const oled_font_t *font, uint8_t chr, uint8_t *width)
+{
+    uint8_t pages = (font->height + BYTE_TO_BITS - 1) / BYTE_TO_BITS;
+    const uint8_t *cell = NULL;
+
+    if ((chr < font->first) || (chr - font->first >= font->num)) {
+        return NULL;
+    }
+
+    cell = font->bitmap + (uint32_t)(chr - font->first) * font->cell * pages;
+    if (font->glyphs == NULL) {
+        *width = font->cell;
+        return cell;
+    }
+    *width = font->glyphs[chr - font->first].width;
+    return cell + font->glyphs[chr - font->first].x;
+}
+
+
+/***************************************************************
+ * 函数名称: oled_draw_text
+ * 说    明: 用指定字体在任意位置显示字符串，写入影子缓冲区，
+ *           超出屏幕右边界的字符不显示
+ * 参    数:
+ *      @x：起始位置X轴坐标
+ *      @y：起始位置Y轴坐标，不需要按页对齐
+ *      @str：字符串
+ *      @font：字体，如oled_font_6x8_prop
+ *      @mode：OLED_DRAW_NORMAL、OLED_DRAW_INVERT或OLED_DRAW_OVERLAY
+ * 返 回 值: 字符串的显示宽度
+ ***************************************************************/
+uint16_t oled_draw_text(int16_t x, int16_t y, const char *str, const oled_font_t *font, uint8_t mode)
+{
+    static const uint8_t blank[OLED_FONT_HEIGHT_MAX / BYTE_TO_BITS] = {0};
+    const uint8_t *glyph = NULL;
+    int16_t start = x;
+    uint8_t width, gap;
+
+    if ((font->height == 0) || (font->height > OLED_FONT_HEIGHT_MAX)) {
+        return 0;
+    }
+
+    for (; (*str != '\0') && (x < OLED_COLUMN_MAX); str++) {
+        glyph = oled_font_glyph(font, (uint8_t)*str, &width);
+        gap = font->spacing;
+        if (glyph == NULL) {
+            /* 字体中没有的字符显示为空白 */
+            glyph = blank;
+            width = 0;
+            gap = font->height / 2;
+        }
+
+        oled_buf_band(x, y, width, font->height, glyph, font->cell, mode);
+        x += width;
+        /* 字间距的空白列，叠加模式下不需要画 */
+        for (; (gap > 0) && (mode != OLED_DRAW_OVERLAY); gap--, x++) {
+            oled_buf_band(x, y, 1, font->height, blank, 1, mode);
+        }
+        x += gap;
+    }
+
+    return x - start;
+}
+
+
+/***************************************************************
+ * 函数名称: oled_text_width
+ * 说    明: 计算字符串用指定字体显示时的宽度
+ * 参    数:
+ *      @str：字符串
+ *      @font：字体
+ * 返 回 值: 字符串的显示宽度
+ ***************************************************************/
+uint16_t oled_text_width(const char *str, const oled_font_t *font)
+{
+    uint16_t width = 0;
+    uint8_t w;
+
+    for (; *str != '\0'; str++) {
+        if (oled_font_glyph(font, (uint8_t)*str, &w) == NULL) {
+            width += font->height / 2;
+        } else {
+            width += w + font->spacing;
+        }
+    }
+
+    return width;
+}
@@ -0,0 +1,536 @@
+/*
+ * Copyright (c) 2022 FuZhou Lockzhiner Electronic Co., Ltd. All rights reserved.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "lz_hardware.h"
+#include "los_task.h"
+#include "los_tick.h"
+#include "hal_base.h"
+#include "soft_i2c.h"
+
+/* 每个GPIO控制器的引脚数，GPIO0_PA0~GPIO0_PD7属于GPIO0，之后属于GPIO1 */
+#define SOFT_I2C_BANK_PINS      32
+#define SOFT_I2C_BANK_NUM       2
+/* PA、PB对应寄存器_L的bit0~bit15，PC、PD对应寄存器_H的bit0~bit15，
+ * 寄存器高16位为对应位的写使能，一次写操作只修改写使能的位 */
+#define SOFT_I2C_HALF_PINS      16
+#define SOFT_I2C_WRITE_EN(bits) ((uint32_t)(bits) << 16)
+
+/* 读写GPIO寄存器，主机测试时替换为总线模型 */
+#ifndef SOFT_I2C_WRITE
+#define SOFT_I2C_WRITE(reg, val)    (*(reg) = (val))
+#endif
+#ifndef SOFT_I2C_READ
+#define SOFT_I2C_READ(reg)          (*(reg))
+#endif
+
+/* 字节的bits数目 */
+#define BYTE_TO_BITS            8
+#define BYTE_HIGH_BIT           0x80
+
+/* 校准时每次测量的tick数、每检查一次tick执行的循环次数、测量延时循环所用的延时 */
+#define SOFT_I2C_CALIB_TICKS    10
+#define SOFT_I2C_CALIB_BLOCK    64
+#define SOFT_I2C_CALIB_DELAY    64
+
+/* 发送时每个时钟周期的寄存器操作数和延时数：改变SDA、释放SCL、读取SCL、拉低SCL，
+ * 读操作按与写操作相同的耗时估算 */
+#define SOFT_I2C_PERIOD_ACCESSES 4
+#define SOFT_I2C_PERIOD_DELAYS  2
+
+/* 等待从设备释放SCL（时钟延展）的最大次数，超过时传输失败 */
+#ifndef SOFT_I2C_STRETCH_MAX
+#define SOFT_I2C_STRETCH_MAX    10000
+#endif
+/* 总线恢复时最多发送的时钟数 */
+#define SOFT_I2C_RECOVER_CLOCKS 9
+
+/* 皮秒与秒、毫秒的换算 */
+#define PSEC_PER_SEC            1000000000000ULL
+#define PSEC_PER_MSEC           1000000000ULL
+
+/* 校准结果：一次寄存器写操作（含延时函数的固定开销）和一次延时循环的耗时（皮秒），
+ * m_loop_ps为0表示尚未校准，所有总线共用
+ */
+static uint32_t m_write_ps = 0;
+static uint32_t m_loop_ps = 0;
+
+/***************************************************************
+ * 函数名称: soft_i2c_delay
+ * 说    明: 延时循环
+ * 参    数:
+ *      @n：循环次数
+ * 返 回 值: 无
+ ***************************************************************/
+static inline void soft_i2c_delay(uint32_t n)
+{
+    volatile uint32_t i = n;
+
+    while (i > 0) {
+        i--;
+    }
+}
+
+
+/***************************************************************
+ * 函数名称: soft_i2c_pin
+ * 说    明: 计算引脚对应的寄存器地址和位
+ * 参    数:
+ *      @pin：引脚
+ *      @dr：返回输出寄存器的地址
+ *      @ddr：返回方向寄存器的地址
+ *      @in：返回输入寄存器的地址
+ *      @bit：返回引脚在输出、方向寄存器中的位
+ *      @mask：返回引脚在输入寄存器中的位
+ * 返 回 值: 返回0为成功，反之为失败
+ ***************************************************************/
+static unsigned int soft_i2c_pin(uint32_t pin, volatile uint32_t **dr, volatile uint32_t **ddr,
+                                 volatile uint32_t **in, uint32_t *bit, uint32_t *mask)
+{
+    struct GPIO_REG *gpio = NULL;
+    uint32_t n = pin % SOFT_I2C_BANK_PINS;
+
+    if (pin >= SOFT_I2C_BANK_PINS * SOFT_I2C_BANK_NUM) {
+        return __LINE__;
+    }
+    gpio = (pin < SOFT_I2C_BANK_PINS) ? GPIO0 : GPIO1;
+
+    *dr = (n < SOFT_I2C_HALF_PINS) ? &gpio->SWPORT_DR_L : &gpio->SWPORT_DR_H;
+    *ddr = (n < SOFT_I2C_HALF_PINS) ? &gpio->SWPORT_DDR_L : &gpio->SWPORT_DDR_H;
+    *in = &gpio->EXT_PORT;
+    *bit = 1U << (n % SOFT_I2C_HALF_PINS);
+    *mask = 1U << n;
+    return 0;
+}
+
+
+/***************************************************************
+ * 函数名称: soft_i2c_calib_ps
+ * 说    明: 测量一次寄存器写操作加上指定延时的耗时。写入的是释放SCL的值，
+ *           SCL已经释放，不会在总线上产生波形
+ * 参    数:
+ *      @bus：i2c总线
+ *      @delay：延时循环次数
+ * 返 回 值: 每次的耗时（皮秒）
+ ***************************************************************/
+static uint32_t soft_i2c_calib_ps(soft_i2c_t *bus, uint32_t delay)
+{
+    uint64_t start;
+    uint32_t count = 0;
+    uint32_t i;
+
+    /* 从tick的边沿开始计时 */
+    start = LOS_TickCountGet();
+    while (LOS_TickCountGet() == start) {
+    }
+    start += 1 + SOFT_I2C_CALIB_TICKS;
+    while (LOS_TickCountGet() < start) {
+        for (i = 0; i < SOFT_I2C_CALIB_BLOCK; i++) {
+            SOFT_I2C_WRITE(bus->scl_ddr, bus->scl_high);
+            soft_i2c_delay(delay);
+        }
+        count += SOFT_I2C_CALIB_BLOCK;
+    }
+
+    return (uint32_t)(LOS_Tick2MS(SOFT_I2C_CALIB_TICKS) * PSEC_PER_MSEC / count);
+}
+
+
+/***************************************************************
+ * 函数名称: soft_i2c_calibrate
+ * 说    明: 校准寄存器写操作和延时循环的耗时，测量期间禁止任务调度
+ * 参    数:
+ *      @bus：i2c总线
+ * 返 回 值: 无
+ ***************************************************************/
+static void soft_i2c_calibrate(soft_i2c_t *bus)
+{
+    uint32_t t0, t1;
+
+    LOS_TaskLock();
+    t0 = soft_i2c_calib_ps(bus, 0);
+    t1 = soft_i2c_calib_ps(bus, SOFT_I2C_CALIB_DELAY);
+    LOS_TaskUnlock();
+
+    m_write_ps = t0;
+    m_loop_ps = (t1 > t0) ? ((t1 - t0) / SOFT_I2C_CALIB_DELAY) : 1;
+    if (m_loop_ps == 0) {
+        m_loop_ps = 1;
+    }
+}
+
+
+/***************************************************************
+ * 函数名称: soft_i2c_wait_scl
+ * 说    明: 释放SCL后等待SCL变为高电平，从设备可以拉低SCL延展时钟
+ * 参    数:
+ *      @bus：i2c总线
+ * 返 回 值: 返回0为成功，反之为等待SOFT_I2C_STRETCH_MAX次后SCL仍为低电平
+ ***************************************************************/
+static inline unsigned int soft_i2c_wait_scl(soft_i2c_t *bus)
+{
+    uint32_t n = SOFT_I2C_STRETCH_MAX;
+
+    while ((SOFT_I2C_READ(bus->scl_in) & bus->scl_mask) == 0) {
+        if (--n == 0) {
+            return __LINE__;
+        }
+    }
+
+    return 0;
+}
+
+
+/***************************************************************
+ * 函数名称: soft_i2c_wait_ack
+ * 说    明: 释放SDA，发送第9个时钟并采样从设备的应答
+ * 参    数:
+ *      @bus：i2c总线
+ * 返 回 值: 返回0为从设备应答，反之为没有应答或等待SCL超时
+ ***************************************************************/
+static inline unsigned int soft_i2c_wait_ack(soft_i2c_t *bus)
+{
+    unsigned int ret;
+
+    SOFT_I2C_WRITE(bus->sda_ddr, bus->sda_high);
+    soft_i2c_delay(bus->delay);
+    SOFT_I2C_WRITE(bus->scl_ddr, bus->scl_high);
+    ret = soft_i2c_wait_scl(bus);
+    soft_i2c_delay(bus->delay);
+    if ((ret == 0) && (SOFT_I2C_READ(bus->sda_in) & bus->sda_mask)) {
+        ret = __LINE__;
+    }
+    SOFT_I2C_WRITE(bus->scl_ddr, bus->scl_low);
+
+    return ret;
+}
+
+
+/***************************************************************
+ * 函数名称: soft_i2c_init
+ * 说    明: 初始化GPIO模拟的i2c总线，释放SCL和SDA。第一次调用时校准
+ *           寄存器写操作和延时循环的耗时（约20ms），之后按校准结果
+ *           计算指定频率对应的延时。SDA被从设备拉低时发送最多9个时钟
+ *           和结束条件恢复总线
+ * 参    数:
+ *       @bus：i2c总线
+ *       @scl：SCL引脚
+ *       @sda：SDA引脚
+ *       @freq：时钟频率（Hz），如SOFT_I2C_FREQ_FAST
+ * 返 回 值: 返回0为成功，反之为失败，包括恢复后SCL或SDA仍为低电平
+ ***************************************************************/
+unsigned int soft_i2c_init(soft_i2c_t *bus, uint32_t scl, uint32_t sda, uint32_t freq)
+{
+    volatile uint32_t *scl_dr = NULL;
+    volatile uint32_t *sda_dr = NULL;
+    uint32_t scl_bit, sda_bit;
+    uint8_t i;
+
+    if ((freq == 0) ||
+        (soft_i2c_pin(scl, &scl_dr, &bus->scl_ddr, &bus->scl_in, &scl_bit, &bus->scl_mask) != 0) ||
+        (soft_i2c_pin(sda, &sda_dr, &bus->sda_ddr, &bus->sda_in, &sda_bit, &bus->sda_mask) != 0)) {
+        return __LINE__;
+    }
+    bus->scl = scl;
+    bus->sda = sda;
+    bus->scl_low = SOFT_I2C_WRITE_EN(scl_bit) | scl_bit;
+    bus->scl_high = SOFT_I2C_WRITE_EN(scl_bit);
+    bus->sda_low = SOFT_I2C_WRITE_EN(sda_bit) | sda_bit;
+    bus->sda_high = SOFT_I2C_WRITE_EN(sda_bit);
+
+    /* 先设为输入释放引脚，再把输出寄存器清0，之后只修改方向 */
+    if ((LzGpioInit(scl) != LZ_HARDWARE_SUCCESS) || (LzGpioInit(sda) != LZ_HARDWARE_SUCCESS)) {
+        return __LINE__;
+    }
+    LzGpioSetDir(scl, LZGPIO_DIR_IN);
+    LzGpioSetDir(sda, LZGPIO_DIR_IN);
+    SOFT_I2C_WRITE(scl_dr, SOFT_I2C_WRITE_EN(scl_bit));
+    SOFT_I2C_WRITE(sda_dr, SOFT_I2C_WRITE_EN(sda_bit));
+
+    if (m_loop_ps == 0) {
+        soft_i2c_calibrate(bus);
+    }
+    soft_i2c_set_freq(bus, freq);
+
+    /* 从设备在传输中途复位时可能一直拉低SDA，发送时钟直到从设备释放SDA */
+    for (i = 0; i < SOFT_I2C_RECOVER_CLOCKS; i++) {
+        if (SOFT_I2C_READ(bus->sda_in) & bus->sda_mask) {
+            break;
+        }
+        SOFT_I2C_WRITE(bus->scl_ddr, bus->scl_low);
+        soft_i2c_delay(bus->delay);
+        SOFT_I2C_WRITE(bus->scl_ddr, bus->scl_high);
+        soft_i2c_delay(bus->delay);
+    }
+    if (i > 0) {
+        SOFT_I2C_WRITE(bus->scl_ddr, bus->scl_low);
+        if (soft_i2c_stop(bus) != 0) {
+            return __LINE__;
+        }
+    }
+    /* 恢复后SCL或SDA仍被拉低，总线无法使用 */
+    if (((SOFT_I2C_READ(bus->scl_in) & bus->scl_mask) == 0) ||
+        ((SOFT_I2C_READ(bus->sda_in) & bus->sda_mask) == 0)) {
+        return __LINE__;
+    }
+
+    return 0;
+}
+
+
+/***************************************************************
+ * 函数名称: soft_i2c_deinit
+ * 说    明: 销毁GPIO模拟的i2c总线
+ * 参    数:
+ *       @bus：i2c总线
+ * 返 回 值: 返回0为成功，反之为失败
+ ***************************************************************/
+unsigned int soft_i2c_deinit(soft_i2c_t *bus)
+{
+    SOFT_I2C_WRITE(bus->scl_ddr, bus->scl_high);
+    SOFT_I2C_WRITE(bus->sda_ddr, bus->sda_high);
+    LzGpioDeinit(bus->scl);
+    LzGpioDeinit(bus->sda);
+    return 0;
+}
+
+
+/***************************************************************
+ * 函数名称: soft_i2c_set_freq
+ * 说    明: 修改时钟频率，超过能达到的最高频率时按最高频率工作，
+ *           实际频率保存在bus->freq中
+ * 参    数:
+ *       @bus：i2c总线
+ *       @freq：时钟频率（Hz）
+ * 返 回 值: 无
+ ***************************************************************/
+void soft_i2c_set_freq(soft_i2c_t *bus, uint32_t freq)
+{
+    uint64_t period, fixed, step;
+
+    /* 尚未校准时无法计算延时，由soft_i2c_init校准后再设置 */
+    if ((freq == 0) || (m_loop_ps == 0)) {
+        return;
+    }
+
+    /* 周期 = 固定的寄存器写操作耗时 + 两个半周期的延时，延时向上取整，不超过指定频率 */
+    period = PSEC_PER_SEC / freq;
+    fixed = (uint64_t)m_write_ps * SOFT_I2C_PERIOD_ACCESSES;
+    step = (uint64_t)m_loop_ps * SOFT_I2C_PERIOD_DELAYS;
+    bus->delay = 0;
+    if (period > fixed) {
+        bus->delay = (uint32_t)((period - fixed + step - 1) / step);
+    }
+    bus->freq = (uint32_t)(PSEC_PER_SEC / (fixed + step * bus->delay));
+}
+
+
+/***************************************************************
+ * 函数名称: soft_i2c_start
+ * 说    明: 发送起始条件（总线已被占用时为重复起始条件）和从设备地址
+ * 参    数:
+ *       @bus：i2c总线
+ *       @addr：7位从设备地址
+ *       @read：0为写操作；1为读操作
+ * 返 回 值: 返回0为从设备应答，反之为没有应答或等待SCL超时
+ ***************************************************************/
+unsigned int soft_i2c_start(soft_i2c_t *bus, uint8_t addr, uint8_t read)
+{
+    uint8_t dat = (addr << 1) | (read ? 1 : 0);
+
+    /* 空闲时SCL、SDA都为高电平；重复起始时先在SCL低电平期间释放SDA */
+    SOFT_I2C_WRITE(bus->sda_ddr, bus->sda_high);
+    soft_i2c_delay(bus->delay);
+    SOFT_I2C_WRITE(bus->scl_ddr, bus->scl_high);
+    if (soft_i2c_wait_scl(bus) != 0) {
+        return __LINE__;
+    }
+    soft_i2c_delay(bus->delay);
+    /* SCL为高电平时SDA由高变低 */
+    SOFT_I2C_WRITE(bus->sda_ddr, bus->sda_low);
+    soft_i2c_delay(bus->delay);
+    SOFT_I2C_WRITE(bus->scl_ddr, bus->scl_low);
+
+    return soft_i2c_send(bus, &dat, 1);
+}
+
+
+/***************************************************************
+ * 函数名称: soft_i2c_send
+ * 说    明: 在soft_i2c_start之后连续发送多个字节，每个字节检查应答，
+ *           没有应答或等待SCL超时时停止发送
+ * 参    数:
+ *       @bus：i2c总线
+ *       @buf：数据
+ *       @len：字节数
+ * 返 回 值: 返回0为成功，反之为从设备没有应答或等待SCL超时
+ ***************************************************************/
+unsigned int soft_i2c_send(soft_i2c_t *bus, const uint8_t *buf, uint32_t len)
+{
+    /* 寄存器地址和写入值放在局部变量中，循环内不再从bus读取 */
+    volatile uint32_t *scl = bus->scl_ddr;
+    volatile uint32_t *sda = bus->sda_ddr;
+    const uint32_t scl_low = bus->scl_low;
+    const uint32_t scl_high = bus->scl_high;
+    const uint32_t sda_low = bus->sda_low;
+    const uint32_t sda_high = bus->sda_high;
+    const uint32_t delay = bus->delay;
+    unsigned int ret;
+    uint32_t k;
+    uint8_t i, dat;
+
+    for (k = 0; k < len; k++) {
+        dat = buf[k];
+        /* SCL为低电平时改变SDA，高位在前 */
+        for (i = 0; i < BYTE_TO_BITS; i++) {
+            SOFT_I2C_WRITE(sda, (dat & BYTE_HIGH_BIT) ? sda_high : sda_low);
+            soft_i2c_delay(delay);
+            SOFT_I2C_WRITE(scl, scl_high);
+            ret = soft_i2c_wait_scl(bus);
+            soft_i2c_delay(delay);
+            SOFT_I2C_WRITE(scl, scl_low);
+            if (ret != 0) {
+                return ret;
+            }
+            dat <<= 1;
+        }
+        ret = soft_i2c_wait_ack(bus);
+        if (ret != 0) {
+            return ret;
+        }
+    }
+
+    return 0;
+}
+
+
+/***************************************************************
+ * 函数名称: soft_i2c_recv
+ * 说    明: 在soft_i2c_start之后连续接收多个字节，最后一个字节回复非应答，
+ *           等待SCL超时时停止接收
+ * 参    数:
+ *       @bus：i2c总线
+ *       @buf：数据
+ *       @len：字节数
+ * 返 回 值: 返回0为成功，反之为等待SCL超时
+ ***************************************************************/
+unsigned int soft_i2c_recv(soft_i2c_t *bus, uint8_t *buf, uint32_t len)
+{
+    unsigned int ret;
+    uint32_t k;
+    uint8_t i, dat;
+
+    for (k = 0; k < len; k++) {
+        dat = 0;
+        SOFT_I2C_WRITE(bus->sda_ddr, bus->sda_high);
+        for (i = 0; i < BYTE_TO_BITS; i++) {
+            soft_i2c_delay(bus->delay);
+            SOFT_I2C_WRITE(bus->scl_ddr, bus->scl_high);
+            ret = soft_i2c_wait_scl(bus);
+            soft_i2c_delay(bus->delay);
+            dat = (dat << 1) | ((SOFT_I2C_READ(bus->sda_in) & bus->sda_mask) ? 1 : 0);
+            SOFT_I2C_WRITE(bus->scl_ddr, bus->scl_low);
+            if (ret != 0) {
+                return ret;
+            }
+        }
+        buf[k] = dat;
+
+        /* 应答，最后一个字节回复非应答 */
+        SOFT_I2C_WRITE(bus->sda_ddr, (k + 1 < len) ? bus->sda_low : bus->sda_high);
+        soft_i2c_delay(bus->delay);
+        SOFT_I2C_WRITE(bus->scl_ddr, bus->scl_high);
+        ret = soft_i2c_wait_scl(bus);
+        soft_i2c_delay(bus->delay);
+        SOFT_I2C_WRITE(bus->scl_ddr, bus->scl_low);
+        if (ret != 0) {
+            return ret;
+        }
+    }
+
+    return 0;
+}
+
+
+/***************************************************************
+ * 函数名称: soft_i2c_stop
+ * 说    明: 发送结束条件，释放总线。等待SCL超时时仍然释放SCL和SDA
+ * 参    数:
+ *       @bus：i2c总线
+ * 返 回 值: 返回0为成功，反之为等待SCL超时
+ ***************************************************************/
+unsigned int soft_i2c_stop(soft_i2c_t *bus)
+{
+    unsigned int ret;
+
+    /* SCL为高电平时SDA由低变高 */
+    SOFT_I2C_WRITE(bus->sda_ddr, bus->sda_low);
+    soft_i2c_delay(bus->delay);
+    SOFT_I2C_WRITE(bus->scl_ddr, bus->scl_high);
+    ret = soft_i2c_wait_scl(bus);
+    soft_i2c_delay(bus->delay);
+    SOFT_I2C_WRITE(bus->sda_ddr, bus->sda_high);
+    soft_i2c_delay(bus->delay);
+
+    return ret;
+}
+
+
+/***************************************************************
+ * 函数名称: soft_i2c_write
+ * 说    明: 在一次传输中往从设备写入多个字节
+ * 参    数:
+ *       @bus：i2c总线
+ *       @addr：7位从设备地址
+ *       @buf：数据
+ *       @len：字节数
+ * 返 回 值: 返回0为成功，反之为从设备没有应答或等待SCL超时
+ ***************************************************************/
+unsigned int soft_i2c_write(soft_i2c_t *bus, uint8_t addr, const uint8_t *buf, uint32_t len)
+{
+    unsigned int ret;
+    unsigned int stop;
+
+    ret = soft_i2c_start(bus, addr, 0);
+    if (ret == 0) {
+        ret = soft_i2c_send(bus, buf, len);
+    }
+    stop = soft_i2c_stop(bus);
+
+    return (ret != 0) ? ret : stop;
+}
+
+
+/***************************************************************
+ * 函数名称: soft_i2c_read
+ * 说    明: 在一次传输中从从设备读取多个字节
+ * 参    数:
+ *       @bus：i2c总线
+ *       @addr：7位从设备地址
+ *       @buf：数据
+ *       @len：字节数
+ * 返 回 值: 返回0为成功，反之为从设备没有应答或等待SCL超时
+ ***************************************************************/
+unsigned int soft_i2c_read(soft_i2c_t *bus, uint8_t addr, uint8_t *buf, uint32_t len)
+{
+    unsigned int ret;
+    unsigned int stop;
+
+    ret = soft_i2c_start(bus, addr, 1);
+    if (ret == 0) {
+        ret = soft_i2c_recv(bus, buf, len);
+    }
+    stop = soft_i2c_stop(bus);
+
+    return (ret != 0) ? ret : stop;
+}
@@ -0,0 +1,459 @@
+/*
+ * Copyright (c) 2022 FuZhou Lockzhiner Electronic Co., Ltd. All rights reserved.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+/* i2c总线模拟器：SCL、SDA为开漏输出，主设备或从设备任一方拉低即为低电平。
+ * 主设备把引脚设为输出（输出寄存器为0）表示拉低，设为输入表示释放
+ */
+#include <stdarg.h>
+#include <stdbool.h>
+#include <stdio.h>
+#include <string.h>
+#include "lz_hardware.h"
+#include "hal_base.h"
+#include "i2c_sim.h"
+
+/* 与soft_i2c.c相同的寄存器布局 */
+#define SIM_BANK_PINS           32
+#define SIM_BANK_NUM            2
+#define SIM_HALF_PINS           16
+#define SIM_HALF_MASK           0xFFFF
+
+/* 一次写传输最多缓存的字节数，大于一次刷新一页的字节数 */
+#define SIM_WRITE_MAX           2048
+#define SIM_TRACE_MAX           4096
+
+/* 从设备的状态 */
+enum {
+    SIM_IDLE = 0,                           /* 没有传输，或结束条件之后 */
+    SIM_ADDR,                               /* 接收地址 */
+    SIM_WRITE,                              /* 接收数据 */
+    SIM_READ,                               /* 发送数据 */
+    SIM_DONE                                /* 已经不应答，等待结束条件 */
+};
+
+typedef struct {
+    uint32_t scl;
+    uint32_t sda;
+    uint8_t addr;
+
+    /* 总线电平，true为高电平 */
+    bool scl_level;
+    bool sda_level;
+    /* 从设备拉低SCL、SDA */
+    bool stretch;
+    bool drive_sda;
+    bool hold_sda;
+
+    /* 配置 */
+    uint32_t nack_byte;
+    uint32_t stretch_clock;
+    uint32_t stretch_reads;
+    uint32_t stretch_left;
+    uint32_t hold_left;
+    uint8_t rdata[I2C_SIM_READ_MAX];
+    uint32_t rlen;
+
+    /* 传输状态：bits为当前字节已经过的SCL上升沿数（第9个为应答） */
+    uint8_t state;
+    uint8_t bits;
+    uint8_t shift;
+    bool ack;
+    uint32_t byte;
+    uint8_t rbyte;
+    uint8_t wbuf[SIM_WRITE_MAX];
+    uint32_t wlen;
+
+    char trace[SIM_TRACE_MAX];
+    uint32_t trace_len;
+    i2c_sim_stats_t stats;
+} i2c_sim_t;
+
+struct GPIO_REG g_i2c_sim_gpio0;
+struct GPIO_REG g_i2c_sim_gpio1;
+
+static i2c_sim_t m_sim;
+
+static void sim_trace(const char *fmt, ...)
+{
+    va_list ap;
+    int n;
+
+    if (m_sim.trace_len + 1 >= SIM_TRACE_MAX) {
+        return;
+    }
+    if (m_sim.trace_len > 0) {
+        m_sim.trace[m_sim.trace_len++] = ' ';
+    }
+    va_start(ap, fmt);
+    n = vsnprintf(m_sim.trace + m_sim.trace_len, SIM_TRACE_MAX - m_sim.trace_len, fmt, ap);
+    va_end(ap);
+    if (n > 0) {
+        m_sim.trace_len += (uint32_t)n;
+    }
+    if (m_sim.trace_len >= SIM_TRACE_MAX) {
+        m_sim.trace_len = SIM_TRACE_MAX - 1;
+    }
+}
+
+
+static struct GPIO_REG *sim_gpio(uint32_t pin)
+{
+    return (pin < SIM_BANK_PINS) ? &g_i2c_sim_gpio0 : &g_i2c_sim_gpio1;
+}
+
+
+/* 主设备是否拉低引脚：方向为输出且输出寄存器为0 */
+static bool sim_master_low(uint32_t pin)
+{
+    struct GPIO_REG *gpio = sim_gpio(pin);
+    uint32_t n = pin % SIM_BANK_PINS;
+    uint32_t bit = 1U << (n % SIM_HALF_PINS);
+    uint32_t dr = (n < SIM_HALF_PINS) ? gpio->SWPORT_DR_L : gpio->SWPORT_DR_H;
+    uint32_t ddr = (n < SIM_HALF_PINS) ? gpio->SWPORT_DDR_L : gpio->SWPORT_DDR_H;
+
+    return ((ddr & bit) != 0) && ((dr & bit) == 0);
+}
+
+
+static bool sim_scl(void)
+{
+    return !(sim_master_low(m_sim.scl) || m_sim.stretch);
+}
+
+
+static bool sim_sda(void)
+{
+    return !(sim_master_low(m_sim.sda) || m_sim.drive_sda || m_sim.hold_sda);
+}
+
+
+/* 把写传输中已应答的数据交给面板模拟器 */
+static void sim_flush(void)
+{
+    if (m_sim.wlen > 0) {
+        LzI2cWrite(0, m_sim.addr, m_sim.wbuf, m_sim.wlen);
+        m_sim.wlen = 0;
+    }
+}
+
+
+static void sim_start(void)
+{
+    m_sim.stats.starts++;
+    sim_trace((m_sim.state == SIM_IDLE) ? "S" : "Sr");
+    sim_flush();
+    m_sim.state = SIM_ADDR;
+    m_sim.bits = 0;
+    m_sim.shift = 0;
+    m_sim.byte = 0;
+    m_sim.drive_sda = false;
+}
+
+
+static void sim_stop(void)
+{
+    m_sim.stats.stops++;
+    sim_trace("P");
+    sim_flush();
+    m_sim.state = SIM_IDLE;
+    m_sim.drive_sda = false;
+}
+
+
+/* 下一个要发送的字节，发送完后重复最后一个字节 */
+static void sim_load_read(void)
+{
+    uint32_t i = (m_sim.byte - 1 < m_sim.rlen) ? (m_sim.byte - 1) : (m_sim.rlen - 1);
+
+    m_sim.rbyte = (m_sim.rlen > 0) ? m_sim.rdata[i] : 0xFF;
+    m_sim.bits = 0;
+    m_sim.drive_sda = (m_sim.rbyte & 0x80) == 0;
+}
+
+
+/* SCL上升沿：采样SDA */
+static void sim_scl_rise(void)
+{
+    switch (m_sim.state) {
+        case SIM_ADDR:
+        case SIM_WRITE:
+            if (m_sim.bits < 8) {
+                m_sim.shift = (uint8_t)((m_sim.shift << 1) | (m_sim.sda_level ? 1 : 0));
+            }
+            m_sim.bits++;
+            break;
+        case SIM_READ:
+            if (m_sim.bits == 8) {
+                m_sim.ack = !m_sim.sda_level;
+            }
+            m_sim.bits++;
+            break;
+        default:
+            break;
+    }
+}
+
+
+/* 第8个时钟之后决定是否应答 */
+static void sim_recv_byte(void)
+{
+    if (m_sim.state == SIM_ADDR) {
+        m_sim.ack = ((m_sim.shift >> 1) == m_sim.addr) && (m_sim.nack_byte != 0);
+    } else {
+        m_sim.ack = (m_sim.nack_byte != m_sim.byte);
+        if (m_sim.ack && (m_sim.wlen < SIM_WRITE_MAX)) {
+            m_sim.wbuf[m_sim.wlen++] = m_sim.shift;
+        }
+    }
+    sim_trace("%02X%c", m_sim.shift, m_sim.ack ? '+' : '-');
+    m_sim.drive_sda = m_sim.ack;
+}
+
+
+/* SCL下降沿：从设备改变SDA，可以延展时钟 */
+static void sim_scl_fall(void)
+{
+    m_sim.stats.clocks++;
+    if (m_sim.hold_sda && (m_sim.hold_left != I2C_SIM_FOREVER) && (--m_sim.hold_left == 0)) {
+        m_sim.hold_sda = false;
+    }
+    if ((m_sim.stretch_clock != 0) && (m_sim.stats.clocks == m_sim.stretch_clock)) {
+        m_sim.stretch = true;
+        m_sim.stretch_left = m_sim.stretch_reads;
+        m_sim.stats.stretches++;
+    }
+
+    switch (m_sim.state) {
+        case SIM_IDLE:
+            sim_trace("c");
+            break;
+        case SIM_ADDR:
+        case SIM_WRITE:
+            if (m_sim.bits == 8) {
+                sim_recv_byte();
+            } else if (m_sim.bits == 9) {
+                m_sim.drive_sda = false;
+                m_sim.bits = 0;
+                m_sim.byte++;
+                if (!m_sim.ack) {
+                    m_sim.state = SIM_DONE;
+                } else if ((m_sim.state == SIM_ADDR) && (m_sim.shift & 1)) {
+                    m_sim.state = SIM_READ;
+                    sim_load_read();
+                } else {
+                    m_sim.state = SIM_WRITE;
+                }
+                m_sim.shift = 0;
+            }
+            break;
+        case SIM_READ:
+            if ((m_sim.bits >= 1) && (m_sim.bits < 8)) {
+                m_sim.drive_sda = ((m_sim.rbyte << m_sim.bits) & 0x80) == 0;
+            } else if (m_sim.bits == 8) {
+                m_sim.drive_sda = false;
+            } else if (m_sim.bits == 9) {
+                sim_trace("<%02X%c", m_sim.rbyte, m_sim.ack ? '+' : '-');
+                m_sim.byte++;
+                if (m_sim.ack) {
+                    sim_load_read();
+                } else {
+                    m_sim.drive_sda = false;
+                    m_sim.state = SIM_DONE;
+                }
+            }
+            break;
+        default:
+            break;
+    }
+}
+
+
+/* 重新计算总线电平，处理电平变化；从设备的响应可能再次改变电平 */
+static void sim_update(void)
+{
+    bool scl = sim_scl();
+    bool sda = sim_sda();
+
+    while ((scl != m_sim.scl_level) || (sda != m_sim.sda_level)) {
+        if (scl != m_sim.scl_level) {
+            m_sim.scl_level = scl;
+            m_sim.stats.scl_edges++;
+            if (scl) {
+                sim_scl_rise();
+            } else {
+                sim_scl_fall();
+            }
+        } else {
+            m_sim.sda_level = sda;
+            m_sim.stats.sda_edges++;
+            /* SCL为高电平时SDA变化为起始条件或结束条件 */
+            if (m_sim.scl_level) {
+                if (sda) {
+                    sim_stop();
+                } else {
+                    sim_start();
+                }
+            }
+        }
+        scl = sim_scl();
+        sda = sim_sda();
+    }
+}
+
+
+void i2c_sim_reset(uint32_t scl, uint32_t sda, uint8_t addr)
+{
+    memset(&g_i2c_sim_gpio0, 0, sizeof(g_i2c_sim_gpio0));
+    memset(&g_i2c_sim_gpio1, 0, sizeof(g_i2c_sim_gpio1));
+    memset(&m_sim, 0, sizeof(m_sim));
+    m_sim.scl = scl;
+    m_sim.sda = sda;
+    m_sim.addr = addr;
+    m_sim.scl_level = true;
+    m_sim.sda_level = true;
+    m_sim.nack_byte = I2C_SIM_FOREVER;
+}
+
+
+void i2c_sim_write(volatile uint32_t *reg, uint32_t val)
+{
+    uint32_t mask = val >> SIM_HALF_PINS;
+
+    *reg = (*reg & ~mask & SIM_HALF_MASK) | (val & mask);
+    sim_update();
+}
+
+
+uint32_t i2c_sim_read(volatile uint32_t *reg)
+{
+    struct GPIO_REG *gpio;
+    uint32_t i;
+
+    /* EXT_PORT：没有被拉低的引脚读到高电平 */
+    for (i = 0; i < SIM_BANK_NUM; i++) {
+        gpio = (i == 0) ? &g_i2c_sim_gpio0 : &g_i2c_sim_gpio1;
+        gpio->EXT_PORT = 0xFFFFFFFF;
+    }
+    if (!m_sim.scl_level) {
+        sim_gpio(m_sim.scl)->EXT_PORT &= ~(1U << (m_sim.scl % SIM_BANK_PINS));
+    }
+    if (!m_sim.sda_level) {
+        sim_gpio(m_sim.sda)->EXT_PORT &= ~(1U << (m_sim.sda % SIM_BANK_PINS));
+    }
+    i = *reg;
+    if ((reg == &g_i2c_sim_gpio0.EXT_PORT) || (reg == &g_i2c_sim_gpio1.EXT_PORT)) {
+        m_sim.stats.reads++;
+    }
+
+    /* 延展时钟时读到低电平，计满后释放SCL */
+    if ((reg == &sim_gpio(m_sim.scl)->EXT_PORT) && m_sim.stretch &&
+        (m_sim.stretch_left != I2C_SIM_FOREVER) && (--m_sim.stretch_left == 0)) {
+        m_sim.stretch = false;
+        sim_update();
+    }
+
+    return i;
+}
+
+
+void i2c_sim_clear(void)
+{
+    m_sim.trace_len = 0;
+    m_sim.trace[0] = '\0';
+    memset(&m_sim.stats, 0, sizeof(m_sim.stats));
+}
+
+
+void i2c_sim_set_nack(uint32_t byte)
+{
+    m_sim.nack_byte = byte;
+}
+
+
+void i2c_sim_set_stretch(uint32_t clock, uint32_t reads)
+{
+    m_sim.stretch_clock = (reads != 0) ? clock : 0;
+    m_sim.stretch_reads = reads;
+    if ((m_sim.stretch_clock == 0) && m_sim.stretch) {
+        m_sim.stretch = false;
+        sim_update();
+    }
+}
+
+
+void i2c_sim_hold_sda(uint32_t clocks)
+{
+    m_sim.hold_sda = (clocks != 0);
+    m_sim.hold_left = clocks;
+    /* 直接改变电平，不当作起始条件或结束条件 */
+    m_sim.sda_level = sim_sda();
+}
+
+
+void i2c_sim_set_read_data(const uint8_t *buf, uint32_t len)
+{
+    m_sim.rlen = (len < I2C_SIM_READ_MAX) ? len : I2C_SIM_READ_MAX;
+    memcpy(m_sim.rdata, buf, m_sim.rlen);
+}
+
+
+const char *i2c_sim_trace(void)
+{
+    m_sim.trace[m_sim.trace_len] = '\0';
+    return m_sim.trace;
+}
+
+
+void i2c_sim_get_stats(i2c_sim_stats_t *stats)
+{
+    *stats = m_sim.stats;
+}
+
+
+uint8_t i2c_sim_master_released(void)
+{
+    return (!sim_master_low(m_sim.scl) && !sim_master_low(m_sim.sda)) ? 1 : 0;
+}
+
+
+unsigned int LzGpioInit(uint32_t id)
+{
+    return (id < SIM_BANK_PINS * SIM_BANK_NUM) ? LZ_HARDWARE_SUCCESS : __LINE__;
+}
+
+
+unsigned int LzGpioDeinit(uint32_t id)
+{
+    return (id < SIM_BANK_PINS * SIM_BANK_NUM) ? LZ_HARDWARE_SUCCESS : __LINE__;
+}
+
+
+unsigned int LzGpioSetDir(uint32_t id, LzGpioDir dir)
+{
+    struct GPIO_REG *gpio = sim_gpio(id);
+    uint32_t n = id % SIM_BANK_PINS;
+    uint32_t bit = 1U << (n % SIM_HALF_PINS);
+    volatile uint32_t *ddr = (n < SIM_HALF_PINS) ? &gpio->SWPORT_DDR_L : &gpio->SWPORT_DDR_H;
+
+    if (id >= SIM_BANK_PINS * SIM_BANK_NUM) {
+        return __LINE__;
+    }
+    if (dir == LZGPIO_DIR_OUT) {
+        *ddr |= bit;
+    } else if (dir == LZGPIO_DIR_IN) {
+        *ddr &= ~bit;
+    }
+    sim_update();
+    return LZ_HARDWARE_SUCCESS;
+}
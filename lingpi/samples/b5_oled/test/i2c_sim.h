@@ -0,0 +1,161 @@
+/*
+ * Copyright (c) 2022 FuZhou Lockzhiner Electronic Co., Ltd. All rights reserved.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+/* i2c总线模拟器：soft_i2c对GPIO寄存器的读写经i2c_sim_write()/i2c_sim_read()
+ * 进入模拟器，按开漏方式计算SCL、SDA的电平，电平变化时运行一个i2c从设备：
+ * 解码起始条件、结束条件、地址和数据，回复应答，可以延展时钟、不应答或
+ * 拉低SDA。写入从设备的数据在结束条件或重复起始条件时交给LzI2cWrite()，
+ * 由oled_sim.c解码
+ */
+#ifndef _I2C_SIM_H_
+#define _I2C_SIM_H_
+
+#include <stdint.h>
+
+/* i2c_sim_set_stretch()、i2c_sim_hold_sda()的参数：一直保持，直到再次调用 */
+#define I2C_SIM_FOREVER         0xFFFFFFFF
+
+/* 从总线上记录的统计 */
+typedef struct {
+    uint32_t scl_edges;                     /* SCL的电平变化次数 */
+    uint32_t sda_edges;                     /* SDA的电平变化次数 */
+    uint32_t clocks;                        /* SCL的下降沿数 */
+    uint32_t starts;                        /* 起始条件数，含重复起始条件 */
+    uint32_t stops;                         /* 结束条件数 */
+    uint32_t stretches;                     /* 从设备延展时钟的次数 */
+    uint32_t reads;                         /* 主设备读取EXT_PORT的次数 */
+} i2c_sim_stats_t;
+
+/***************************************************************
+ * 函数名称: i2c_sim_reset
+ * 说    明: 复位模拟器：寄存器清零，SCL、SDA释放，从设备回到空闲状态，
+ *           应答所有字节，不延展时钟，清空记录和统计
+ * 参    数:
+ *       @scl：SCL引脚
+ *       @sda：SDA引脚
+ *       @addr：从设备的7位地址
+ * 返 回 值: 无
+ ***************************************************************/
+void i2c_sim_reset(uint32_t scl, uint32_t sda, uint8_t addr);
+
+
+/***************************************************************
+ * 函数名称: i2c_sim_write
+ * 说    明: 写GPIO寄存器，高16位为低16位的写使能，之后更新总线电平
+ * 参    数:
+ *       @reg：寄存器地址
+ *       @val：写入的值
+ * 返 回 值: 无
+ ***************************************************************/
+void i2c_sim_write(volatile uint32_t *reg, uint32_t val);
+
+
+/***************************************************************
+ * 函数名称: i2c_sim_read
+ * 说    明: 读GPIO寄存器，EXT_PORT返回SCL、SDA当前的电平。从设备延展
+ *           时钟时，每读一次EXT_PORT计数一次，计满后释放SCL
+ * 参    数:
+ *       @reg：寄存器地址
+ * 返 回 值: 寄存器的值
+ ***************************************************************/
+uint32_t i2c_sim_read(volatile uint32_t *reg);
+
+
+/***************************************************************
+ * 函数名称: i2c_sim_clear
+ * 说    明: 清空记录和统计，SCL下降沿从0开始计数
+ * 参    数: 无
+ * 返 回 值: 无
+ ***************************************************************/
+void i2c_sim_clear(void);
+
+
+/***************************************************************
+ * 函数名称: i2c_sim_set_nack
+ * 说    明: 每次传输中不应答指定的字节
+ * 参    数:
+ *       @byte：字节序号，0为地址，I2C_SIM_FOREVER为应答所有字节
+ * 返 回 值: 无
+ ***************************************************************/
+void i2c_sim_set_nack(uint32_t byte);
+
+
+/***************************************************************
+ * 函数名称: i2c_sim_set_stretch
+ * 说    明: 在第clock个SCL下降沿（i2c_sim_clear()之后从1开始计数）之后
+ *           拉低SCL，主设备读取reads次SCL后释放；reads为I2C_SIM_FOREVER
+ *           时一直拉低。clock为0时取消，并释放正在拉低的SCL
+ * 参    数:
+ *       @clock：SCL下降沿的序号
+ *       @reads：延展期间主设备读取SCL的次数
+ * 返 回 值: 无
+ ***************************************************************/
+void i2c_sim_set_stretch(uint32_t clock, uint32_t reads);
+
+
+/***************************************************************
+ * 函数名称: i2c_sim_hold_sda
+ * 说    明: 模拟从设备在传输中途复位：立即拉低SDA（不产生起始条件），
+ *           经过clocks个SCL下降沿后释放；clocks为I2C_SIM_FOREVER时一直拉低
+ * 参    数:
+ *       @clocks：释放前的SCL下降沿数
+ * 返 回 值: 无
+ ***************************************************************/
+void i2c_sim_hold_sda(uint32_t clocks);
+
+
+/***************************************************************
+ * 函数名称: i2c_sim_set_read_data
+ * 说    明: 设置读操作时从设备依次发送的字节，发送完后重复最后一个字节
+ * 参    数:
+ *       @buf：数据
+ *       @len：字节数，最大I2C_SIM_READ_MAX
+ * 返 回 值: 无
+ ***************************************************************/
+#define I2C_SIM_READ_MAX        16
+void i2c_sim_set_read_data(const uint8_t *buf, uint32_t len);
+
+
+/***************************************************************
+ * 函数名称: i2c_sim_trace
+ * 说    明: 获取从总线上解码的记录，以空格分隔：
+ *           S 起始条件，Sr 重复起始条件，P 结束条件，
+ *           XX+/XX- 主设备发送的字节（含地址）和从设备的应答/非应答，
+ *           <XX+/<XX- 从设备发送的字节和主设备的应答/非应答，
+ *           c 传输以外的时钟（如恢复总线时发送的时钟）
+ * 参    数: 无
+ * 返 回 值: 记录，超过缓冲区的部分被丢弃
+ ***************************************************************/
+const char *i2c_sim_trace(void);
+
+
+/***************************************************************
+ * 函数名称: i2c_sim_get_stats
+ * 说    明: 获取从总线上记录的统计
+ * 参    数:
+ *       @stats：统计
+ * 返 回 值: 无
+ ***************************************************************/
+void i2c_sim_get_stats(i2c_sim_stats_t *stats);
+
+
+/***************************************************************
+ * 函数名称: i2c_sim_master_released
+ * 说    明: 主设备是否已经释放SCL和SDA（两个引脚都不是输出低电平）
+ * 参    数: 无
+ * 返 回 值: 1为已释放，0为仍有引脚被主设备拉低
+ ***************************************************************/
+uint8_t i2c_sim_master_released(void);
+
+#endif
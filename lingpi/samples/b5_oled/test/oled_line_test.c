@@ -0,0 +1,176 @@
+/*
+ * Copyright (c) 2022 FuZhou Lockzhiner Electronic Co., Ltd. All rights reserved.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+/* 直线测试：oled_draw_line()画出的像素与按同样的Bresenham算法逐点计算的
+ * 参考结果比较，包括屏幕内、部分超出屏幕、完全在屏幕外的直线，以及
+ * 端点相距超过int16_t范围的直线。用alarm()限制运行时间，计算溢出导致
+ * 死循环时报告失败
+ */
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <signal.h>
+#include <unistd.h>
+#include "oled.h"
+#include "oled_sim.h"
+
+/* 整个测试的最长运行时间（秒） */
+#define TEST_TIMEOUT_SEC        10
+#define RANDOM_LINES            2000
+/* 随机直线的坐标范围，超出屏幕两侧 */
+#define RANDOM_MIN              (-100)
+#define RANDOM_SPAN             330
+
+typedef struct {
+    int16_t x1;
+    int16_t y1;
+    int16_t x2;
+    int16_t y2;
+} line_t;
+
+static const line_t m_lines[] = {
+    {0, 0, 127, 63},
+    {127, 0, 0, 63},
+    {5, 40, 120, 38},
+    {64, 2, 66, 60},
+    {10, 10, 10, 10},
+    {0, 31, 127, 31},
+    {100, 0, 100, 63},
+    /* 部分超出屏幕 */
+    {-20, -10, 150, 70},
+    {200, -50, -100, 100},
+    {-5, 70, 130, 20},
+    /* 完全在屏幕外 */
+    {-50, -50, -10, -5},
+    {130, 0, 200, 63},
+    /* 端点相距超过int16_t范围 */
+    {0, 0, 17000, 3},
+    {-9000, 0, 9000, 3},
+    {3, -17000, 0, 17000},
+    {-32768, -32768, 32767, 32767},
+    {32767, 0, -32768, 63},
+};
+
+static uint8_t m_ref[OLED_SIM_H][OLED_SIM_W];
+static uint32_t m_failed = 0;
+
+static void on_timeout(int sig)
+{
+    (void)sig;
+    printf("FAIL: timed out after %d s, oled_draw_line() does not terminate\n", TEST_TIMEOUT_SEC);
+    fflush(stdout);
+    _exit(1);
+}
+
+
+static void ref_point(int32_t x, int32_t y, uint8_t color)
+{
+    if ((x < 0) || (x >= OLED_SIM_W) || (y < 0) || (y >= OLED_SIM_H)) {
+        return;
+    }
+    m_ref[y][x] = (color == OLED_COLOR_INVERT) ? (m_ref[y][x] ^ 1) : color;
+}
+
+
+/* 参考实现：逐点的Bresenham算法，用int32_t计算 */
+static void ref_line(int32_t x1, int32_t y1, int32_t x2, int32_t y2, uint8_t color)
+{
+    int32_t dx = abs(x2 - x1);
+    int32_t dy = -abs(y2 - y1);
+    int32_t sx = (x1 < x2) ? 1 : -1;
+    int32_t sy = (y1 < y2) ? 1 : -1;
+    int32_t err = dx + dy;
+    int32_t e2;
+
+    while (1) {
+        ref_point(x1, y1, color);
+        if ((x1 == x2) && (y1 == y2)) {
+            break;
+        }
+        e2 = 2 * err;
+        if (e2 >= dy) {
+            err += dy;
+            x1 += sx;
+        }
+        if (e2 <= dx) {
+            err += dx;
+            y1 += sy;
+        }
+    }
+}
+
+
+/* 画一条直线并刷新，返回与参考结果不同的像素数 */
+static uint32_t check_line(const line_t *line, uint8_t color)
+{
+    uint32_t diff = 0;
+    uint16_t x, y;
+
+    oled_draw_line(line->x1, line->y1, line->x2, line->y2, color);
+    ref_line(line->x1, line->y1, line->x2, line->y2, color);
+    oled_refresh();
+    for (y = 0; y < OLED_SIM_H; y++) {
+        for (x = 0; x < OLED_SIM_W; x++) {
+            diff += (oled_sim_get_pixel(x, y) != m_ref[y][x]);
+        }
+    }
+    if (diff != 0) {
+        printf("FAIL: line (%d, %d)-(%d, %d) color %u: %u pixels differ\n",
+               line->x1, line->y1, line->x2, line->y2, color, diff);
+        m_failed++;
+    }
+    return diff;
+}
+
+
+int main(void)
+{
+    line_t line;
+    uint32_t i;
+
+    signal(SIGALRM, on_timeout);
+    alarm(TEST_TIMEOUT_SEC);
+
+    oled_sim_reset();
+    if (oled_init() != 0) {
+        printf("oled_init failed\n");
+        return 1;
+    }
+
+    /* 每条直线单独画在空白屏幕上，再用反色画一遍，反色时每个像素只改变一次 */
+    for (i = 0; i < sizeof(m_lines) / sizeof(m_lines[0]); i++) {
+        oled_clear();
+        memset(m_ref, 0, sizeof(m_ref));
+        check_line(&m_lines[i], OLED_COLOR_WHITE);
+        check_line(&m_lines[i], OLED_COLOR_INVERT);
+    }
+
+    /* 随机直线叠加在同一个屏幕上 */
+    oled_clear();
+    memset(m_ref, 0, sizeof(m_ref));
+    srand(1);
+    for (i = 0; i < RANDOM_LINES; i++) {
+        line.x1 = (int16_t)(RANDOM_MIN + rand() % RANDOM_SPAN);
+        line.y1 = (int16_t)(RANDOM_MIN + rand() % RANDOM_SPAN);
+        line.x2 = (int16_t)(RANDOM_MIN + rand() % RANDOM_SPAN);
+        line.y2 = (int16_t)(RANDOM_MIN + rand() % RANDOM_SPAN);
+        check_line(&line, (uint8_t)(rand() % 3));
+    }
+
+    if (m_failed != 0) {
+        return 1;
+    }
+    printf("PASS\n");
+    return 0;
+}
@@ -0,0 +1,221 @@
+/*
+ * Copyright (c) 2022 FuZhou Lockzhiner Electronic Co., Ltd. All rights reserved.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+/* SSD1306面板模拟器。只实现OLED驱动用到的寻址命令：
+ *   0x20 寻址方式（水平、垂直、页），0x21 列窗口，0x22 页窗口，
+ *   0xB0~0xB7 页地址，0x00~0x1F 页寻址方式的列地址；
+ * 其他带参数的命令按参数个数跳过
+ */
+#include <string.h>
+#include "lz_hardware.h"
+#include "oled_sim.h"
+
+#define SIM_PAGES               (OLED_SIM_H / 8)
+#define SIM_I2C_ADDRESS         0x3C
+
+/* 控制字节：Co为1时只跟一个字节，D/C#为1时是显存数据 */
+#define SIM_CTRL_CO             0x80
+#define SIM_CTRL_DC             0x40
+
+/* 寻址方式，0x20命令的参数 */
+#define SIM_MODE_HORIZONTAL     0
+#define SIM_MODE_VERTICAL       1
+#define SIM_MODE_PAGE           2
+
+typedef struct {
+    uint8_t gram[SIM_PAGES][OLED_SIM_W];
+    uint8_t mode;
+    uint8_t col, col_start, col_end;
+    uint8_t page, page_start, page_end;
+    uint8_t cmd;                            /* 等待参数的命令 */
+    uint8_t args[2];
+    uint8_t nargs;
+    uint8_t need;                           /* 还需要的参数个数 */
+    oled_sim_stats_t stats;
+} oled_sim_t;
+
+static oled_sim_t m_sim;
+
+/* 带参数命令的参数个数 */
+static uint8_t sim_cmd_args(uint8_t cmd)
+{
+    switch (cmd) {
+        case 0x20: case 0x81: case 0x8D: case 0xA8: case 0xD3:
+        case 0xD5: case 0xD8: case 0xD9: case 0xDA: case 0xDB:
+            return 1;
+        case 0x21: case 0x22:
+            return 2;
+        default:
+            return 0;
+    }
+}
+
+
+static void sim_cmd_done(void)
+{
+    switch (m_sim.cmd) {
+        case 0x20:
+            m_sim.mode = m_sim.args[0] & 0x03;
+            break;
+        case 0x21:
+            m_sim.col_start = m_sim.args[0] & 0x7F;
+            m_sim.col_end = m_sim.args[1] & 0x7F;
+            m_sim.col = m_sim.col_start;
+            break;
+        case 0x22:
+            m_sim.page_start = m_sim.args[0] & 0x07;
+            m_sim.page_end = m_sim.args[1] & 0x07;
+            m_sim.page = m_sim.page_start;
+            break;
+        default:
+            break;
+    }
+}
+
+
+static void sim_cmd_byte(uint8_t b)
+{
+    m_sim.stats.commands++;
+    if (m_sim.need > 0) {
+        m_sim.args[m_sim.nargs++] = b;
+        if (--m_sim.need == 0) {
+            sim_cmd_done();
+        }
+        return;
+    }
+
+    if ((b >= 0xB0) && (b <= 0xB7)) {
+        m_sim.page = b - 0xB0;
+    } else if (b <= 0x0F) {
+        m_sim.col = (m_sim.col & 0xF0) | b;
+    } else if (b <= 0x1F) {
+        m_sim.col = (m_sim.col & 0x0F) | ((b & 0x0F) << 4);
+    } else {
+        m_sim.cmd = b;
+        m_sim.nargs = 0;
+        m_sim.need = sim_cmd_args(b);
+    }
+}
+
+
+static void sim_data_byte(uint8_t b)
+{
+    m_sim.stats.data++;
+    m_sim.gram[m_sim.page][m_sim.col] = b;
+
+    if (m_sim.mode == SIM_MODE_PAGE) {
+        m_sim.col = (m_sim.col + 1) % OLED_SIM_W;
+    } else if (m_sim.mode == SIM_MODE_HORIZONTAL) {
+        if (m_sim.col == m_sim.col_end) {
+            m_sim.col = m_sim.col_start;
+            m_sim.page = (m_sim.page == m_sim.page_end) ? m_sim.page_start : (m_sim.page + 1);
+        } else {
+            m_sim.col++;
+        }
+    } else {
+        if (m_sim.page == m_sim.page_end) {
+            m_sim.page = m_sim.page_start;
+            m_sim.col = (m_sim.col == m_sim.col_end) ? m_sim.col_start : (m_sim.col + 1);
+        } else {
+            m_sim.page++;
+        }
+    }
+}
+
+
+static void sim_byte(uint8_t ctrl, uint8_t b)
+{
+    if (ctrl & SIM_CTRL_DC) {
+        sim_data_byte(b);
+    } else {
+        sim_cmd_byte(b);
+    }
+}
+
+
+void oled_sim_reset(void)
+{
+    memset(&m_sim, 0, sizeof(m_sim));
+    m_sim.mode = SIM_MODE_PAGE;
+    m_sim.col_end = OLED_SIM_W - 1;
+    m_sim.page_end = SIM_PAGES - 1;
+}
+
+
+void oled_sim_get_stats(oled_sim_stats_t *stats)
+{
+    *stats = m_sim.stats;
+}
+
+
+uint8_t oled_sim_get_pixel(uint16_t x, uint16_t y)
+{
+    if ((x >= OLED_SIM_W) || (y >= OLED_SIM_H)) {
+        return 0;
+    }
+    return (m_sim.gram[y / 8][x] >> (y % 8)) & 0x01;
+}
+
+
+unsigned int I2cIoInit(I2cBusIo i2c)
+{
+    (void)i2c;
+    return LZ_HARDWARE_SUCCESS;
+}
+
+
+unsigned int LzI2cInit(unsigned int id, unsigned int freq)
+{
+    (void)id;
+    (void)freq;
+    return LZ_HARDWARE_SUCCESS;
+}
+
+
+unsigned int LzI2cDeinit(unsigned int id)
+{
+    (void)id;
+    return LZ_HARDWARE_SUCCESS;
+}
+
+
+/* 一次传输：控制字节Co为0时后面的字节都按它的D/C#处理，
+ * Co为1时每个字节前面都有一个控制字节 */
+unsigned int LzI2cWrite(unsigned int id, unsigned short slaveAddr, const unsigned char *buf, unsigned int len)
+{
+    unsigned int i = 0;
+    uint8_t ctrl;
+
+    (void)id;
+    if (slaveAddr != SIM_I2C_ADDRESS) {
+        return __LINE__;
+    }
+    m_sim.stats.transactions++;
+    m_sim.stats.bytes += len;
+
+    while (i < len) {
+        ctrl = buf[i++];
+        if (ctrl & SIM_CTRL_CO) {
+            if (i < len) {
+                sim_byte(ctrl, buf[i]);
+                i++;
+            }
+            continue;
+        }
+        for (; i < len; i++) {
+            sim_byte(ctrl, buf[i]);
+        }
+    }
+    return LZ_HARDWARE_SUCCESS;
+}
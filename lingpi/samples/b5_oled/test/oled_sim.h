@@ -0,0 +1,64 @@
+/*
+ * Copyright (c) 2022 FuZhou Lockzhiner Electronic Co., Ltd. All rights reserved.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+/* SSD1306面板模拟器：从LzI2cWrite()的数据中解码控制字节、命令和显存数据，
+ * 写入内存中的128x64显存 */
+#ifndef _OLED_SIM_H_
+#define _OLED_SIM_H_
+
+#include <stdint.h>
+
+/* 模拟的面板尺寸 */
+#define OLED_SIM_W              128
+#define OLED_SIM_H              64
+
+/* 从总线上解码得到的传输统计 */
+typedef struct {
+    uint32_t transactions;                  /* LzI2cWrite()的调用次数 */
+    uint32_t bytes;                         /* 总字节数，含控制字节 */
+    uint32_t commands;                      /* 命令字节数 */
+    uint32_t data;                          /* 写入显存的字节数 */
+} oled_sim_stats_t;
+
+/***************************************************************
+ * 函数名称: oled_sim_reset
+ * 说    明: 复位模拟的面板：显存清零，寻址方式和窗口恢复上电默认值，
+ *           传输统计清零
+ * 参    数: 无
+ * 返 回 值: 无
+ ***************************************************************/
+void oled_sim_reset(void);
+
+
+/***************************************************************
+ * 函数名称: oled_sim_get_stats
+ * 说    明: 获取从总线上解码得到的传输统计
+ * 参    数:
+ *       @stats：传输统计
+ * 返 回 值: 无
+ ***************************************************************/
+void oled_sim_get_stats(oled_sim_stats_t *stats);
+
+
+/***************************************************************
+ * 函数名称: oled_sim_get_pixel
+ * 说    明: 获取显存中的像素
+ * 参    数:
+ *       @x：X坐标
+ *       @y：Y坐标
+ * 返 回 值: 1为点亮，0为熄灭
+ ***************************************************************/
+uint8_t oled_sim_get_pixel(uint16_t x, uint16_t y);
+
+#endif
@@ -0,0 +1,285 @@
+/*
+ * Copyright (c) 2022 FuZhou Lockzhiner Electronic Co., Ltd. All rights reserved.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+/* gpio模拟i2c测试：soft_i2c对GPIO寄存器的读写由i2c_sim.c模拟成总线，
+ * 检查解码出的帧（起始、地址、数据、应答、结束）、从设备不应答和延展时钟
+ * 时的返回值、SDA被拉低时的总线恢复，以及OLED驱动通过soft_i2c刷新的结果。
+ * 延展时钟超时时传输必须失败，并且不再继续发送
+ */
+#include <stdio.h>
+#include <string.h>
+#include <signal.h>
+#include <unistd.h>
+#include "lz_hardware.h"
+#include "soft_i2c.h"
+#include "oled.h"
+#include "oled_sim.h"
+#include "i2c_sim.h"
+
+/* 整个测试的最长运行时间（秒） */
+#define TEST_TIMEOUT_SEC        20
+/* 与oled.c相同的引脚和地址 */
+#define TEST_SCL                GPIO0_PC2
+#define TEST_SDA                GPIO0_PC1
+#define TEST_ADDR               0x3C
+/* 有限的时钟延展期间主设备读取SCL的次数，小于SOFT_I2C_STRETCH_MAX */
+#define TEST_STRETCH_READS      20
+/* 延展时钟超时后允许的EXT_PORT读取次数：一次超时加上结束条件的一次超时
+ * （SOFT_I2C_STRETCH_MAX默认10000次），超时后继续发送时每个字节或每行
+ * 还要再等待一次超时 */
+#define TEST_ABORT_READS        30000
+
+#define CHECK(cond, ...) do { \
+        if (!(cond)) { \
+            printf("FAIL %s:%d: ", __func__, __LINE__); \
+            printf(__VA_ARGS__); \
+            printf("\n"); \
+            m_failed++; \
+        } \
+    } while (0)
+
+#define CHECK_TRACE(expect) CHECK(strcmp(i2c_sim_trace(), (expect)) == 0, \
+                                  "trace \"%s\", expected \"%s\"", i2c_sim_trace(), (expect))
+
+static const uint8_t m_cmds[] = {0x00, 0xAE, 0xAF};
+/* m_cmds一次写传输的SCL下降沿数：起始条件1个，地址和每个字节9个 */
+#define CMDS_CLOCKS             (1 + 9 * (1 + sizeof(m_cmds)))
+static const uint8_t m_read_data[] = {0x5A, 0xC3};
+
+static soft_i2c_t m_bus;
+static uint32_t m_failed = 0;
+
+static void on_timeout(int sig)
+{
+    (void)sig;
+    printf("FAIL: timed out after %d s\n", TEST_TIMEOUT_SEC);
+    fflush(stdout);
+    _exit(1);
+}
+
+
+static void test_init(void)
+{
+    i2c_sim_reset(TEST_SCL, TEST_SDA, TEST_ADDR);
+    CHECK(soft_i2c_init(&m_bus, TEST_SCL, TEST_SDA, SOFT_I2C_FREQ_FAST) == 0, "init failed");
+    CHECK((m_bus.freq > 0) && (m_bus.freq <= SOFT_I2C_FREQ_FAST), "freq %u", m_bus.freq);
+    /* 总线空闲时不发送时钟 */
+    CHECK_TRACE("");
+    CHECK(i2c_sim_master_released(), "bus not released after init");
+}
+
+
+static void test_frames(void)
+{
+    oled_sim_stats_t stats;
+    uint8_t buf[2];
+
+    /* 写操作 */
+    oled_sim_reset();
+    i2c_sim_clear();
+    CHECK(soft_i2c_write(&m_bus, TEST_ADDR, m_cmds, sizeof(m_cmds)) == 0, "write failed");
+    CHECK_TRACE("S 78+ 00+ AE+ AF+ P");
+    CHECK(i2c_sim_master_released(), "bus not released after write");
+    oled_sim_get_stats(&stats);
+    CHECK((stats.transactions == 1) && (stats.bytes == 3) && (stats.commands == 2),
+          "panel got %u transactions, %u bytes, %u commands", stats.transactions, stats.bytes, stats.commands);
+
+    /* 地址没有应答 */
+    i2c_sim_clear();
+    CHECK(soft_i2c_write(&m_bus, TEST_ADDR + 1, m_cmds, sizeof(m_cmds)) != 0, "address NACK not reported");
+    CHECK_TRACE("S 7A- P");
+
+    /* 数据没有应答，不再发送后面的字节 */
+    i2c_sim_clear();
+    i2c_sim_set_nack(2);
+    CHECK(soft_i2c_write(&m_bus, TEST_ADDR, m_cmds, sizeof(m_cmds)) != 0, "data NACK not reported");
+    CHECK_TRACE("S 78+ 00+ AE- P");
+    i2c_sim_set_nack(I2C_SIM_FOREVER);
+
+    /* 读操作，最后一个字节回复非应答 */
+    i2c_sim_clear();
+    i2c_sim_set_read_data(m_read_data, sizeof(m_read_data));
+    memset(buf, 0, sizeof(buf));
+    CHECK(soft_i2c_read(&m_bus, TEST_ADDR, buf, sizeof(buf)) == 0, "read failed");
+    CHECK(memcmp(buf, m_read_data, sizeof(buf)) == 0, "read %02X %02X", buf[0], buf[1]);
+    CHECK_TRACE("S 79+ <5A+ <C3- P");
+
+    /* 分段发送的字节在同一次传输中 */
+    i2c_sim_clear();
+    CHECK(soft_i2c_start(&m_bus, TEST_ADDR, 0) == 0, "burst start failed");
+    CHECK(soft_i2c_send(&m_bus, &m_cmds[0], 1) == 0, "burst send failed");
+    CHECK(soft_i2c_send(&m_bus, &m_cmds[1], 2) == 0, "burst send failed");
+    CHECK(soft_i2c_stop(&m_bus) == 0, "burst stop failed");
+    CHECK_TRACE("S 78+ 00+ AE+ AF+ P");
+
+    /* 重复起始条件 */
+    i2c_sim_clear();
+    CHECK(soft_i2c_start(&m_bus, TEST_ADDR, 0) == 0, "start failed");
+    CHECK(soft_i2c_send(&m_bus, &m_cmds[0], 1) == 0, "send failed");
+    CHECK(soft_i2c_start(&m_bus, TEST_ADDR, 1) == 0, "repeated start failed");
+    CHECK(soft_i2c_recv(&m_bus, buf, 1) == 0, "recv failed");
+    CHECK(soft_i2c_stop(&m_bus) == 0, "stop failed");
+    CHECK_TRACE("S 78+ 00+ Sr 79+ <5A- P");
+    CHECK(buf[0] == m_read_data[0], "read %02X after repeated start", buf[0]);
+}
+
+
+static void test_stretch(void)
+{
+    i2c_sim_stats_t stats;
+    uint8_t buf[2];
+    uint32_t clock;
+
+    /* 在每一个时钟之后延展，包括地址、数据、应答和结束条件之前，传输都成功 */
+    for (clock = 1; clock <= CMDS_CLOCKS; clock++) {
+        i2c_sim_clear();
+        i2c_sim_set_stretch(clock, TEST_STRETCH_READS);
+        CHECK(soft_i2c_write(&m_bus, TEST_ADDR, m_cmds, sizeof(m_cmds)) == 0, "stretch at clock %u failed", clock);
+        CHECK_TRACE("S 78+ 00+ AE+ AF+ P");
+        i2c_sim_get_stats(&stats);
+        CHECK(stats.stretches == 1, "stretch at clock %u: %u stretches", clock, stats.stretches);
+    }
+    i2c_sim_clear();
+    i2c_sim_set_stretch(11, TEST_STRETCH_READS);
+    CHECK(soft_i2c_read(&m_bus, TEST_ADDR, buf, sizeof(buf)) == 0, "stretched read failed");
+    CHECK_TRACE("S 79+ <5A+ <C3- P");
+
+    /* 一直延展：每一步都返回错误，结束条件之后主设备释放引脚。从设备释放SCL时
+     * 可能正拉低SDA，重新初始化恢复总线后可以继续使用 */
+    for (clock = 1; clock <= CMDS_CLOCKS; clock++) {
+        i2c_sim_clear();
+        i2c_sim_set_stretch(clock, I2C_SIM_FOREVER);
+        CHECK(soft_i2c_write(&m_bus, TEST_ADDR, m_cmds, sizeof(m_cmds)) != 0, "timeout at clock %u not reported", clock);
+        i2c_sim_get_stats(&stats);
+        CHECK(stats.clocks == clock, "timeout at clock %u: %u clocks sent", clock, stats.clocks);
+        CHECK(stats.reads < TEST_ABORT_READS, "timeout at clock %u: %u reads", clock, stats.reads);
+        CHECK(i2c_sim_master_released(), "bus not released after timeout at clock %u", clock);
+
+        i2c_sim_set_stretch(0, 0);
+        CHECK(soft_i2c_init(&m_bus, TEST_SCL, TEST_SDA, SOFT_I2C_FREQ_FAST) == 0, "init after timeout at clock %u failed", clock);
+        i2c_sim_clear();
+        CHECK(soft_i2c_write(&m_bus, TEST_ADDR, m_cmds, sizeof(m_cmds)) == 0, "write after timeout at clock %u failed", clock);
+        CHECK((strcmp(i2c_sim_trace(), "S 78+ 00+ AE+ AF+ P") == 0) || (strcmp(i2c_sim_trace(), "Sr 78+ 00+ AE+ AF+ P") == 0),
+              "trace \"%s\" after timeout at clock %u", i2c_sim_trace(), clock);
+    }
+
+    /* 接收数据时超时 */
+    i2c_sim_clear();
+    CHECK(soft_i2c_start(&m_bus, TEST_ADDR, 1) == 0, "start failed");
+    i2c_sim_set_stretch(12, I2C_SIM_FOREVER);
+    CHECK(soft_i2c_recv(&m_bus, buf, sizeof(buf)) != 0, "recv timeout not reported");
+    CHECK(soft_i2c_stop(&m_bus) != 0, "stop timeout not reported");
+    i2c_sim_set_stretch(0, 0);
+}
+
+
+static void test_recover(void)
+{
+    i2c_sim_stats_t stats;
+
+    /* 从设备在传输中途复位，经过3个时钟才释放SDA：发送时钟直到SDA释放，再发送结束条件 */
+    i2c_sim_reset(TEST_SCL, TEST_SDA, TEST_ADDR);
+    i2c_sim_hold_sda(3);
+    CHECK(soft_i2c_init(&m_bus, TEST_SCL, TEST_SDA, SOFT_I2C_FREQ_FAST) == 0, "init after recovery failed");
+    CHECK_TRACE("c c c c P");
+    i2c_sim_clear();
+    CHECK(soft_i2c_write(&m_bus, TEST_ADDR, m_cmds, sizeof(m_cmds)) == 0, "write after recovery failed");
+    CHECK_TRACE("S 78+ 00+ AE+ AF+ P");
+
+    /* SDA一直被拉低：最多9个时钟加上结束条件之前的时钟，初始化失败 */
+    i2c_sim_reset(TEST_SCL, TEST_SDA, TEST_ADDR);
+    i2c_sim_hold_sda(I2C_SIM_FOREVER);
+    CHECK(soft_i2c_init(&m_bus, TEST_SCL, TEST_SDA, SOFT_I2C_FREQ_FAST) != 0, "stuck SDA not reported");
+    i2c_sim_get_stats(&stats);
+    CHECK(stats.clocks == 10, "%u clocks sent to a stuck bus", stats.clocks);
+    CHECK(stats.stops == 0, "stop detected on a stuck bus");
+    CHECK(i2c_sim_master_released(), "bus not released after failed recovery");
+}
+
+
+/* 检查面板上的像素：矩形内为color，其余为0 */
+static uint32_t check_panel(int16_t x1, int16_t y1, int16_t x2, int16_t y2, uint8_t color)
+{
+    uint32_t diff = 0;
+    uint8_t expect;
+    uint16_t x, y;
+
+    for (y = 0; y < OLED_SIM_H; y++) {
+        for (x = 0; x < OLED_SIM_W; x++) {
+            expect = ((x >= x1) && (x <= x2) && (y >= y1) && (y <= y2)) ? color : 0;
+            diff += (oled_sim_get_pixel(x, y) != expect);
+        }
+    }
+    return diff;
+}
+
+
+static void test_oled(void)
+{
+    oled_sim_stats_t panel;
+    i2c_sim_stats_t bus;
+    uint32_t diff;
+
+    /* OLED驱动通过soft_i2c初始化和刷新，每次传输都被面板模拟器完整解码 */
+    i2c_sim_reset(TEST_SCL, TEST_SDA, TEST_ADDR);
+    oled_sim_reset();
+    CHECK(oled_init() == 0, "oled_init failed");
+    oled_clear();
+    oled_refresh();
+    oled_fill_rectangle(10, 5, 70, 40, OLED_COLOR_WHITE);
+    oled_refresh();
+    diff = check_panel(10, 5, 70, 40, 1);
+    CHECK(diff == 0, "%u pixels differ", diff);
+    oled_sim_get_stats(&panel);
+    i2c_sim_get_stats(&bus);
+    CHECK((panel.transactions > 0) && (panel.transactions == bus.starts) && (bus.starts == bus.stops),
+          "%u panel transactions, %u starts, %u stops", panel.transactions, bus.starts, bus.stops);
+
+    /* 刷新中途一直延展时钟：放弃这次传输，不再发送剩余的字节 */
+    i2c_sim_clear();
+    i2c_sim_set_stretch(100, I2C_SIM_FOREVER);
+    oled_fill_rectangle(0, 0, OLED_SIM_W - 1, OLED_SIM_H - 1, OLED_COLOR_WHITE);
+    oled_refresh();
+    i2c_sim_get_stats(&bus);
+    CHECK(bus.reads < TEST_ABORT_READS, "refresh kept clocking after a timeout: %u reads", bus.reads);
+    CHECK(check_panel(0, 0, OLED_SIM_W - 1, OLED_SIM_H - 1, 1) != 0, "aborted refresh reached the panel");
+    CHECK(i2c_sim_master_released(), "bus not released after aborted refresh");
+
+    /* 从设备释放SCL后重新初始化，第一次刷新发送整个屏幕 */
+    i2c_sim_set_stretch(0, 0);
+    CHECK(oled_init() == 0, "oled_init after timeout failed");
+    oled_refresh();
+    diff = check_panel(0, 0, -1, -1, 0);
+    CHECK(diff == 0, "%u pixels differ after recovery", diff);
+    oled_deinit();
+}
+
+
+int main(void)
+{
+    signal(SIGALRM, on_timeout);
+    alarm(TEST_TIMEOUT_SEC);
+
+    test_init();
+    test_frames();
+    test_stretch();
+    test_recover();
+    test_oled();
+
+    if (m_failed != 0) {
+        return 1;
+    }
+    printf("PASS\n");
+    return 0;
+}
@@ -0,0 +1,36 @@
+/*
+ * Copyright (c) 2022 FuZhou Lockzhiner Electronic Co., Ltd. All rights reserved.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+/* 主机模拟器用的hal_base.h，只保留soft_i2c用到的GPIO寄存器，由i2c_sim.c实现。
+ * 模拟器编译时SOFT_I2C_WRITE/SOFT_I2C_READ被替换为i2c_sim_write()/i2c_sim_read()
+ */
+#ifndef _HAL_BASE_H_
+#define _HAL_BASE_H_
+
+#include <stdint.h>
+
+struct GPIO_REG {
+    volatile uint32_t SWPORT_DR_L;
+    volatile uint32_t SWPORT_DR_H;
+    volatile uint32_t SWPORT_DDR_L;
+    volatile uint32_t SWPORT_DDR_H;
+    volatile uint32_t EXT_PORT;
+};
+
+extern struct GPIO_REG g_i2c_sim_gpio0;
+extern struct GPIO_REG g_i2c_sim_gpio1;
+#define GPIO0                   (&g_i2c_sim_gpio0)
+#define GPIO1                   (&g_i2c_sim_gpio1)
+
+#endif
@@ -0,0 +1,46 @@
+/*
+ * Copyright (c) 2022 FuZhou Lockzhiner Electronic Co., Ltd. All rights reserved.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+/* 主机模拟器用的LiteOS接口：tick为主机的单调时钟，LOS_Msleep()不等待 */
+#include <time.h>
+#include "los_task.h"
+#include "los_tick.h"
+
+#define MSEC_PER_SEC            1000
+#define NSEC_PER_MSEC           1000000
+
+unsigned int LOS_Msleep(unsigned int msecs)
+{
+    (void)msecs;
+    return 0;
+}
+
+
+void LOS_TaskLock(void)
+{
+}
+
+
+void LOS_TaskUnlock(void)
+{
+}
+
+
+uint64_t LOS_TickCountGet(void)
+{
+    struct timespec ts;
+
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint64_t)ts.tv_sec * MSEC_PER_SEC + (uint64_t)ts.tv_nsec / NSEC_PER_MSEC;
+}
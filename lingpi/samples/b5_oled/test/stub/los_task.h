@@ -0,0 +1,26 @@
+/*
+ * Copyright (c) 2022 FuZhou Lockzhiner Electronic Co., Ltd. All rights reserved.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+/* 主机模拟器用的los_task.h，OLED驱动和soft_i2c用到的部分 */
+#ifndef _LOS_TASK_H_
+#define _LOS_TASK_H_
+
+#include <stdint.h>
+
+unsigned int LOS_Msleep(unsigned int msecs);
+/* 测试程序只有一个线程，禁止任务调度不做任何事 */
+void LOS_TaskLock(void);
+void LOS_TaskUnlock(void);
+
+#endif
@@ -0,0 +1,28 @@
+/*
+ * Copyright (c) 2022 FuZhou Lockzhiner Electronic Co., Ltd. All rights reserved.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+/* 主机模拟器用的los_tick.h，1个tick为1毫秒 */
+#ifndef _LOS_TICK_H_
+#define _LOS_TICK_H_
+
+#include <stdint.h>
+
+uint64_t LOS_TickCountGet(void);
+
+static inline uint32_t LOS_Tick2MS(uint32_t ticks)
+{
+    return ticks;
+}
+
+#endif
@@ -0,0 +1,83 @@
+/*
+ * Copyright (c) 2022 FuZhou Lockzhiner Electronic Co., Ltd. All rights reserved.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+/* 主机模拟器用的lz_hardware.h，只声明OLED驱动用到的部分：硬件i2c由
+ * oled_sim.c实现，gpio模拟i2c用到的GPIO接口由i2c_sim.c实现。
+ * 与SDK一样包含stdio.h、string.h和los_task.h */
+#ifndef _LZ_HARDWARE_H_
+#define _LZ_HARDWARE_H_
+
+#include <stdint.h>
+#include <stdio.h>
+#include <string.h>
+#include "los_task.h"
+
+#define LZ_HARDWARE_SUCCESS     0
+
+enum {
+    GPIO0_PA0 = 0,
+    GPIO0_PB0 = 8,
+    GPIO0_PC0 = 16,
+    GPIO0_PC1,
+    GPIO0_PC2,
+    GPIO_PIN_NUM,
+    INVALID_GPIO = 0xFF
+};
+
+typedef enum {
+    LZGPIO_LEVEL_LOW = 0,
+    LZGPIO_LEVEL_HIGH,
+    LZGPIO_LEVEL_KEEP
+} LzGpioValue;
+
+typedef enum {
+    LZGPIO_DIR_IN = 0,
+    LZGPIO_DIR_OUT,
+    LZGPIO_DIR_KEEP
+} LzGpioDir;
+
+enum {
+    MUX_FUNC5 = 5,
+    PULL_NONE = 0,
+    DRIVE_KEEP = 0,
+    FUNC_ID_I2C1 = 1,
+    FUNC_MODE_M1 = 1
+};
+
+typedef struct {
+    uint32_t gpio;
+    uint32_t func;
+    uint32_t type;
+    uint32_t drv;
+    uint32_t dir;
+    uint32_t val;
+} PinIo;
+
+typedef struct {
+    PinIo scl;
+    PinIo sda;
+    uint32_t id;
+    uint32_t mode;
+} I2cBusIo;
+
+unsigned int LzGpioInit(uint32_t id);
+unsigned int LzGpioDeinit(uint32_t id);
+unsigned int LzGpioSetDir(uint32_t id, LzGpioDir dir);
+
+unsigned int I2cIoInit(I2cBusIo i2c);
+unsigned int LzI2cInit(unsigned int id, unsigned int freq);
+unsigned int LzI2cDeinit(unsigned int id);
+unsigned int LzI2cWrite(unsigned int id, unsigned short slaveAddr, const unsigned char *buf, unsigned int len);
+
+#endif